@@ -1,6 +1,8 @@
 #include "EditorLayer.h"
 
 #include <Arcane/Core/Application.h>
+#include <Arcane/Graphics/Culling/PVSBaker.h>
+#include <Arcane/Graphics/Lightmap/LightmapBaker.h>
 #include <Arcane/Graphics/Renderer/Renderpass/EditorPass.h>
 #include <Arcane/Vendor/Imgui/imgui.h>
 #include <Testbed.h>
@@ -8,8 +10,11 @@
 extern bool g_ApplicationRunning;
 namespace Arcane
 {
+	static const std::string s_TestbedPVSPath = "res/baked/TestbedGraphics.pvs";
+	static const std::string s_TestbedLightmapPath = "res/baked/TestbedGraphics.lightmap";
+
 	EditorLayer::EditorLayer(const std::string &debugName /*= "Layer"*/) : Layer(debugName), m_EditorScene(Arcane::Application::GetInstance().GetScene()), m_EditorViewport(), m_ConsolePanel(), m_GraphicsSettings(Arcane::Application::GetInstance().GetMasterRenderPass()),
-		m_InspectorPanel(), m_ScenePanel(m_EditorScene, &m_InspectorPanel), m_ShowGraphicsSettings(false)
+		m_InspectorPanel(), m_ScenePanel(m_EditorScene, &m_InspectorPanel), m_ShowGraphicsSettings(false), m_BakedDataLoaded(false)
 	{}
 
 	EditorLayer::~EditorLayer()
@@ -40,6 +45,12 @@ namespace Arcane
 	void EditorLayer::OnUpdate(float deltaTime)
 	{
 		Arcane::Application::GetInstance().GetMasterRenderPass()->GetEditorPass()->SetFocusedEntity(m_InspectorPanel.GetFocusedEntity());
+
+		if (!m_BakedDataLoaded && !AssetManager::GetInstance().AssetsInFlight())
+		{
+			LoadBakedData();
+			m_BakedDataLoaded = true;
+		}
 	}
 
 	void EditorLayer::OnImGuiRender()
@@ -128,6 +139,17 @@ namespace Arcane
 				ImGui::EndMenu();
 			}
 
+			if (ImGui::BeginMenu("Bake"))
+			{
+				// Bakers need every model loaded, and the result is only loaded at startup once the testbed's assets are in
+				bool canBake = m_BakedDataLoaded && !AssetManager::GetInstance().AssetsInFlight();
+				if (ImGui::MenuItem("Bake PVS", NULL, false, canBake))
+					BakePVS();
+				if (ImGui::MenuItem("Bake Lightmap", NULL, false, canBake))
+					BakeLightmap();
+				ImGui::EndMenu();
+			}
+
 			if (ImGui::BeginMenu("Settings"))
 			{
 				ImGui::MenuItem("Asset Manager", NULL, false, false);
@@ -166,6 +188,60 @@ namespace Arcane
 
 	}
 
+	void EditorLayer::LoadBakedData()
+	{
+		m_EditorScene->BakeImpostors();
+
+		if (VirtualFileSystem::Exists(s_TestbedPVSPath))
+		{
+			PotentiallyVisibleSet *pvs = new PotentiallyVisibleSet();
+			if (pvs->Load(s_TestbedPVSPath))
+			{
+				m_EditorScene->SetPVS(pvs);
+			}
+			else
+			{
+				delete pvs;
+			}
+		}
+
+		// Lightmap UVs get regenerated for the lightmapped models, which is why this has to wait for the models to load
+		if (VirtualFileSystem::Exists(s_TestbedLightmapPath))
+		{
+			Lightmap *lightmap = new Lightmap();
+			if (lightmap->Load(s_TestbedLightmapPath))
+			{
+				m_EditorScene->SetLightmap(lightmap);
+			}
+			else
+			{
+				delete lightmap;
+			}
+		}
+	}
+
+	void EditorLayer::BakePVS()
+	{
+		PotentiallyVisibleSet *pvs = PVSBaker::Bake(m_EditorScene);
+
+		std::error_code error;
+		std::filesystem::create_directories(std::filesystem::path(s_TestbedPVSPath).parent_path(), error);
+		pvs->Save(s_TestbedPVSPath);
+		m_EditorScene->SetPVS(pvs);
+	}
+
+	void EditorLayer::BakeLightmap()
+	{
+		Lightmap *lightmap = LightmapBaker::Bake(m_EditorScene);
+		if (!lightmap)
+			return;
+
+		std::error_code error;
+		std::filesystem::create_directories(std::filesystem::path(s_TestbedLightmapPath).parent_path(), error);
+		lightmap->Save(s_TestbedLightmapPath);
+		m_EditorScene->SetLightmap(lightmap);
+	}
+
 	void EditorLayer::NewScene()
 	{
 
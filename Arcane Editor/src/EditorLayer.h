@@ -26,6 +26,11 @@ namespace Arcane
 
 		void NewScene();
 		void OpenScene(const std::string& filepath);
+	private:
+		// Baked data is tied to the entities the testbed creates, so it is only loaded (and impostors baked) once all of the testbed's assets are in
+		void LoadBakedData();
+		void BakePVS();
+		void BakeLightmap();
 	private:
 		Scene *m_EditorScene;
 
@@ -38,5 +43,6 @@ namespace Arcane
 		GraphicsSettings m_GraphicsSettings;
 
 		bool m_ShowGraphicsSettings;
+		bool m_BakedDataLoaded;
 	};
 }
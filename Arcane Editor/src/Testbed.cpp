@@ -9,6 +9,7 @@
 #include <Arcane/Scene/Components.h>
 #include <Arcane/Scene/Scene.h>
 #include <Arcane/Scene/Entity.h>
+#include <Arcane/Terrain/Terrain.h>
 #include <Arcane/Animation/AnimationClip.h>
 #include <Arcane/Graphics/Renderer/Renderpass/MasterRenderPass.h>
 #include <Arcane/Graphics/Renderer/Renderpass/PostProcessPass.h>
@@ -43,9 +44,7 @@ void Testbed::LoadTestbedGraphics()
 				auto& material = loadedModel->GetMeshes()[0].GetMaterial();
 
 				material.SetNormalMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Cerberus_Gun/Textures/Cerberus_N.tga")));
-				material.SetMetallicMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Cerberus_Gun/Textures/Cerberus_M.tga")));
-				material.SetRoughnessMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Cerberus_Gun/Textures/Cerberus_R.tga")));
-				material.SetAmbientOcclusionMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Cerberus_Gun/Textures/Cerberus_AO.tga")));
+				material.SetOrmTexture(assetManager.LoadOrmTextureAsync(std::string("res/3D_Models/Cerberus_Gun/Textures/Cerberus_AO.tga"), std::string("res/3D_Models/Cerberus_Gun/Textures/Cerberus_R.tga"), std::string("res/3D_Models/Cerberus_Gun/Textures/Cerberus_M.tga")));
 			}
 		);
 
@@ -70,9 +69,7 @@ void Testbed::LoadTestbedGraphics()
 
 				material.SetAlbedoMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Hyrule_Shield/HShield_[Albedo].tga"), &srgbTextureSettings));
 				material.SetNormalMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Hyrule_Shield/HShield_[Normal].tga")));
-				material.SetMetallicMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Hyrule_Shield/HShield_[Metallic].tga")));
-				material.SetRoughnessMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Hyrule_Shield/HShield_[Roughness].tga")));
-				material.SetAmbientOcclusionMap(assetManager.Load2DTextureAsync(std::string("res/3D_Models/Hyrule_Shield/HShield_[Occlusion].tga")));
+				material.SetOrmTexture(assetManager.LoadOrmTextureAsync(std::string("res/3D_Models/Hyrule_Shield/HShield_[Occlusion].tga"), std::string("res/3D_Models/Hyrule_Shield/HShield_[Roughness].tga"), std::string("res/3D_Models/Hyrule_Shield/HShield_[Metallic].tga")));
 			}
 		);
 
@@ -82,6 +79,7 @@ void Testbed::LoadTestbedGraphics()
 		auto& meshComponent = shield.AddComponent<MeshComponent>(shieldModel);
 		meshComponent.IsStatic = true;
 		meshComponent.IsTransparent = false;
+		shield.AddComponent<ImpostorComponent>(); // Baked by the editor once the shield and its textures are loaded
 	}
 
 	{
@@ -285,6 +283,30 @@ void Testbed::LoadTestbedGraphics()
 		meshMaterial.SetEmissionIntensity(5.0f);
 		meshMaterial.SetRoughnessValue(1.0f);
 	}
+
+	// Grass cards scattered over the scene's terrain, drawn by the terrain's foliage system instead of as entities
+	{
+		Terrain* terrain = scene->GetTerrain();
+		if (terrain && terrain->IsLoaded())
+		{
+			Model* grassModel = new Model(*quad);
+
+			TextureSettings srgbTextureSettings;
+			srgbTextureSettings.IsSRGB = true;
+
+			Material& grassMaterial = grassModel->GetMeshes()[0].GetMaterial();
+			grassMaterial.SetAlbedoMap(assetManager.Load2DTextureAsync(std::string("res/terrain/grass/grassAlbedo.tga"), &srgbTextureSettings));
+			grassMaterial.SetRoughnessValue(1.0f);
+
+			FoliageLayerSettings grassSettings;
+			grassSettings.Scatter.Seed = 1;
+			grassSettings.Scatter.Density = 0.5f;
+			grassSettings.Scatter.MinScale = 0.4f;
+			grassSettings.Scatter.MaxScale = 0.7f;
+			grassSettings.MaxDrawDistance = 100.0f;
+			terrain->GetFoliageSystem()->AddLayer(terrain, grassModel, grassSettings);
+		}
+	}
 }
 
 void Testbed::LoadTestbedGraphics2D()
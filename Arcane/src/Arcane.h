@@ -33,5 +33,8 @@
 #include <Arcane/Util/Loaders/AssetManager.h>
 #include <Arcane/Util/Logger.h>
 #include <Arcane/Util/FileUtils.h>
+#include <Arcane/Util/VirtualFileSystem.h>
+#include <Arcane/Util/AssetPackBuilder.h>
+#include <Arcane/Util/AssetBaker.h>
 #include <Arcane/Util/Time.h>
 #include <Arcane/Util/Timer.h>
@@ -4,6 +4,7 @@
 #include <assimp/Importer.hpp>
 #include <Arcane/Animation/AnimationData.h>
 #include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Util/Loaders/AssimpIOSystem.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
@@ -12,6 +13,7 @@ namespace Arcane
 	AnimationClip::AnimationClip(const std::string &animationPath, int animationIndex, Model *model) : m_Model(model)
 	{
 		Assimp::Importer importer;
+		importer.SetIOHandler(new AssimpIOSystem()); // Importer takes ownership
 		const aiScene *scene = importer.ReadFile(animationPath, aiProcess_Triangulate);
 		ARC_ASSERT(scene && scene->mRootNode, "Failed importing animationPath");
 
@@ -33,20 +35,15 @@ namespace Arcane
 
 	}
 
-	Bone* AnimationClip::FindBone(const std::string &name)
+	Bone* AnimationClip::FindBone(StringId name)
 	{
-		auto iter = std::find_if(m_Bones.begin(), m_Bones.end(),
-			[&](const Bone& bone)
-			{
-				return bone.GetName() == name;
-			}
-		);
+		auto iter = m_BoneIndexLookup.find(name);
 
 		// If we didn't find just return nullptr
-		if (iter == m_Bones.end()) return nullptr;
-		
+		if (iter == m_BoneIndexLookup.end()) return nullptr;
+
 		// Otherwise we found it
-		return &(*iter);
+		return &m_Bones[iter->second];
 	}
 
 	void AnimationClip::ReadMissingBones(aiAnimation *assimpAnimation)
@@ -60,13 +57,14 @@ namespace Arcane
 		for (int i = 0; i < size; i++)
 		{
 			auto channel = assimpAnimation->mChannels[i];
-			std::string boneName = channel->mNodeName.data;
+			StringId boneName(channel->mNodeName.data, channel->mNodeName.length);
 
 			if (boneInfoMap->find(boneName) == boneInfoMap->end())
 			{
 				(*boneInfoMap)[boneName].boneID = boneCount++;
 			}
-			m_Bones.push_back(Bone(channel->mNodeName.data, (*boneInfoMap)[channel->mNodeName.data].boneID, channel));
+			m_BoneIndexLookup[boneName] = m_Bones.size();
+			m_Bones.push_back(Bone(channel->mNodeName.data, (*boneInfoMap)[boneName].boneID, channel));
 		}
 	}
 
@@ -75,6 +73,7 @@ namespace Arcane
 		ARC_ASSERT(src, "Needs src data to read in AnimationClip");
 
 		dest.name = src->mName.data;
+		dest.nameId = StringId(src->mName.data, src->mName.length);
 		dest.transformation = Model::ConvertAssimpMatrixToGLM(src->mTransformation);
 		dest.childCount = src->mNumChildren;
 		dest.children.reserve(dest.childCount);
@@ -24,6 +24,7 @@ namespace Arcane
 	{
 		glm::mat4 transformation;
 		std::string name;
+		StringId nameId;
 		int childCount;
 		std::vector<AssimpBoneData> children;
 	};
@@ -34,11 +35,12 @@ namespace Arcane
 		AnimationClip(const std::string &animationPath, int animationIndex, Model *model);
 		~AnimationClip();
 
-		Bone* FindBone(const std::string &name);
+		Bone* FindBone(StringId name);
 
 		inline float GetDuration() { return m_ClipDuration; }
 		inline float GetTicksPerSecond() { return m_TicksPerSecond; }
 		inline const AssimpBoneData* GetRootBone() const { return &m_RootNode; }
+		inline std::vector<Bone>& GetBones() { return m_Bones; }
 		inline auto* GetBoneDataMap() { return m_Model->GetBoneDataMap(); }
 		inline const auto& GetGlobalInverseTransform() const { return m_Model->GetGlobalInverseTransform(); }
 #if !ARC_FINAL
@@ -51,6 +53,7 @@ namespace Arcane
 		float m_ClipDuration;
 		float m_TicksPerSecond;
 		std::vector<Bone> m_Bones;
+		std::unordered_map<StringId, size_t> m_BoneIndexLookup;
 		AssimpBoneData m_RootNode;
 
 #if !ARC_FINAL
@@ -5,7 +5,7 @@
 
 namespace Arcane
 {
-	Bone::Bone(const std::string &name, int id, const aiNodeAnim *channel) : m_Name(name), m_ID(id), m_LocalTransform(1.0f)
+	Bone::Bone(const std::string &name, int id, const aiNodeAnim *channel) : m_Name(name), m_NameId(name), m_ID(id), m_LocalTransform(1.0f)
 	{
 		m_Positions.reserve(channel->mNumPositionKeys);
 		m_Rotations.reserve(channel->mNumRotationKeys);
@@ -40,13 +40,12 @@ namespace Arcane
 		}
 	}
 
-	// Interpolates between positions, rotations, and scaling keys based on the current timestep were at in the animation and prepares the local transform for the bone given this info
-	void Bone::Update(float currentAnimationTime)
+	// Interpolates between positions and scaling keys based on the current timestep were at in the animation, the rotation keys are left for the caller to slerp
+	void Bone::SampleKeyframes(float currentAnimationTime, glm::vec3 &outPosition, glm::quat &outRotationFrom, glm::quat &outRotationTo, float &outRotationBlend, glm::vec3 &outScale)
 	{
-		glm::mat4 translation = InterpolatePosition(currentAnimationTime);
-		glm::mat4 rotation = InterpolateRotation(currentAnimationTime);
-		glm::mat4 scale = InterpolateScale(currentAnimationTime);
-		m_LocalTransform = translation * rotation * scale;
+		outPosition = InterpolatePosition(currentAnimationTime);
+		FindRotationKeys(currentAnimationTime, outRotationFrom, outRotationTo, outRotationBlend);
+		outScale = InterpolateScale(currentAnimationTime);
 	}
 
 	float Bone::GetNormalizedInterpolationAmountBetweenFrames(float lastTimestamp, float nextTimestamp, float currentAnimationTime)
@@ -56,50 +55,47 @@ namespace Arcane
 		return widwayLength / framesDiff;
 	}
 
-	glm::mat4 Bone::InterpolatePosition(float currentAnimationTime)
+	glm::vec3 Bone::InterpolatePosition(float currentAnimationTime)
 	{
 		if (m_Positions.size() == 1)
-			return glm::translate(glm::mat4(1.0f), m_Positions[0].position);
+			return m_Positions[0].position;
 
 		int index0 = GetPositionIndex(currentAnimationTime);
 		int index1 = index0 + 1;
 		float lerpValue = GetNormalizedInterpolationAmountBetweenFrames(m_Positions[index0].timestamp, m_Positions[index1].timestamp, currentAnimationTime);
 
 		// Finally LERP between our position data for our animation frames
-		glm::vec3 finalPosition = glm::mix(m_Positions[index0].position, m_Positions[index1].position, lerpValue);
-		return glm::translate(glm::mat4(1.0f), finalPosition);
+		return glm::mix(m_Positions[index0].position, m_Positions[index1].position, lerpValue);
 	}
 
-	glm::mat4 Bone::InterpolateRotation(float currentAnimationTime)
+	void Bone::FindRotationKeys(float currentAnimationTime, glm::quat &outFrom, glm::quat &outTo, float &outBlend)
 	{
+		// A single key slerps with itself, which just normalizes it
 		if (m_Rotations.size() == 1)
 		{
-			auto rotation = glm::normalize(m_Rotations[0].orientation);
-			return glm::toMat4(rotation);
+			outFrom = outTo = m_Rotations[0].orientation;
+			outBlend = 0.0f;
+			return;
 		}
 
 		int index0 = GetRotationIndex(currentAnimationTime);
 		int index1 = index0 + 1;
-		float slerpValue = GetNormalizedInterpolationAmountBetweenFrames(m_Rotations[index0].timestamp, m_Rotations[index1].timestamp, currentAnimationTime);
-
-		// Finally SLERP between our rotation data for our animation frames
-		glm::quat finalRotation = glm::slerp(m_Rotations[index0].orientation, m_Rotations[index1].orientation, slerpValue);
-		finalRotation = glm::normalize(finalRotation);
-		return glm::toMat4(finalRotation);
+		outFrom = m_Rotations[index0].orientation;
+		outTo = m_Rotations[index1].orientation;
+		outBlend = GetNormalizedInterpolationAmountBetweenFrames(m_Rotations[index0].timestamp, m_Rotations[index1].timestamp, currentAnimationTime);
 	}
 
-	glm::mat4 Bone::InterpolateScale(float currentAnimationTime)
+	glm::vec3 Bone::InterpolateScale(float currentAnimationTime)
 	{
 		if (m_Scales.size() == 1)
-			return glm::scale(glm::mat4(1.0f), m_Scales[0].scale);
+			return m_Scales[0].scale;
 
 		int index0 = GetScaleIndex(currentAnimationTime);
 		int index1 = index0 + 1;
 		float lerpValue = GetNormalizedInterpolationAmountBetweenFrames(m_Scales[index0].timestamp, m_Scales[index1].timestamp, currentAnimationTime);
 
 		// Finally LERP between our scale data for our animation frames
-		glm::vec3 finalScale = glm::mix(m_Scales[index0].scale, m_Scales[index1].scale, lerpValue);
-		return glm::scale(glm::mat4(1.0f), finalScale);
+		return glm::mix(m_Scales[index0].scale, m_Scales[index1].scale, lerpValue);
 	}
 
 	// TODO: At least binary search this..
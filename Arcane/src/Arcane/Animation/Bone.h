@@ -2,6 +2,10 @@
 #ifndef BONE_H
 #define BONE_H
 
+#ifndef STRINGID_H
+#include <Arcane/Util/StringId.h>
+#endif
+
 struct aiNodeAnim;
 
 namespace Arcane
@@ -29,18 +33,21 @@ namespace Arcane
 	public:
 		Bone(const std::string& name, int id, const aiNodeAnim* channel);
 
-		void Update(float currentAnimationTime);
+		// Samples the keyframes around the current time. Rotations are returned as the two keys to slerp between so the animator can blend every bone in one batch
+		void SampleKeyframes(float currentAnimationTime, glm::vec3 &outPosition, glm::quat &outRotationFrom, glm::quat &outRotationTo, float &outRotationBlend, glm::vec3 &outScale);
 		int GetPositionIndex(float currentAnimationTime);
 		int GetRotationIndex(float currentAnimationTime);
 		int GetScaleIndex(float currentAnimationTime);
 
 		inline const std::string& GetName() const { return m_Name; }
+		inline StringId GetNameId() const { return m_NameId; }
 		inline const glm::mat4& GetLocalTransform() const { return m_LocalTransform; }
+		inline void SetLocalTransform(const glm::mat4 &transform) { m_LocalTransform = transform; }
 	private:
 		float GetNormalizedInterpolationAmountBetweenFrames(float lastTimestamp, float nextTimestamp, float currentAnimationTime);
-		glm::mat4 InterpolatePosition(float currentAnimationTime);
-		glm::mat4 InterpolateRotation(float currentAnimationTime);
-		glm::mat4 InterpolateScale(float currentAnimationTime);
+		glm::vec3 InterpolatePosition(float currentAnimationTime);
+		void FindRotationKeys(float currentAnimationTime, glm::quat &outFrom, glm::quat &outTo, float &outBlend);
+		glm::vec3 InterpolateScale(float currentAnimationTime);
 	private:
 		std::vector<KeyPosition> m_Positions;
 		std::vector<KeyRotation> m_Rotations;
@@ -48,6 +55,7 @@ namespace Arcane
 
 		glm::mat4 m_LocalTransform;
 		std::string m_Name;
+		StringId m_NameId;
 		int m_ID;
 	};
 }
@@ -3,6 +3,7 @@
 
 #include <Arcane/Animation/AnimationClip.h>
 #include <Arcane/Animation/AnimationData.h>
+#include <Arcane/Math/BatchMath.h>
 
 namespace Arcane
 {
@@ -21,6 +22,7 @@ namespace Arcane
 				m_CurrentTime = fmod(m_CurrentTime, m_CurrentAnimationClip->GetDuration());
 			}
 
+			UpdateBoneLocalTransforms();
 			CalculateBoneTransform(m_CurrentAnimationClip->GetRootBone(), glm::mat4(1.0f));
 		}
 	}
@@ -31,17 +33,42 @@ namespace Arcane
 		m_CurrentTime = 0.0f;
 	}
 
+	void PoseAnimator::UpdateBoneLocalTransforms()
+	{
+		std::vector<Bone> &bones = m_CurrentAnimationClip->GetBones();
+		size_t boneCount = bones.size();
+		if (boneCount == 0)
+			return;
+
+		m_BoneTranslations.resize(boneCount);
+		m_BoneScales.resize(boneCount);
+		m_BoneRotationsFrom.resize(boneCount);
+		m_BoneRotationsTo.resize(boneCount);
+		m_BoneRotations.resize(boneCount);
+		m_BoneRotationBlends.resize(boneCount);
+		m_BoneLocalTransforms.resize(boneCount);
+		for (size_t i = 0; i < boneCount; i++)
+		{
+			bones[i].SampleKeyframes(m_CurrentTime, m_BoneTranslations[i], m_BoneRotationsFrom[i], m_BoneRotationsTo[i], m_BoneRotationBlends[i], m_BoneScales[i]);
+		}
+
+		BatchMath::SlerpQuaternions(&m_BoneRotationsFrom[0], &m_BoneRotationsTo[0], &m_BoneRotationBlends[0], &m_BoneRotations[0], boneCount);
+		BatchMath::ComposeTRS(&m_BoneTranslations[0], &m_BoneRotations[0], &m_BoneScales[0], &m_BoneLocalTransforms[0], boneCount);
+		for (size_t i = 0; i < boneCount; i++)
+		{
+			bones[i].SetLocalTransform(m_BoneLocalTransforms[i]);
+		}
+	}
+
 	void PoseAnimator::CalculateBoneTransform(const AssimpBoneData *node, glm::mat4 parentTransform)
 	{
-		const std::string &nodeName = node->name;
+		StringId nodeName = node->nameId;
 		glm::mat4 nodeTransformation = node->transformation;
 
-		// Get the current bone engaged in the animation
+		// Get the current bone engaged in the animation, its local transform was already blended from the current keyframe(s) by UpdateBoneLocalTransforms
 		Bone *bone = m_CurrentAnimationClip->FindBone(nodeName);
 		if (bone)
 		{
-			// Update the bones local transform with the current keyframe(s) data when we supply it the current animation time (will blend between the keyframes)
-			bone->Update(m_CurrentTime);
 			nodeTransformation = bone->GetLocalTransform();
 		}
 
@@ -51,11 +78,12 @@ namespace Arcane
 		// We need to apply the inverse bind pose to our globalTransformation. This is necessary because the model starts in bind pose
 		// and you need to animate a vertex, you need to transform it to the bone's local coordinate system, calculate the transformation and move it back into world space in the shader
 		auto boneDataMap = m_CurrentAnimationClip->GetBoneDataMap();
-		if (boneDataMap->find(nodeName) != boneDataMap->end())
+		auto boneDataIter = boneDataMap->find(nodeName);
+		if (boneDataIter != boneDataMap->end())
 		{
-			int index = (*boneDataMap)[nodeName].boneID;
+			int index = boneDataIter->second.boneID;
 			ARC_ASSERT(index < MaxBonesPerModel, "We exceeded the MaxBonesPerModel limit");
-			glm::mat4 inverseBindPose = (*boneDataMap)[nodeName].inverseBindPose;
+			const glm::mat4 &inverseBindPose = boneDataIter->second.inverseBindPose;
 			m_FinalBoneMatrices[index] = m_CurrentAnimationClip->GetGlobalInverseTransform() * globalTransformation * inverseBindPose;
 		}
 
@@ -18,9 +18,16 @@ namespace Arcane
 		inline AnimationClip* GetCurrentAnimationClip() { return m_CurrentAnimationClip; }
 		inline const std::vector<glm::mat4>& GetFinalBoneMatrices() const { return m_FinalBoneMatrices; }
 	private:
+		void UpdateBoneLocalTransforms(); // Blends the keyframes of every bone in the clip with BatchMath
 		void CalculateBoneTransform(const AssimpBoneData *node, glm::mat4 parentTransform);
 	private:
 		std::vector<glm::mat4> m_FinalBoneMatrices;
+
+		// Scratch for the batched keyframe blending, kept around so it doesn't allocate every update
+		std::vector<glm::vec3> m_BoneTranslations, m_BoneScales;
+		std::vector<glm::quat> m_BoneRotationsFrom, m_BoneRotationsTo, m_BoneRotations;
+		std::vector<float> m_BoneRotationBlends;
+		std::vector<glm::mat4> m_BoneLocalTransforms;
 		AnimationClip *m_CurrentAnimationClip;
 		float m_CurrentTime;
 
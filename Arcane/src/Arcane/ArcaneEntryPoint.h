@@ -8,12 +8,21 @@
 #include <arcpch.h>
 #include <Arcane/Core/Application.h>
 #include <Arcane/RenderdocManager.h>
+#include <Arcane/Util/AssetBaker.h>
+#include <Arcane/Util/ThumbnailGenerator.h>
 
 extern Arcane::Application* Arcane::CreateApplication(int argc, char **argv);
 bool g_ApplicationRunning = true;
 
 int main(int argc, char **argv)
 {
+	// Offline asset bake, no window or GL context gets created. ie: "Arcane Editor.exe --bake res cooked/ --pack res.apak"
+	if (argc > 1 && std::string(argv[1]) == "--bake")
+		return Arcane::AssetBaker::RunCommandLine(argc - 2, argv + 2);
+	// Batch model thumbnails, rendered with a hidden window. ie: "Arcane Editor.exe --thumbnails res thumbnails/ --size 256"
+	if (argc > 1 && std::string(argv[1]) == "--thumbnails")
+		return Arcane::ThumbnailGenerator::RunCommandLine(argc - 2, argv + 2);
+
 #if USE_RENDERDOC
 	// Load in renderdoc api
 	RENDERDOCMANAGER;
@@ -9,7 +9,10 @@
 #include <Arcane/Util/Loaders/ShaderLoader.h>
 #include <Arcane/Util/Loaders/TextureLoader.h>
 #include <Arcane/Util/Time.h>
+#include <Arcane/Util/VirtualFileSystem.h>
 #include <Arcane/Core/Layer.h>
+#include <Arcane/Core/Events/KeyEvent.h>
+#include <Arcane/Core/Events/MouseEvent.h>
 #include <Arcane/ImGui/ImGuiLayer.h>
 #include <Arcane/RenderdocManager.h>
 #include <Arcane/Input/InputManager.h>
@@ -32,18 +35,30 @@ namespace Arcane
 	Application::Application(const ApplicationSpecification &specification) : m_Specification(specification), m_Wireframe(false)
 	{
 		s_Instance = this;
+		m_StartupTime = std::chrono::steady_clock::now();
 
 		// Prepare the engine
 		ARC_LOG_INFO("Initializing Arcane Engine...");
+		for (const std::string &assetPack : specification.AssetPacks)
+		{
+			VirtualFileSystem::Mount(assetPack);
+		}
+
+		// Neither of these need a GL context, so the shader reads and the asset manager's workers get going while the window and context are created
+		Arcane::ShaderLoader::SetShaderFilepath("../Arcane/src/Arcane/shaders/");
+		Arcane::ShaderLoader::PrefetchShaderSources();
+		m_AssetManager = &Arcane::AssetManager::GetInstance(); // Need to initialize the asset manager early so we can load resources and have our worker threads instantiated
+
 		m_Window = new Window(this, specification);
 		m_Window->Init();
-		m_AssetManager = &Arcane::AssetManager::GetInstance(); // Need to initialize the asset manager early so we can load resources and have our worker threads instantiated
-		Arcane::ShaderLoader::SetShaderFilepath("../Arcane/src/Arcane/shaders/");
+		TraceStartup("Window created");
 		Renderer::Init(); // Must be loaded before textures get created since they query for the max anistropy from the renderer
 		Arcane::TextureLoader::InitializeDefaultTextures();
+		TraceStartup("Renderer initialized");
 		m_ActiveScene = new Scene(m_Window);
 		m_MasterRenderPass = new MasterRenderPass(m_ActiveScene);
 		m_InputManager = &InputManager::GetInstance();
+		TraceStartup("Scene and render passes created");
 	}
 
 	Application::~Application()
@@ -58,11 +73,14 @@ namespace Arcane
 		GPUTimerManager::Shutdown();
 #endif
 
+		m_FramePacer.Shutdown();
 		Renderer::Shutdown();
 
 		delete m_Window;
 		delete m_ActiveScene;
 		delete m_MasterRenderPass;
+
+		VirtualFileSystem::UnmountAll();
 	}
 
 	void Application::InternalInit()
@@ -70,11 +88,13 @@ namespace Arcane
 		// This will call OnAttach for any layers in the layer stack. This is where the editor layer can load up assets before runtime
 		OnInit();
 
+#if !NON_BLOCKING_STARTUP
 		// Make sure all assets load before booting for first time
 		while (Arcane::AssetManager::GetInstance().AssetsInFlight())
 		{
 			m_AssetManager->Update(100000, 100000, 100000);
 		}
+#endif
 
 		m_ActiveScene->Init();
 
@@ -90,6 +110,7 @@ namespace Arcane
 			m_ImGuiLayer = ImGuiLayer::Create(ARC_DEV_ONLY("Engine ImGui Layer"));
 			PushOverlay(m_ImGuiLayer);
 		}
+		TraceStartup("Init finished");
 	}
 
 	void Application::Run()
@@ -100,9 +121,26 @@ namespace Arcane
 		Time deltaTime;
 		while (m_Running && !m_Window->Closed())
 		{
+			// Pace before anything gets sampled so the frame starts with the freshest input possible
+			m_FramePacer.WaitForNextFrame(GetTargetFrameRate());
+
 			deltaTime.Update();
 			m_InputManager->Update();
 			m_Window->Update();
+			m_FramePacer.OnFramePresented(m_MaxGPUFramesInFlight);
+			if (frameCounter == 1 && m_TimeToFirstFrameMS < 0.0)
+			{
+				m_TimeToFirstFrameMS = GetStartupElapsedMS();
+				TraceStartup("First frame presented");
+			}
+
+			// Input sampled last frame has now been presented, so we can measure how long it took
+			if (m_InputSampleTime > 0.0)
+				m_InputToPresentLatencyMS = (m_Window->GetLastPresentTime() - m_InputSampleTime) * 1000.0;
+			m_InputSampleTime = glfwGetTime();
+
+			// Event stage of the update, all buffered window and input events get processed here
+			ProcessEvents();
 
 #if USE_RENDERDOC
 			RENDERDOCMANAGER.Update();
@@ -120,11 +158,26 @@ namespace Arcane
 				m_Window->ClearAll();
 
 				m_AssetManager->Update(TEXTURE_LOADS_PER_FRAME, CUBEMAP_FACES_PER_FRAME, MODELS_PER_FRAME);
+				if (m_TimeToFullyLoadedMS < 0.0 && !m_AssetManager->AssetsInFlight())
+				{
+					m_MasterRenderPass->OnAssetsResident();
+					m_TimeToFullyLoadedMS = GetStartupElapsedMS();
+					TraceStartup("Fully loaded");
+				}
 				m_ActiveScene->OnUpdate((float)deltaTime.GetDeltaTime());
 
 				for (Layer *layer : m_LayerStack)
 					layer->OnUpdate((float)deltaTime.GetDeltaTime());
 
+#if LATE_LATCH_CAMERA_INPUT
+				// Re-sample input right before the view gets built for this frame. New events stay buffered until next frame's event stage, the camera only peeks the latest cursor position
+				double earlySampleTime = m_InputSampleTime;
+				m_Window->PollEvents();
+				m_InputSampleTime = glfwGetTime();
+				m_LateLatchGainMS = (m_InputSampleTime - earlySampleTime) * 1000.0;
+				m_ActiveScene->LateLatchInput(m_EventQueue);
+#endif
+
 				// Render the frame
 				Renderer::BeginFrame();
 				{
@@ -147,15 +200,122 @@ namespace Arcane
 		OnShutdown();
 	}
 
+	double Application::GetStartupElapsedMS() const
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_StartupTime).count();
+	}
+
+	void Application::TraceStartup(const char *milestone) const
+	{
+		ARC_LOG_INFO("Startup trace - {0}: {1:.1f} ms", milestone, GetStartupElapsedMS());
+	}
+
+	double Application::GetTargetFrameRate() const
+	{
+#if THROTTLE_IN_BACKGROUND
+		if (m_Minimized || !m_Focused)
+			return BACKGROUND_FRAME_RATE_LIMIT;
+#endif
+		return m_FrameRateLimit;
+	}
+
 	void Application::Close()
 	{
 		m_Running = false;
 	}
 
+	void Application::ProcessEvents()
+	{
+		m_EventQueue.Drain([this](const BufferedEvent &bufferedEvent)
+		{
+			switch (bufferedEvent.Type)
+			{
+			case EventType::WindowClose:
+			{
+				WindowCloseEvent event;
+				OnEvent(event);
+				break;
+			}
+			case EventType::WindowFocus:
+			{
+				WindowFocusEvent event;
+				OnEvent(event);
+				break;
+			}
+			case EventType::WindowLostFocus:
+			{
+				WindowLostFocusEvent event;
+				OnEvent(event);
+				break;
+			}
+			case EventType::WindowIconify:
+			{
+				WindowIconifyEvent event(bufferedEvent.Iconify.Iconified != 0);
+				OnEvent(event);
+				break;
+			}
+			case EventType::WindowResize:
+			{
+				WindowResizeEvent event(bufferedEvent.Resize.Width, bufferedEvent.Resize.Height);
+				OnEvent(event);
+				break;
+			}
+			case EventType::KeyPressed:
+			{
+				m_InputManager->KeyCallback(bufferedEvent.Key.KeyCode, bufferedEvent.Key.Scancode, bufferedEvent.Key.Action, bufferedEvent.Key.Mods);
+				KeyPressedEvent event(bufferedEvent.Key.KeyCode, bufferedEvent.Key.Action == GLFW_REPEAT ? 1 : 0);
+				OnEvent(event);
+				break;
+			}
+			case EventType::KeyReleased:
+			{
+				m_InputManager->KeyCallback(bufferedEvent.Key.KeyCode, bufferedEvent.Key.Scancode, bufferedEvent.Key.Action, bufferedEvent.Key.Mods);
+				KeyReleasedEvent event(bufferedEvent.Key.KeyCode);
+				OnEvent(event);
+				break;
+			}
+			case EventType::MouseButtonPressed:
+			{
+				m_InputManager->MouseButtonCallback(bufferedEvent.MouseButton.Button, bufferedEvent.MouseButton.Action, bufferedEvent.MouseButton.Mods);
+				MouseButtonPressedEvent event(bufferedEvent.MouseButton.Button);
+				OnEvent(event);
+				break;
+			}
+			case EventType::MouseButtonReleased:
+			{
+				m_InputManager->MouseButtonCallback(bufferedEvent.MouseButton.Button, bufferedEvent.MouseButton.Action, bufferedEvent.MouseButton.Mods);
+				MouseButtonReleasedEvent event(bufferedEvent.MouseButton.Button);
+				OnEvent(event);
+				break;
+			}
+			case EventType::MouseMoved:
+			{
+				m_InputManager->CursorPositionCallback(bufferedEvent.Cursor.X, bufferedEvent.Cursor.Y);
+				MouseMovedEvent event((float)bufferedEvent.Cursor.X, (float)bufferedEvent.Cursor.Y);
+				OnEvent(event);
+				break;
+			}
+			case EventType::MouseScrolled:
+			{
+				m_InputManager->ScrollCallback(bufferedEvent.Scroll.XOffset, bufferedEvent.Scroll.YOffset);
+				MouseScrolledEvent event((float)bufferedEvent.Scroll.XOffset, (float)bufferedEvent.Scroll.YOffset);
+				OnEvent(event);
+				break;
+			}
+			default:
+				ARC_LOG_WARN("Unhandled buffered event type: {0}", static_cast<int>(bufferedEvent.Type));
+				break;
+			}
+		});
+	}
+
 	void Application::OnEvent(Event &event)
 	{
 		EventDispatcher dispatcher(event);
 		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(OnWindowClose));
+		dispatcher.Dispatch<WindowFocusEvent>(BIND_EVENT_FN(OnWindowFocus));
+		dispatcher.Dispatch<WindowLostFocusEvent>(BIND_EVENT_FN(OnWindowLostFocus));
+		dispatcher.Dispatch<WindowIconifyEvent>(BIND_EVENT_FN(OnWindowIconify));
 		
 		for (auto it = m_LayerStack.end(); it != m_LayerStack.begin();)
 		{
@@ -217,4 +377,22 @@ namespace Arcane
 
 		return true;
 	}
+
+	bool Application::OnWindowFocus(WindowFocusEvent &event)
+	{
+		m_Focused = true;
+		return false;
+	}
+
+	bool Application::OnWindowLostFocus(WindowLostFocusEvent &event)
+	{
+		m_Focused = false;
+		return false;
+	}
+
+	bool Application::OnWindowIconify(WindowIconifyEvent &event)
+	{
+		m_Minimized = event.IsIconified();
+		return false;
+	}
 }
@@ -6,6 +6,14 @@
 #include "Arcane/Core/Events/ApplicationEvent.h"
 #endif
 
+#ifndef EVENTQUEUE_H
+#include <Arcane/Core/Events/EventQueue.h>
+#endif
+
+#ifndef FRAMEPACER_H
+#include <Arcane/Core/FramePacer.h>
+#endif
+
 #ifndef LAYERSTACK_H
 #include <Arcane/Core/LayerStack.h>
 #endif
@@ -31,6 +39,7 @@ namespace Arcane
 		uint32_t RenderResolutionWidth = WindowWidth, RenderResolutionHeight = WindowHeight;
 		bool VSync = true;
 		bool EnableImGui = true;
+		std::vector<std::string> AssetPacks; // Mounted in order before anything loads, entries in later packs override earlier ones
 	};
 
 	class Application : public Singleton
@@ -45,6 +54,23 @@ namespace Arcane
 		inline MasterRenderPass* GetMasterRenderPass() { return m_MasterRenderPass; }
 		inline bool GetWireframe() { return m_Wireframe; }
 		inline bool* GetWireframePtr() { return &m_Wireframe; }
+		inline EventQueue* GetEventQueue() { return &m_EventQueue; }
+
+		// CPU side approximation of how long it takes for sampled input to be presented (measured from the last input sample to the buffer swap)
+		inline double GetInputToPresentLatencyMS() const { return m_InputToPresentLatencyMS; }
+		inline double GetLateLatchGainMS() const { return m_LateLatchGainMS; }
+
+		// Measured from the start of the application's construction, negative until reached. Fully loaded is when everything queued during startup finished streaming in
+		inline double GetTimeToFirstFrameMS() const { return m_TimeToFirstFrameMS; }
+		inline double GetTimeToFullyLoadedMS() const { return m_TimeToFullyLoadedMS; }
+
+		// Frame pacing, a frame rate limit of 0 means unlimited. Background throttling (THROTTLE_IN_BACKGROUND) takes priority when the window is minimized or unfocused
+		inline void SetFrameRateLimit(double framesPerSecond) { m_FrameRateLimit = framesPerSecond; }
+		inline double GetFrameRateLimit() const { return m_FrameRateLimit; }
+		inline void SetMaxGPUFramesInFlight(int maxFramesInFlight) { m_MaxGPUFramesInFlight = maxFramesInFlight; }
+		inline int GetMaxGPUFramesInFlight() const { return m_MaxGPUFramesInFlight; }
+		inline const FramePacer& GetFramePacer() const { return m_FramePacer; }
+		double GetTargetFrameRate() const;
 
 		void Run();
 		void Close();
@@ -66,8 +92,14 @@ namespace Arcane
 
 	private:
 		void InternalInit();
+		void ProcessEvents();
+		double GetStartupElapsedMS() const;
+		void TraceStartup(const char *milestone) const; // Logs the milestone with the time since startup began
 
 		bool OnWindowClose(WindowCloseEvent &event);
+		bool OnWindowFocus(WindowFocusEvent &event);
+		bool OnWindowLostFocus(WindowLostFocusEvent &event);
+		bool OnWindowIconify(WindowIconifyEvent &event);
 	private:
 		ApplicationSpecification m_Specification;
 
@@ -77,15 +109,29 @@ namespace Arcane
 		Scene *m_ActiveScene;
 		MasterRenderPass *m_MasterRenderPass;
 		LayerStack m_LayerStack;
+		EventQueue m_EventQueue;
 
 		bool m_Running = true;
 		bool m_Minimized = false;
+		bool m_Focused = true;
 
 		ImGuiLayer *m_ImGuiLayer;
 
 		static Application *s_Instance;
 
 		bool m_Wireframe;
+
+		double m_InputSampleTime = 0.0;
+		double m_InputToPresentLatencyMS = 0.0;
+		double m_LateLatchGainMS = 0.0;
+
+		std::chrono::steady_clock::time_point m_StartupTime;
+		double m_TimeToFirstFrameMS = -1.0;
+		double m_TimeToFullyLoadedMS = -1.0;
+
+		FramePacer m_FramePacer;
+		double m_FrameRateLimit = FRAME_RATE_LIMIT;
+		int m_MaxGPUFramesInFlight = MAX_GPU_FRAMES_IN_FLIGHT;
 	};
 
 	// Implemented by the client
@@ -71,6 +71,54 @@ namespace Arcane
 		uint32_t m_Width, m_Height;
 	};
 
+	class WindowFocusEvent : public Event
+	{
+	public:
+		WindowFocusEvent() = default;
+
+		EVENT_TYPE(EventType::WindowFocus);
+		EVENT_CATEGORY_FLAGS(EventCategoryFlags::EventFlagsApplication);
+
+		std::string ToString() const override
+		{
+			return std::string("WindowFocusEvent");
+		}
+	};
+
+	class WindowLostFocusEvent : public Event
+	{
+	public:
+		WindowLostFocusEvent() = default;
+
+		EVENT_TYPE(EventType::WindowLostFocus);
+		EVENT_CATEGORY_FLAGS(EventCategoryFlags::EventFlagsApplication);
+
+		std::string ToString() const override
+		{
+			return std::string("WindowLostFocusEvent");
+		}
+	};
+
+	class WindowIconifyEvent : public Event
+	{
+	public:
+		WindowIconifyEvent(bool iconified) : m_Iconified(iconified) {}
+
+		EVENT_TYPE(EventType::WindowIconify);
+		EVENT_CATEGORY_FLAGS(EventCategoryFlags::EventFlagsApplication);
+
+		inline bool IsIconified() const { return m_Iconified; }
+
+		std::string ToString() const override
+		{
+			std::stringstream ss;
+			ss << "WindowIconifyEvent - Iconified:" << m_Iconified;
+			return ss.str();
+		}
+	private:
+		bool m_Iconified;
+	};
+
 	class WindowCloseEvent : public Event
 	{
 	public:
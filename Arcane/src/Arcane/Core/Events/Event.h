@@ -7,9 +7,8 @@
 #endif
 
 /*
-	Events in Arcane are not being buffered, instead they are blocking
-	That means every time an event gets dispatched it must be processed
-	TODO: Buffer Events and process during the event part of the update stage
+	Window and input events in Arcane are buffered by the window callbacks into the application's EventQueue
+	They are then dispatched through the layer stack during the event part of the update stage (see Application::ProcessEvents)
 */
 
 namespace Arcane
@@ -18,7 +17,7 @@ namespace Arcane
 	{
 		None = 0,
 		ApplicationUpdate, ApplicationRender, ApplicationTick,
-		WindowClose, WindowResize, WindowFocus, WindowLostFocus, WindowMoved,
+		WindowClose, WindowResize, WindowFocus, WindowLostFocus, WindowMoved, WindowIconify,
 		MouseButtonPressed, MouseButtonReleased, MouseScrolled, MouseMoved,
 		KeyPressed, KeyReleased, KeyTyped
 	};
@@ -0,0 +1,40 @@
+#include "arcpch.h"
+#include "EventQueue.h"
+
+namespace Arcane
+{
+	EventQueue::EventQueue() : m_Head(0), m_Count(0), m_DroppedEventCount(0) {}
+
+	bool EventQueue::Push(const BufferedEvent &event)
+	{
+		if (m_Count >= EVENT_QUEUE_CAPACITY)
+		{
+			++m_DroppedEventCount;
+			ARC_LOG_WARN("Event queue is full, dropping event - Consider increasing EVENT_QUEUE_CAPACITY");
+			return false;
+		}
+
+		uint32_t tail = (m_Head + m_Count) % EVENT_QUEUE_CAPACITY;
+		m_Events[tail] = event;
+		++m_Count;
+		return true;
+	}
+
+	bool EventQueue::PeekLatestCursorPosition(double &outX, double &outY, double &outTimestamp) const
+	{
+		// Walk backwards from the newest event since we only care about the latest cursor sample
+		for (uint32_t i = m_Count; i > 0; --i)
+		{
+			const BufferedEvent &event = m_Events[(m_Head + i - 1) % EVENT_QUEUE_CAPACITY];
+			if (event.Type == EventType::MouseMoved)
+			{
+				outX = event.Cursor.X;
+				outY = event.Cursor.Y;
+				outTimestamp = event.Timestamp;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#ifndef EVENT_H
+#include <Arcane/Core/Events/Event.h>
+#endif
+
+namespace Arcane
+{
+	// Plain data version of an event so it can be stored in a fixed size ring buffer without any allocations. The concrete Event gets rebuilt on the stack when the queue is drained
+	struct BufferedEvent
+	{
+		EventType Type = EventType::None;
+		double Timestamp = 0.0; // Time (glfwGetTime) that the event was captured from the OS
+
+		union
+		{
+			struct { int KeyCode, Scancode, Action, Mods; } Key;
+			struct { int Button, Action, Mods; } MouseButton;
+			struct { double X, Y; } Cursor;
+			struct { double XOffset, YOffset; } Scroll;
+			struct { uint32_t Width, Height; } Resize;
+			struct { int Iconified; } Iconify;
+		};
+
+		BufferedEvent() : Key{ 0, 0, 0, 0 } {}
+	};
+
+	/*
+		Single threaded ring buffer that holds all events captured by the window callbacks until they are drained during the event part of the update stage.
+		GLFW only invokes callbacks from the main thread (inside glfwPollEvents) so no synchronization is needed. If the queue is full the newest event is dropped
+	*/
+	class EventQueue
+	{
+	public:
+		EventQueue();
+
+		bool Push(const BufferedEvent &event);
+
+		template<typename Fn>
+		void Drain(Fn func)
+		{
+			while (m_Count > 0)
+			{
+				// Copy out before invoking since handling an event is allowed to push more events
+				BufferedEvent event = m_Events[m_Head];
+				m_Head = (m_Head + 1) % EVENT_QUEUE_CAPACITY;
+				--m_Count;
+
+				func(event);
+			}
+		}
+
+		// Finds the most recent cursor position that hasn't been drained yet, used to late-latch camera input without consuming the events
+		bool PeekLatestCursorPosition(double &outX, double &outY, double &outTimestamp) const;
+
+		inline bool Empty() const { return m_Count == 0; }
+		inline uint32_t Size() const { return m_Count; }
+		inline uint32_t GetDroppedEventCount() const { return m_DroppedEventCount; }
+	private:
+		std::array<BufferedEvent, EVENT_QUEUE_CAPACITY> m_Events;
+		uint32_t m_Head, m_Count;
+		uint32_t m_DroppedEventCount;
+	};
+}
+#endif
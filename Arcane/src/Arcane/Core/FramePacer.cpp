@@ -0,0 +1,94 @@
+#include "arcpch.h"
+#include "FramePacer.h"
+
+namespace Arcane
+{
+	FramePacer::FramePacer() : m_NextFrameTime(0.0), m_SleepDurationEstimate(0.002), m_LimiterWaitMS(0.0), m_GPUSyncWaitMS(0.0) {}
+
+	void FramePacer::Shutdown()
+	{
+		ReleaseFences();
+	}
+
+	void FramePacer::WaitForNextFrame(double targetFrameRate)
+	{
+		double startTime = glfwGetTime();
+		if (targetFrameRate <= 0.0)
+		{
+			m_NextFrameTime = startTime;
+			m_LimiterWaitMS = 0.0;
+			return;
+		}
+
+		// If we fell behind by more than a frame (hitch, breakpoint, target change) don't try and catch up with a burst of frames, just restart the schedule
+		double frameDuration = 1.0 / targetFrameRate;
+		if (startTime - m_NextFrameTime > frameDuration || m_NextFrameTime - startTime > frameDuration)
+			m_NextFrameTime = startTime;
+
+		const std::chrono::milliseconds sleepStep(1);
+		double currentTime = startTime;
+		while (currentTime < m_NextFrameTime)
+		{
+			double remaining = m_NextFrameTime - currentTime;
+			if (remaining > m_SleepDurationEstimate)
+			{
+				std::this_thread::sleep_for(sleepStep);
+				double sleptFor = glfwGetTime() - currentTime;
+
+				// Quickly adapt to longer sleeps (so we don't overshoot the target) but slowly relax when sleeps become precise again
+				if (sleptFor > m_SleepDurationEstimate)
+					m_SleepDurationEstimate = sleptFor;
+				else
+					m_SleepDurationEstimate = m_SleepDurationEstimate * 0.95 + sleptFor * 0.05;
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+			currentTime = glfwGetTime();
+		}
+
+		m_NextFrameTime += frameDuration;
+		m_LimiterWaitMS = (currentTime - startTime) * 1000.0;
+	}
+
+	void FramePacer::OnFramePresented(int maxGPUFramesInFlight)
+	{
+		if (maxGPUFramesInFlight <= 0)
+		{
+			ReleaseFences();
+			m_GPUSyncWaitMS = 0.0;
+			return;
+		}
+
+		m_FrameFences.push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+		double waitStart = glfwGetTime();
+		while (static_cast<int>(m_FrameFences.size()) > maxGPUFramesInFlight)
+		{
+			GLsync oldestFence = m_FrameFences.front();
+			m_FrameFences.pop_front();
+
+			const GLuint64 timeoutNS = 100000000; // 100ms, we loop so this is just how often we wake up if the GPU is really behind
+			GLenum waitResult = glClientWaitSync(oldestFence, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNS);
+			while (waitResult == GL_TIMEOUT_EXPIRED)
+			{
+				waitResult = glClientWaitSync(oldestFence, 0, timeoutNS);
+			}
+			if (waitResult == GL_WAIT_FAILED)
+			{
+				ARC_LOG_WARN("Failed to wait on frame fence, GPU frame sync will be inaccurate");
+			}
+
+			glDeleteSync(oldestFence);
+		}
+		m_GPUSyncWaitMS = (glfwGetTime() - waitStart) * 1000.0;
+	}
+
+	void FramePacer::ReleaseFences()
+	{
+		for (GLsync fence : m_FrameFences)
+			glDeleteSync(fence);
+		m_FrameFences.clear();
+	}
+}
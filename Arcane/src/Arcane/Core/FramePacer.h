@@ -0,0 +1,38 @@
+#pragma once
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+namespace Arcane
+{
+	/*
+		Keeps frame times even and bounds latency
+		CPU side: Hybrid sleep/spin limiter, sleeps while there is plenty of time left in the frame budget and spins for the remainder since OS sleeps are not precise
+		GPU side: Inserts a fence after every present and blocks the CPU if too many frames are still queued up on the GPU, so the driver can't buffer frames deeply
+	*/
+	class FramePacer
+	{
+	public:
+		FramePacer();
+
+		void Shutdown(); // Must be called while the GL context is still alive
+
+		// Blocks until 1/targetFrameRate seconds have passed since the last frame began. A target of 0 or less means unlimited
+		void WaitForNextFrame(double targetFrameRate);
+
+		// Call after the buffers have been swapped. A value of 0 or less disables CPU/GPU syncing
+		void OnFramePresented(int maxGPUFramesInFlight);
+
+		inline double GetLimiterWaitMS() const { return m_LimiterWaitMS; }
+		inline double GetGPUSyncWaitMS() const { return m_GPUSyncWaitMS; }
+	private:
+		void ReleaseFences();
+	private:
+		double m_NextFrameTime;
+		double m_SleepDurationEstimate; // Running estimate of how long a 1ms sleep actually takes on this machine, so we know when to stop sleeping and start spinning
+
+		std::deque<GLsync> m_FrameFences;
+
+		double m_LimiterWaitMS, m_GPUSyncWaitMS;
+	};
+}
+#endif
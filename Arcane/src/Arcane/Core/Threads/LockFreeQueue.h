@@ -0,0 +1,206 @@
+#pragma once
+#ifndef LOCKFREEQUEUE_H
+#define LOCKFREEQUEUE_H
+
+namespace Arcane
+{
+	/*
+		Bounded multi-producer/multi-consumer ring queue (based on Dmitry Vyukov's bounded MPMC queue). Every cell stores a sequence number that tells
+		producers and consumers whether the cell is free or filled for the current lap, so pushing/popping only needs a single CAS on the shared
+		position and never allocates after construction. Capacity is rounded up to a power of two.
+
+		Mirrors the ThreadSafeQueue interface (Push, TryPop, Empty, Size) so it can be swapped in for the asset/job pipelines. Since the queue is bounded
+		Push will yield until space is available, use TryPush if the caller should not block
+	*/
+	template<typename T>
+	class LockFreeQueue
+	{
+	public:
+		explicit LockFreeQueue(size_t capacity = LOCK_FREE_QUEUE_DEFAULT_CAPACITY)
+			: m_EnqueuePos(0), m_DequeuePos(0)
+		{
+			size_t powerOfTwoCapacity = 2;
+			while (powerOfTwoCapacity < capacity)
+				powerOfTwoCapacity <<= 1;
+
+			m_Mask = powerOfTwoCapacity - 1;
+			m_Cells = std::unique_ptr<Cell[]>(new Cell[powerOfTwoCapacity]);
+			for (size_t i = 0; i < powerOfTwoCapacity; ++i)
+				m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+		LockFreeQueue(const LockFreeQueue &copy) = delete;
+		LockFreeQueue& operator=(const LockFreeQueue &copy) = delete;
+
+		bool TryPush(T val)
+		{
+			Cell *cell;
+			size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				cell = &m_Cells[pos & m_Mask];
+				size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+				if (diff == 0)
+				{
+					if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+				{
+					return false; // Full
+				}
+				else
+				{
+					pos = m_EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->Data = std::move(val);
+			cell->Sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		void Push(T val)
+		{
+			while (!TryPush(val))
+				std::this_thread::yield();
+		}
+
+		bool TryPop(T &val)
+		{
+			Cell *cell;
+			size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				cell = &m_Cells[pos & m_Mask];
+				size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+				if (diff == 0)
+				{
+					if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+				{
+					return false; // Empty
+				}
+				else
+				{
+					pos = m_DequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			val = std::move(cell->Data);
+			cell->Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Claims as many consecutive free cells as possible (up to count) with a single CAS. Returns the amount of values pushed, values are taken in order
+		size_t TryPushBatch(T *vals, size_t count)
+		{
+			size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			size_t claimed;
+			while (true)
+			{
+				claimed = 0;
+				while (claimed < count && claimed <= m_Mask)
+				{
+					size_t sequence = m_Cells[(pos + claimed) & m_Mask].Sequence.load(std::memory_order_acquire);
+					if (sequence != pos + claimed)
+						break;
+					++claimed;
+				}
+
+				if (claimed == 0)
+				{
+					// Either full or another producer moved the position, only bail out if we are actually full
+					size_t sequence = m_Cells[pos & m_Mask].Sequence.load(std::memory_order_acquire);
+					if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos) < 0)
+						return 0;
+					pos = m_EnqueuePos.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				if (m_EnqueuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+					break;
+			}
+
+			for (size_t i = 0; i < claimed; ++i)
+			{
+				Cell &cell = m_Cells[(pos + i) & m_Mask];
+				cell.Data = std::move(vals[i]);
+				cell.Sequence.store(pos + i + 1, std::memory_order_release);
+			}
+			return claimed;
+		}
+
+		// Claims as many consecutive filled cells as possible (up to count) with a single CAS. Returns the amount of values popped into outVals
+		size_t TryPopBatch(T *outVals, size_t count)
+		{
+			size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+			size_t claimed;
+			while (true)
+			{
+				claimed = 0;
+				while (claimed < count && claimed <= m_Mask)
+				{
+					size_t sequence = m_Cells[(pos + claimed) & m_Mask].Sequence.load(std::memory_order_acquire);
+					if (sequence != pos + claimed + 1)
+						break;
+					++claimed;
+				}
+
+				if (claimed == 0)
+				{
+					size_t sequence = m_Cells[pos & m_Mask].Sequence.load(std::memory_order_acquire);
+					if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0)
+						return 0;
+					pos = m_DequeuePos.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				if (m_DequeuePos.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+					break;
+			}
+
+			for (size_t i = 0; i < claimed; ++i)
+			{
+				Cell &cell = m_Cells[(pos + i) & m_Mask];
+				outVals[i] = std::move(cell.Data);
+				cell.Sequence.store(pos + i + m_Mask + 1, std::memory_order_release);
+			}
+			return claimed;
+		}
+
+		// Empty and Size are only approximations when other threads are pushing/popping, which is fine for the polling loops these queues are used in
+		bool Empty() const
+		{
+			return Size() == 0;
+		}
+
+		unsigned int Size() const
+		{
+			size_t enqueuePos = m_EnqueuePos.load(std::memory_order_relaxed);
+			size_t dequeuePos = m_DequeuePos.load(std::memory_order_relaxed);
+			return enqueuePos > dequeuePos ? static_cast<unsigned int>(enqueuePos - dequeuePos) : 0;
+		}
+
+		inline size_t Capacity() const { return m_Mask + 1; }
+
+	private:
+		static constexpr size_t s_CacheLineSize = 64;
+
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			T Data;
+		};
+
+		// Producers and consumers hammer different positions, keep them on separate cache lines to avoid false sharing
+		alignas(s_CacheLineSize) std::unique_ptr<Cell[]> m_Cells;
+		size_t m_Mask;
+		alignas(s_CacheLineSize) std::atomic<size_t> m_EnqueuePos;
+		alignas(s_CacheLineSize) std::atomic<size_t> m_DequeuePos;
+	};
+}
+#endif
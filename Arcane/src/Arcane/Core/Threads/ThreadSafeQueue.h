@@ -25,7 +25,7 @@ namespace Arcane
 		void WaitAndPop(T& val)
 		{
 			std::unique_lock<std::mutex> lock(m_mutex);
-			m_dataCondVar.wait([&m_dataQueue]() { return !m_dataQueue.empty(); });
+			m_dataCondVar.wait(lock, [this]() { return !m_dataQueue.empty(); });
 
 			val = m_dataQueue.front();
 			m_dataQueue.pop();
@@ -34,7 +34,7 @@ namespace Arcane
 		T WaitAndPop()
 		{
 			std::unique_lock<std::mutex> lock(m_mutex);
-			m_dataCondVar.wait([&m_dataQueue]() { return !m_dataQueue.empty(); });
+			m_dataCondVar.wait(lock, [this]() { return !m_dataQueue.empty(); });
 
 			T val = m_dataQueue.front();
 			m_dataQueue.pop();
@@ -56,7 +56,7 @@ namespace Arcane
 			return true;
 		}
 
-		T TryPop()
+		std::shared_ptr<T> TryPop()
 		{
 			std::lock_guard<std::mutex> lock(m_mutex);
 			if (m_dataQueue.empty())
@@ -64,7 +64,7 @@ namespace Arcane
 				return std::shared_ptr<T>();
 			}
 
-			T val = m_dataQueue.front();
+			std::shared_ptr<T> val = std::make_shared<T>(m_dataQueue.front());
 			m_dataQueue.pop();
 			return val;
 		}
@@ -11,13 +11,68 @@
 #define V_SYNC 0
 #define FULLSCREEN_MODE 0 // If set, window resolution is maximized to your screen resolution
 
+// Frame Pacing Settings
+#define FRAME_RATE_LIMIT 0 // 0 = unlimited, otherwise the max frames per second when the window is focused
+#define BACKGROUND_FRAME_RATE_LIMIT 15 // Frame rate used when the window is minimized or loses focus
+#define THROTTLE_IN_BACKGROUND 1 // If set, BACKGROUND_FRAME_RATE_LIMIT is applied when the window is minimized or unfocused
+#define MAX_GPU_FRAMES_IN_FLIGHT 2 // Max frames the CPU can get ahead of the GPU (enforced with fences), 0 disables the CPU/GPU sync
+
+// Event Settings
+#define EVENT_QUEUE_CAPACITY 512 // Maximum amount of buffered window/input events per frame, anything over this gets dropped
+#define LATE_LATCH_CAMERA_INPUT 1 // If set, input is re-sampled right before rendering and applied to the camera's view
+
+// Math Settings
+#define USE_SIMD_MATH 1 // If set, batched math (BatchMath) uses SSE when the target supports it, otherwise it falls back to GLM
+
 // Render Settings
 #define FORWARD_RENDER 0
+#define RENDER_TARGET_RELEASE_DELAY 5.0 // Seconds an optional effect has to go unused before its render targets are released, they are recreated the next time it runs
+#define WEIGHTED_BLENDED_OIT 1 // If set, transparent meshes in the main view are drawn unsorted into accumulation + revealage targets and composited, instead of being sorted back to front
+
+// Meshlet Settings
+#define MESHLET_CULLING 1 // If set, large static meshes in the main view are drawn as clusters that get frustum and backface culled on the GPU first
+#define MESHLET_MIN_TRIANGLE_COUNT 4096 // Meshes with fewer triangles than this aren't split into meshlets, whole mesh culling is enough for them
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+#define MESHLET_MAX_DRAWS_PER_FRAME 131072 // Size of the indirect command buffer culled meshlets are written to, meshes that don't fit are drawn whole
+
+// Text Settings
+#define TEXT_FONT_PATH "res/fonts/Roboto-Regular.ttf"
+#define TEXT_SDF_GLYPH_SIZE 48 // Pixel height of a line when the glyphs are rasterized into the atlas, the distance field keeps them sharp well past this size
+#define TEXT_SDF_PADDING 6 // Texels the distance field reaches outside of a glyph's edge
+#define TEXT_FIRST_CHARACTER 32 // Only this range of codepoints is baked into the atlas, anything else is skipped
+#define TEXT_LAST_CHARACTER 126
+#define TEXT_MAX_GLYPHS_PER_FRAME 16384
+#define TEXT_LAYOUT_CACHE_SIZE 4096 // Cached layouts are dropped once there are more distinct strings than this
+
+// Frame Capture Settings
+#define FRAME_CAPTURE_DIRECTORY "captures/"
+#define FRAME_CAPTURE_RING_SIZE 4 // Readbacks that can be in flight (on the GPU or being encoded) at once, frames captured while every slot is busy get dropped
+#define FRAME_CAPTURE_LATENCY_FRAMES 2 // Frames a readback gets before its fence is checked, so checking it shouldn't ever find the GPU still busy
+#define FRAME_CAPTURE_WORKER_THREADS 2
+
+// Thumbnail Settings
+#define THUMBNAIL_DEFAULT_SIZE 256
+#define THUMBNAIL_MODELS_IN_FLIGHT 8 // Models loading ahead of the renderer, enough to keep it busy while the workers are stuck on I/O
+#define THUMBNAIL_TEXTURE_WAIT_SECONDS 10.0 // A loaded model whose textures still aren't all generated after this long gets rendered without them (ie: missing files)
+#define THUMBNAIL_FIELD_OF_VIEW 30.0f
+
+// Asset Pack Settings
+#define ASSET_PACK_LOOSE_FILES_OVERRIDE 1 // If set, loose files on disk are used over packed entries with the same path (iterating on assets without rebuilding packs)
+#define ASSET_PACK_ENTRY_ALIGNMENT 65536 // Packed entries bigger than this start on this boundary, smaller ones never straddle it
+
+// Cooked Asset Settings
+#define USE_COOKED_ASSETS 1 // If set, loaders use the output of the asset baker (run the executable with --bake) when it exists and fall back to the source asset
+#define COOKED_ASSET_DIRECTORY "cooked/" // Cooked assets mirror the source path under this directory, ie: "res/a.png" -> "cooked/res/a.png.atex"
+#define COOKED_ASSETS_VALIDATE_SOURCE 1 // If set, a cooked asset is ignored when its loose source file no longer matches the content hash it was baked from
 
 // Streaming Settings
 #define TEXTURE_LOADS_PER_FRAME 2
 #define CUBEMAP_FACES_PER_FRAME 2
 #define MODELS_PER_FRAME 1
+#define NON_BLOCKING_STARTUP 1 // If set, the first frame renders right away with proxy meshes and placeholder textures while the scene streams in, otherwise startup waits for every queued asset
+#define STARTUP_PROXY_MESH_SIZE 1.0f // World space size of the cube drawn in place of a model that is still loading, 0 draws nothing
+#define LOCK_FREE_QUEUE_DEFAULT_CAPACITY 1024 // Rounded up to a power of two, producers yield when a lock-free queue is full
 
 // AA Settings
 #define MSAA_SAMPLE_AMOUNT 4 // Only used in forward rendering & for water
@@ -25,6 +80,8 @@
 
 // Texture Filtering Settings
 #define ANISOTROPIC_FILTERING_LEVEL 16.0f
+#define CPU_MIP_GENERATION 1 // If set, mip chains of loaded textures are built on the loader threads (filtered in linear space for sRGB, renormalized for normal maps) and uploaded level by level instead of glGenerateMipmap on the main thread
+#define CPU_MIP_KAISER_FILTER 1 // If set, CPU mip generation uses a Kaiser windowed sinc for sharper mips, otherwise a box filter
 
 // IBL Settings
 #define LIGHT_PROBE_RESOLUTION 32
@@ -68,6 +125,26 @@
 #define PARALLAX_MIN_STEPS 1
 #define PARALLAX_MAX_STEPS 20
 
+// Foliage Options
+#define FOLIAGE_MAX_INSTANCES_PER_LAYER 2000000
+#define FOLIAGE_MAX_DRAW_DISTANCE_DEFAULT 150.0f
+
+// Impostor Options
+#define IMPOSTOR_FRAMES_PER_SIDE_DEFAULT 8
+#define IMPOSTOR_FRAME_RESOLUTION_DEFAULT 128
+#define IMPOSTOR_SCREEN_SIZE_THRESHOLD_DEFAULT 0.05f // Fraction of the screen height the model's bounding sphere covers, below this the impostor is rendered instead
+
+// Lightmap Options
+#define LIGHTMAP_UV_PACK_RESOLUTION 256 // Texel resolution the lightmap UV chart padding is computed for, also the largest a single entity gets in the atlas
+#define LIGHTMAP_UV_PADDING_TEXELS 2
+#define LIGHTMAP_ATLAS_RESOLUTION_DEFAULT 2048
+#define LIGHTMAP_TEXELS_PER_UNIT_DEFAULT 8.0f
+
+// PVS Options
+#define PVS_CELL_SIZE_DEFAULT 4.0f
+#define PVS_SAMPLES_PER_CELL_DEFAULT 32 // Ray origins jittered inside every cell
+#define PVS_RAYS_PER_ENTITY_DEFAULT 256 // Rays cast from a cell towards each static entity before it is considered hidden
+
 // Water Options
 #define WATER_REFLECTION_NEAR_PLANE_DEFAULT 0.3f
 #define WATER_REFLECTION_FAR_PLANE_DEFAULT 1000.0f
@@ -40,7 +40,11 @@ namespace Arcane
 				if (m_FocusedEntity.HasComponent<MeshComponent>())
 				{
 					auto &meshComponent = m_FocusedEntity.GetComponent<MeshComponent>();
-					if (ImGui::CollapsingHeader("Material", ImGuiTreeNodeFlags_DefaultOpen))
+					if (!meshComponent.AssetModel->IsLoaded())
+					{
+						ImGui::TextDisabled("Model is still loading");
+					}
+					else if (ImGui::CollapsingHeader("Material", ImGuiTreeNodeFlags_DefaultOpen))
 					{
 						Material &meshMaterial = meshComponent.AssetModel->GetMeshes()[0].GetMaterial();
 						const char *items[] = { "Opaque", "Transparent" };
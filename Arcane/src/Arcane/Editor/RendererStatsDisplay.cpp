@@ -3,6 +3,9 @@
 
 #include <Arcane/Vendor/Imgui/imgui.h>
 #include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
+#include <Arcane/Graphics/Renderer/FrameCapture.h>
+#include <Arcane/Core/Application.h>
 
 #ifdef ARC_DEV_BUILD
 #include <Arcane/Platform/OpenGL/GPUTimerManager.h>
@@ -24,10 +27,59 @@ namespace Arcane
 			ImGui::Text("Total Draw Call Count: %u", rendererStats.DrawCallCount);
 			ImGui::Text("Mesh Draw Call Count: %u", rendererStats.MeshesDrawnCount);
 			ImGui::Text("Quads Draw Call Count: %u", rendererStats.QuadsDrawnCount);
+			ImGui::Text("Impostors Drawn Count: %u", rendererStats.ImpostorsDrawnCount);
+			ImGui::Separator();
+			if (ImGui::TreeNode("Render Target Memory"))
+			{
+				size_t allocatedMemory = 0, savedMemory = 0;
+				for (const LazyRenderTargets *targets : LazyRenderTargets::GetAll())
+				{
+					float memoryMB = static_cast<float>(targets->GetMemorySize() / (1024.0 * 1024.0));
+					if (targets->IsAllocated())
+					{
+						allocatedMemory += targets->GetMemorySize();
+						ImGui::Text("%s: %.2f MB", targets->GetEffectName(), memoryMB);
+					}
+					else
+					{
+						savedMemory += targets->GetMemorySize();
+						ImGui::TextDisabled("%s: %.2f MB saved (not allocated)", targets->GetEffectName(), memoryMB);
+					}
+				}
+				ImGui::Text("Allocated: %.2f MB, Saved: %.2f MB", allocatedMemory / (1024.0 * 1024.0), savedMemory / (1024.0 * 1024.0));
+				ImGui::TreePop();
+			}
+			if (ImGui::TreeNode("Frame Capture"))
+			{
+				static int s_SequenceFormat = static_cast<int>(FrameCaptureFormat::Raw);
+				if (ImGui::Button("Screenshot"))
+					FrameCapture::RequestScreenshot();
+				ImGui::SameLine();
+				if (!FrameCapture::IsSequenceActive())
+				{
+					if (ImGui::Button("Start Sequence"))
+						FrameCapture::BeginSequence(std::string(FRAME_CAPTURE_DIRECTORY) + "sequence/", static_cast<FrameCaptureFormat>(s_SequenceFormat));
+				}
+				else if (ImGui::Button("Stop Sequence"))
+				{
+					FrameCapture::EndSequence();
+				}
+				ImGui::RadioButton("Raw", &s_SequenceFormat, static_cast<int>(FrameCaptureFormat::Raw));
+				ImGui::SameLine();
+				ImGui::RadioButton("PNG", &s_SequenceFormat, static_cast<int>(FrameCaptureFormat::PNG));
+				ImGui::Text("Written: %u, Dropped: %u, Render Thread: %.3f ms", FrameCapture::GetFramesWritten(), FrameCapture::GetFramesDropped(), FrameCapture::GetRenderThreadMS());
+				ImGui::TreePop();
+			}
 			ImGui::Separator();
 #ifdef ARC_DEV_BUILD
 			float frametime = 1000.0f / ImGui::GetIO().Framerate;
 			ImGui::Text("Frametime: %.3f ms (FPS %.1f)", frametime, ImGui::GetIO().Framerate);
+			ImGui::Text("Input To Present Latency: %.3f ms (Late-Latch Gain %.3f ms)", Application::GetInstance().GetInputToPresentLatencyMS(), Application::GetInstance().GetLateLatchGainMS());
+			ImGui::Text("Frame Pacing: Target %.1f FPS, Limiter Wait %.3f ms, GPU Sync Wait %.3f ms", Application::GetInstance().GetTargetFrameRate(), Application::GetInstance().GetFramePacer().GetLimiterWaitMS(), Application::GetInstance().GetFramePacer().GetGPUSyncWaitMS());
+			if (Application::GetInstance().GetTimeToFullyLoadedMS() < 0.0)
+				ImGui::Text("Startup: First Frame %.1f ms, Still Streaming", Application::GetInstance().GetTimeToFirstFrameMS());
+			else
+				ImGui::Text("Startup: First Frame %.1f ms, Fully Loaded %.1f ms", Application::GetInstance().GetTimeToFirstFrameMS(), Application::GetInstance().GetTimeToFullyLoadedMS());
 			GPUTimerManager::BuildImguiTimerUI();
 #endif
 		}
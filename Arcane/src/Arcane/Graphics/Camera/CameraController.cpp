@@ -7,7 +7,8 @@
 namespace Arcane
 {
 	CameraController::CameraController(glm::vec3 position, glm::vec3 up, float yaw, float pitch, float nearPlane, float farPlane)
-		: ICamera(position, nearPlane, farPlane), m_Front(glm::vec3(0.0f, 0.0f, -1.0f)), m_CurrentMovementSpeed(0.0f)
+		: ICamera(position, nearPlane, farPlane), m_Front(glm::vec3(0.0f, 0.0f, -1.0f)), m_CurrentMovementSpeed(0.0f),
+		m_ConsumedMouseX(0.0), m_ConsumedMouseY(0.0), m_HasConsumedMouse(false), m_LastDeltaTime(0.0f)
 	{
 		m_WorldUp = up;
 		m_Up = up;
@@ -23,6 +24,8 @@ namespace Arcane
 
 	void CameraController::ProcessInput(float deltaTime)
 	{
+		m_LastDeltaTime = deltaTime;
+
 		// Movement speed
 		if (InputManager::IsKeyPressed(GLFW_KEY_LEFT_SHIFT))
 			m_CurrentMovementSpeed = CAMERA_SPEED * 4.0f;
@@ -59,13 +62,40 @@ namespace Arcane
 		ProcessCameraScroll(mouseScrollDelta + controllerScrollDelta);
 
 		// Camera rotation
-		float mouseXDelta = (float)InputManager::GetMouseXDelta() * CAMERA_ROTATION_SENSITIVITY_MOUSE * deltaTime;
-		float mouseYDelta = (float)-InputManager::GetMouseYDelta() * CAMERA_ROTATION_SENSITIVITY_MOUSE * deltaTime;
+		glm::vec2 mouseMovement = ConsumeMouseMovement(InputManager::GetMouseX(), InputManager::GetMouseY());
+		float mouseXDelta = mouseMovement.x * CAMERA_ROTATION_SENSITIVITY_MOUSE * deltaTime;
+		float mouseYDelta = -mouseMovement.y * CAMERA_ROTATION_SENSITIVITY_MOUSE * deltaTime;
 		float controllerXDelta = (float)JoystickManager::GetRightStick(0).x * CAMERA_ROTATION_SENSITIVITY_CONTROLLER * deltaTime;
 		float controllerYDelta = (float)-JoystickManager::GetRightStick(0).y * CAMERA_ROTATION_SENSITIVITY_CONTROLLER * deltaTime;
 		ProcessCameraRotation(mouseXDelta + controllerXDelta, mouseYDelta + controllerYDelta, true);
 	}
 
+	void CameraController::LateLatchInput(double mouseX, double mouseY)
+	{
+		glm::vec2 mouseMovement = ConsumeMouseMovement(mouseX, mouseY);
+		if (mouseMovement.x == 0.0f && mouseMovement.y == 0.0f)
+			return;
+
+		float mouseXDelta = mouseMovement.x * CAMERA_ROTATION_SENSITIVITY_MOUSE * m_LastDeltaTime;
+		float mouseYDelta = -mouseMovement.y * CAMERA_ROTATION_SENSITIVITY_MOUSE * m_LastDeltaTime;
+		ProcessCameraRotation(mouseXDelta, mouseYDelta, true);
+	}
+
+	glm::vec2 CameraController::ConsumeMouseMovement(double mouseX, double mouseY)
+	{
+		if (!m_HasConsumedMouse)
+		{
+			m_ConsumedMouseX = mouseX;
+			m_ConsumedMouseY = mouseY;
+			m_HasConsumedMouse = true;
+		}
+
+		glm::vec2 movement((float)(mouseX - m_ConsumedMouseX), (float)(mouseY - m_ConsumedMouseY));
+		m_ConsumedMouseX = mouseX;
+		m_ConsumedMouseY = mouseY;
+		return movement;
+	}
+
 	void CameraController::InvertPitch()
 	{
 		m_CurrentPitch = -m_CurrentPitch;
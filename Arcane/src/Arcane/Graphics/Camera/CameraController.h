@@ -26,6 +26,7 @@ namespace Arcane
 		virtual glm::mat4 GetViewMatrix() override;
 
 		void ProcessInput(float deltaTime);
+		void LateLatchInput(double mouseX, double mouseY); // Applies mouse movement that arrived after ProcessInput, using the same delta time
 		virtual void ProcessCameraScroll(float yOffset) = 0;
 
 		virtual void InvertPitch() override;
@@ -38,6 +39,7 @@ namespace Arcane
 		inline virtual const glm::vec3& GetUp() const override { return m_Up; }
 	private:
 		void UpdateCameraVectors();
+		glm::vec2 ConsumeMouseMovement(double mouseX, double mouseY);
 		void ProcessCameraMovement(glm::vec3 &direction, float deltaTime);
 		void ProcessCameraRotation(double xOffset, double yOffset, GLboolean constrainPitch = true);
 	protected:
@@ -49,6 +51,11 @@ namespace Arcane
 		float m_CurrentPitch;
 
 		float m_CurrentMovementSpeed;
+
+		// Last cursor position applied to the camera, this lets input be consumed in multiple steps per frame (update and late-latch)
+		double m_ConsumedMouseX, m_ConsumedMouseY;
+		bool m_HasConsumedMouse;
+		float m_LastDeltaTime;
 	};
 }
 #endif
@@ -0,0 +1,193 @@
+#include "arcpch.h"
+#include "PVSBaker.h"
+
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Math/TriangleBVH.h>
+#include <Arcane/Scene/Scene.h>
+#include <Arcane/Scene/Components.h>
+
+namespace Arcane
+{
+	// Deterministic so rebaking the same scene produces the same PVS
+	static uint32_t PVSHash(uint32_t value)
+	{
+		uint32_t state = value * 747796405u + 2891336453u;
+		uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+		return (word >> 22u) ^ word;
+	}
+
+	static float PVSRandom(uint32_t &seed)
+	{
+		seed = PVSHash(seed);
+		return static_cast<float>(seed) / 4294967296.0f;
+	}
+
+	static glm::vec3 RandomPointInAABB(const AABB &aabb, uint32_t &seed)
+	{
+		float x = PVSRandom(seed);
+		float y = PVSRandom(seed);
+		float z = PVSRandom(seed);
+		return aabb.Min + (aabb.Max - aabb.Min) * glm::vec3(x, y, z);
+	}
+
+	static bool AABBsOverlap(const AABB &a, const AABB &b)
+	{
+		return glm::all(glm::lessThanEqual(a.Min, b.Max)) && glm::all(glm::greaterThanEqual(a.Max, b.Min));
+	}
+
+	PotentiallyVisibleSet* PVSBaker::Bake(Scene *scene, const PVSBakeSettings &settings)
+	{
+		// Gather the static entities, sorted by id so the bit assignment does not depend on the registry's internal ordering
+		std::vector<entt::entity> entities;
+		auto view = scene->m_Registry.view<TransformComponent, MeshComponent>();
+		for (auto entity : view)
+		{
+			const MeshComponent &meshComponent = view.get<MeshComponent>(entity);
+			if (meshComponent.IsStatic && meshComponent.AssetModel)
+				entities.push_back(entity);
+		}
+		std::sort(entities.begin(), entities.end());
+
+		uint32_t entityCount = static_cast<uint32_t>(entities.size());
+		std::vector<AABB> localBounds(entityCount);
+		std::vector<glm::mat4> transforms(entityCount);
+		std::vector<AABB> worldBounds(entityCount);
+		TriangleBVH occluders;
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			Model *model = view.get<MeshComponent>(entities[i]).AssetModel;
+			transforms[i] = view.get<TransformComponent>(entities[i]).GetTransform();
+			localBounds[i] = model->ComputeBounds();
+
+			for (const Mesh &mesh : model->GetMeshes())
+			{
+				const std::vector<glm::vec3> &positions = mesh.GetPositions();
+				const std::vector<unsigned int> &indices = mesh.GetIndices();
+				size_t vertexCount = mesh.IsIndexed() ? indices.size() : positions.size();
+				for (size_t v = 0; v + 2 < vertexCount; v += 3)
+				{
+					glm::vec3 p0 = glm::vec3(transforms[i] * glm::vec4(positions[mesh.IsIndexed() ? indices[v] : v], 1.0f));
+					glm::vec3 p1 = glm::vec3(transforms[i] * glm::vec4(positions[mesh.IsIndexed() ? indices[v + 1] : v + 1], 1.0f));
+					glm::vec3 p2 = glm::vec3(transforms[i] * glm::vec4(positions[mesh.IsIndexed() ? indices[v + 2] : v + 2], 1.0f));
+					occluders.AddTriangle(p0, p1, p2, i);
+				}
+			}
+		}
+		BatchMath::TransformAABBs(localBounds.data(), transforms.data(), worldBounds.data(), entityCount);
+
+		occluders.Build();
+
+		PotentiallyVisibleSet *pvs = new PotentiallyVisibleSet();
+		pvs->m_Entities = entities;
+		pvs->m_CellSize = glm::max(settings.CellSize, 0.01f);
+		pvs->m_WordsPerRow = glm::max((entityCount + 63) / 64, 1u);
+		if (settings.UseCustomBounds)
+		{
+			pvs->m_Bounds = settings.CustomBounds;
+		}
+		else if (entityCount > 0)
+		{
+			pvs->m_Bounds = worldBounds[0];
+			for (const AABB &bounds : worldBounds)
+			{
+				pvs->m_Bounds.Min = glm::min(pvs->m_Bounds.Min, bounds.Min);
+				pvs->m_Bounds.Max = glm::max(pvs->m_Bounds.Max, bounds.Max);
+			}
+		}
+		pvs->m_CellDimensions = glm::max(glm::ivec3(glm::ceil((pvs->m_Bounds.Max - pvs->m_Bounds.Min) / pvs->m_CellSize)), glm::ivec3(1));
+
+		uint32_t cellCount = static_cast<uint32_t>(pvs->m_CellDimensions.x * pvs->m_CellDimensions.y * pvs->m_CellDimensions.z);
+		uint32_t wordsPerRow = pvs->m_WordsPerRow;
+		std::vector<uint64_t> cellRows(static_cast<size_t>(cellCount) * wordsPerRow, 0);
+
+		// Cells are handed out to the worker threads one at a time, every cell only writes to its own row so no other synchronization is needed
+		std::atomic<uint32_t> nextCell(0);
+		auto bakeCells = [&]()
+		{
+			int samplesPerCell = glm::max(settings.SamplesPerCell, 1);
+			std::vector<glm::vec3> cellSamples(samplesPerCell);
+			for (uint32_t cell = nextCell++; cell < cellCount; cell = nextCell++)
+			{
+				glm::ivec3 cellCoord = glm::ivec3(cell % pvs->m_CellDimensions.x, (cell / pvs->m_CellDimensions.x) % pvs->m_CellDimensions.y, cell / (pvs->m_CellDimensions.x * pvs->m_CellDimensions.y));
+				AABB cellBounds;
+				cellBounds.Min = pvs->m_Bounds.Min + glm::vec3(cellCoord) * pvs->m_CellSize;
+				cellBounds.Max = cellBounds.Min + glm::vec3(pvs->m_CellSize);
+
+				uint32_t seed = PVSHash(cell);
+				for (glm::vec3 &sample : cellSamples)
+					sample = RandomPointInAABB(cellBounds, seed);
+
+				uint64_t *row = &cellRows[static_cast<size_t>(cell) * wordsPerRow];
+				for (uint32_t entity = 0; entity < entityCount; entity++)
+				{
+					bool visible = AABBsOverlap(cellBounds, worldBounds[entity]);
+					for (int ray = 0; !visible && ray < settings.RaysPerEntity; ray++)
+					{
+						glm::vec3 origin = cellSamples[PVSHash(seed + ray) % samplesPerCell];
+						glm::vec3 target = RandomPointInAABB(worldBounds[entity], seed);
+						glm::vec3 toTarget = target - origin;
+						float distance = glm::length(toTarget);
+						if (distance < 1e-4f)
+						{
+							visible = true;
+							break;
+						}
+
+						// Reaching the target point unobstructed counts as well since it lies inside the entity's bounds
+						TriangleBVH::Hit hit;
+						visible = !occluders.TraceClosest(origin, toTarget / distance, distance, hit) || occluders.GetTriangles()[hit.TriangleIndex].Owner == entity;
+					}
+
+					if (visible)
+						row[entity >> 6] |= 1ull << (entity & 63);
+				}
+			}
+		};
+
+		int threadCount = settings.ThreadCount > 0 ? settings.ThreadCount : static_cast<int>(std::thread::hardware_concurrency());
+		threadCount = glm::max(threadCount, 1);
+		std::vector<std::thread> workerThreads;
+		for (int i = 1; i < threadCount; i++)
+			workerThreads.push_back(std::thread(bakeCells));
+		bakeCells();
+		for (std::thread &thread : workerThreads)
+			thread.join();
+
+		// Merge in the visibility of neighbouring cells
+		if (settings.DilationCells > 0)
+		{
+			std::vector<uint64_t> dilatedRows(cellRows.size(), 0);
+			glm::ivec3 dimensions = pvs->m_CellDimensions;
+			for (int z = 0; z < dimensions.z; z++)
+			{
+				for (int y = 0; y < dimensions.y; y++)
+				{
+					for (int x = 0; x < dimensions.x; x++)
+					{
+						uint64_t *row = &dilatedRows[static_cast<size_t>(x + dimensions.x * (y + dimensions.y * z)) * wordsPerRow];
+						glm::ivec3 neighbourMin = glm::max(glm::ivec3(x, y, z) - settings.DilationCells, glm::ivec3(0));
+						glm::ivec3 neighbourMax = glm::min(glm::ivec3(x, y, z) + settings.DilationCells, dimensions - 1);
+						for (int nz = neighbourMin.z; nz <= neighbourMax.z; nz++)
+						{
+							for (int ny = neighbourMin.y; ny <= neighbourMax.y; ny++)
+							{
+								for (int nx = neighbourMin.x; nx <= neighbourMax.x; nx++)
+								{
+									const uint64_t *neighbourRow = &cellRows[static_cast<size_t>(nx + dimensions.x * (ny + dimensions.y * nz)) * wordsPerRow];
+									for (uint32_t word = 0; word < wordsPerRow; word++)
+										row[word] |= neighbourRow[word];
+								}
+							}
+						}
+					}
+				}
+			}
+			cellRows = std::move(dilatedRows);
+		}
+
+		pvs->DeduplicateRows(cellRows);
+
+		ARC_LOG_INFO("Baked PVS - {0} static entities, {1} cells, {2} unique rows", entityCount, cellCount, pvs->GetUniqueRowCount());
+		return pvs;
+	}
+}
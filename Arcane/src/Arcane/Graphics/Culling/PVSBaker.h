@@ -0,0 +1,40 @@
+#pragma once
+#ifndef PVSBAKER_H
+#define PVSBAKER_H
+
+#ifndef POTENTIALLYVISIBLESET_H
+#include <Arcane/Graphics/Culling/PotentiallyVisibleSet.h>
+#endif
+
+namespace Arcane
+{
+	class Scene;
+
+	struct PVSBakeSettings
+	{
+		float CellSize = PVS_CELL_SIZE_DEFAULT;
+		int SamplesPerCell = PVS_SAMPLES_PER_CELL_DEFAULT;
+		int RaysPerEntity = PVS_RAYS_PER_ENTITY_DEFAULT;
+		int DilationCells = 1; // Visibility is merged from neighbouring cells within this range, hides popping when the sampling misses thin gaps
+		int ThreadCount = 0; // 0 uses every hardware thread
+
+		// By default the bounds of all static entities are used, indoor levels should set this to the navigable space to avoid baking cells inside walls
+		bool UseCustomBounds = false;
+		AABB CustomBounds;
+	};
+
+	/*
+		Offline tool that bakes a PotentiallyVisibleSet for the static entities (MeshComponent::IsStatic) of a scene. Only static geometry acts as an
+		occluder. Every cell casts rays from jittered points inside of it towards random points inside each entity's world bounds, and the entity is
+		considered visible as soon as one ray reaches it unobstructed.
+
+		Sampling is not strictly conservative, small gaps can be missed with low ray counts. DilationCells and a higher RaysPerEntity trade bake time and
+		PVS size for fewer false rejections. Runs on the CPU only, so no GL context is needed
+	*/
+	class PVSBaker
+	{
+	public:
+		static PotentiallyVisibleSet* Bake(Scene *scene, const PVSBakeSettings &settings = PVSBakeSettings());
+	};
+}
+#endif
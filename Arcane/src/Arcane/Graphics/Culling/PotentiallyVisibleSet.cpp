@@ -0,0 +1,168 @@
+#include "arcpch.h"
+#include "PotentiallyVisibleSet.h"
+
+#include <Arcane/Util/VirtualFileSystem.h>
+
+namespace Arcane
+{
+	static constexpr uint32_t s_PVSFileMagic = 0x53565041; // "APVS"
+	static constexpr uint32_t s_PVSFileVersion = 1;
+
+	bool PotentiallyVisibleSet::Save(const std::string &path) const
+	{
+		std::ofstream ofs(path, std::ios::out | std::ios::binary);
+		if (!ofs)
+		{
+			ARC_LOG_ERROR("Failed to open PVS file for writing - {0}", path);
+			return false;
+		}
+
+		uint32_t entityCount = static_cast<uint32_t>(m_Entities.size());
+		uint64_t rowWordCount = static_cast<uint64_t>(m_Rows.size());
+		uint32_t cellCount = static_cast<uint32_t>(m_CellRows.size());
+
+		ofs.write(reinterpret_cast<const char*>(&s_PVSFileMagic), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&s_PVSFileVersion), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&m_Bounds), sizeof(AABB));
+		ofs.write(reinterpret_cast<const char*>(&m_CellSize), sizeof(float));
+		ofs.write(reinterpret_cast<const char*>(&m_CellDimensions), sizeof(glm::ivec3));
+		ofs.write(reinterpret_cast<const char*>(&m_WordsPerRow), sizeof(uint32_t));
+
+		ofs.write(reinterpret_cast<const char*>(&entityCount), sizeof(uint32_t));
+		for (entt::entity entity : m_Entities)
+		{
+			uint32_t id = static_cast<uint32_t>(entity);
+			ofs.write(reinterpret_cast<const char*>(&id), sizeof(uint32_t));
+		}
+
+		ofs.write(reinterpret_cast<const char*>(&rowWordCount), sizeof(uint64_t));
+		ofs.write(reinterpret_cast<const char*>(m_Rows.data()), rowWordCount * sizeof(uint64_t));
+		ofs.write(reinterpret_cast<const char*>(&cellCount), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(m_CellRows.data()), cellCount * sizeof(uint32_t));
+
+		return ofs.good();
+	}
+
+	bool PotentiallyVisibleSet::Load(const std::string &path)
+	{
+		VirtualFile file = VirtualFileSystem::ReadFile(path);
+		if (!file.IsValid())
+		{
+			ARC_LOG_ERROR("Failed to open PVS file - {0}", path);
+			return false;
+		}
+		std::istringstream ifs(file.ToString(), std::ios::in | std::ios::binary);
+
+		uint32_t magic = 0, version = 0;
+		ifs.read(reinterpret_cast<char*>(&magic), sizeof(uint32_t));
+		ifs.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
+		if (magic != s_PVSFileMagic || version != s_PVSFileVersion)
+		{
+			ARC_LOG_ERROR("Invalid or outdated PVS file, it needs to be rebaked - {0}", path);
+			return false;
+		}
+
+		AABB bounds;
+		float cellSize;
+		glm::ivec3 cellDimensions;
+		uint32_t wordsPerRow, entityCount;
+		ifs.read(reinterpret_cast<char*>(&bounds), sizeof(AABB));
+		ifs.read(reinterpret_cast<char*>(&cellSize), sizeof(float));
+		ifs.read(reinterpret_cast<char*>(&cellDimensions), sizeof(glm::ivec3));
+		ifs.read(reinterpret_cast<char*>(&wordsPerRow), sizeof(uint32_t));
+		ifs.read(reinterpret_cast<char*>(&entityCount), sizeof(uint32_t));
+		if (!ifs || entityCount > wordsPerRow * 64)
+		{
+			ARC_LOG_ERROR("Corrupt PVS file - {0}", path);
+			return false;
+		}
+
+		std::vector<entt::entity> entities(entityCount);
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			uint32_t id;
+			ifs.read(reinterpret_cast<char*>(&id), sizeof(uint32_t));
+			entities[i] = static_cast<entt::entity>(id);
+		}
+
+		uint64_t rowWordCount = 0;
+		ifs.read(reinterpret_cast<char*>(&rowWordCount), sizeof(uint64_t));
+		std::vector<uint64_t> rows(static_cast<size_t>(rowWordCount));
+		ifs.read(reinterpret_cast<char*>(rows.data()), rowWordCount * sizeof(uint64_t));
+
+		uint32_t cellCount = 0;
+		ifs.read(reinterpret_cast<char*>(&cellCount), sizeof(uint32_t));
+		std::vector<uint32_t> cellRows(cellCount);
+		ifs.read(reinterpret_cast<char*>(cellRows.data()), cellCount * sizeof(uint32_t));
+
+		uint32_t uniqueRowCount = wordsPerRow ? static_cast<uint32_t>(rowWordCount / wordsPerRow) : 0;
+		bool valid = ifs.good() && cellCount == static_cast<uint32_t>(cellDimensions.x * cellDimensions.y * cellDimensions.z);
+		for (uint32_t i = 0; valid && i < cellCount; i++)
+			valid = cellRows[i] < uniqueRowCount;
+		if (!valid)
+		{
+			ARC_LOG_ERROR("Corrupt PVS file - {0}", path);
+			return false;
+		}
+
+		m_Bounds = bounds;
+		m_CellSize = cellSize;
+		m_CellDimensions = cellDimensions;
+		m_WordsPerRow = wordsPerRow;
+		m_Entities = std::move(entities);
+		m_Rows = std::move(rows);
+		m_CellRows = std::move(cellRows);
+		return true;
+	}
+
+	uint32_t PotentiallyVisibleSet::FindCell(const glm::vec3 &position) const
+	{
+		if (m_CellRows.empty())
+			return InvalidIndex;
+
+		glm::ivec3 cell = glm::ivec3(glm::floor((position - m_Bounds.Min) / m_CellSize));
+		if (glm::any(glm::lessThan(cell, glm::ivec3(0))) || glm::any(glm::greaterThanEqual(cell, m_CellDimensions)))
+			return InvalidIndex;
+
+		return static_cast<uint32_t>(cell.x + m_CellDimensions.x * (cell.y + m_CellDimensions.y * cell.z));
+	}
+
+	void PotentiallyVisibleSet::DeduplicateRows(const std::vector<uint64_t> &perCellRows)
+	{
+		size_t cellCount = m_WordsPerRow ? perCellRows.size() / m_WordsPerRow : 0;
+		m_Rows.clear();
+		m_CellRows.resize(cellCount);
+
+		// Bucket the unique rows by hash, collisions are resolved by comparing the actual words
+		std::unordered_map<uint64_t, std::vector<uint32_t>> rowBuckets;
+		for (size_t cell = 0; cell < cellCount; cell++)
+		{
+			const uint64_t *row = &perCellRows[cell * m_WordsPerRow];
+			uint64_t hash = 14695981039346656037ull;
+			for (uint32_t word = 0; word < m_WordsPerRow; word++)
+			{
+				hash ^= row[word];
+				hash *= 1099511628211ull;
+			}
+
+			std::vector<uint32_t> &bucket = rowBuckets[hash];
+			uint32_t rowIndex = InvalidIndex;
+			for (uint32_t candidate : bucket)
+			{
+				if (std::equal(row, row + m_WordsPerRow, &m_Rows[static_cast<size_t>(candidate) * m_WordsPerRow]))
+				{
+					rowIndex = candidate;
+					break;
+				}
+			}
+
+			if (rowIndex == InvalidIndex)
+			{
+				rowIndex = GetUniqueRowCount();
+				m_Rows.insert(m_Rows.end(), row, row + m_WordsPerRow);
+				bucket.push_back(rowIndex);
+			}
+			m_CellRows[cell] = rowIndex;
+		}
+	}
+}
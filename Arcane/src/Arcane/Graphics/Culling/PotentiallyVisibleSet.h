@@ -0,0 +1,63 @@
+#pragma once
+#ifndef POTENTIALLYVISIBLESET_H
+#define POTENTIALLYVISIBLESET_H
+
+#ifndef BATCHMATH_H
+#include <Arcane/Math/BatchMath.h>
+#endif
+
+#ifndef ENTT_CONFIG_CONFIG_H
+#include "entt.hpp"
+#endif
+
+namespace Arcane
+{
+	/*
+		Baked cell-to-entity visibility for the static part of a scene (see PVSBaker). The baked space is split into a uniform grid of cells and every
+		cell points at a bitset row over the static entities, one bit per entity. Cells that see the same set of entities share a row, which keeps indoor
+		levels with many similar cells small.
+
+		Entities are stored as their raw entt ids, so a saved PVS only stays valid as long as the scene creates its static entities in the same order
+	*/
+	class PotentiallyVisibleSet
+	{
+		friend class PVSBaker;
+	public:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+		PotentiallyVisibleSet() = default;
+
+		bool Save(const std::string &path) const;
+		bool Load(const std::string &path);
+
+		// Returns InvalidIndex if the position is outside of the baked bounds, in that case nothing should be rejected
+		uint32_t FindCell(const glm::vec3 &position) const;
+
+		inline bool IsVisible(uint32_t cellIndex, uint32_t entityIndex) const
+		{
+			const uint64_t *row = &m_Rows[static_cast<size_t>(m_CellRows[cellIndex]) * m_WordsPerRow];
+			return (row[entityIndex >> 6] >> (entityIndex & 63)) & 1;
+		}
+
+		inline const std::vector<entt::entity>& GetEntities() const { return m_Entities; }
+		inline uint32_t GetCellCount() const { return static_cast<uint32_t>(m_CellRows.size()); }
+		inline uint32_t GetUniqueRowCount() const { return m_WordsPerRow ? static_cast<uint32_t>(m_Rows.size() / m_WordsPerRow) : 0; }
+		inline const AABB& GetBounds() const { return m_Bounds; }
+		inline float GetCellSize() const { return m_CellSize; }
+		inline const glm::ivec3& GetCellDimensions() const { return m_CellDimensions; }
+		inline bool IsEmpty() const { return m_CellRows.empty(); }
+	private:
+		// Replaces every cell's row with a shared copy if an identical row already exists
+		void DeduplicateRows(const std::vector<uint64_t> &perCellRows);
+	private:
+		AABB m_Bounds;
+		float m_CellSize = PVS_CELL_SIZE_DEFAULT;
+		glm::ivec3 m_CellDimensions = glm::ivec3(0);
+
+		std::vector<entt::entity> m_Entities; // Bit i of a row refers to m_Entities[i]
+		uint32_t m_WordsPerRow = 0;
+		std::vector<uint64_t> m_Rows; // Unique rows, m_WordsPerRow words each
+		std::vector<uint32_t> m_CellRows; // Row index for every cell (x fastest, then y, then z)
+	};
+}
+#endif
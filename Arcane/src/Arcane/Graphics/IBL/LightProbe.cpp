@@ -28,6 +28,6 @@ namespace Arcane
 
 	void LightProbe::Bind(Shader *shader) {
 		m_IrradianceMap->Bind(3);
-		shader->SetUniform("irradianceMap", 3);
+		shader->SetUniform(ARC_UNIFORM("irradianceMap"), 3);
 	}
 }
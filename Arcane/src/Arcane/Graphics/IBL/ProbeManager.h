@@ -23,8 +23,9 @@ namespace Arcane
 		void AddProbe(LightProbe *probe);
 		void AddProbe(ReflectionProbe *probe);
 
-		inline void SetLightProbeFallback(LightProbe *probe) { m_LightProbeFallback = probe; }
-		inline void SetReflectionProbeFallback(ReflectionProbe *probe) { m_ReflectionProbeFallback = probe; }
+		// Takes ownership and deletes the previous fallback
+		inline void SetLightProbeFallback(LightProbe *probe) { delete m_LightProbeFallback; m_LightProbeFallback = probe; }
+		inline void SetReflectionProbeFallback(ReflectionProbe *probe) { delete m_ReflectionProbeFallback; m_ReflectionProbeFallback = probe; }
 
 		// Assumes shader is bound
 		void BindProbes(glm::vec3 &renderPosition, Shader *shader);
@@ -33,11 +33,11 @@ namespace Arcane
 	}
 
 	void ReflectionProbe::Bind(Shader *shader) {
-		shader->SetUniform("reflectionProbeMipCount", REFLECTION_PROBE_MIP_COUNT);
+		shader->SetUniform(ARC_UNIFORM("reflectionProbeMipCount"), REFLECTION_PROBE_MIP_COUNT);
 		
 		m_PrefilterMap->Bind(4);
-		shader->SetUniform("prefilterMap", 4);
+		shader->SetUniform(ARC_UNIFORM("prefilterMap"), 4);
 		s_BRDF_LUT->Bind(5);
-		shader->SetUniform("brdfLUT", 5);
+		shader->SetUniform(ARC_UNIFORM("brdfLUT"), 5);
 	}
 }
@@ -0,0 +1,65 @@
+#include "arcpch.h"
+#include "Impostor.h"
+
+namespace Arcane
+{
+	Impostor::Impostor(const ImpostorBakeSettings &settings, const glm::vec3 &boundsCentre, float boundsRadius)
+		: m_Settings(settings), m_BoundsCentre(boundsCentre), m_BoundsRadius(boundsRadius)
+	{
+		unsigned int atlasResolution = m_Settings.FramesPerSide * m_Settings.FrameResolution;
+		m_Atlas = new GBuffer(atlasResolution, atlasResolution);
+	}
+
+	Impostor::~Impostor()
+	{
+		delete m_Atlas;
+	}
+
+	glm::vec3 Impostor::GetFrameDirection(unsigned int cellX, unsigned int cellY) const
+	{
+		glm::vec2 cellCentre = (glm::vec2(cellX, cellY) + 0.5f) / static_cast<float>(m_Settings.FramesPerSide);
+		return OctahedralDecode(cellCentre * 2.0f - 1.0f, m_Settings.Hemispherical);
+	}
+
+	glm::vec3 Impostor::GetFrameUp(const glm::vec3 &frameDirection)
+	{
+		return glm::abs(frameDirection.y) > 0.999f ? glm::vec3(0.0f, 0.0f, -1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+	}
+
+	glm::vec2 Impostor::OctahedralEncode(const glm::vec3 &direction, bool hemispherical)
+	{
+		glm::vec3 n = direction / (glm::abs(direction.x) + glm::abs(direction.y) + glm::abs(direction.z));
+		if (hemispherical)
+		{
+			return glm::vec2(n.x + n.z, n.x - n.z);
+		}
+
+		if (n.y >= 0.0f)
+		{
+			return glm::vec2(n.x, n.z);
+		}
+		return (1.0f - glm::abs(glm::vec2(n.z, n.x))) * glm::vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.z >= 0.0f ? 1.0f : -1.0f);
+	}
+
+	glm::vec3 Impostor::OctahedralDecode(const glm::vec2 &octahedralCoords, bool hemispherical)
+	{
+		glm::vec3 n;
+		if (hemispherical)
+		{
+			n.x = (octahedralCoords.x + octahedralCoords.y) * 0.5f;
+			n.z = (octahedralCoords.x - octahedralCoords.y) * 0.5f;
+			n.y = 1.0f - glm::abs(n.x) - glm::abs(n.z);
+		}
+		else
+		{
+			n = glm::vec3(octahedralCoords.x, 1.0f - glm::abs(octahedralCoords.x) - glm::abs(octahedralCoords.y), octahedralCoords.y);
+			if (n.y < 0.0f)
+			{
+				glm::vec2 folded = (1.0f - glm::abs(glm::vec2(n.z, n.x))) * glm::vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.z >= 0.0f ? 1.0f : -1.0f);
+				n.x = folded.x;
+				n.z = folded.y;
+			}
+		}
+		return glm::normalize(n);
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef IMPOSTOR_H
+#define IMPOSTOR_H
+
+#ifndef GBUFFER_H
+#include <Arcane/Platform/OpenGL/Framebuffer/GBuffer.h>
+#endif
+
+namespace Arcane
+{
+	struct ImpostorBakeSettings
+	{
+		unsigned int FramesPerSide = IMPOSTOR_FRAMES_PER_SIDE_DEFAULT; // The atlas holds FramesPerSide x FramesPerSide captures
+		unsigned int FrameResolution = IMPOSTOR_FRAME_RESOLUTION_DEFAULT;
+		bool Hemispherical = false; // Only capture the upper hemisphere, gives more angular resolution for models that are never seen from below (trees, buildings)
+	};
+
+	/*
+		Baked octahedral impostor of a model (see ImpostorBaker). Every cell in the atlas is an orthographic capture of the model from the direction
+		given by decoding the cell's centre from octahedral space. The atlas is a GBuffer so the captures contain albedo, normals (object space),
+		material info and depth, which lets distant impostors be written straight into the deferred GBuffer and lit like regular geometry
+	*/
+	class Impostor
+	{
+	public:
+		Impostor(const ImpostorBakeSettings &settings, const glm::vec3 &boundsCentre, float boundsRadius);
+		~Impostor();
+
+		// Direction (object space, pointing from the model towards the capture camera) of the frame at the cell
+		glm::vec3 GetFrameDirection(unsigned int cellX, unsigned int cellY) const;
+		// Up vector used for the capture of a frame, must match the impostor shaders
+		static glm::vec3 GetFrameUp(const glm::vec3 &frameDirection);
+
+		static glm::vec2 OctahedralEncode(const glm::vec3 &direction, bool hemispherical); // Returns [-1, 1]
+		static glm::vec3 OctahedralDecode(const glm::vec2 &octahedralCoords, bool hemispherical);
+
+		inline GBuffer* GetAtlas() { return m_Atlas; }
+		inline Texture* GetAlbedoAtlas() { return m_Atlas->GetAlbedo(); }
+		inline Texture* GetNormalAtlas() { return m_Atlas->GetNormal(); }
+		inline Texture* GetMaterialInfoAtlas() { return m_Atlas->GetMaterialInfo(); }
+		inline Texture* GetDepthAtlas() { return m_Atlas->GetDepthStencilTexture(); }
+
+		inline unsigned int GetFramesPerSide() const { return m_Settings.FramesPerSide; }
+		inline unsigned int GetFrameResolution() const { return m_Settings.FrameResolution; }
+		inline bool IsHemispherical() const { return m_Settings.Hemispherical; }
+		inline const glm::vec3& GetBoundsCentre() const { return m_BoundsCentre; }
+		inline float GetBoundsRadius() const { return m_BoundsRadius; }
+	private:
+		ImpostorBakeSettings m_Settings;
+		glm::vec3 m_BoundsCentre;
+		float m_BoundsRadius;
+
+		GBuffer *m_Atlas;
+	};
+}
+#endif
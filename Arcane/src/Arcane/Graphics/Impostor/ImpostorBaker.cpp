@@ -0,0 +1,62 @@
+#include "arcpch.h"
+#include "ImpostorBaker.h"
+
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+
+namespace Arcane
+{
+	Impostor* ImpostorBaker::Bake(Model *model, const ImpostorBakeSettings &settings)
+	{
+		// Bound the model with a sphere so every capture uses the same orthographic frustum and frames line up at runtime
+		AABB bounds = model->ComputeBounds();
+		glm::vec3 boundsCentre = (bounds.Min + bounds.Max) * 0.5f;
+		float boundsRadius = glm::max(glm::length(bounds.Max - bounds.Min) * 0.5f, 0.0001f);
+
+		Impostor *impostor = new Impostor(settings, boundsCentre, boundsRadius);
+		GBuffer *atlas = impostor->GetAtlas();
+
+		// Captures use the regular deferred geometry shader so the atlas contains exactly what the GBuffer would for the full model
+		Shader *captureShader = ShaderLoader::LoadShader("deferred/PBR_Model_GeometryPass.glsl");
+
+		GLCache *glCache = GLCache::GetInstance();
+		atlas->Bind();
+		glViewport(0, 0, atlas->GetWidth(), atlas->GetHeight());
+		atlas->ClearAll();
+		glCache->SetDepthTest(true);
+		glCache->SetBlend(false);
+		glCache->SetMultisample(false);
+		glCache->SetFaceCull(false); // Foliage cards are often single sided
+		glCache->SetShader(captureShader);
+
+		// Camera sits at 2 * radius so the model occupies [radius, 3 * radius] of the depth range, the impostor shader relies on this
+		glm::mat4 projection = glm::ortho(-boundsRadius, boundsRadius, -boundsRadius, boundsRadius, boundsRadius, 3.0f * boundsRadius);
+		glm::mat4 modelMatrix = glm::mat4(1.0f);
+		captureShader->SetUniform(ARC_UNIFORM("projection"), projection);
+		captureShader->SetUniform(ARC_UNIFORM("model"), modelMatrix);
+		captureShader->SetUniform(ARC_UNIFORM("normalMatrix"), glm::mat3(1.0f));
+
+		for (unsigned int cellY = 0; cellY < settings.FramesPerSide; cellY++)
+		{
+			for (unsigned int cellX = 0; cellX < settings.FramesPerSide; cellX++)
+			{
+				glm::vec3 frameDirection = impostor->GetFrameDirection(cellX, cellY);
+				glm::vec3 capturePosition = boundsCentre + frameDirection * (2.0f * boundsRadius);
+				glm::mat4 view = glm::lookAt(capturePosition, boundsCentre, Impostor::GetFrameUp(frameDirection));
+
+				glViewport(cellX * settings.FrameResolution, cellY * settings.FrameResolution, settings.FrameResolution, settings.FrameResolution);
+				captureShader->SetUniform(ARC_UNIFORM("viewPos"), capturePosition);
+				captureShader->SetUniform(ARC_UNIFORM("view"), view);
+				model->Draw(captureShader, MaterialRequired);
+			}
+		}
+
+		glCache->SetFaceCull(true);
+		atlas->Unbind();
+
+		ARC_LOG_INFO("Baked {0}x{0} impostor for model {1}", settings.FramesPerSide, model->GetName());
+		return impostor;
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+#ifndef IMPOSTORBAKER_H
+#define IMPOSTORBAKER_H
+
+#ifndef IMPOSTOR_H
+#include <Arcane/Graphics/Impostor/Impostor.h>
+#endif
+
+namespace Arcane
+{
+	class Model;
+
+	// Offline/load time tool that captures a model from an octahedral set of directions into an impostor atlas. Requires a GL context
+	class ImpostorBaker
+	{
+	public:
+		static Impostor* Bake(Model *model, const ImpostorBakeSettings &settings = ImpostorBakeSettings());
+	};
+}
+#endif
@@ -0,0 +1,112 @@
+#include "arcpch.h"
+#include "Lightmap.h"
+
+#include <Arcane/Graphics/Texture/Texture.h>
+#include <Arcane/Util/VirtualFileSystem.h>
+
+namespace Arcane
+{
+	static constexpr uint32_t s_LightmapFileMagic = 0x4D4C4141; // "AALM"
+	static constexpr uint32_t s_LightmapFileVersion = 1;
+
+	Lightmap::~Lightmap()
+	{
+		delete m_Texture;
+	}
+
+	bool Lightmap::Save(const std::string &path) const
+	{
+		std::ofstream ofs(path, std::ios::out | std::ios::binary);
+		if (!ofs)
+		{
+			ARC_LOG_ERROR("Failed to open lightmap file for writing - {0}", path);
+			return false;
+		}
+
+		uint32_t entityCount = static_cast<uint32_t>(m_Entities.size());
+		ofs.write(reinterpret_cast<const char*>(&s_LightmapFileMagic), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&s_LightmapFileVersion), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&m_Width), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&m_Height), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&entityCount), sizeof(uint32_t));
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			uint32_t id = static_cast<uint32_t>(m_Entities[i]);
+			ofs.write(reinterpret_cast<const char*>(&id), sizeof(uint32_t));
+			ofs.write(reinterpret_cast<const char*>(&m_ScaleOffsets[i]), sizeof(glm::vec4));
+		}
+		ofs.write(reinterpret_cast<const char*>(m_Texels.data()), m_Texels.size() * sizeof(glm::vec3));
+
+		return ofs.good();
+	}
+
+	bool Lightmap::Load(const std::string &path)
+	{
+		VirtualFile file = VirtualFileSystem::ReadFile(path);
+		if (!file.IsValid())
+		{
+			ARC_LOG_ERROR("Failed to open lightmap file - {0}", path);
+			return false;
+		}
+		std::istringstream ifs(file.ToString(), std::ios::in | std::ios::binary);
+
+		uint32_t magic = 0, version = 0, width = 0, height = 0, entityCount = 0;
+		ifs.read(reinterpret_cast<char*>(&magic), sizeof(uint32_t));
+		ifs.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
+		if (magic != s_LightmapFileMagic || version != s_LightmapFileVersion)
+		{
+			ARC_LOG_ERROR("Invalid or outdated lightmap file, it needs to be rebaked - {0}", path);
+			return false;
+		}
+		ifs.read(reinterpret_cast<char*>(&width), sizeof(uint32_t));
+		ifs.read(reinterpret_cast<char*>(&height), sizeof(uint32_t));
+		ifs.read(reinterpret_cast<char*>(&entityCount), sizeof(uint32_t));
+
+		std::vector<entt::entity> entities(entityCount);
+		std::vector<glm::vec4> scaleOffsets(entityCount);
+		for (uint32_t i = 0; i < entityCount && ifs; i++)
+		{
+			uint32_t id;
+			ifs.read(reinterpret_cast<char*>(&id), sizeof(uint32_t));
+			ifs.read(reinterpret_cast<char*>(&scaleOffsets[i]), sizeof(glm::vec4));
+			entities[i] = static_cast<entt::entity>(id);
+		}
+
+		std::vector<glm::vec3> texels(static_cast<size_t>(width) * height);
+		ifs.read(reinterpret_cast<char*>(texels.data()), texels.size() * sizeof(glm::vec3));
+		if (!ifs)
+		{
+			ARC_LOG_ERROR("Corrupt lightmap file - {0}", path);
+			return false;
+		}
+
+		m_Width = width;
+		m_Height = height;
+		m_Texels = std::move(texels);
+		m_Entities = std::move(entities);
+		m_ScaleOffsets = std::move(scaleOffsets);
+		delete m_Texture;
+		m_Texture = nullptr;
+		return true;
+	}
+
+	void Lightmap::GenerateTexture()
+	{
+		if (m_Texels.empty())
+			return;
+
+		TextureSettings textureSettings;
+		textureSettings.TextureFormat = GL_RGB16F;
+		textureSettings.IsSRGB = false;
+		textureSettings.TextureWrapSMode = GL_CLAMP_TO_EDGE;
+		textureSettings.TextureWrapTMode = GL_CLAMP_TO_EDGE;
+		textureSettings.TextureMinificationFilterMode = GL_LINEAR;
+		textureSettings.TextureMagnificationFilterMode = GL_LINEAR;
+		textureSettings.TextureAnisotropyLevel = 1.0f;
+		textureSettings.HasMips = false;
+
+		delete m_Texture;
+		m_Texture = new Texture(textureSettings);
+		m_Texture->Generate2DTexture(m_Width, m_Height, GL_RGB, GL_FLOAT, m_Texels.data());
+	}
+}
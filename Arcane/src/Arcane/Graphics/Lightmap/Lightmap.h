@@ -0,0 +1,50 @@
+#pragma once
+#ifndef LIGHTMAP_H
+#define LIGHTMAP_H
+
+#ifndef ENTT_CONFIG_CONFIG_H
+#include "entt.hpp"
+#endif
+
+namespace Arcane
+{
+	class Texture;
+
+	/*
+		Baked lighting from the static lights of a scene (see LightmapBaker). Every lightmapped entity owns a square region of a single HDR atlas, its
+		lightmap UVs get remapped into that region with a per entity scale and offset (atlasUV = lightmapUV * scale + offset).
+
+		Texels store the diffuse lighting that reaches a white surface (direct + indirect), so shading is albedo * texel.
+		Entities are stored as their raw entt ids, so a saved lightmap only stays valid as long as the scene creates its static entities in the same order
+	*/
+	class Lightmap
+	{
+		friend class LightmapBaker;
+	public:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+		Lightmap() = default;
+		~Lightmap();
+
+		bool Save(const std::string &path) const;
+		bool Load(const std::string &path);
+
+		void GenerateTexture(); // Uploads the texels, requires a GL context
+
+		inline Texture* GetTexture() { return m_Texture; }
+		inline const std::vector<entt::entity>& GetEntities() const { return m_Entities; }
+		inline const glm::vec4& GetScaleOffset(uint32_t index) const { return m_ScaleOffsets[index]; } // xy = scale, zw = offset
+		inline uint32_t GetWidth() const { return m_Width; }
+		inline uint32_t GetHeight() const { return m_Height; }
+		inline const std::vector<glm::vec3>& GetTexels() const { return m_Texels; }
+	private:
+		uint32_t m_Width = 0, m_Height = 0;
+		std::vector<glm::vec3> m_Texels;
+
+		std::vector<entt::entity> m_Entities;
+		std::vector<glm::vec4> m_ScaleOffsets;
+
+		Texture *m_Texture = nullptr;
+	};
+}
+#endif
@@ -0,0 +1,493 @@
+#include "arcpch.h"
+#include "LightmapBaker.h"
+
+#include <Arcane/Graphics/Lightmap/LightmapUVGenerator.h>
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Math/TriangleBVH.h>
+#include <Arcane/Scene/Scene.h>
+#include <Arcane/Scene/Components.h>
+
+namespace Arcane
+{
+	struct LightmapBakeLight
+	{
+		LightType Type;
+		glm::vec3 Position;
+		glm::vec3 Direction; // Direction the light travels in
+		glm::vec3 Radiance;
+		float Range;
+		float InnerCutOff, OuterCutOff;
+	};
+
+	struct LightmapSurface
+	{
+		glm::vec3 Albedo;
+		glm::vec3 Emission;
+	};
+
+	struct LightmapRect
+	{
+		uint32_t EntityIndex;
+		int X, Y, Resolution;
+		float WorldArea;
+	};
+
+	// Everything the path tracer needs, shared read only between the worker threads
+	struct LightmapScene
+	{
+		TriangleBVH Occluders;
+		std::vector<LightmapSurface> Surfaces; // Indexed by the occluder triangles' owner
+		std::vector<LightmapBakeLight> Lights;
+	};
+
+	// Deterministic so rebaking the same scene produces the same lightmap
+	static uint32_t LightmapHash(uint32_t value)
+	{
+		uint32_t state = value * 747796405u + 2891336453u;
+		uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+		return (word >> 22u) ^ word;
+	}
+
+	static float LightmapRandom(uint32_t &seed)
+	{
+		seed = LightmapHash(seed);
+		return static_cast<float>(seed) / 4294967296.0f;
+	}
+
+	static glm::vec3 CosineSampleHemisphere(const glm::vec3 &normal, uint32_t &seed)
+	{
+		float u1 = LightmapRandom(seed);
+		float u2 = LightmapRandom(seed);
+		float radius = glm::sqrt(u1);
+		float phi = 2.0f * glm::pi<float>() * u2;
+
+		glm::vec3 tangent = glm::abs(normal.x) > 0.9f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+		tangent = glm::normalize(glm::cross(tangent, normal));
+		glm::vec3 bitangent = glm::cross(normal, tangent);
+		return glm::normalize(tangent * (radius * glm::cos(phi)) + bitangent * (radius * glm::sin(phi)) + normal * glm::sqrt(glm::max(1.0f - u1, 0.0f)));
+	}
+
+	template<typename Function>
+	static void ParallelFor(uint32_t count, int threadCount, const Function &function)
+	{
+		std::atomic<uint32_t> next(0);
+		auto worker = [&]()
+		{
+			for (uint32_t i = next++; i < count; i = next++)
+				function(i);
+		};
+
+		std::vector<std::thread> workerThreads;
+		for (int i = 1; i < threadCount; i++)
+			workerThreads.push_back(std::thread(worker));
+		worker();
+		for (std::thread &thread : workerThreads)
+			thread.join();
+	}
+
+	// Diffuse lighting reaching a white surface (irradiance / pi) from the static lights, with a shadow ray per light
+	static glm::vec3 ComputeDirectLighting(const LightmapScene &scene, const glm::vec3 &position, const glm::vec3 &normal, float rayBias)
+	{
+		glm::vec3 origin = position + normal * rayBias;
+		glm::vec3 result = glm::vec3(0.0f);
+		for (const LightmapBakeLight &light : scene.Lights)
+		{
+			glm::vec3 toLight;
+			float distance, attenuation = 1.0f;
+			if (light.Type == LightType::LightType_Directional)
+			{
+				toLight = -light.Direction;
+				distance = std::numeric_limits<float>::max();
+			}
+			else
+			{
+				toLight = light.Position - position;
+				distance = glm::length(toLight);
+				if (distance >= light.Range || distance < 1e-5f)
+					continue;
+				toLight /= distance;
+
+				// Windowed inverse square falloff that reaches zero at the attenuation range
+				float window = glm::clamp(1.0f - glm::pow(distance / light.Range, 4.0f), 0.0f, 1.0f);
+				attenuation = (window * window) / (distance * distance + 1.0f);
+
+				if (light.Type == LightType::LightType_Spot)
+				{
+					float theta = glm::dot(toLight, -light.Direction);
+					attenuation *= glm::clamp((theta - light.OuterCutOff) / glm::max(light.InnerCutOff - light.OuterCutOff, 1e-4f), 0.0f, 1.0f);
+				}
+			}
+
+			float nDotL = glm::dot(normal, toLight);
+			if (nDotL <= 0.0f || attenuation <= 0.0f)
+				continue;
+			if (scene.Occluders.IsOccluded(origin, toLight, distance - rayBias))
+				continue;
+
+			result += light.Radiance * attenuation * nDotL;
+		}
+		return result / glm::pi<float>();
+	}
+
+	// Cosine weighted paths, so the average of the gathered radiance is the indirect irradiance / pi
+	static glm::vec3 ComputeIndirectLighting(const LightmapScene &scene, const glm::vec3 &position, const glm::vec3 &normal, uint32_t seed, const LightmapBakeSettings &settings)
+	{
+		glm::vec3 result = glm::vec3(0.0f);
+		for (int sample = 0; sample < settings.IndirectSamples; sample++)
+		{
+			uint32_t pathSeed = LightmapHash(seed ^ LightmapHash(static_cast<uint32_t>(sample)));
+			glm::vec3 origin = position + normal * settings.RayBias;
+			glm::vec3 surfaceNormal = normal;
+			glm::vec3 throughput = glm::vec3(1.0f);
+			for (int bounce = 0; bounce < settings.Bounces; bounce++)
+			{
+				glm::vec3 direction = CosineSampleHemisphere(surfaceNormal, pathSeed);
+				TriangleBVH::Hit hit;
+				if (!scene.Occluders.TraceClosest(origin, direction, std::numeric_limits<float>::max(), hit))
+				{
+					result += throughput * settings.SkyColour;
+					break;
+				}
+
+				const TriangleBVH::Triangle &triangle = scene.Occluders.GetTriangles()[hit.TriangleIndex];
+				const LightmapSurface &surface = scene.Surfaces[triangle.Owner];
+				glm::vec3 hitPosition = origin + direction * hit.Distance;
+				glm::vec3 hitNormal = glm::normalize(glm::cross(triangle.Edge1, triangle.Edge2));
+				if (glm::dot(hitNormal, direction) > 0.0f)
+					hitNormal = -hitNormal;
+
+				result += throughput * surface.Emission;
+				throughput *= surface.Albedo;
+				result += throughput * ComputeDirectLighting(scene, hitPosition, hitNormal, settings.RayBias);
+
+				origin = hitPosition + hitNormal * settings.RayBias;
+				surfaceNormal = hitNormal;
+			}
+		}
+		return result / static_cast<float>(glm::max(settings.IndirectSamples, 1));
+	}
+
+	// Shelf packs the square regions (sorted biggest first), returns false if they don't fit in the atlas
+	static bool PackLightmapRects(std::vector<LightmapRect> &rects, int atlasResolution)
+	{
+		std::sort(rects.begin(), rects.end(), [](const LightmapRect &a, const LightmapRect &b) { return a.Resolution > b.Resolution; });
+
+		int cursorX = 0, shelfY = 0, shelfHeight = 0;
+		for (LightmapRect &rect : rects)
+		{
+			if (cursorX + rect.Resolution > atlasResolution)
+			{
+				cursorX = 0;
+				shelfY += shelfHeight;
+				shelfHeight = 0;
+			}
+			if (shelfY + rect.Resolution > atlasResolution)
+				return false;
+
+			rect.X = cursorX;
+			rect.Y = shelfY;
+			cursorX += rect.Resolution;
+			shelfHeight = glm::max(shelfHeight, rect.Resolution);
+		}
+		return true;
+	}
+
+	static float EdgeFunction(const glm::vec2 &a, const glm::vec2 &b, const glm::vec2 &c)
+	{
+		return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+	}
+
+	Lightmap* LightmapBaker::Bake(Scene *scene, const LightmapBakeSettings &settings)
+	{
+		entt::registry &registry = scene->m_Registry;
+		int threadCount = settings.ThreadCount > 0 ? settings.ThreadCount : static_cast<int>(std::thread::hardware_concurrency());
+		threadCount = glm::max(threadCount, 1);
+
+		LightmapScene bakeScene;
+		auto lightGroup = registry.group<LightComponent>(entt::get<TransformComponent>);
+		for (auto entity : lightGroup)
+		{
+			auto&[transformComponent, lightComponent] = lightGroup.get<TransformComponent, LightComponent>(entity);
+			if (!lightComponent.IsStatic)
+				continue;
+
+			LightmapBakeLight light;
+			light.Type = lightComponent.Type;
+			light.Position = transformComponent.Translation;
+			light.Direction = glm::normalize(transformComponent.GetForward());
+			light.Radiance = lightComponent.LightColour * lightComponent.Intensity;
+			light.Range = lightComponent.AttenuationRange;
+			light.InnerCutOff = lightComponent.InnerCutOff;
+			light.OuterCutOff = lightComponent.OuterCutOff;
+			bakeScene.Lights.push_back(light);
+		}
+
+		// Static opaque entities occlude, the non-animated ones among them also get lightmapped. Sorted by id so rebakes are stable
+		std::vector<entt::entity> staticEntities;
+		auto meshView = registry.view<TransformComponent, MeshComponent>();
+		for (auto entity : meshView)
+		{
+			const MeshComponent &meshComponent = meshView.get<MeshComponent>(entity);
+			if (meshComponent.IsStatic && !meshComponent.IsTransparent && meshComponent.AssetModel)
+				staticEntities.push_back(entity);
+		}
+		std::sort(staticEntities.begin(), staticEntities.end());
+
+		std::vector<entt::entity> lightmappedEntities;
+		std::vector<LightmapRect> rects;
+		for (entt::entity entity : staticEntities)
+		{
+			if (registry.all_of<PoseAnimatorComponent>(entity))
+				continue;
+
+			Model *model = meshView.get<MeshComponent>(entity).AssetModel;
+			LightmapUVGenerator::Generate(model);
+
+			LightmapRect rect;
+			rect.EntityIndex = static_cast<uint32_t>(lightmappedEntities.size());
+			rect.X = rect.Y = rect.Resolution = 0;
+			rect.WorldArea = 0.0f;
+			lightmappedEntities.push_back(entity);
+			rects.push_back(rect);
+		}
+
+		for (entt::entity entity : staticEntities)
+		{
+			glm::mat4 transform = meshView.get<TransformComponent>(entity).GetTransform();
+			for (Mesh &mesh : meshView.get<MeshComponent>(entity).AssetModel->GetMeshes())
+			{
+				Material &material = mesh.GetMaterial();
+				LightmapSurface surface;
+				surface.Albedo = material.GetAlbedoMap() ? settings.FallbackAlbedo : glm::vec3(material.GetAlbedoColourRef());
+				surface.Emission = material.GetEmissionMap() ? glm::vec3(0.0f) : material.GetEmissionColourRef() * material.GetEmissionIntensityRef();
+				uint32_t surfaceIndex = static_cast<uint32_t>(bakeScene.Surfaces.size());
+				bakeScene.Surfaces.push_back(surface);
+
+				const std::vector<glm::vec3> &positions = mesh.GetPositions();
+				const std::vector<unsigned int> &indices = mesh.GetIndices();
+				size_t cornerCount = mesh.IsIndexed() ? indices.size() : positions.size();
+				for (size_t corner = 0; corner + 2 < cornerCount; corner += 3)
+				{
+					glm::vec3 p0 = glm::vec3(transform * glm::vec4(positions[mesh.IsIndexed() ? indices[corner] : corner], 1.0f));
+					glm::vec3 p1 = glm::vec3(transform * glm::vec4(positions[mesh.IsIndexed() ? indices[corner + 1] : corner + 1], 1.0f));
+					glm::vec3 p2 = glm::vec3(transform * glm::vec4(positions[mesh.IsIndexed() ? indices[corner + 2] : corner + 2], 1.0f));
+					bakeScene.Occluders.AddTriangle(p0, p1, p2, surfaceIndex);
+				}
+			}
+		}
+		bakeScene.Occluders.Build();
+
+		// Hand out atlas space by surface area, shrinking everything until it fits
+		for (LightmapRect &rect : rects)
+		{
+			entt::entity entity = lightmappedEntities[rect.EntityIndex];
+			glm::mat4 transform = meshView.get<TransformComponent>(entity).GetTransform();
+			for (const Mesh &mesh : meshView.get<MeshComponent>(entity).AssetModel->GetMeshes())
+			{
+				const std::vector<glm::vec3> &positions = mesh.GetPositions();
+				const std::vector<unsigned int> &indices = mesh.GetIndices();
+				size_t cornerCount = mesh.IsIndexed() ? indices.size() : positions.size();
+				for (size_t corner = 0; corner + 2 < cornerCount; corner += 3)
+				{
+					glm::vec3 p0 = glm::vec3(transform * glm::vec4(positions[mesh.IsIndexed() ? indices[corner] : corner], 1.0f));
+					glm::vec3 p1 = glm::vec3(transform * glm::vec4(positions[mesh.IsIndexed() ? indices[corner + 1] : corner + 1], 1.0f));
+					glm::vec3 p2 = glm::vec3(transform * glm::vec4(positions[mesh.IsIndexed() ? indices[corner + 2] : corner + 2], 1.0f));
+					rect.WorldArea += 0.5f * glm::length(glm::cross(p1 - p0, p2 - p0));
+				}
+			}
+		}
+
+		int atlasResolution = glm::max(settings.AtlasResolution, 1);
+		float densityScale = 1.0f;
+		while (true)
+		{
+			bool atMinimum = true;
+			for (LightmapRect &rect : rects)
+			{
+				int resolution = static_cast<int>(glm::sqrt(rect.WorldArea) * settings.TexelsPerUnit * densityScale + 0.5f);
+				rect.Resolution = glm::clamp(resolution, settings.MinEntityResolution, settings.MaxEntityResolution);
+				atMinimum &= rect.Resolution == settings.MinEntityResolution;
+			}
+
+			if (PackLightmapRects(rects, atlasResolution))
+				break;
+			if (atMinimum)
+			{
+				ARC_LOG_ERROR("Lightmap atlas is too small to fit {0} entities, increase the atlas resolution", rects.size());
+				return nullptr;
+			}
+			densityScale *= 0.9f;
+		}
+
+		// Rasterize every lightmapped triangle in lightmap UV space to find the world position and normal of each texel
+		size_t texelCount = static_cast<size_t>(atlasResolution) * atlasResolution;
+		std::vector<glm::vec3> texelPositions(texelCount), texelNormals(texelCount);
+		std::vector<uint8_t> texelValid(texelCount, 0);
+		std::vector<int> texelRects(texelCount, -1);
+		for (int r = 0; r < static_cast<int>(rects.size()); r++)
+		{
+			const LightmapRect &rect = rects[r];
+			for (int y = rect.Y; y < rect.Y + rect.Resolution; y++)
+			{
+				for (int x = rect.X; x < rect.X + rect.Resolution; x++)
+					texelRects[static_cast<size_t>(y) * atlasResolution + x] = r;
+			}
+
+			entt::entity entity = lightmappedEntities[rect.EntityIndex];
+			glm::mat4 transform = meshView.get<TransformComponent>(entity).GetTransform();
+			glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
+			for (const Mesh &mesh : meshView.get<MeshComponent>(entity).AssetModel->GetMeshes())
+			{
+				if (!mesh.HasLightmapUVs())
+					continue;
+
+				const std::vector<glm::vec3> &positions = mesh.GetPositions();
+				const std::vector<glm::vec3> &normals = mesh.GetNormals();
+				const std::vector<glm::vec2> &lightmapUVs = mesh.GetLightmapUVs();
+				const std::vector<unsigned int> &indices = mesh.GetIndices();
+				size_t cornerCount = mesh.IsIndexed() ? indices.size() : positions.size();
+				for (size_t corner = 0; corner + 2 < cornerCount; corner += 3)
+				{
+					unsigned int v[3];
+					glm::vec2 t[3];
+					glm::vec3 p[3], n[3];
+					for (int i = 0; i < 3; i++)
+					{
+						v[i] = mesh.IsIndexed() ? indices[corner + i] : static_cast<unsigned int>(corner + i);
+						t[i] = lightmapUVs[v[i]] * static_cast<float>(rect.Resolution);
+						p[i] = glm::vec3(transform * glm::vec4(positions[v[i]], 1.0f));
+					}
+					glm::vec3 faceNormal = glm::normalize(glm::cross(p[1] - p[0], p[2] - p[0]));
+					for (int i = 0; i < 3; i++)
+						n[i] = normals.empty() ? faceNormal : glm::normalize(normalMatrix * normals[v[i]]);
+
+					float area = EdgeFunction(t[0], t[1], t[2]);
+					if (glm::abs(area) < 1e-10f)
+						continue;
+
+					glm::ivec2 minTexel = glm::max(glm::ivec2(glm::floor(glm::min(t[0], glm::min(t[1], t[2])))), glm::ivec2(0));
+					glm::ivec2 maxTexel = glm::min(glm::ivec2(glm::ceil(glm::max(t[0], glm::max(t[1], t[2])))), glm::ivec2(rect.Resolution - 1));
+					for (int y = minTexel.y; y <= maxTexel.y; y++)
+					{
+						for (int x = minTexel.x; x <= maxTexel.x; x++)
+						{
+							glm::vec2 centre = glm::vec2(x + 0.5f, y + 0.5f);
+							float w0 = EdgeFunction(t[1], t[2], centre) / area;
+							float w1 = EdgeFunction(t[2], t[0], centre) / area;
+							float w2 = 1.0f - w0 - w1;
+							if (w0 < -1e-4f || w1 < -1e-4f || w2 < -1e-4f)
+								continue;
+
+							size_t texel = static_cast<size_t>(rect.Y + y) * atlasResolution + (rect.X + x);
+							texelPositions[texel] = p[0] * w0 + p[1] * w1 + p[2] * w2;
+							texelNormals[texel] = glm::normalize(n[0] * w0 + n[1] * w1 + n[2] * w2);
+							texelValid[texel] = 1;
+						}
+					}
+				}
+			}
+		}
+
+		// Path trace every covered texel
+		std::vector<glm::vec3> direct(texelCount, glm::vec3(0.0f)), indirect(texelCount, glm::vec3(0.0f));
+		ParallelFor(static_cast<uint32_t>(texelCount), threadCount, [&](uint32_t texel)
+		{
+			if (!texelValid[texel])
+				return;
+
+			direct[texel] = ComputeDirectLighting(bakeScene, texelPositions[texel], texelNormals[texel], settings.RayBias);
+			if (settings.Bounces > 0)
+				indirect[texel] = ComputeIndirectLighting(bakeScene, texelPositions[texel], texelNormals[texel], LightmapHash(texel), settings);
+		});
+
+		// Edge aware blur of the indirect lighting, only texels of the same entity that face the same way and are close in world space contribute
+		std::vector<glm::vec3> texels(texelCount, glm::vec3(0.0f));
+		int radius = glm::max(settings.DenoiseRadius, 0);
+		ParallelFor(static_cast<uint32_t>(texelCount), threadCount, [&](uint32_t texel)
+		{
+			if (!texelValid[texel])
+				return;
+
+			const LightmapRect &rect = rects[texelRects[texel]];
+			float worldTexelSize = glm::sqrt(rect.WorldArea) / static_cast<float>(rect.Resolution);
+			float positionSigma = glm::max(worldTexelSize * static_cast<float>(radius), 1e-4f);
+			float spatialSigma = glm::max(static_cast<float>(radius) * 0.5f, 0.5f);
+
+			int x = static_cast<int>(texel % atlasResolution), y = static_cast<int>(texel / atlasResolution);
+			glm::vec3 filtered = glm::vec3(0.0f);
+			float totalWeight = 0.0f;
+			for (int dy = -radius; dy <= radius; dy++)
+			{
+				for (int dx = -radius; dx <= radius; dx++)
+				{
+					int nx = x + dx, ny = y + dy;
+					if (nx < 0 || ny < 0 || nx >= atlasResolution || ny >= atlasResolution)
+						continue;
+
+					size_t neighbour = static_cast<size_t>(ny) * atlasResolution + nx;
+					if (!texelValid[neighbour] || texelRects[neighbour] != texelRects[texel])
+						continue;
+
+					float normalWeight = glm::pow(glm::max(glm::dot(texelNormals[texel], texelNormals[neighbour]), 0.0f), 8.0f);
+					float positionDistance2 = glm::length2(texelPositions[texel] - texelPositions[neighbour]);
+					float weight = glm::exp(-static_cast<float>(dx * dx + dy * dy) / (2.0f * spatialSigma * spatialSigma)) * normalWeight * glm::exp(-positionDistance2 / (2.0f * positionSigma * positionSigma));
+					filtered += indirect[neighbour] * weight;
+					totalWeight += weight;
+				}
+			}
+			texels[texel] = direct[texel] + (totalWeight > 0.0f ? filtered / totalWeight : indirect[texel]);
+		});
+
+		// Dilate into the chart padding so bilinear filtering at chart edges doesn't blend with black texels
+		for (int iteration = 0; iteration < LIGHTMAP_UV_PADDING_TEXELS + 1; iteration++)
+		{
+			std::vector<uint8_t> validBefore = texelValid;
+			for (size_t texel = 0; texel < texelCount; texel++)
+			{
+				if (validBefore[texel] || texelRects[texel] < 0)
+					continue;
+
+				int x = static_cast<int>(texel % atlasResolution), y = static_cast<int>(texel / atlasResolution);
+				glm::vec3 sum = glm::vec3(0.0f);
+				int count = 0;
+				for (int dy = -1; dy <= 1; dy++)
+				{
+					for (int dx = -1; dx <= 1; dx++)
+					{
+						int nx = x + dx, ny = y + dy;
+						if (nx < 0 || ny < 0 || nx >= atlasResolution || ny >= atlasResolution)
+							continue;
+
+						size_t neighbour = static_cast<size_t>(ny) * atlasResolution + nx;
+						if (validBefore[neighbour] && texelRects[neighbour] == texelRects[texel])
+						{
+							sum += texels[neighbour];
+							count++;
+						}
+					}
+				}
+
+				if (count > 0)
+				{
+					texels[texel] = sum / static_cast<float>(count);
+					texelValid[texel] = 1;
+				}
+			}
+		}
+
+		Lightmap *lightmap = new Lightmap();
+		lightmap->m_Width = lightmap->m_Height = static_cast<uint32_t>(atlasResolution);
+		lightmap->m_Texels = std::move(texels);
+		lightmap->m_Entities = lightmappedEntities;
+		lightmap->m_ScaleOffsets.resize(lightmappedEntities.size());
+		for (const LightmapRect &rect : rects)
+		{
+			float scale = static_cast<float>(rect.Resolution) / static_cast<float>(atlasResolution);
+			lightmap->m_ScaleOffsets[rect.EntityIndex] = glm::vec4(scale, scale, static_cast<float>(rect.X) / atlasResolution, static_cast<float>(rect.Y) / atlasResolution);
+		}
+		lightmap->GenerateTexture();
+
+		ARC_LOG_INFO("Baked lightmap - {0} entities, {1} static lights, {2}x{2} atlas", lightmappedEntities.size(), bakeScene.Lights.size(), atlasResolution);
+		return lightmap;
+	}
+}
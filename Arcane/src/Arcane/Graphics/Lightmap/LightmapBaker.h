@@ -0,0 +1,44 @@
+#pragma once
+#ifndef LIGHTMAPBAKER_H
+#define LIGHTMAPBAKER_H
+
+#ifndef LIGHTMAP_H
+#include <Arcane/Graphics/Lightmap/Lightmap.h>
+#endif
+
+namespace Arcane
+{
+	class Scene;
+
+	struct LightmapBakeSettings
+	{
+		int AtlasResolution = LIGHTMAP_ATLAS_RESOLUTION_DEFAULT;
+		float TexelsPerUnit = LIGHTMAP_TEXELS_PER_UNIT_DEFAULT; // Atlas space is handed out by surface area, entities are scaled down if it doesn't fit
+		int MinEntityResolution = 8;
+		int MaxEntityResolution = LIGHTMAP_UV_PACK_RESOLUTION;
+
+		int IndirectSamples = 128; // Paths traced per texel for the indirect lighting
+		int Bounces = 2; // 0 only bakes direct lighting
+		glm::vec3 SkyColour = glm::vec3(0.0f); // Radiance of rays that escape the scene
+		glm::vec3 FallbackAlbedo = glm::vec3(0.5f); // Used for bounces off textured materials since the textures only live on the GPU
+		float RayBias = 0.01f;
+
+		int DenoiseRadius = 3; // Texel radius of the edge aware filter applied to the indirect lighting, 0 disables it
+		int ThreadCount = 0; // 0 uses every hardware thread
+	};
+
+	/*
+		Offline CPU lightmapper for the static lights (LightComponent::IsStatic) of a scene. Static, opaque, non-animated entities get lightmap UVs generated,
+		a region in the atlas sized by their surface area and every texel is path traced against a BVH of the static geometry: direct lighting with a shadow
+		ray per light plus cosine weighted paths for the indirect lighting. The noisy indirect term is then filtered with an edge aware blur and finally
+		the texels are dilated into the chart padding so bilinear filtering doesn't pull in unlit texels.
+
+		Needs a GL context since the models get re-uploaded with their lightmap UVs and the atlas texture is created at the end
+	*/
+	class LightmapBaker
+	{
+	public:
+		static Lightmap* Bake(Scene *scene, const LightmapBakeSettings &settings = LightmapBakeSettings());
+	};
+}
+#endif
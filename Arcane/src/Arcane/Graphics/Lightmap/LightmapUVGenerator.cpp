@@ -0,0 +1,232 @@
+#include "arcpch.h"
+#include "LightmapUVGenerator.h"
+
+#include <Arcane/Graphics/Mesh/Model.h>
+
+namespace Arcane
+{
+	static uint32_t FindChartRoot(std::vector<uint32_t> &parents, uint32_t triangle)
+	{
+		while (parents[triangle] != triangle)
+		{
+			parents[triangle] = parents[parents[triangle]];
+			triangle = parents[triangle];
+		}
+		return triangle;
+	}
+
+	void LightmapUVGenerator::Generate(Model *model, int packResolution, int paddingTexels)
+	{
+		std::vector<Mesh> &meshes = model->GetMeshes();
+		bool needsUVs = false;
+		for (const Mesh &mesh : meshes)
+			needsUVs |= !mesh.HasLightmapUVs() && !mesh.m_Positions.empty();
+		if (!needsUVs)
+			return;
+
+		std::vector<Chart> charts;
+		std::vector<std::vector<uint32_t>> vertexCharts(meshes.size());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(meshes.size()); i++)
+		{
+			BuildCharts(meshes[i], i, charts, vertexCharts[i]);
+		}
+
+		float packedSize = PackCharts(charts, packResolution, paddingTexels);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(meshes.size()); i++)
+		{
+			Mesh &mesh = meshes[i];
+			for (size_t v = 0; v < mesh.m_LightmapUVs.size(); v++)
+			{
+				const Chart &chart = charts[vertexCharts[i][v]];
+				mesh.m_LightmapUVs[v] = (chart.PackedOffset + (mesh.m_LightmapUVs[v] - chart.Min)) / packedSize;
+			}
+			mesh.ReloadGpuData();
+		}
+	}
+
+	void LightmapUVGenerator::BuildCharts(Mesh &mesh, uint32_t meshIndex, std::vector<Chart> &charts, std::vector<uint32_t> &outVertexCharts)
+	{
+		if (mesh.m_Positions.empty())
+			return;
+
+		bool wasIndexed = mesh.IsIndexed();
+		std::vector<unsigned int> indices = mesh.m_Indices;
+		if (!wasIndexed)
+		{
+			indices.resize(mesh.m_Positions.size() - mesh.m_Positions.size() % 3);
+			for (unsigned int i = 0; i < static_cast<unsigned int>(indices.size()); i++)
+				indices[i] = i;
+		}
+		uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+		// Classify every triangle by the major axis (and side) its face normal points along
+		std::vector<int> triangleClasses(triangleCount);
+		for (uint32_t t = 0; t < triangleCount; t++)
+		{
+			const glm::vec3 &p0 = mesh.m_Positions[indices[t * 3]];
+			glm::vec3 normal = glm::cross(mesh.m_Positions[indices[t * 3 + 1]] - p0, mesh.m_Positions[indices[t * 3 + 2]] - p0);
+			glm::vec3 absNormal = glm::abs(normal);
+			int axis = absNormal.x > absNormal.y ? (absNormal.x > absNormal.z ? 0 : 2) : (absNormal.y > absNormal.z ? 1 : 2);
+			triangleClasses[t] = axis * 2 + (normal[axis] < 0.0f ? 1 : 0);
+		}
+
+		// Weld vertices by position so triangles still connect across the UV/normal seams of the source mesh
+		AABB bounds = mesh.ComputeBounds();
+		float weldScale = 1.0f / glm::max(glm::length(bounds.Max - bounds.Min) * 1e-5f, 1e-8f);
+		std::map<std::array<int64_t, 3>, uint32_t> weldLookup;
+		std::vector<uint32_t> weldIds(mesh.m_Positions.size());
+		for (size_t v = 0; v < mesh.m_Positions.size(); v++)
+		{
+			glm::vec3 quantized = glm::round((mesh.m_Positions[v] - bounds.Min) * weldScale);
+			std::array<int64_t, 3> key = { static_cast<int64_t>(quantized.x), static_cast<int64_t>(quantized.y), static_cast<int64_t>(quantized.z) };
+			auto result = weldLookup.emplace(key, static_cast<uint32_t>(weldLookup.size()));
+			weldIds[v] = result.first->second;
+		}
+
+		// Union triangles that share an edge and face the same way into charts
+		std::vector<uint32_t> parents(triangleCount);
+		for (uint32_t t = 0; t < triangleCount; t++)
+			parents[t] = t;
+
+		std::unordered_map<uint64_t, std::vector<uint32_t>> edgeTriangles;
+		for (uint32_t t = 0; t < triangleCount; t++)
+		{
+			for (int e = 0; e < 3; e++)
+			{
+				uint32_t a = weldIds[indices[t * 3 + e]];
+				uint32_t b = weldIds[indices[t * 3 + (e + 1) % 3]];
+				uint64_t edgeKey = (static_cast<uint64_t>(glm::min(a, b)) << 32) | glm::max(a, b);
+
+				std::vector<uint32_t> &adjacent = edgeTriangles[edgeKey];
+				for (uint32_t other : adjacent)
+				{
+					if (triangleClasses[other] == triangleClasses[t])
+						parents[FindChartRoot(parents, t)] = FindChartRoot(parents, other);
+				}
+				adjacent.push_back(t);
+			}
+		}
+
+		std::unordered_map<uint32_t, uint32_t> rootToChart;
+		std::vector<uint32_t> triangleCharts(triangleCount);
+		for (uint32_t t = 0; t < triangleCount; t++)
+		{
+			uint32_t root = FindChartRoot(parents, t);
+			auto result = rootToChart.emplace(root, static_cast<uint32_t>(charts.size()));
+			if (result.second)
+			{
+				Chart chart;
+				chart.MeshIndex = meshIndex;
+				chart.ProjectionAxis = triangleClasses[t] / 2;
+				chart.Min = glm::vec2(std::numeric_limits<float>::max());
+				chart.Max = glm::vec2(-std::numeric_limits<float>::max());
+				chart.PackedOffset = glm::vec2(0.0f);
+				charts.push_back(chart);
+			}
+			triangleCharts[t] = result.first->second;
+		}
+
+		// Split every vertex that is used by more than one chart, all other attributes get duplicated
+		std::vector<glm::vec3> positions, normals, tangents, bitangents;
+		std::vector<glm::vec2> uvs, lightmapUVs;
+		std::vector<VertexBoneData> boneData;
+		std::vector<unsigned int> newIndices(indices.size());
+		std::unordered_map<uint64_t, unsigned int> splitLookup;
+		outVertexCharts.clear();
+		for (size_t corner = 0; corner < indices.size(); corner++)
+		{
+			unsigned int vertex = indices[corner];
+			uint32_t chartIndex = triangleCharts[corner / 3];
+			uint64_t splitKey = (static_cast<uint64_t>(vertex) << 32) | chartIndex;
+
+			auto result = splitLookup.emplace(splitKey, static_cast<unsigned int>(positions.size()));
+			if (result.second)
+			{
+				Chart &chart = charts[chartIndex];
+				const glm::vec3 &position = mesh.m_Positions[vertex];
+				glm::vec2 projected = glm::vec2(position[(chart.ProjectionAxis + 1) % 3], position[(chart.ProjectionAxis + 2) % 3]);
+				chart.Min = glm::min(chart.Min, projected);
+				chart.Max = glm::max(chart.Max, projected);
+
+				positions.push_back(position);
+				lightmapUVs.push_back(projected);
+				outVertexCharts.push_back(chartIndex);
+				if (!mesh.m_UVs.empty())
+					uvs.push_back(mesh.m_UVs[vertex]);
+				if (!mesh.m_Normals.empty())
+					normals.push_back(mesh.m_Normals[vertex]);
+				if (!mesh.m_Tangents.empty())
+					tangents.push_back(mesh.m_Tangents[vertex]);
+				if (!mesh.m_Bitangents.empty())
+					bitangents.push_back(mesh.m_Bitangents[vertex]);
+				if (!mesh.m_BoneData.empty())
+					boneData.push_back(mesh.m_BoneData[vertex]);
+			}
+			newIndices[corner] = result.first->second;
+		}
+
+		mesh.m_Positions = std::move(positions);
+		mesh.m_UVs = std::move(uvs);
+		mesh.m_Normals = std::move(normals);
+		mesh.m_Tangents = std::move(tangents);
+		mesh.m_Bitangents = std::move(bitangents);
+		mesh.m_BoneData = std::move(boneData);
+		mesh.m_LightmapUVs = std::move(lightmapUVs);
+		if (wasIndexed)
+			mesh.m_Indices = std::move(newIndices); // Non-indexed meshes never share vertices so the order is unchanged
+	}
+
+	float LightmapUVGenerator::PackCharts(std::vector<Chart> &charts, int packResolution, int paddingTexels)
+	{
+		if (charts.empty())
+			return 1.0f;
+
+		float totalArea = 0.0f, largestSide = 0.0f;
+		for (const Chart &chart : charts)
+		{
+			glm::vec2 size = chart.Max - chart.Min;
+			totalArea += size.x * size.y;
+			largestSide = glm::max(largestSide, glm::max(size.x, size.y));
+		}
+
+		std::vector<uint32_t> order(charts.size());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(order.size()); i++)
+			order[i] = i;
+		std::sort(order.begin(), order.end(), [&charts](uint32_t a, uint32_t b) { return (charts[a].Max.y - charts[a].Min.y) > (charts[b].Max.y - charts[b].Min.y); });
+
+		// Start from a slightly larger square than the charts' area and grow it until the shelves fit
+		float paddingFraction = static_cast<float>(paddingTexels) / static_cast<float>(glm::max(packResolution, 1));
+		float side = glm::max(glm::sqrt(totalArea) * 1.1f, largestSide) / glm::max(1.0f - 4.0f * paddingFraction, 0.1f);
+		side = glm::max(side, 1e-6f);
+		while (true)
+		{
+			float padding = side * paddingFraction;
+			float cursorX = 0.0f, shelfY = 0.0f, shelfHeight = 0.0f;
+			bool fits = true;
+			for (uint32_t index : order)
+			{
+				Chart &chart = charts[index];
+				glm::vec2 size = chart.Max - chart.Min + glm::vec2(2.0f * padding);
+				if (cursorX + size.x > side)
+				{
+					cursorX = 0.0f;
+					shelfY += shelfHeight;
+					shelfHeight = 0.0f;
+				}
+				if (shelfY + size.y > side || size.x > side)
+				{
+					fits = false;
+					break;
+				}
+
+				chart.PackedOffset = glm::vec2(cursorX, shelfY) + glm::vec2(padding);
+				cursorX += size.x;
+				shelfHeight = glm::max(shelfHeight, size.y);
+			}
+
+			if (fits)
+				return side;
+			side *= 1.1f;
+		}
+	}
+}
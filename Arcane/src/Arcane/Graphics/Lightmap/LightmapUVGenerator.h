@@ -0,0 +1,37 @@
+#pragma once
+#ifndef LIGHTMAPUVGENERATOR_H
+#define LIGHTMAPUVGENERATOR_H
+
+namespace Arcane
+{
+	class Model;
+	class Mesh;
+
+	/*
+		Generates a second UV set for lightmapping where no two triangles of a model overlap. Connected triangles that face the same major axis are grouped
+		into charts, every chart is planar projected onto that axis and all of the model's charts get packed into a single [0, 1] square with some padding
+		between them. Vertices on chart borders get split, so the meshes are re-uploaded afterwards.
+
+		The result only depends on the mesh data, so the UVs can be regenerated at load time instead of being stored with the baked lightmap
+	*/
+	class LightmapUVGenerator
+	{
+	public:
+		// Does nothing if every mesh of the model already has lightmap UVs. packResolution is the texel resolution the padding is computed for
+		static void Generate(Model *model, int packResolution = LIGHTMAP_UV_PACK_RESOLUTION, int paddingTexels = LIGHTMAP_UV_PADDING_TEXELS);
+	private:
+		struct Chart
+		{
+			uint32_t MeshIndex;
+			int ProjectionAxis;
+			glm::vec2 Min, Max; // Projected bounds in model units
+			glm::vec2 PackedOffset;
+		};
+
+		// Splits the mesh's vertices per chart and fills the chart list, the lightmap UVs are left in projected model units
+		static void BuildCharts(Mesh &mesh, uint32_t meshIndex, std::vector<Chart> &charts, std::vector<uint32_t> &outVertexCharts);
+		// Shelf packs the charts, returns the side length of the packed square in model units
+		static float PackCharts(std::vector<Chart> &charts, int packResolution, int paddingTexels);
+	};
+}
+#endif
@@ -6,32 +6,70 @@
 
 namespace Arcane
 {
+	// Uniform names (and their hashes) only get built once per light slot so binding lights doesn't format, allocate and hash strings every frame
+	struct LightUniform
+	{
+		std::string Name;
+		StringId Id;
+
+		LightUniform& operator=(const std::string &name) { Name = name; Id = StringId::HashOnly(name); return *this; }
+		inline UniformName Get() const { return UniformName(Id, Name.c_str()); }
+	};
+
+	struct LightUniformNames
+	{
+		LightUniform Position, Direction, Intensity, LightColour, AttenuationRadius, CutOff, OuterCutOff;
+	};
+
+	static std::vector<LightUniformNames> BuildLightUniformNames(const char *lightArrayName, int lightCount)
+	{
+		std::vector<LightUniformNames> names(lightCount);
+		for (int i = 0; i < lightCount; i++)
+		{
+			std::string prefix = std::string(lightArrayName) + "[" + std::to_string(i) + "].";
+			names[i].Position = prefix + "position";
+			names[i].Direction = prefix + "direction";
+			names[i].Intensity = prefix + "intensity";
+			names[i].LightColour = prefix + "lightColour";
+			names[i].AttenuationRadius = prefix + "attenuationRadius";
+			names[i].CutOff = prefix + "cutOff";
+			names[i].OuterCutOff = prefix + "outerCutOff";
+		}
+		return names;
+	}
+
 	void LightBindings::BindDirectionalLight(const TransformComponent &transformComponent, const LightComponent &lightComponent, Shader *shader, int currentLightIndex)
 	{
 		ARC_ASSERT(currentLightIndex < MaxDirLights, "Exceeded Directional Light Count");
-		shader->SetUniform(("dirLights[" + std::to_string(currentLightIndex) + "].direction").c_str(), transformComponent.GetForward());
-		shader->SetUniform(("dirLights[" + std::to_string(currentLightIndex) + "].intensity").c_str(), lightComponent.Intensity);
-		shader->SetUniform(("dirLights[" + std::to_string(currentLightIndex) + "].lightColour").c_str(), lightComponent.LightColour);
+		static const std::vector<LightUniformNames> s_Names = BuildLightUniformNames("dirLights", MaxDirLights);
+		const LightUniformNames &names = s_Names[currentLightIndex];
+		shader->SetUniform(names.Direction.Get(), transformComponent.GetForward());
+		shader->SetUniform(names.Intensity.Get(), lightComponent.Intensity);
+		shader->SetUniform(names.LightColour.Get(), lightComponent.LightColour);
 	}
 
 	void LightBindings::BindPointLight(const TransformComponent &transformComponent, const LightComponent &lightComponent, Shader *shader, int currentLightIndex)
 	{
 		ARC_ASSERT(currentLightIndex < MaxPointLights, "Exceeded Point Light Count");
-		shader->SetUniform(("pointLights[" + std::to_string(currentLightIndex) + "].position").c_str(), transformComponent.Translation);
-		shader->SetUniform(("pointLights[" + std::to_string(currentLightIndex) + "].intensity").c_str(), lightComponent.Intensity);
-		shader->SetUniform(("pointLights[" + std::to_string(currentLightIndex) + "].lightColour").c_str(), lightComponent.LightColour);
-		shader->SetUniform(("pointLights[" + std::to_string(currentLightIndex) + "].attenuationRadius").c_str(), lightComponent.AttenuationRange);
+		static const std::vector<LightUniformNames> s_Names = BuildLightUniformNames("pointLights", MaxPointLights);
+		const LightUniformNames &names = s_Names[currentLightIndex];
+		shader->SetUniform(names.Position.Get(), transformComponent.Translation);
+		shader->SetUniform(names.Intensity.Get(), lightComponent.Intensity);
+		shader->SetUniform(names.LightColour.Get(), lightComponent.LightColour);
+		shader->SetUniform(names.AttenuationRadius.Get(), lightComponent.AttenuationRange);
 	}
 
 	void LightBindings::BindSpotLight(const TransformComponent &transformComponent, const LightComponent &lightComponent, Shader *shader, int currentLightIndex)
 	{
 		ARC_ASSERT(currentLightIndex < MaxSpotLights, "Exceeded Spot Light Count");
-		shader->SetUniform(("spotLights[" + std::to_string(currentLightIndex) + "].position").c_str(), transformComponent.Translation);
-		shader->SetUniform(("spotLights[" + std::to_string(currentLightIndex) + "].direction").c_str(), transformComponent.GetForward());
-		shader->SetUniform(("spotLights[" + std::to_string(currentLightIndex) + "].intensity").c_str(), lightComponent.Intensity);
-		shader->SetUniform(("spotLights[" + std::to_string(currentLightIndex) + "].lightColour").c_str(), lightComponent.LightColour);
-		shader->SetUniform(("spotLights[" + std::to_string(currentLightIndex) + "].attenuationRadius").c_str(), lightComponent.AttenuationRange);
-		shader->SetUniform(("spotLights[" + std::to_string(currentLightIndex) + "].cutOff").c_str(), lightComponent.InnerCutOff);
-		shader->SetUniform(("spotLights[" + std::to_string(currentLightIndex) + "].outerCutOff").c_str(), lightComponent.OuterCutOff);
+		static const std::vector<LightUniformNames> s_Names = BuildLightUniformNames("spotLights", MaxSpotLights);
+		const LightUniformNames &names = s_Names[currentLightIndex];
+		shader->SetUniform(names.Position.Get(), transformComponent.Translation);
+		shader->SetUniform(names.Direction.Get(), transformComponent.GetForward());
+		shader->SetUniform(names.Intensity.Get(), lightComponent.Intensity);
+		shader->SetUniform(names.LightColour.Get(), lightComponent.LightColour);
+		shader->SetUniform(names.AttenuationRadius.Get(), lightComponent.AttenuationRange);
+		shader->SetUniform(names.CutOff.Get(), lightComponent.InnerCutOff);
+		shader->SetUniform(names.OuterCutOff.Get(), lightComponent.OuterCutOff);
 	}
 }
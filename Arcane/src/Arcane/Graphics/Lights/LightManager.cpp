@@ -218,15 +218,20 @@ namespace Arcane
 
 	void LightManager::BindLightingUniforms(Shader *shader)
 	{
-		BindLights(shader, false);
+		BindLights(shader, true, true);
 	}
 
 	void LightManager::BindStaticLightingUniforms(Shader *shader)
 	{
-		BindLights(shader, true);
+		BindLights(shader, true, false);
 	}
 
-	void LightManager::BindLights(Shader *shader, bool bindOnlyStatic)
+	void LightManager::BindDynamicLightingUniforms(Shader *shader)
+	{
+		BindLights(shader, false, true);
+	}
+
+	void LightManager::BindLights(Shader *shader, bool bindStatic, bool bindDynamic)
 	{
 		int numDirLights = 0, numPointLights = 0, numSpotLights = 0;
 
@@ -235,7 +240,7 @@ namespace Arcane
 		{
 			auto&[transformComponent, lightComponent] = group.get<TransformComponent, LightComponent>(entity);
 
-			if (bindOnlyStatic && !lightComponent.IsStatic)
+			if ((lightComponent.IsStatic && !bindStatic) || (!lightComponent.IsStatic && !bindDynamic))
 				continue;
 
 			switch (lightComponent.Type)
@@ -258,7 +263,27 @@ namespace Arcane
 		numDirLights = std::min<int>(numDirLights, LightBindings::MaxDirLights);
 		numPointLights = std::min<int>(numPointLights, LightBindings::MaxPointLights);
 		numSpotLights = std::min<int>(numSpotLights, LightBindings::MaxSpotLights);
-		shader->SetUniform("numDirPointSpotLights", glm::ivec4(numDirLights, numPointLights, numSpotLights, 0));
+		shader->SetUniform(ARC_UNIFORM("numDirPointSpotLights"), glm::ivec4(numDirLights, numPointLights, numSpotLights, 0));
+	}
+
+	int LightManager::FindDynamicLightIndex(const LightComponent *light)
+	{
+		if (!light || light->IsStatic)
+			return -1;
+
+		int currentIndex = -1;
+		auto group = m_Scene->m_Registry.group<LightComponent>(entt::get<TransformComponent>);
+		for (auto entity : group)
+		{
+			const LightComponent &lightComponent = group.get<LightComponent>(entity);
+			if (lightComponent.Type != light->Type || lightComponent.IsStatic)
+				continue;
+
+			currentIndex++;
+			if (&lightComponent == light)
+				return currentIndex;
+		}
+		return -1;
 	}
 
 	glm::uvec2 LightManager::GetShadowQualityResolution(ShadowQuality quality)
@@ -451,4 +476,9 @@ namespace Arcane
 
 		return m_ClosestPointLightIndex;
 	}
+
+	glm::ivec3 LightManager::GetDynamicShadowCasterIndices()
+	{
+		return glm::ivec3(FindDynamicLightIndex(m_ClosestDirectionalLightShadowCaster), FindDynamicLightIndex(m_ClosestSpotLightShadowCaster), FindDynamicLightIndex(m_ClosestPointLightShadowCaster));
+	}
 }
@@ -40,6 +40,7 @@ namespace Arcane
 
 		void BindLightingUniforms(Shader *shader);
 		void BindStaticLightingUniforms(Shader *shader);
+		void BindDynamicLightingUniforms(Shader *shader); // For lightmapped surfaces, the static lights are already baked in
 
 		static glm::uvec2 GetShadowQualityResolution(ShadowQuality quality);
 
@@ -69,11 +70,15 @@ namespace Arcane
 		glm::vec2 GetPointLightShadowCasterNearFarPlane();
 		float GetPointLightShadowCasterBias();
 		int GetPointLightShadowCasterIndex();
+
+		// Shadow caster indices (directional, spot, point) into the lights bound by BindDynamicLightingUniforms, -1 if the caster doesn't exist or is static
+		glm::ivec3 GetDynamicShadowCasterIndices();
 	private:
 		void FindClosestDirectionalLightShadowCaster();
 		void FindClosestSpotLightShadowCaster();
 		void FindClosestPointLightShadowCaster();
-		void BindLights(Shader *shader, bool bindOnlyStatic);
+		void BindLights(Shader *shader, bool bindStatic, bool bindDynamic);
+		int FindDynamicLightIndex(const LightComponent *light);
 		void ReallocateDepthTarget(Framebuffer **framebuffer, glm::uvec2 newResolution);
 		void ReallocateDepthCubemap(Cubemap** cubemap, glm::uvec2 newResolution);
 	private:
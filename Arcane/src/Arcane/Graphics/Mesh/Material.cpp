@@ -3,6 +3,7 @@
 
 #include <Arcane/Graphics/Shader.h>
 #include <Arcane/Graphics/texture/Texture.h>
+#include <Arcane/Graphics/Texture/OrmTexture.h>
 #include <Arcane/Util/Loaders/AssetManager.h>
 
 namespace Arcane
@@ -39,6 +40,27 @@ namespace Arcane
 		m_EmissionMap = texture;
 	}
 
+	Texture* Material::GetMetallicMap()
+	{
+		if (m_OrmTexture)
+			return m_OrmTexture->HasMetallic ? &m_OrmTexture->MetallicView : nullptr;
+		return m_MetallicMap;
+	}
+
+	Texture* Material::GetRoughnessMap()
+	{
+		if (m_OrmTexture)
+			return m_OrmTexture->HasRoughness ? &m_OrmTexture->RoughnessView : nullptr;
+		return m_RoughnessMap;
+	}
+
+	Texture* Material::GetAmbientOcclusionMap()
+	{
+		if (m_OrmTexture)
+			return m_OrmTexture->HasOcclusion ? &m_OrmTexture->OcclusionView : nullptr;
+		return m_AmbientOcclusionMap;
+	}
+
 	void Material::BindMaterialInformation(Shader *shader) const
 	{
 		// Texture unit 0 is reserved for the directional shadowmap
@@ -49,19 +71,19 @@ namespace Arcane
 		// Texture unit 5 is reserved for the brdfLUT used for indirect specular IBL
 		int currentTextureUnit = 6;
 
-		shader->SetUniform("material.albedoColour", m_AlbedoColour);
+		shader->SetUniform(ARC_UNIFORM("material.albedoColour"), m_AlbedoColour);
 		if (m_AlbedoMap && m_AlbedoMap->IsGenerated())
 		{
-			shader->SetUniform("material.texture_albedo", currentTextureUnit);
-			shader->SetUniform("material.hasAlbedoTexture", true);
+			shader->SetUniform(ARC_UNIFORM("material.texture_albedo"), currentTextureUnit);
+			shader->SetUniform(ARC_UNIFORM("material.hasAlbedoTexture"), true);
 			m_AlbedoMap->Bind(currentTextureUnit++);
 		}
 		else
 		{
-			shader->SetUniform("material.hasAlbedoTexture", false);
+			shader->SetUniform(ARC_UNIFORM("material.hasAlbedoTexture"), false);
 		}
 
-		shader->SetUniform("material.texture_normal", currentTextureUnit);
+		shader->SetUniform(ARC_UNIFORM("material.texture_normal"), currentTextureUnit);
 		if (m_NormalMap && m_NormalMap->IsGenerated())
 		{
 			m_NormalMap->Bind(currentTextureUnit++);
@@ -71,73 +93,109 @@ namespace Arcane
 			AssetManager::GetInstance().GetDefaultNormalTexture()->Bind(currentTextureUnit++);
 		}
 
-		if (m_MetallicMap && m_MetallicMap->IsGenerated())
-		{
-			shader->SetUniform("material.texture_metallic", currentTextureUnit);
-			shader->SetUniform("material.hasMetallicTexture", true);
-			m_MetallicMap->Bind(currentTextureUnit++);
-		}
-		else
+		if (m_OrmTexture && m_OrmTexture->IsGenerated())
 		{
-			shader->SetUniform("material.hasMetallicTexture", false);
-			shader->SetUniform("material.metallicValue", m_MetallicValue);
-		}
+			shader->SetUniform(ARC_UNIFORM("material.hasMetallicTexture"), m_OrmTexture->HasMetallic);
+			shader->SetUniform(ARC_UNIFORM("material.metallicValue"), m_MetallicValue);
+			shader->SetUniform(ARC_UNIFORM("material.hasRoughnessTexture"), m_OrmTexture->HasRoughness);
+			shader->SetUniform(ARC_UNIFORM("material.roughnessValue"), m_RoughnessValue);
 
-		if (m_RoughnessMap && m_RoughnessMap->IsGenerated())
-		{
-			shader->SetUniform("material.texture_roughness", currentTextureUnit);
-			shader->SetUniform("material.hasRoughnessTexture", true);
-			m_RoughnessMap->Bind(currentTextureUnit++);
+			if (shader->HasUniform(ARC_UNIFORM("material.texture_orm")))
+			{
+				// One bind covers all three. The separate samplers get pointed at the same unit so none of them is left on a unit from an earlier material
+				shader->SetUniform(ARC_UNIFORM("material.hasOrmTexture"), true);
+				shader->SetUniform(ARC_UNIFORM("material.texture_orm"), currentTextureUnit);
+				shader->SetUniform(ARC_UNIFORM("material.texture_metallic"), currentTextureUnit);
+				shader->SetUniform(ARC_UNIFORM("material.texture_roughness"), currentTextureUnit);
+				shader->SetUniform(ARC_UNIFORM("material.texture_ao"), currentTextureUnit);
+				m_OrmTexture->Packed.Bind(currentTextureUnit++);
+			}
+			else
+			{
+				// Shader samples the maps separately, the views still share the packed storage
+				shader->SetUniform(ARC_UNIFORM("material.texture_metallic"), currentTextureUnit);
+				m_OrmTexture->MetallicView.Bind(currentTextureUnit++);
+				shader->SetUniform(ARC_UNIFORM("material.texture_roughness"), currentTextureUnit);
+				m_OrmTexture->RoughnessView.Bind(currentTextureUnit++);
+				shader->SetUniform(ARC_UNIFORM("material.texture_ao"), currentTextureUnit);
+				m_OrmTexture->OcclusionView.Bind(currentTextureUnit++);
+			}
 		}
 		else
 		{
-			shader->SetUniform("material.hasRoughnessTexture", false);
-			shader->SetUniform("material.roughnessValue", m_RoughnessValue);
-		}
+			shader->SetUniform(ARC_UNIFORM("material.hasOrmTexture"), false);
 
-		shader->SetUniform("material.texture_ao", currentTextureUnit);
-		if (m_AmbientOcclusionMap && m_AmbientOcclusionMap->IsGenerated())
-		{
-			m_AmbientOcclusionMap->Bind(currentTextureUnit++);
-		}
-		else
-		{
-			AssetManager::GetInstance().GetDefaultAOTexture()->Bind(currentTextureUnit++);
+			if (m_MetallicMap && m_MetallicMap->IsGenerated())
+			{
+				shader->SetUniform(ARC_UNIFORM("material.texture_metallic"), currentTextureUnit);
+				shader->SetUniform(ARC_UNIFORM("material.hasMetallicTexture"), true);
+				m_MetallicMap->Bind(currentTextureUnit++);
+			}
+			else
+			{
+				shader->SetUniform(ARC_UNIFORM("material.hasMetallicTexture"), false);
+				shader->SetUniform(ARC_UNIFORM("material.metallicValue"), m_MetallicValue);
+			}
+
+			if (m_RoughnessMap && m_RoughnessMap->IsGenerated())
+			{
+				shader->SetUniform(ARC_UNIFORM("material.texture_roughness"), currentTextureUnit);
+				shader->SetUniform(ARC_UNIFORM("material.hasRoughnessTexture"), true);
+				m_RoughnessMap->Bind(currentTextureUnit++);
+			}
+			else
+			{
+				shader->SetUniform(ARC_UNIFORM("material.hasRoughnessTexture"), false);
+				shader->SetUniform(ARC_UNIFORM("material.roughnessValue"), m_RoughnessValue);
+			}
+
+			shader->SetUniform(ARC_UNIFORM("material.texture_ao"), currentTextureUnit);
+			if (m_AmbientOcclusionMap && m_AmbientOcclusionMap->IsGenerated())
+			{
+				m_AmbientOcclusionMap->Bind(currentTextureUnit++);
+			}
+			else
+			{
+				AssetManager::GetInstance().GetDefaultAOTexture()->Bind(currentTextureUnit++);
+			}
+
+			// Keep the packed sampler on a 2D texture unit even though it isn't sampled
+			shader->SetUniform(ARC_UNIFORM("material.texture_orm"), currentTextureUnit - 1);
 		}
 
 		if (m_DisplacementMap && m_DisplacementMap->IsGenerated())
 		{
-			shader->SetUniform("hasDisplacement", true);
-			shader->SetUniform("minMaxDisplacementSteps", glm::vec2(m_ParallaxMinSteps, m_ParallaxMaxSteps));
-			shader->SetUniform("parallaxStrength", m_ParallaxStrength);
-			shader->SetUniform("material.texture_displacement", currentTextureUnit);
+			shader->SetUniform(ARC_UNIFORM("hasDisplacement"), true);
+			shader->SetUniform(ARC_UNIFORM("minMaxDisplacementSteps"), glm::vec2(m_ParallaxMinSteps, m_ParallaxMaxSteps));
+			shader->SetUniform(ARC_UNIFORM("parallaxStrength"), m_ParallaxStrength);
+			shader->SetUniform(ARC_UNIFORM("material.texture_displacement"), currentTextureUnit);
 			m_DisplacementMap->Bind(currentTextureUnit++);
 		}
 		else
 		{
-			shader->SetUniform("hasDisplacement", false);
+			shader->SetUniform(ARC_UNIFORM("hasDisplacement"), false);
 		}
 
 		if (m_EmissionMap && m_EmissionMap->IsGenerated())
 		{
-			shader->SetUniform("hasEmission", true);
-			shader->SetUniform("material.emissionIntensity", m_EmissionIntensity);
-			shader->SetUniform("material.hasEmissionTexture", true);
-			shader->SetUniform("material.texture_emission", currentTextureUnit);
+			shader->SetUniform(ARC_UNIFORM("hasEmission"), true);
+			shader->SetUniform(ARC_UNIFORM("material.emissionIntensity"), m_EmissionIntensity);
+			shader->SetUniform(ARC_UNIFORM("material.hasEmissionTexture"), true);
+			shader->SetUniform(ARC_UNIFORM("material.texture_emission"), currentTextureUnit);
 			m_EmissionMap->Bind(currentTextureUnit++);
 		}
 		else if (m_EmissionColour.r != 0.0f || m_EmissionColour.g != 0.0f || m_EmissionColour.b != 0.0f)
 		{
-			shader->SetUniform("hasEmission", true);
-			shader->SetUniform("material.emissionColour", m_EmissionColour);
-			shader->SetUniform("material.emissionIntensity", m_EmissionIntensity);
-			shader->SetUniform("material.hasEmissionTexture", false);
+			shader->SetUniform(ARC_UNIFORM("hasEmission"), true);
+			shader->SetUniform(ARC_UNIFORM("material.emissionColour"), m_EmissionColour);
+			shader->SetUniform(ARC_UNIFORM("material.emissionIntensity"), m_EmissionIntensity);
+			shader->SetUniform(ARC_UNIFORM("material.hasEmissionTexture"), false);
 		}
 		else
 		{
-			shader->SetUniform("hasEmission", false);
-			shader->SetUniform("material.hasEmissionTexture", false);
-			shader->SetUniform("material.emissionIntensity", 0.0f);
+			shader->SetUniform(ARC_UNIFORM("hasEmission"), false);
+			shader->SetUniform(ARC_UNIFORM("material.hasEmissionTexture"), false);
+			shader->SetUniform(ARC_UNIFORM("material.emissionIntensity"), 0.0f);
 		}
 	}
 }
@@ -6,6 +6,7 @@ namespace Arcane
 {
 	class Shader;
 	class Texture;
+	struct OrmTexture;
 
 	class Material {
 	public:
@@ -19,6 +20,7 @@ namespace Arcane
 		inline void SetMetallicMap(Texture *texture) { m_MetallicMap = texture; }
 		inline void SetRoughnessMap(Texture *texture) { m_RoughnessMap = texture; }
 		inline void SetAmbientOcclusionMap(Texture *texture) { m_AmbientOcclusionMap = texture; }
+		inline void SetOrmTexture(OrmTexture *texture) { m_OrmTexture = texture; } // Takes precedence over the separate metallic, roughness and AO maps
 		inline void SetDisplacementMap(Texture *texture) { m_DisplacementMap = texture; }
 		void SetEmissionMap(Texture *texture);
 
@@ -33,9 +35,11 @@ namespace Arcane
 
 		inline Texture* GetAlbedoMap() { return m_AlbedoMap; }
 		inline Texture* GetNormalMap() { return m_NormalMap; }
-		inline Texture* GetMetallicMap() { return m_MetallicMap; }
-		inline Texture* GetRoughnessMap() { return m_RoughnessMap; }
-		inline Texture* GetAmbientOcclusionMap() { return m_AmbientOcclusionMap; }
+		// With an ORM texture set these return its channel views
+		Texture* GetMetallicMap();
+		Texture* GetRoughnessMap();
+		Texture* GetAmbientOcclusionMap();
+		inline OrmTexture* GetOrmTexture() { return m_OrmTexture; }
 		inline Texture* GetDisplacementMap() { return m_DisplacementMap; }
 		inline Texture* GetEmissionMap() { return m_EmissionMap; }
 
@@ -50,6 +54,7 @@ namespace Arcane
 	private:
 		// Textures will be given precedence if provided over raw values
 		Texture *m_AlbedoMap = nullptr, *m_NormalMap = nullptr, *m_MetallicMap = nullptr, *m_RoughnessMap = nullptr, *m_AmbientOcclusionMap = nullptr, *m_DisplacementMap = nullptr, *m_EmissionMap = nullptr;
+		OrmTexture *m_OrmTexture = nullptr;
 		glm::vec4 m_AlbedoColour = glm::vec4(0.894f, 0.023f, 0.992f, 1.0f);
 		float m_MetallicValue = 0.0f, m_RoughnessValue = 0.0f;
 
@@ -6,16 +6,16 @@
 
 namespace Arcane
 {
-	Mesh::Mesh() : m_VAO(0), m_VBO(0), m_IBO(0) {}
+	Mesh::Mesh() : m_VAO(0), m_VBO(0), m_IBO(0), m_PositionVAO(0), m_PositionVBO(0), m_MeshletBuffer(0) {}
 
 	Mesh::Mesh(std::vector<glm::vec3>&& positions, std::vector<glm::vec2>&& uvs, std::vector<unsigned int>&& indices)
-		: m_Positions(std::move(positions)), m_UVs(std::move(uvs)), m_Normals(), m_Tangents(), m_Bitangents(), m_BoneData(), m_Indices(std::move(indices)) {}
+		: m_Positions(std::move(positions)), m_UVs(std::move(uvs)), m_Normals(), m_Tangents(), m_Bitangents(), m_BoneData(), m_Indices(std::move(indices)), m_PositionVAO(0), m_PositionVBO(0), m_MeshletBuffer(0) {}
 
 	Mesh::Mesh(std::vector<glm::vec3>&& positions, std::vector<glm::vec2>&& uvs, std::vector<glm::vec3>&& normals, std::vector<glm::vec3>&& tangents, std::vector<glm::vec3>&& bitangents, std::vector<unsigned int>&& indices)
-		: m_Positions(std::move(positions)), m_UVs(std::move(uvs)), m_Normals(std::move(normals)), m_Tangents(std::move(tangents)), m_Bitangents(std::move(bitangents)), m_BoneData(), m_Indices(std::move(indices)) {}
+		: m_Positions(std::move(positions)), m_UVs(std::move(uvs)), m_Normals(std::move(normals)), m_Tangents(std::move(tangents)), m_Bitangents(std::move(bitangents)), m_BoneData(), m_Indices(std::move(indices)), m_PositionVAO(0), m_PositionVBO(0), m_MeshletBuffer(0) {}
 
 	Mesh::Mesh(std::vector<glm::vec3> &&positions, std::vector<glm::vec2> &&uvs, std::vector<glm::vec3> &&normals, std::vector<glm::vec3> &&tangents, std::vector<glm::vec3> &&bitangents, std::vector<VertexBoneData> &&boneWeights, std::vector<unsigned int> &&indices)
-		: m_Positions(std::move(positions)), m_UVs(std::move(uvs)), m_Normals(std::move(normals)), m_Tangents(std::move(tangents)), m_Bitangents(std::move(bitangents)), m_BoneData(std::move(boneWeights)), m_Indices(std::move(indices)) {}
+		: m_Positions(std::move(positions)), m_UVs(std::move(uvs)), m_Normals(std::move(normals)), m_Tangents(std::move(tangents)), m_Bitangents(std::move(bitangents)), m_BoneData(std::move(boneWeights)), m_Indices(std::move(indices)), m_PositionVAO(0), m_PositionVBO(0), m_MeshletBuffer(0) {}
  
 
 	void Mesh::Draw() const
@@ -32,6 +32,67 @@ namespace Arcane
 		glBindVertexArray(0);
 	}
 
+	void Mesh::DrawPositionOnly() const
+	{
+		glBindVertexArray(m_PositionVAO);
+		if (m_Indices.size() > 0) {
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_Indices.size()), GL_UNSIGNED_INT, 0);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		}
+		else {
+			glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_Positions.size()));
+		}
+		glBindVertexArray(0);
+	}
+
+	void Mesh::DrawIndirect(const void *indirectCommandOffset) const
+	{
+		glBindVertexArray(m_VAO);
+		if (m_Indices.size() > 0) {
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+			glDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, indirectCommandOffset);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		}
+		else {
+			glDrawArraysIndirect(GL_TRIANGLES, indirectCommandOffset);
+		}
+		glBindVertexArray(0);
+	}
+
+	void Mesh::DrawMeshletsIndirect(const void *firstCommandOffset) const
+	{
+		glBindVertexArray(m_VAO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, firstCommandOffset, static_cast<GLsizei>(m_Meshlets.size()), 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		glBindVertexArray(0);
+	}
+
+	void Mesh::BuildMeshlets()
+	{
+		// Skinned meshes deform after culling would have happened, so their bounds and cones can't be trusted
+		if (!IsIndexed() || !m_BoneData.empty() || m_Indices.size() / 3 < MESHLET_MIN_TRIANGLE_COUNT)
+			return;
+
+		MeshletBuilder::Build(m_Positions, m_Indices, m_Meshlets);
+	}
+
+	AABB Mesh::ComputeBounds() const
+	{
+		AABB bounds;
+		if (m_Positions.empty())
+			return bounds;
+
+		bounds.Min = bounds.Max = m_Positions[0];
+		for (const glm::vec3 &position : m_Positions)
+		{
+			bounds.Min = glm::min(bounds.Min, position);
+			bounds.Max = glm::max(bounds.Max, position);
+		}
+		return bounds;
+	}
+
 	void Mesh::LoadData(bool interleaved)
 	{
 		// Check for possible mesh initialization errors
@@ -52,6 +113,8 @@ namespace Arcane
 				ARC_LOG_WARN("Mesh Bitangent count doesn't match the vertex count");
 			if (m_BoneData.size() != 0 && m_BoneData.size() != vertexCount)
 				ARC_LOG_WARN("Mesh Bone Data count doesn't match the vertex count");
+			if (m_LightmapUVs.size() != 0 && m_LightmapUVs.size() != vertexCount)
+				ARC_LOG_WARN("Mesh Lightmap UV count doesn't match the vertex count");
 		}
 #endif
 
@@ -71,9 +134,11 @@ namespace Arcane
 			m_BufferComponentCount += 3;
 		if (m_BoneData.size() > 0)
 			m_BufferComponentCount += (2 * MaxBonesPerVertex);
+		if (m_LightmapUVs.size() > 0)
+			m_BufferComponentCount += 2;
 
 		// Pre-process the mesh data in the format that was specified
-		m_BufferData.reserve((3 * m_Positions.size()) + (3 * m_Normals.size()) + (2 * m_UVs.size()) + (3 * m_Tangents.size()) + (3 * m_Bitangents.size()) + (m_BoneData.size() * 2 * MaxBonesPerVertex));
+		m_BufferData.reserve((3 * m_Positions.size()) + (3 * m_Normals.size()) + (2 * m_UVs.size()) + (3 * m_Tangents.size()) + (3 * m_Bitangents.size()) + (m_BoneData.size() * 2 * MaxBonesPerVertex) + (2 * m_LightmapUVs.size()));
 		if (interleaved)
 		{
 			for (unsigned int i = 0; i < m_Positions.size(); i++)
@@ -115,6 +180,11 @@ namespace Arcane
 						m_BufferData.push_back({ m_BoneData[i].Weights[j] });
 					}
 				}
+				if (m_LightmapUVs.size() > 0)
+				{
+					m_BufferData.push_back({ m_LightmapUVs[i].x });
+					m_BufferData.push_back({ m_LightmapUVs[i].y });
+				}
 			}
 		}
 		else
@@ -162,6 +232,31 @@ namespace Arcane
 					m_BufferData.push_back({ m_BoneData[i].Weights[j] });
 				}
 			}
+			for (unsigned int i = 0; i < m_LightmapUVs.size(); i++)
+			{
+				m_BufferData.push_back({ m_LightmapUVs[i].x });
+				m_BufferData.push_back({ m_LightmapUVs[i].y });
+			}
+		}
+
+		// Skinned depth passes still need the bones, so they get interleaved with the positions in the same layout as the full buffer
+		if (m_BoneData.size() > 0)
+		{
+			m_PositionBufferData.reserve(m_Positions.size() * (3 + 2 * MaxBonesPerVertex));
+			for (unsigned int i = 0; i < m_Positions.size(); i++)
+			{
+				m_PositionBufferData.push_back({ m_Positions[i].x });
+				m_PositionBufferData.push_back({ m_Positions[i].y });
+				m_PositionBufferData.push_back({ m_Positions[i].z });
+				for (int j = 0; j < MaxBonesPerVertex; j++)
+				{
+					m_PositionBufferData.push_back({ m_BoneData[i].BoneIDs[j] });
+				}
+				for (int j = 0; j < MaxBonesPerVertex; j++)
+				{
+					m_PositionBufferData.push_back({ m_BoneData[i].Weights[j] });
+				}
+			}
 		}
 	}
 
@@ -170,6 +265,8 @@ namespace Arcane
 		glGenVertexArrays(1, &m_VAO);
 		glGenBuffers(1, &m_VBO);
 		glGenBuffers(1, &m_IBO);
+		if (!m_Meshlets.empty())
+			glCreateBuffers(1, &m_MeshletBuffer);
 
 		// Load data into the index buffer and vertex buffer
 		glBindVertexArray(m_VAO);
@@ -180,6 +277,10 @@ namespace Arcane
 			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
 			glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Indices.size() * sizeof(unsigned int), &m_Indices[0], GL_STATIC_DRAW);
 		}
+		if (!m_Meshlets.empty())
+		{
+			glNamedBufferStorage(m_MeshletBuffer, m_Meshlets.size() * sizeof(Meshlet), &m_Meshlets[0], 0);
+		}
 
 		// Setup the format for the VAO
 		if (m_IsInterleaved)
@@ -224,6 +325,12 @@ namespace Arcane
 				glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(stride), (void*)offset);
 				offset += 4 * sizeof(float);
 			}
+			if (m_LightmapUVs.size() > 0)
+			{
+				glEnableVertexAttribArray(7);
+				glVertexAttribPointer(7, 2, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(stride), (void*)offset);
+				offset += 2 * sizeof(float);
+			}
 		}
 		else
 		{
@@ -266,8 +373,70 @@ namespace Arcane
 				glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, 0, (void*)offset);
 				offset += m_BoneData.size() * 4 * sizeof(float);
 			}
+			if (m_LightmapUVs.size() > 0)
+			{
+				glEnableVertexAttribArray(7);
+				glVertexAttribPointer(7, 2, GL_FLOAT, GL_FALSE, 0, (void*)offset);
+				offset += m_LightmapUVs.size() * 2 * sizeof(float);
+			}
 		}
 
 		glBindVertexArray(0);
+
+		// Position only stream, uses the same attribute locations so the depth shaders work with either VAO
+		glGenVertexArrays(1, &m_PositionVAO);
+		glGenBuffers(1, &m_PositionVBO);
+		glBindVertexArray(m_PositionVAO);
+		glBindBuffer(GL_ARRAY_BUFFER, m_PositionVBO);
+		if (m_BoneData.size() > 0)
+		{
+			size_t stride = (3 + 2 * MaxBonesPerVertex) * sizeof(float);
+			glBufferData(GL_ARRAY_BUFFER, m_PositionBufferData.size() * sizeof(float), &m_PositionBufferData[0], GL_STATIC_DRAW);
+
+			glEnableVertexAttribArray(0);
+			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(stride), (void*)0);
+			glEnableVertexAttribArray(5);
+			glVertexAttribIPointer(5, 4, GL_INT, static_cast<GLsizei>(stride), (void*)(3 * sizeof(float)));
+			glEnableVertexAttribArray(6);
+			glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(stride), (void*)(3 * sizeof(float) + 4 * sizeof(int)));
+		}
+		else
+		{
+			glBufferData(GL_ARRAY_BUFFER, m_Positions.size() * sizeof(glm::vec3), &m_Positions[0], GL_STATIC_DRAW);
+
+			glEnableVertexAttribArray(0);
+			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+		}
+		glBindVertexArray(0);
+	}
+
+	void Mesh::ReloadGpuData()
+	{
+		ReleaseGpuData();
+
+		m_BufferData.clear();
+		m_PositionBufferData.clear();
+		LoadData(m_IsInterleaved);
+		GenerateGpuData();
+	}
+
+	void Mesh::ReleaseGpuData()
+	{
+		if (m_VAO)
+		{
+			glDeleteVertexArrays(1, &m_VAO);
+			glDeleteBuffers(1, &m_VBO);
+			glDeleteBuffers(1, &m_IBO);
+			if (m_MeshletBuffer)
+				glDeleteBuffers(1, &m_MeshletBuffer);
+			glDeleteVertexArrays(1, &m_PositionVAO);
+			glDeleteBuffers(1, &m_PositionVBO);
+		}
+		m_VAO = 0;
+		m_VBO = 0;
+		m_IBO = 0;
+		m_PositionVAO = 0;
+		m_PositionVBO = 0;
+		m_MeshletBuffer = 0;
 	}
 }
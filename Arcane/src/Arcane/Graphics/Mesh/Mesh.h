@@ -10,12 +10,21 @@
 #include <Arcane/Animation/AnimationData.h>
 #endif
 
+#ifndef BATCHMATH_H
+#include <Arcane/Math/BatchMath.h>
+#endif
+
+#ifndef MESHLETBUILDER_H
+#include <Arcane/Graphics/Mesh/MeshletBuilder.h>
+#endif
+
 namespace Arcane
 {
 	class Mesh
 	{
 		friend class Model;
 		friend class AssetManager;
+		friend class LightmapUVGenerator;
 
 		// This works great for loading in different types of data into our vertex buffers. This will no longer be a valid strategy if we ever add a data type that isn't the same size
 		// When that happens we should rework how we are loading in data anyways, since it will be a nice memory and speed optimization anyways. For now, this will do!
@@ -34,12 +43,33 @@ namespace Arcane
 		
 		void LoadData(bool interleaved = true);
 		void GenerateGpuData(); // Commits all of the buffers and their attributes to the GPU driver
+		void ReloadGpuData(); // Rebuilds and recommits the buffers after the CPU side data was modified (ie: lightmap UVs were generated)
+		void ReleaseGpuData(); // Meshes get copied around so they never free their buffers on destruction, whoever owns the last copy has to call this
 
 		void Draw() const;
+		void DrawPositionOnly() const; // Only fetches positions (and bone data when skinned) from a tightly packed stream, for depth only passes
+		void DrawIndirect(const void *indirectCommandOffset) const; // Assumes the indirect command buffer is bound to GL_DRAW_INDIRECT_BUFFER
+		void DrawMeshletsIndirect(const void *firstCommandOffset) const; // One indexed indirect command per meshlet (see MeshletCuller), same assumption as DrawIndirect
+
+		void BuildMeshlets(); // Reorders the indices into clusters, has to happen before the GPU data is generated
+
+		AABB ComputeBounds() const; // Local space bounds of the CPU side positions
 
 		inline Material& GetMaterial() { return m_Material; }
+		inline bool IsIndexed() const { return !m_Indices.empty(); }
+		inline unsigned int GetIndexCount() const { return static_cast<unsigned int>(m_Indices.size()); }
+		inline unsigned int GetVertexCount() const { return static_cast<unsigned int>(m_Positions.size()); }
+		inline const std::vector<glm::vec3>& GetPositions() const { return m_Positions; }
+		inline const std::vector<unsigned int>& GetIndices() const { return m_Indices; }
+		inline const std::vector<glm::vec3>& GetNormals() const { return m_Normals; }
+		inline const std::vector<glm::vec2>& GetLightmapUVs() const { return m_LightmapUVs; }
+		inline bool HasLightmapUVs() const { return !m_LightmapUVs.empty(); }
+		inline bool HasMeshlets() const { return !m_Meshlets.empty(); }
+		inline unsigned int GetMeshletCount() const { return static_cast<unsigned int>(m_Meshlets.size()); }
+		inline unsigned int GetMeshletBuffer() const { return m_MeshletBuffer; }
 	protected:
 		unsigned int m_VAO, m_VBO, m_IBO;
+		unsigned int m_PositionVAO, m_PositionVBO; // Position only stream sharing m_IBO, interleaved with the bone data for skinned meshes
 		Material m_Material;
 
 		std::vector<glm::vec3> m_Positions;
@@ -48,10 +78,14 @@ namespace Arcane
 		std::vector<glm::vec3> m_Tangents;
 		std::vector<glm::vec3> m_Bitangents;
 		std::vector<VertexBoneData> m_BoneData;
+		std::vector<glm::vec2> m_LightmapUVs; // Unique, non-overlapping UVs across the whole model (see LightmapUVGenerator)
 
 		std::vector<unsigned int> m_Indices;
+		std::vector<Meshlet> m_Meshlets; // Empty unless the mesh was big enough to be clustered, each one covers a contiguous range of m_Indices
+		unsigned int m_MeshletBuffer; // Storage buffer with m_Meshlets for the culling shader
 
 		std::vector<BufferData> m_BufferData;
+		std::vector<BufferData> m_PositionBufferData; // Only filled for skinned meshes, otherwise m_Positions is uploaded as is
 		bool m_IsInterleaved;
 		unsigned int m_BufferComponentCount;
 	};
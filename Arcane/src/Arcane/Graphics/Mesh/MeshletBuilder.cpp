@@ -0,0 +1,157 @@
+#include "arcpch.h"
+#include "MeshletBuilder.h"
+
+#include <Arcane/Math/RadixSort.h>
+
+namespace Arcane
+{
+	// Spreads the low 10 bits out so there are two zero bits between each of them
+	static uint32_t SpreadBits10(uint32_t value)
+	{
+		value &= 0x3FF;
+		value = (value | (value << 16)) & 0x030000FF;
+		value = (value | (value << 8)) & 0x0300F00F;
+		value = (value | (value << 4)) & 0x030C30C3;
+		value = (value | (value << 2)) & 0x09249249;
+		return value;
+	}
+
+	static uint32_t MortonCode(const glm::vec3 &normalized)
+	{
+		glm::uvec3 quantized = glm::uvec3(glm::clamp(normalized, 0.0f, 1.0f) * 1023.0f);
+		return SpreadBits10(quantized.x) | (SpreadBits10(quantized.y) << 1) | (SpreadBits10(quantized.z) << 2);
+	}
+
+	void MeshletBuilder::Build(const std::vector<glm::vec3> &positions, std::vector<unsigned int> &inOutIndices, std::vector<Meshlet> &outMeshlets)
+	{
+		outMeshlets.clear();
+		size_t triangleCount = inOutIndices.size() / 3;
+		if (triangleCount == 0 || positions.empty())
+			return;
+
+		// Order the triangles along a Morton curve through the mesh's bounds so neighbouring triangles end up in the same cluster
+		glm::vec3 boundsMin = positions[0], boundsMax = positions[0];
+		for (const glm::vec3 &position : positions)
+		{
+			boundsMin = glm::min(boundsMin, position);
+			boundsMax = glm::max(boundsMax, position);
+		}
+		glm::vec3 inverseExtent = 1.0f / glm::max(boundsMax - boundsMin, glm::vec3(1e-6f));
+
+		std::vector<uint32_t> mortonCodes(triangleCount), triangleOrder(triangleCount), scratch(triangleCount);
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			const unsigned int *triangle = &inOutIndices[i * 3];
+			glm::vec3 centroid = (positions[triangle[0]] + positions[triangle[1]] + positions[triangle[2]]) / 3.0f;
+			mortonCodes[i] = MortonCode((centroid - boundsMin) * inverseExtent);
+		}
+		RadixSort::SortIndices(mortonCodes.data(), triangleOrder.data(), scratch.data(), triangleCount);
+
+		// Greedily fill clusters in that order, a vertex counts towards a cluster's limit if its stamp doesn't match the cluster being built
+		std::vector<uint32_t> vertexStamps(positions.size(), 0);
+		uint32_t currentStamp = 1;
+		auto countNewVertices = [&](const unsigned int *triangle) -> uint32_t
+		{
+			return (vertexStamps[triangle[0]] != currentStamp) + (vertexStamps[triangle[1]] != currentStamp) + (vertexStamps[triangle[2]] != currentStamp);
+		};
+
+		std::vector<unsigned int> clusteredIndices;
+		clusteredIndices.reserve(triangleCount * 3);
+		Meshlet current = {};
+		uint32_t currentVertexCount = 0, currentTriangleCount = 0;
+		for (size_t i = 0; i < triangleCount; i++)
+		{
+			const unsigned int *triangle = &inOutIndices[triangleOrder[i] * 3];
+			if (currentTriangleCount == MESHLET_MAX_TRIANGLES || currentVertexCount + countNewVertices(triangle) > MESHLET_MAX_VERTICES)
+			{
+				current.IndexCount = currentTriangleCount * 3;
+				ComputeBounds(positions, &clusteredIndices[current.FirstIndex], current);
+				outMeshlets.push_back(current);
+
+				current = {};
+				current.FirstIndex = static_cast<uint32_t>(clusteredIndices.size());
+				currentVertexCount = currentTriangleCount = 0;
+				currentStamp++;
+			}
+
+			for (int j = 0; j < 3; j++)
+			{
+				if (vertexStamps[triangle[j]] != currentStamp)
+				{
+					vertexStamps[triangle[j]] = currentStamp;
+					currentVertexCount++;
+				}
+				clusteredIndices.push_back(triangle[j]);
+			}
+			currentTriangleCount++;
+		}
+
+		current.IndexCount = currentTriangleCount * 3;
+		ComputeBounds(positions, &clusteredIndices[current.FirstIndex], current);
+		outMeshlets.push_back(current);
+
+		inOutIndices.swap(clusteredIndices);
+	}
+
+	void MeshletBuilder::ComputeBounds(const std::vector<glm::vec3> &positions, const unsigned int *indices, Meshlet &meshlet)
+	{
+		// Bounding sphere around the centre of the cluster's AABB
+		glm::vec3 clusterMin = positions[indices[0]], clusterMax = positions[indices[0]];
+		for (uint32_t i = 1; i < meshlet.IndexCount; i++)
+		{
+			clusterMin = glm::min(clusterMin, positions[indices[i]]);
+			clusterMax = glm::max(clusterMax, positions[indices[i]]);
+		}
+		glm::vec3 centre = (clusterMin + clusterMax) * 0.5f;
+		float radiusSquared = 0.0f;
+		for (uint32_t i = 0; i < meshlet.IndexCount; i++)
+			radiusSquared = glm::max(radiusSquared, glm::length2(positions[indices[i]] - centre));
+		meshlet.BoundingSphere = glm::vec4(centre, glm::sqrt(radiusSquared));
+
+		// No cone by default, a cutoff above 1 can never pass the culling test
+		meshlet.ConeAxisAndCutoff = glm::vec4(0.0f, 0.0f, 0.0f, 2.0f);
+		meshlet.ConeApex = glm::vec4(centre, 0.0f);
+
+		// Cone axis is the average of the face normals (counter-clockwise winding is front facing), degenerate triangles don't get a say
+		uint32_t triangleCount = meshlet.IndexCount / 3;
+		glm::vec3 normals[MESHLET_MAX_TRIANGLES];
+		glm::vec3 axis = glm::vec3(0.0f);
+		for (uint32_t t = 0; t < triangleCount; t++)
+		{
+			const glm::vec3 &p0 = positions[indices[t * 3]];
+			glm::vec3 normal = glm::cross(positions[indices[t * 3 + 1]] - p0, positions[indices[t * 3 + 2]] - p0);
+			float area = glm::length(normal);
+			normals[t] = area > 1e-12f ? normal / area : glm::vec3(0.0f);
+			axis += normals[t];
+		}
+		float axisLength = glm::length(axis);
+		if (axisLength < 1e-6f)
+			return;
+		axis /= axisLength;
+
+		float minDot = 1.0f;
+		for (uint32_t t = 0; t < triangleCount; t++)
+		{
+			if (normals[t] != glm::vec3(0.0f))
+				minDot = glm::min(minDot, glm::dot(normals[t], axis));
+		}
+		// The cone would be close to (or wider than) a hemisphere, the cluster is basically never entirely backfacing
+		if (minDot <= 0.1f)
+			return;
+
+		// Pull the apex back along the axis until every triangle's plane is in front of it, then a camera outside of the cone sees every triangle from behind
+		float maxT = 0.0f;
+		for (uint32_t t = 0; t < triangleCount; t++)
+		{
+			if (normals[t] == glm::vec3(0.0f))
+				continue;
+
+			float planeDistance = glm::dot(centre - positions[indices[t * 3]], normals[t]);
+			float t0 = planeDistance / glm::dot(axis, normals[t]);
+			maxT = glm::max(maxT, t0);
+		}
+
+		meshlet.ConeApex = glm::vec4(centre - axis * maxT, 0.0f);
+		meshlet.ConeAxisAndCutoff = glm::vec4(axis, glm::sqrt(1.0f - minDot * minDot));
+	}
+}
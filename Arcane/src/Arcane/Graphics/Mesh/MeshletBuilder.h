@@ -0,0 +1,33 @@
+#pragma once
+#ifndef MESHLETBUILDER_H
+#define MESHLETBUILDER_H
+
+namespace Arcane
+{
+	// Matches the Meshlet struct in MeshletCull.glsl. Everything is in mesh space
+	struct Meshlet
+	{
+		glm::vec4 BoundingSphere; // xyz = centre, w = radius
+		glm::vec4 ConeAxisAndCutoff; // xyz = axis the triangles face, w = cos of the cone's cutoff. Above 1 when the triangles face too many ways for the cluster to ever be backfacing
+		glm::vec4 ConeApex; // w unused
+		uint32_t FirstIndex; // Into the mesh's (reordered) index buffer
+		uint32_t IndexCount;
+		uint32_t Padding[2];
+	};
+
+	/*
+		Splits an indexed triangle mesh into small clusters (meshlets) that can be culled on their own on the GPU. Triangles are ordered along a Morton curve
+		of their centroids and then greedily packed into clusters of up to MESHLET_MAX_VERTICES unique vertices and MESHLET_MAX_TRIANGLES triangles, this keeps
+		clusters spatially tight even for meshes that don't share vertices between triangles.
+		Each cluster gets a bounding sphere for frustum culling and a normal cone (apex + axis + cutoff) for backface culling the whole cluster at once
+	*/
+	class MeshletBuilder
+	{
+	public:
+		// Reorders the indices so every meshlet's triangles are contiguous, the set of triangles (and their winding) is unchanged so the mesh draws the same
+		static void Build(const std::vector<glm::vec3> &positions, std::vector<unsigned int> &inOutIndices, std::vector<Meshlet> &outMeshlets);
+	private:
+		static void ComputeBounds(const std::vector<glm::vec3> &positions, const unsigned int *indices, Meshlet &meshlet);
+	};
+}
+#endif
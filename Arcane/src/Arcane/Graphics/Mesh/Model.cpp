@@ -2,7 +2,10 @@
 #include "Model.h"
 
 #include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Renderer/MeshletCuller.h>
 #include <Arcane/Util/Loaders/AssetManager.h>
+#include <Arcane/Util/Loaders/AssimpIOSystem.h>
+#include <Arcane/Util/Loaders/CookedAsset.h>
 #include <Arcane/Animation/AnimationData.h>
 #include <assimp/scene.h>
 #include <assimp/Importer.hpp>
@@ -10,17 +13,86 @@
 
 namespace Arcane
 {
-	Model::Model() : m_BoneCount(0)
+	// Remembers every file Assimp opens while importing (.mtl, .bin etc) so the baker knows when a cooked model needs rebuilding
+	class RecordingAssimpIOSystem : public AssimpIOSystem
+	{
+	public:
+		RecordingAssimpIOSystem(std::vector<std::string> &outPaths) : m_Paths(outPaths) {}
+
+		virtual Assimp::IOStream* Open(const char *path, const char *mode = "rb") override
+		{
+			Assimp::IOStream *stream = AssimpIOSystem::Open(path, mode);
+			if (stream && std::find(m_Paths.begin(), m_Paths.end(), path) == m_Paths.end())
+				m_Paths.push_back(path);
+			return stream;
+		}
+	private:
+		std::vector<std::string> &m_Paths;
+	};
+
+	template<typename T>
+	static void WriteCookedArray(std::ostream &stream, const std::vector<T> &values)
+	{
+		uint32_t count = static_cast<uint32_t>(values.size());
+		stream.write(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+		stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+	}
+
+	static void WriteCookedString(std::ostream &stream, const std::string &str)
+	{
+		uint32_t length = static_cast<uint32_t>(str.size());
+		stream.write(reinterpret_cast<const char*>(&length), sizeof(uint32_t));
+		stream.write(str.data(), str.size());
+	}
+
+	// Bounds checked reads straight out of the cooked file's memory
+	struct CookedModelReader
+	{
+		const unsigned char *Data;
+		size_t Size;
+		size_t Offset;
+
+		bool Read(void *out, size_t byteCount)
+		{
+			if (Size - Offset < byteCount)
+				return false;
+			memcpy(out, Data + Offset, byteCount);
+			Offset += byteCount;
+			return true;
+		}
+
+		template<typename T>
+		bool ReadArray(std::vector<T> &outValues)
+		{
+			uint32_t count;
+			if (!Read(&count, sizeof(uint32_t)) || (Size - Offset) / sizeof(T) < count)
+				return false;
+			outValues.resize(count);
+			return Read(outValues.data(), count * sizeof(T));
+		}
+
+		bool ReadString(std::string &outStr)
+		{
+			uint32_t length;
+			if (!Read(&length, sizeof(uint32_t)) || Size - Offset < length)
+				return false;
+			outStr.assign(reinterpret_cast<const char*>(Data + Offset), length);
+			Offset += length;
+			return true;
+		}
+	};
+
+	Model::Model() : m_BoneCount(0), m_IsLoaded(false)
 	{
 		m_Meshes.resize(0);
 	}
 
-	Model::Model(const Mesh &mesh) : m_BoneCount(0)
+	Model::Model(const Mesh &mesh) : m_BoneCount(0), m_IsLoaded(true)
 	{
 		m_Meshes.push_back(mesh);
 	}
 
-	Model::Model(const std::vector<Mesh> &meshes) : m_BoneCount(0)
+	Model::Model(const std::vector<Mesh> &meshes) : m_BoneCount(0), m_IsLoaded(true)
 	{
 		m_Meshes = meshes;
 	}
@@ -32,25 +104,91 @@ namespace Arcane
 			if (pass == MaterialRequired) {
 				m_Meshes[i].m_Material.BindMaterialInformation(shader);
 			}
-			m_Meshes[i].Draw();
+			if (pass == DepthOnly) {
+				m_Meshes[i].DrawPositionOnly();
+			}
+			else {
+				m_Meshes[i].Draw();
+			}
+		}
+	}
+
+	void Model::Draw(Shader *shader, RenderPassType pass, int meshletCommandIndex) const
+	{
+		// Meshes with meshlets take up consecutive commands in the culled command buffer, in mesh order
+		for (unsigned int i = 0; i < m_Meshes.size(); ++i) {
+			if (pass == MaterialRequired) {
+				m_Meshes[i].m_Material.BindMaterialInformation(shader);
+			}
+			if (meshletCommandIndex >= 0 && m_Meshes[i].HasMeshlets()) {
+				m_Meshes[i].DrawMeshletsIndirect(reinterpret_cast<const void*>(sizeof(MeshletDrawCommand) * meshletCommandIndex));
+				meshletCommandIndex += m_Meshes[i].GetMeshletCount();
+			}
+			else if (pass == DepthOnly) {
+				m_Meshes[i].DrawPositionOnly();
+			}
+			else {
+				m_Meshes[i].Draw();
+			}
+		}
+	}
+
+	AABB Model::ComputeBounds() const
+	{
+		AABB bounds;
+		bool hasBounds = false;
+		for (const Mesh &mesh : m_Meshes)
+		{
+			if (mesh.m_Positions.empty())
+				continue;
+
+			AABB meshBounds = mesh.ComputeBounds();
+			bounds.Min = hasBounds ? glm::min(bounds.Min, meshBounds.Min) : meshBounds.Min;
+			bounds.Max = hasBounds ? glm::max(bounds.Max, meshBounds.Max) : meshBounds.Max;
+			hasBounds = true;
 		}
+
+		return bounds;
+	}
+
+	unsigned int Model::GetMeshletCount() const
+	{
+		unsigned int meshletCount = 0;
+		for (const Mesh &mesh : m_Meshes)
+			meshletCount += mesh.GetMeshletCount();
+		return meshletCount;
 	}
 
 	void Model::LoadModel(const std::string &path)
+	{
+#if USE_COOKED_ASSETS
+		if (!LoadCooked(path))
+#endif
+		{
+			if (!ImportModel(path, new AssimpIOSystem()))
+				return;
+		}
+
+		LoadMaterialTextures();
+	}
+
+	bool Model::ImportModel(const std::string &path, Assimp::IOSystem *ioSystem)
 	{
 		Assimp::Importer import;
+		import.SetIOHandler(ioSystem);
 		const aiScene *scene = import.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
 
 		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
 		{
 			ARC_LOG_ERROR("failed to load model - {0}", import.GetErrorString());
-			return;
+			return false;
 		}
 
 		m_Directory = path.substr(0, path.find_last_of('/'));
 		m_Name = path.substr(path.find_last_of("/\\") + 1);
 
 		ProcessNode(scene->mRootNode, scene);
+		return true;
 	}
 
 	void Model::GenerateGpuData()
@@ -61,6 +199,14 @@ namespace Arcane
 		}
 	}
 
+	void Model::ReleaseGpuData()
+	{
+		for (int i = 0; i < m_Meshes.size(); i++)
+		{
+			m_Meshes[i].ReleaseGpuData();
+		}
+	}
+
 	void Model::ProcessNode(aiNode *node, const aiScene *scene)
 	{
 		// Process all of the node's meshes (if any)
@@ -134,7 +280,7 @@ namespace Arcane
 			aiBone *bone = mesh->mBones[boneIndex];
 
 			// Get the bone name and if it doesn't exist let's add it to the bone array along with its matrix
-			std::string boneName = bone->mName.C_Str();
+			StringId boneName(bone->mName.C_Str(), bone->mName.length);
 			auto iter = m_BoneDataMap.find(boneName);
 			if (iter == m_BoneDataMap.end())
 			{
@@ -216,44 +362,245 @@ namespace Arcane
 		}
 
 		Mesh newMesh(std::move(positions), std::move(uvs), std::move(normals), std::move(tangents), std::move(bitangents), std::move(boneWeights), std::move(indices));
+		newMesh.BuildMeshlets();
 		newMesh.LoadData();
 
-		// Process Materials (textures in this case)
+		// Process Materials (textures in this case), they get loaded once the whole model has been processed
+		MaterialTexturePaths texturePaths;
 		if (mesh->mMaterialIndex >= 0)
 		{
 			aiMaterial *material = scene->mMaterials[mesh->mMaterialIndex];
 
-			// Attempt to load the materials if they can be found. However PBR materials will need to be manually configured since Assimp doesn't support them
-			// Only colour data for the renderer is considered sRGB, all other type of non-colour texture data shouldn't be corrected by the hardware
-			newMesh.m_Material.SetAlbedoMap(LoadMaterialTexture(material, aiTextureType_DIFFUSE, true));
-			newMesh.m_Material.SetNormalMap(LoadMaterialTexture(material, aiTextureType_NORMALS, false));
-			newMesh.m_Material.SetAmbientOcclusionMap(LoadMaterialTexture(material, aiTextureType_AMBIENT, false));
-			newMesh.m_Material.SetDisplacementMap(LoadMaterialTexture(material, aiTextureType_DISPLACEMENT, false));
+			texturePaths.Albedo = GetMaterialTexturePath(material, aiTextureType_DIFFUSE);
+			texturePaths.Normal = GetMaterialTexturePath(material, aiTextureType_NORMALS);
+			texturePaths.AmbientOcclusion = GetMaterialTexturePath(material, aiTextureType_AMBIENT);
+			texturePaths.Roughness = GetMaterialTexturePath(material, aiTextureType_DIFFUSE_ROUGHNESS);
+			texturePaths.Metallic = GetMaterialTexturePath(material, aiTextureType_METALNESS);
+			texturePaths.Displacement = GetMaterialTexturePath(material, aiTextureType_DISPLACEMENT);
 		}
 
 		m_Meshes.emplace_back(newMesh);
+		m_MaterialTexturePaths.push_back(texturePaths);
 	}
 
-	Texture* Model::LoadMaterialTexture(aiMaterial *mat, aiTextureType type, bool isSRGB)
+	std::string Model::GetMaterialTexturePath(aiMaterial *mat, aiTextureType type)
 	{
 		// Log material constraints are being violated (1 texture per type for the standard shader)
 		if (mat->GetTextureCount(type) > 1)
 			ARC_LOG_WARN("Mesh's default material contains more than 1 texture for the same type, which isn't currently supported by the standard shaders");
 
-		// Load the texture of a certain type, assuming there is one
 		if (mat->GetTextureCount(type) > 0)
 		{
 			aiString str;
 			mat->GetTexture(type, 0, &str); // Grab only the first texture (standard shader only supports one texture of each type, it doesn't know how you want to do special blending)
+			return std::string(str.C_Str());
+		}
+
+		return std::string();
+	}
+
+	void Model::LoadMaterialTextures()
+	{
+		for (size_t i = 0; i < m_Meshes.size() && i < m_MaterialTexturePaths.size(); i++)
+		{
+			Material &material = m_Meshes[i].m_Material;
+			const MaterialTexturePaths &texturePaths = m_MaterialTexturePaths[i];
+
+			// Attempt to load the materials if they can be found. Roughness and metallic maps are only found in formats with PBR materials (ie: glTF), others will need to be manually configured
+			// Only colour data for the renderer is considered sRGB, all other type of non-colour texture data shouldn't be corrected by the hardware
+			material.SetAlbedoMap(LoadMaterialTexture(texturePaths.Albedo, true));
+			material.SetNormalMap(LoadMaterialTexture(texturePaths.Normal, false, true));
+			material.SetDisplacementMap(LoadMaterialTexture(texturePaths.Displacement, false));
+
+			// Packing only pays off once a material has more than one of the maps
+			int ormMapCount = !texturePaths.AmbientOcclusion.empty() + !texturePaths.Roughness.empty() + !texturePaths.Metallic.empty();
+			if (ormMapCount > 1)
+			{
+				material.SetOrmTexture(LoadMaterialOrmTexture(texturePaths.AmbientOcclusion, texturePaths.Roughness, texturePaths.Metallic));
+			}
+			else
+			{
+				material.SetAmbientOcclusionMap(LoadMaterialTexture(texturePaths.AmbientOcclusion, false));
+				material.SetRoughnessMap(LoadMaterialTexture(texturePaths.Roughness, false));
+				material.SetMetallicMap(LoadMaterialTexture(texturePaths.Metallic, false));
+			}
+		}
+	}
+
+	Texture* Model::LoadMaterialTexture(const std::string &relativePath, bool isSRGB, bool isNormalMap)
+	{
+		if (relativePath.empty())
+			return nullptr;
+
+		// Assumption made: material stuff is located in the same directory as the model object
+		std::string fileToSearch = m_Directory + "/" + relativePath;
+
+		TextureSettings textureSettings;
+		textureSettings.IsSRGB = isSRGB;
+		textureSettings.IsNormalMap = isNormalMap;
+		return AssetManager::GetInstance().Load2DTextureAsync(fileToSearch, &textureSettings);
+	}
+
+	OrmTexture* Model::LoadMaterialOrmTexture(const std::string &relativeOcclusionPath, const std::string &relativeRoughnessPath, const std::string &relativeMetallicPath)
+	{
+		// Missing maps stay empty so the packer knows to fill in their channel
+		auto toPath = [this](const std::string &relativePath) { return relativePath.empty() ? relativePath : m_Directory + "/" + relativePath; };
+		return AssetManager::GetInstance().LoadOrmTextureAsync(toPath(relativeOcclusionPath), toPath(relativeRoughnessPath), toPath(relativeMetallicPath));
+	}
+
+	void Model::ReleaseMaterialTextures()
+	{
+		AssetManager &assetManager = AssetManager::GetInstance();
+		auto toPath = [this](const std::string &relativePath) { return relativePath.empty() ? relativePath : m_Directory + "/" + relativePath; };
+		auto releaseTexture = [&](const std::string &relativePath)
+		{
+			if (!relativePath.empty())
+				assetManager.ReleaseTexture(toPath(relativePath));
+		};
+
+		for (size_t i = 0; i < m_Meshes.size() && i < m_MaterialTexturePaths.size(); i++)
+		{
+			const MaterialTexturePaths &texturePaths = m_MaterialTexturePaths[i];
+			releaseTexture(texturePaths.Albedo);
+			releaseTexture(texturePaths.Normal);
+			releaseTexture(texturePaths.Displacement);
+
+			int ormMapCount = !texturePaths.AmbientOcclusion.empty() + !texturePaths.Roughness.empty() + !texturePaths.Metallic.empty();
+			if (ormMapCount > 1)
+			{
+				assetManager.ReleaseOrmTexture(toPath(texturePaths.AmbientOcclusion), toPath(texturePaths.Roughness), toPath(texturePaths.Metallic));
+			}
+			else
+			{
+				releaseTexture(texturePaths.AmbientOcclusion);
+				releaseTexture(texturePaths.Roughness);
+				releaseTexture(texturePaths.Metallic);
+			}
+		}
+	}
+
+	bool Model::Cook(const std::string &sourcePath, const std::string &cookedPath, uint64_t sourceHash, std::vector<std::string> &outDependencies)
+	{
+		Model model;
+		if (!model.ImportModel(sourcePath, new RecordingAssimpIOSystem(outDependencies)))
+			return false;
+
+		return model.SaveCooked(cookedPath, sourceHash);
+	}
+
+	bool Model::SaveCooked(const std::string &cookedPath, uint64_t sourceHash) const
+	{
+		std::ofstream ofs(cookedPath, std::ios::out | std::ios::binary);
+		if (!ofs)
+		{
+			ARC_LOG_ERROR("Failed to open cooked model for writing - {0}", cookedPath);
+			return false;
+		}
 
-			// Assumption made: material stuff is located in the same directory as the model object
-			std::string fileToSearch = (m_Directory + "/" + std::string(str.C_Str())).c_str();
+		CookedAsset::WriteHeader(ofs, CookedAsset::ModelMagic, CookedAsset::ModelVersion, sourceHash);
+		ofs.write(reinterpret_cast<const char*>(&m_GlobalInverseTransform), sizeof(glm::mat4));
+
+		// Bones are stored by their hashed name, so cooked models don't intern the bone names for debugging
+		uint32_t boneCount = static_cast<uint32_t>(m_BoneCount);
+		uint32_t boneMapCount = static_cast<uint32_t>(m_BoneDataMap.size());
+		ofs.write(reinterpret_cast<const char*>(&boneCount), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&boneMapCount), sizeof(uint32_t));
+		for (const auto &bone : m_BoneDataMap)
+		{
+			uint32_t boneNameHash = bone.first.GetHash();
+			int32_t boneID = bone.second.boneID;
+			ofs.write(reinterpret_cast<const char*>(&boneNameHash), sizeof(uint32_t));
+			ofs.write(reinterpret_cast<const char*>(&boneID), sizeof(int32_t));
+			ofs.write(reinterpret_cast<const char*>(&bone.second.inverseBindPose), sizeof(glm::mat4));
+		}
 
-			TextureSettings textureSettings;
-			textureSettings.IsSRGB = isSRGB;
-			return AssetManager::GetInstance().Load2DTextureAsync(fileToSearch, &textureSettings);
+		uint32_t meshCount = static_cast<uint32_t>(m_Meshes.size());
+		ofs.write(reinterpret_cast<const char*>(&meshCount), sizeof(uint32_t));
+		for (uint32_t i = 0; i < meshCount; i++)
+		{
+			const Mesh &mesh = m_Meshes[i];
+			WriteCookedArray(ofs, mesh.m_Positions);
+			WriteCookedArray(ofs, mesh.m_UVs);
+			WriteCookedArray(ofs, mesh.m_Normals);
+			WriteCookedArray(ofs, mesh.m_Tangents);
+			WriteCookedArray(ofs, mesh.m_Bitangents);
+			WriteCookedArray(ofs, mesh.m_BoneData);
+			WriteCookedArray(ofs, mesh.m_Indices);
+			WriteCookedArray(ofs, mesh.m_Meshlets);
+
+			const MaterialTexturePaths &texturePaths = m_MaterialTexturePaths[i];
+			WriteCookedString(ofs, texturePaths.Albedo);
+			WriteCookedString(ofs, texturePaths.Normal);
+			WriteCookedString(ofs, texturePaths.AmbientOcclusion);
+			WriteCookedString(ofs, texturePaths.Roughness);
+			WriteCookedString(ofs, texturePaths.Metallic);
+			WriteCookedString(ofs, texturePaths.Displacement);
 		}
 
-		return nullptr;
+		return ofs.good();
+	}
+
+	bool Model::LoadCooked(const std::string &path)
+	{
+		VirtualFile file = CookedAsset::Open(path, CookedAsset::ModelExtension, CookedAsset::ModelMagic, CookedAsset::ModelVersion);
+		if (!file.IsValid())
+			return false;
+
+		CookedModelReader reader = { file.GetData(), file.GetSize(), sizeof(CookedAssetHeader) };
+		glm::mat4 globalInverseTransform;
+		uint32_t boneCount, boneMapCount;
+		bool valid = reader.Read(&globalInverseTransform, sizeof(glm::mat4)) && reader.Read(&boneCount, sizeof(uint32_t)) && reader.Read(&boneMapCount, sizeof(uint32_t));
+
+		std::unordered_map<StringId, BoneData> boneDataMap;
+		for (uint32_t i = 0; i < boneMapCount && valid; i++)
+		{
+			uint32_t boneNameHash;
+			int32_t boneID;
+			BoneData boneData;
+			valid = reader.Read(&boneNameHash, sizeof(uint32_t)) && reader.Read(&boneID, sizeof(int32_t)) && reader.Read(&boneData.inverseBindPose, sizeof(glm::mat4));
+			boneData.boneID = boneID;
+			boneDataMap[StringId(boneNameHash)] = boneData;
+		}
+
+		uint32_t meshCount = 0;
+		valid = valid && reader.Read(&meshCount, sizeof(uint32_t));
+
+		std::vector<Mesh> meshes;
+		std::vector<MaterialTexturePaths> materialTexturePaths;
+		for (uint32_t i = 0; i < meshCount && valid; i++)
+		{
+			std::vector<glm::vec3> positions, normals, tangents, bitangents;
+			std::vector<glm::vec2> uvs;
+			std::vector<VertexBoneData> boneWeights;
+			std::vector<unsigned int> indices;
+			std::vector<Meshlet> meshlets;
+			MaterialTexturePaths texturePaths;
+			valid = reader.ReadArray(positions) && reader.ReadArray(uvs) && reader.ReadArray(normals) && reader.ReadArray(tangents) && reader.ReadArray(bitangents) &&
+				reader.ReadArray(boneWeights) && reader.ReadArray(indices) && reader.ReadArray(meshlets) &&
+				reader.ReadString(texturePaths.Albedo) && reader.ReadString(texturePaths.Normal) && reader.ReadString(texturePaths.AmbientOcclusion) &&
+				reader.ReadString(texturePaths.Roughness) && reader.ReadString(texturePaths.Metallic) && reader.ReadString(texturePaths.Displacement);
+			if (!valid)
+				break;
+
+			meshes.emplace_back(std::move(positions), std::move(uvs), std::move(normals), std::move(tangents), std::move(bitangents), std::move(boneWeights), std::move(indices));
+			meshes.back().m_Meshlets = std::move(meshlets); // The indices were already reordered when cooking
+			meshes.back().LoadData();
+			materialTexturePaths.push_back(std::move(texturePaths));
+		}
+
+		if (!valid)
+		{
+			ARC_LOG_ERROR("Corrupt cooked model for - {0}", path);
+			return false;
+		}
+
+		m_Directory = path.substr(0, path.find_last_of('/'));
+		m_Name = path.substr(path.find_last_of("/\\") + 1);
+		m_GlobalInverseTransform = globalInverseTransform;
+		m_BoneCount = static_cast<int>(boneCount);
+		m_BoneDataMap = std::move(boneDataMap);
+		m_Meshes = std::move(meshes);
+		m_MaterialTexturePaths = std::move(materialTexturePaths);
+		return true;
 	}
 }
@@ -6,6 +6,10 @@
 #include <Arcane/Graphics/Mesh/Mesh.h>
 #endif
 
+#ifndef STRINGID_H
+#include <Arcane/Util/StringId.h>
+#endif
+
 #ifndef RENDERPASSTYPE_H
 #include <Arcane/Graphics/Renderer/Renderpass/RenderPassType.h>
 #endif
@@ -18,20 +22,31 @@ struct aiMaterial;
 struct aiNode;
 struct aiMesh;
 
+namespace Assimp
+{
+	class IOSystem;
+}
+
 namespace Arcane
 {
 	class Shader;
 
 	class Model {
 		friend class AssetManager;
+		friend class AssetBaker;
 	public:
 		Model();
 		Model(const Mesh &mesh);
 		Model(const std::vector<Mesh> &meshes);
 		
 		void Draw(Shader *shader, RenderPassType pass) const;
+		void Draw(Shader *shader, RenderPassType pass, int meshletCommandIndex) const; // Draws meshes with meshlets from the culled commands starting at this index (see MeshletCuller::CullModel), -1 draws everything whole
+		unsigned int GetMeshletCount() const;
+
+		AABB ComputeBounds() const; // Local space bounds enclosing every mesh
 
 		inline std::vector<Mesh>& GetMeshes() { return m_Meshes; }
+		inline bool IsLoaded() const { return m_IsLoaded; } // Async loads fill in the meshes on a worker thread, nothing should touch them before this is set (on the main thread, once the GPU data exists)
 
 		inline const std::string& GetName() const { return m_Name; }
 		inline std::string& GetNameRef() { return m_Name; }
@@ -48,15 +63,33 @@ namespace Arcane
 	private:
 		void LoadModel(const std::string &path);
 		void GenerateGpuData();
+		void ReleaseGpuData();
 
+		bool ImportModel(const std::string &path, Assimp::IOSystem *ioSystem); // Importer takes ownership of the IO system
 		void ProcessNode(aiNode *node, const aiScene *scene);
 		void ProcessMesh(aiMesh *mesh, const aiScene *scene);
-		Texture* LoadMaterialTexture(aiMaterial *mat, aiTextureType type, bool isSRGB);
+		std::string GetMaterialTexturePath(aiMaterial *mat, aiTextureType type);
+		void LoadMaterialTextures();
+		Texture* LoadMaterialTexture(const std::string &relativePath, bool isSRGB, bool isNormalMap = false);
+		OrmTexture* LoadMaterialOrmTexture(const std::string &relativeOcclusionPath, const std::string &relativeRoughnessPath, const std::string &relativeMetallicPath);
+		void ReleaseMaterialTextures(); // Gives back the texture references LoadMaterialTextures took, must mirror it exactly
+
+		// Cooked models store the imported meshes (tangents already generated) and bones, loading them skips Assimp entirely. Textures are cooked on their own
+		static bool Cook(const std::string &sourcePath, const std::string &cookedPath, uint64_t sourceHash, std::vector<std::string> &outDependencies);
+		bool SaveCooked(const std::string &cookedPath, uint64_t sourceHash) const;
+		bool LoadCooked(const std::string &path);
 	private:
+		struct MaterialTexturePaths
+		{
+			std::string Albedo, Normal, AmbientOcclusion, Roughness, Metallic, Displacement; // Relative to m_Directory, empty if the material has no texture of that type
+		};
+
 		std::vector<Mesh> m_Meshes;
-		std::unordered_map<std::string, BoneData> m_BoneDataMap;
+		std::vector<MaterialTexturePaths> m_MaterialTexturePaths; // One per mesh
+		std::unordered_map<StringId, BoneData> m_BoneDataMap; // Keyed by the hashed bone name
 		glm::mat4 m_GlobalInverseTransform; // Used by animation for bone related data to move it back to the origin
 		int m_BoneCount;
+		bool m_IsLoaded;
 
 		std::string m_Directory;
 		std::string m_Name;
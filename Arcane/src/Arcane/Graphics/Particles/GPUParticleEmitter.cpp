@@ -0,0 +1,174 @@
+#include "arcpch.h"
+#include "GPUParticleEmitter.h"
+
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Scene/Components.h>
+
+namespace Arcane
+{
+	// Must match the bindings in the particle shaders
+	enum ParticleBufferBinding : GLuint
+	{
+		ParticleBufferBinding_Particles = 0,
+		ParticleBufferBinding_CurrentAlive = 1,
+		ParticleBufferBinding_NextAlive = 2,
+		ParticleBufferBinding_Dead = 3,
+		ParticleBufferBinding_Counters = 4,
+		ParticleBufferBinding_IndirectArgs = 5,
+		ParticleBufferBinding_Sort = 6
+	};
+
+	static const uint32_t s_ParticleThreadGroupSize = 256; // Must match local_size_x in the particle compute shaders
+
+	GPUParticleEmitter::GPUParticleEmitter(uint32_t maxParticles) : m_MaxParticles(std::max(maxParticles, 1u)), m_CurrentAliveBuffer(0)
+	{
+		m_SortCapacity = s_ParticleThreadGroupSize;
+		while (m_SortCapacity < m_MaxParticles)
+			m_SortCapacity <<= 1;
+
+		// Every particle starts dead
+		std::vector<uint32_t> deadIndices(m_MaxParticles);
+		for (uint32_t i = 0; i < m_MaxParticles; i++)
+			deadIndices[i] = m_MaxParticles - 1 - i;
+
+		GPUParticleCounters counters = { 0, m_MaxParticles, 0, 0 };
+		GPUParticleIndirectArgs indirectArgs = {};
+		indirectArgs.EmitDispatch[1] = indirectArgs.EmitDispatch[2] = 1;
+		indirectArgs.SimulateDispatch[1] = indirectArgs.SimulateDispatch[2] = 1;
+		indirectArgs.DrawCount = 4; // Quad as a triangle strip
+
+		glGenBuffers(1, &m_ParticleBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ParticleBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(GPUParticle) * m_MaxParticles, nullptr, GL_DYNAMIC_COPY);
+
+		glGenBuffers(2, m_AliveIndexBuffers);
+		for (int i = 0; i < 2; i++)
+		{
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_AliveIndexBuffers[i]);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(uint32_t) * m_MaxParticles, nullptr, GL_DYNAMIC_COPY);
+		}
+
+		glGenBuffers(1, &m_DeadIndexBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_DeadIndexBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(uint32_t) * m_MaxParticles, &deadIndices[0], GL_DYNAMIC_COPY);
+
+		glGenBuffers(1, &m_CounterBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_CounterBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(GPUParticleCounters), &counters, GL_DYNAMIC_COPY);
+
+		glGenBuffers(1, &m_IndirectArgsBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_IndirectArgsBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(GPUParticleIndirectArgs), &indirectArgs, GL_DYNAMIC_COPY);
+
+		glGenBuffers(1, &m_SortBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_SortBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(glm::uvec2) * m_SortCapacity, nullptr, GL_DYNAMIC_COPY);
+
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		glGenVertexArrays(1, &m_EmptyVAO);
+	}
+
+	GPUParticleEmitter::~GPUParticleEmitter()
+	{
+		glDeleteBuffers(1, &m_ParticleBuffer);
+		glDeleteBuffers(2, m_AliveIndexBuffers);
+		glDeleteBuffers(1, &m_DeadIndexBuffer);
+		glDeleteBuffers(1, &m_CounterBuffer);
+		glDeleteBuffers(1, &m_IndirectArgsBuffer);
+		glDeleteBuffers(1, &m_SortBuffer);
+		glDeleteVertexArrays(1, &m_EmptyVAO);
+	}
+
+	void GPUParticleEmitter::Simulate(const ParticleEmitterComponent &settings, const glm::vec3 &emitterPosition, uint32_t emitCount, float deltaTime, uint32_t seed, Shader *beginShader, Shader *emitShader, Shader *simulateShader, Shader *endShader)
+	{
+		GLCache *glCache = GLCache::GetInstance();
+		BindBuffers();
+		glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, m_IndirectArgsBuffer);
+
+		glCache->SetShader(beginShader);
+		beginShader->SetUniform(ARC_UNIFORM("requestedEmitCount"), static_cast<int>(std::min(emitCount, m_MaxParticles)));
+		glDispatchCompute(1, 1, 1);
+		DispatchBarrier();
+
+		glCache->SetShader(emitShader);
+		emitShader->SetUniform(ARC_UNIFORM("emitterPosition"), emitterPosition);
+		emitShader->SetUniform(ARC_UNIFORM("spawnRadius"), settings.SpawnRadius);
+		emitShader->SetUniform(ARC_UNIFORM("initialVelocity"), settings.InitialVelocity);
+		emitShader->SetUniform(ARC_UNIFORM("velocityRandomness"), settings.VelocityRandomness);
+		emitShader->SetUniform(ARC_UNIFORM("lifetimeRange"), glm::vec2(settings.LifetimeMin, settings.LifetimeMax));
+		emitShader->SetUniform(ARC_UNIFORM("seed"), static_cast<int>(seed));
+		glDispatchComputeIndirect(static_cast<GLintptr>(offsetof(GPUParticleIndirectArgs, EmitDispatch)));
+		DispatchBarrier();
+
+		glCache->SetShader(simulateShader);
+		simulateShader->SetUniform(ARC_UNIFORM("deltaTime"), deltaTime);
+		simulateShader->SetUniform(ARC_UNIFORM("acceleration"), settings.Acceleration);
+		glDispatchComputeIndirect(static_cast<GLintptr>(offsetof(GPUParticleIndirectArgs, SimulateDispatch)));
+		DispatchBarrier();
+
+		glCache->SetShader(endShader);
+		glDispatchCompute(1, 1, 1);
+		DispatchBarrier();
+
+		glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+
+		// Survivors were compacted into the other alive list
+		m_CurrentAliveBuffer = 1 - m_CurrentAliveBuffer;
+	}
+
+	void GPUParticleEmitter::SortBackToFront(const glm::vec3 &cameraPosition, Shader *sortKeyShader, Shader *bitonicSortShader)
+	{
+		GLCache *glCache = GLCache::GetInstance();
+		BindBuffers();
+
+		GLuint groupCount = m_SortCapacity / s_ParticleThreadGroupSize;
+
+		// Build the key/value pairs, dead slots get the max key so they end up at the back
+		glCache->SetShader(sortKeyShader);
+		sortKeyShader->SetUniform(ARC_UNIFORM("cameraPosition"), cameraPosition);
+		sortKeyShader->SetUniform(ARC_UNIFORM("sortCapacity"), static_cast<int>(m_SortCapacity));
+		glDispatchCompute(groupCount, 1, 1);
+		DispatchBarrier();
+
+		glCache->SetShader(bitonicSortShader);
+		for (uint32_t k = 2; k <= m_SortCapacity; k <<= 1)
+		{
+			for (uint32_t j = k >> 1; j > 0; j >>= 1)
+			{
+				bitonicSortShader->SetUniform(ARC_UNIFORM("sortStageK"), static_cast<int>(k));
+				bitonicSortShader->SetUniform(ARC_UNIFORM("sortStepJ"), static_cast<int>(j));
+				glDispatchCompute(groupCount, 1, 1);
+				DispatchBarrier();
+			}
+		}
+	}
+
+	void GPUParticleEmitter::Draw()
+	{
+		BindBuffers();
+
+		glBindVertexArray(m_EmptyVAO);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_IndirectArgsBuffer);
+		glDrawArraysIndirect(GL_TRIANGLE_STRIP, reinterpret_cast<const void*>(offsetof(GPUParticleIndirectArgs, DrawCount)));
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		glBindVertexArray(0);
+	}
+
+	void GPUParticleEmitter::BindBuffers()
+	{
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBufferBinding_Particles, m_ParticleBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBufferBinding_CurrentAlive, m_AliveIndexBuffers[m_CurrentAliveBuffer]);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBufferBinding_NextAlive, m_AliveIndexBuffers[1 - m_CurrentAliveBuffer]);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBufferBinding_Dead, m_DeadIndexBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBufferBinding_Counters, m_CounterBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBufferBinding_IndirectArgs, m_IndirectArgsBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBufferBinding_Sort, m_SortBuffer);
+	}
+
+	void GPUParticleEmitter::DispatchBarrier()
+	{
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+#ifndef GPUPARTICLEEMITTER_H
+#define GPUPARTICLEEMITTER_H
+
+#ifndef PARTICLEDATA_H
+#include <Arcane/Graphics/Particles/ParticleData.h>
+#endif
+
+namespace Arcane
+{
+	class Shader;
+	struct ParticleEmitterComponent;
+
+	/*
+		GPU resources for a single emitter. Particle state never leaves the GPU:
+		Begin (1 thread): Clamps the requested emit count to the free particles and writes the indirect dispatch args
+		Emit: Pops particle slots off the dead list, initializes them and appends them to the current alive list
+		Simulate: Integrates every alive particle and compacts survivors into the next alive list, dead particles are pushed back onto the dead list
+		End (1 thread): Publishes the new alive count and writes the instance count for the indirect draw
+		Rendering is a single indirect instanced draw of a quad per alive particle, optionally sorted back to front with a bitonic sort
+	*/
+	class GPUParticleEmitter
+	{
+	public:
+		GPUParticleEmitter(uint32_t maxParticles);
+		~GPUParticleEmitter();
+
+		void Simulate(const ParticleEmitterComponent &settings, const glm::vec3 &emitterPosition, uint32_t emitCount, float deltaTime, uint32_t seed, Shader *beginShader, Shader *emitShader, Shader *simulateShader, Shader *endShader);
+		void SortBackToFront(const glm::vec3 &cameraPosition, Shader *sortKeyShader, Shader *bitonicSortShader);
+		void Draw();
+
+		inline uint32_t GetMaxParticles() const { return m_MaxParticles; }
+	private:
+		void BindBuffers();
+		static void DispatchBarrier();
+	private:
+		uint32_t m_MaxParticles;
+		uint32_t m_SortCapacity; // Power of two >= m_MaxParticles since the bitonic sort requires it
+
+		unsigned int m_ParticleBuffer;
+		unsigned int m_AliveIndexBuffers[2];
+		unsigned int m_DeadIndexBuffer;
+		unsigned int m_CounterBuffer;
+		unsigned int m_IndirectArgsBuffer;
+		unsigned int m_SortBuffer;
+		unsigned int m_EmptyVAO; // Particles are vertex pulled from the SSBOs but a VAO still needs to be bound to draw
+
+		uint32_t m_CurrentAliveBuffer;
+	};
+}
+#endif
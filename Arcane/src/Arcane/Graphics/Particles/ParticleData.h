@@ -0,0 +1,46 @@
+#pragma once
+#ifndef PARTICLEDATA_H
+#define PARTICLEDATA_H
+
+namespace Arcane
+{
+	// Must match the Particle struct in the particle shaders (std430)
+	struct GPUParticle
+	{
+		glm::vec4 PositionAndAge;			// xyz = world position, w = age in seconds
+		glm::vec4 VelocityAndLifetime;		// xyz = velocity, w = lifetime in seconds
+	};
+
+	// Must match the Counters block in the particle shaders (std430)
+	struct GPUParticleCounters
+	{
+		uint32_t AliveCount;
+		uint32_t DeadCount;
+		uint32_t NewAliveCount;
+		uint32_t EmitCount;
+	};
+
+	// Must match the IndirectArgs block in the particle shaders (std430). Layout of the indirect commands so a single buffer can drive every dispatch and the draw
+	struct GPUParticleIndirectArgs
+	{
+		uint32_t EmitDispatch[3];
+		uint32_t SimulateDispatch[3];
+		uint32_t DrawCount, DrawInstanceCount, DrawFirst, DrawBaseInstance; // DrawArraysIndirectCommand
+	};
+
+	// PCG hash, also used in the shaders so the CPU reference simulator generates the same random values for the same seed
+	inline uint32_t ParticleHash(uint32_t input)
+	{
+		uint32_t state = input * 747796405u + 2891336453u;
+		uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+		return (word >> 22u) ^ word;
+	}
+
+	// Returns a random float in [0, 1) and advances the seed
+	inline float ParticleRandom(uint32_t &seed)
+	{
+		seed = ParticleHash(seed);
+		return static_cast<float>(seed) / 4294967296.0f;
+	}
+}
+#endif
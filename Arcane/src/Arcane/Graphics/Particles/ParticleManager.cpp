@@ -0,0 +1,94 @@
+#include "arcpch.h"
+#include "ParticleManager.h"
+
+#include <Arcane/Scene/Scene.h>
+#include <Arcane/Scene/Components.h>
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Particles/GPUParticleEmitter.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+
+namespace Arcane
+{
+	ParticleManager::ParticleManager(Scene *scene) : m_Scene(scene), m_FrameSeed(0), m_BeginShader(nullptr), m_EmitShader(nullptr), m_SimulateShader(nullptr), m_EndShader(nullptr),
+		m_SortKeyShader(nullptr), m_BitonicSortShader(nullptr)
+	{
+
+	}
+
+	ParticleManager::~ParticleManager()
+	{
+		for (auto &emitter : m_Emitters)
+			delete emitter.second;
+	}
+
+	void ParticleManager::Init()
+	{
+		m_BeginShader = ShaderLoader::LoadShader("particles/ParticleBegin.glsl");
+		m_EmitShader = ShaderLoader::LoadShader("particles/ParticleEmit.glsl");
+		m_SimulateShader = ShaderLoader::LoadShader("particles/ParticleSimulate.glsl");
+		m_EndShader = ShaderLoader::LoadShader("particles/ParticleEnd.glsl");
+		m_SortKeyShader = ShaderLoader::LoadShader("particles/ParticleSortKeys.glsl");
+		m_BitonicSortShader = ShaderLoader::LoadShader("particles/ParticleBitonicSort.glsl");
+	}
+
+	void ParticleManager::Update(float deltaTime)
+	{
+		RemoveStaleEmitters();
+
+		auto group = m_Scene->m_Registry.view<TransformComponent, ParticleEmitterComponent>();
+		for (auto entity : group)
+		{
+			auto&[transformComponent, emitterComponent] = group.get<TransformComponent, ParticleEmitterComponent>(entity);
+
+			// Lazily create the GPU resources, and reallocate them if the emitter's capacity changed
+			GPUParticleEmitter *&emitter = m_Emitters[entity];
+			if (emitter && emitter->GetMaxParticles() != emitterComponent.MaxParticles)
+			{
+				delete emitter;
+				emitter = nullptr;
+			}
+			if (!emitter)
+				emitter = new GPUParticleEmitter(emitterComponent.MaxParticles);
+
+			// Carry fractional particles over so low spawn rates and high framerates still emit
+			uint32_t emitCount = 0;
+			if (emitterComponent.IsEmitting)
+			{
+				emitterComponent.EmitAccumulator += emitterComponent.SpawnRate * deltaTime;
+				emitCount = static_cast<uint32_t>(emitterComponent.EmitAccumulator);
+				emitterComponent.EmitAccumulator -= static_cast<float>(emitCount);
+			}
+			else
+			{
+				emitterComponent.EmitAccumulator = 0.0f;
+			}
+
+			uint32_t seed = ParticleHash(m_FrameSeed ^ static_cast<uint32_t>(entity));
+			emitter->Simulate(emitterComponent, transformComponent.Translation, emitCount, deltaTime, seed, m_BeginShader, m_EmitShader, m_SimulateShader, m_EndShader);
+		}
+
+		++m_FrameSeed;
+	}
+
+	GPUParticleEmitter* ParticleManager::GetEmitter(entt::entity entity)
+	{
+		auto iter = m_Emitters.find(entity);
+		return iter != m_Emitters.end() ? iter->second : nullptr;
+	}
+
+	void ParticleManager::RemoveStaleEmitters()
+	{
+		for (auto iter = m_Emitters.begin(); iter != m_Emitters.end();)
+		{
+			if (!m_Scene->m_Registry.valid(iter->first) || !m_Scene->m_Registry.all_of<ParticleEmitterComponent>(iter->first))
+			{
+				delete iter->second;
+				iter = m_Emitters.erase(iter);
+			}
+			else
+			{
+				++iter;
+			}
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef PARTICLEMANAGER_H
+#define PARTICLEMANAGER_H
+
+#ifndef ENTT_CONFIG_CONFIG_H
+#include "entt.hpp"
+#endif
+
+namespace Arcane
+{
+	class Scene;
+	class Shader;
+	class GPUParticleEmitter;
+	struct ParticleEmitterComponent;
+
+	// Owns the GPU resources for every ParticleEmitterComponent in the scene and dispatches their simulation each frame
+	class ParticleManager
+	{
+	public:
+		ParticleManager(Scene *scene);
+		~ParticleManager();
+
+		void Init();
+		void Update(float deltaTime);
+
+		GPUParticleEmitter* GetEmitter(entt::entity entity);
+		inline Shader* GetSortKeyShader() { return m_SortKeyShader; }
+		inline Shader* GetBitonicSortShader() { return m_BitonicSortShader; }
+	private:
+		void RemoveStaleEmitters();
+	private:
+		Scene *m_Scene;
+
+		std::unordered_map<entt::entity, GPUParticleEmitter*> m_Emitters;
+		uint32_t m_FrameSeed;
+
+		Shader *m_BeginShader, *m_EmitShader, *m_SimulateShader, *m_EndShader;
+		Shader *m_SortKeyShader, *m_BitonicSortShader;
+	};
+}
+#endif
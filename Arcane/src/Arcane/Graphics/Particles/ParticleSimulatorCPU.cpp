@@ -0,0 +1,94 @@
+#include "arcpch.h"
+#include "ParticleSimulatorCPU.h"
+
+#include <Arcane/Scene/Components.h>
+
+namespace Arcane
+{
+	ParticleSimulatorCPU::ParticleSimulatorCPU(uint32_t maxParticles) : m_MaxParticles(std::max(maxParticles, 1u)), m_CurrentAliveBuffer(0)
+	{
+		m_Particles.resize(m_MaxParticles);
+		m_AliveIndices[0].resize(m_MaxParticles);
+		m_AliveIndices[1].resize(m_MaxParticles);
+
+		// Same initial dead list layout as the GPU emitter
+		m_DeadIndices.resize(m_MaxParticles);
+		for (uint32_t i = 0; i < m_MaxParticles; i++)
+			m_DeadIndices[i] = m_MaxParticles - 1 - i;
+
+		m_Counters = { 0, m_MaxParticles, 0, 0 };
+	}
+
+	void ParticleSimulatorCPU::Simulate(const ParticleEmitterComponent &settings, const glm::vec3 &emitterPosition, uint32_t emitCount, float deltaTime, uint32_t seed)
+	{
+		// Begin
+		m_Counters.EmitCount = std::min(std::min(emitCount, m_MaxParticles), m_Counters.DeadCount);
+		m_Counters.NewAliveCount = 0;
+
+		Emit(settings, emitterPosition, seed);
+		Update(settings, deltaTime);
+
+		// End
+		m_Counters.AliveCount = m_Counters.NewAliveCount;
+		m_CurrentAliveBuffer = 1 - m_CurrentAliveBuffer;
+	}
+
+	void ParticleSimulatorCPU::Emit(const ParticleEmitterComponent &settings, const glm::vec3 &emitterPosition, uint32_t seed)
+	{
+		std::vector<uint32_t> &currentAliveIndices = m_AliveIndices[m_CurrentAliveBuffer];
+
+		for (uint32_t emitIndex = 0; emitIndex < m_Counters.EmitCount; emitIndex++)
+		{
+			uint32_t rngState = ParticleHash(seed + emitIndex);
+
+			// Uniformly distributed point inside of the spawn sphere
+			float theta = ParticleRandom(rngState) * 2.0f * glm::pi<float>();
+			float cosPhi = ParticleRandom(rngState) * 2.0f - 1.0f;
+			float radius = settings.SpawnRadius * std::pow(ParticleRandom(rngState), 1.0f / 3.0f);
+			float sinPhi = std::sqrt(std::max(0.0f, 1.0f - cosPhi * cosPhi));
+			glm::vec3 spawnOffset = radius * glm::vec3(sinPhi * std::cos(theta), cosPhi, sinPhi * std::sin(theta));
+
+			float randomX = ParticleRandom(rngState);
+			float randomY = ParticleRandom(rngState);
+			float randomZ = ParticleRandom(rngState);
+			glm::vec3 randomVelocity = glm::vec3(randomX, randomY, randomZ) * 2.0f - 1.0f;
+			glm::vec3 velocity = settings.InitialVelocity + randomVelocity * settings.VelocityRandomness;
+			float lifetime = glm::mix(settings.LifetimeMin, settings.LifetimeMax, ParticleRandom(rngState));
+
+			uint32_t particleIndex = m_DeadIndices[--m_Counters.DeadCount];
+			m_Particles[particleIndex].PositionAndAge = glm::vec4(emitterPosition + spawnOffset, 0.0f);
+			m_Particles[particleIndex].VelocityAndLifetime = glm::vec4(velocity, lifetime);
+
+			currentAliveIndices[m_Counters.AliveCount++] = particleIndex;
+		}
+	}
+
+	void ParticleSimulatorCPU::Update(const ParticleEmitterComponent &settings, float deltaTime)
+	{
+		const std::vector<uint32_t> &currentAliveIndices = m_AliveIndices[m_CurrentAliveBuffer];
+		std::vector<uint32_t> &nextAliveIndices = m_AliveIndices[1 - m_CurrentAliveBuffer];
+
+		for (uint32_t aliveSlot = 0; aliveSlot < m_Counters.AliveCount; aliveSlot++)
+		{
+			uint32_t particleIndex = currentAliveIndices[aliveSlot];
+			GPUParticle &particle = m_Particles[particleIndex];
+
+			float age = particle.PositionAndAge.w + deltaTime;
+			float lifetime = particle.VelocityAndLifetime.w;
+			if (age < lifetime)
+			{
+				// Semi-implicit euler
+				glm::vec3 velocity = glm::vec3(particle.VelocityAndLifetime) + settings.Acceleration * deltaTime;
+				glm::vec3 position = glm::vec3(particle.PositionAndAge) + velocity * deltaTime;
+				particle.PositionAndAge = glm::vec4(position, age);
+				particle.VelocityAndLifetime = glm::vec4(velocity, lifetime);
+
+				nextAliveIndices[m_Counters.NewAliveCount++] = particleIndex;
+			}
+			else
+			{
+				m_DeadIndices[m_Counters.DeadCount++] = particleIndex;
+			}
+		}
+	}
+}
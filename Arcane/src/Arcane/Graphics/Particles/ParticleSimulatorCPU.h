@@ -0,0 +1,44 @@
+#pragma once
+#ifndef PARTICLESIMULATORCPU_H
+#define PARTICLESIMULATORCPU_H
+
+#ifndef PARTICLEDATA_H
+#include <Arcane/Graphics/Particles/ParticleData.h>
+#endif
+
+namespace Arcane
+{
+	struct ParticleEmitterComponent;
+
+	/*
+		Single threaded reference implementation of the GPU particle simulation (see GPUParticleEmitter and the particle compute shaders). It uses the same
+		free list, compaction and random number generation so it can be used to validate the GPU results and debug emitter settings without a GL context.
+		The GPU pops dead slots and compacts with atomics so the order of the alive list differs, but the alive count and the set of particles match.
+		Checks/ParticleSimulatorCheck runs it headlessly with fixed seeds
+	*/
+	class ParticleSimulatorCPU
+	{
+	public:
+		ParticleSimulatorCPU(uint32_t maxParticles);
+
+		void Simulate(const ParticleEmitterComponent &settings, const glm::vec3 &emitterPosition, uint32_t emitCount, float deltaTime, uint32_t seed);
+
+		inline uint32_t GetAliveCount() const { return m_Counters.AliveCount; }
+		inline uint32_t GetDeadCount() const { return m_Counters.DeadCount; }
+		inline const std::vector<GPUParticle>& GetParticles() const { return m_Particles; }
+		inline const std::vector<uint32_t>& GetAliveIndices() const { return m_AliveIndices[m_CurrentAliveBuffer]; }
+	private:
+		void Emit(const ParticleEmitterComponent &settings, const glm::vec3 &emitterPosition, uint32_t seed);
+		void Update(const ParticleEmitterComponent &settings, float deltaTime);
+	private:
+		uint32_t m_MaxParticles;
+
+		std::vector<GPUParticle> m_Particles;
+		std::vector<uint32_t> m_AliveIndices[2];
+		std::vector<uint32_t> m_DeadIndices;
+		GPUParticleCounters m_Counters;
+
+		uint32_t m_CurrentAliveBuffer;
+	};
+}
+#endif
@@ -47,7 +47,7 @@ namespace Arcane
 			s_GLCache->SetLineSmooth(true);
 			s_GLCache->SetLineWidth(s_LineThickness);
 			s_GLCache->SetShader(s_LineShader);
-			s_LineShader->SetUniform("viewProjection", camera->GetProjectionMatrix() * camera->GetViewMatrix());
+			s_LineShader->SetUniform(ARC_UNIFORM("viewProjection"), camera->GetProjectionMatrix() * camera->GetViewMatrix());
 			s_LineVertexArray->Bind();
 			glDrawArrays(GL_LINES, 0, s_LineVertexCount);
 		}
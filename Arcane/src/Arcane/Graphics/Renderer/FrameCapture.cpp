@@ -0,0 +1,272 @@
+#include "arcpch.h"
+#include "FrameCapture.h"
+
+#include <Arcane/Platform/OpenGL/Framebuffer/Framebuffer.h>
+
+// RenderDoc already ships stb_image_write, compiled static here so it can't clash with anything else linking it
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <Arcane/Vendor/renderdoc-1.x/renderdoc/3rdparty/stb/stb_image_write.h>
+
+namespace Arcane
+{
+	FrameCapture::CaptureSlot FrameCapture::s_Slots[FRAME_CAPTURE_RING_SIZE];
+	int FrameCapture::s_NextSlot = 0;
+	uint64_t FrameCapture::s_FrameIndex = 0;
+	std::vector<std::thread> FrameCapture::s_WorkerThreads;
+	ThreadSafeQueue<int> FrameCapture::s_JobQueue;
+	std::string FrameCapture::s_PendingScreenshotPath;
+	bool FrameCapture::s_ScreenshotRequested = false;
+	bool FrameCapture::s_SequenceActive = false;
+	std::string FrameCapture::s_SequenceDirectory;
+	FrameCaptureFormat FrameCapture::s_SequenceFormat = FrameCaptureFormat::Raw;
+	uint32_t FrameCapture::s_SequenceFrameCount = 0;
+	uint32_t FrameCapture::s_SequenceFramesQueued = 0;
+	std::atomic<uint32_t> FrameCapture::s_FramesWritten(0);
+	uint32_t FrameCapture::s_FramesDropped = 0;
+	double FrameCapture::s_RenderThreadMS = 0.0;
+
+	static bool IsFenceSignalled(GLsync fence)
+	{
+		GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+		return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+	}
+
+	static void CreateParentDirectories(const std::string &path)
+	{
+		std::filesystem::path parent = std::filesystem::path(path).parent_path();
+		std::error_code error;
+		if (!parent.empty())
+			std::filesystem::create_directories(parent, error);
+	}
+
+	void FrameCapture::Init()
+	{
+		for (int i = 0; i < FRAME_CAPTURE_WORKER_THREADS; i++)
+			s_WorkerThreads.push_back(std::thread(&FrameCapture::WorkerLoop));
+	}
+
+	void FrameCapture::Shutdown()
+	{
+		// Finish whatever the GPU is still reading back so no requested capture gets lost
+		for (int i = 0; i < FRAME_CAPTURE_RING_SIZE; i++)
+		{
+			CaptureSlot &slot = s_Slots[i];
+			if (slot.State.load() == SlotState_Reading)
+			{
+				glClientWaitSync(slot.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+				HandOffReadback(i);
+			}
+		}
+
+		for (size_t i = 0; i < s_WorkerThreads.size(); i++)
+			s_JobQueue.Push(-1);
+		for (std::thread &thread : s_WorkerThreads)
+			thread.join();
+		s_WorkerThreads.clear();
+
+		for (CaptureSlot &slot : s_Slots)
+		{
+			if (slot.PixelBuffer)
+			{
+				glUnmapNamedBuffer(slot.PixelBuffer);
+				glDeleteBuffers(1, &slot.PixelBuffer);
+			}
+			slot.PixelBuffer = 0;
+			slot.MappedPixels = nullptr;
+			slot.Capacity = 0;
+		}
+	}
+
+	void FrameCapture::RequestScreenshot(const std::string &path)
+	{
+		s_ScreenshotRequested = true;
+		s_PendingScreenshotPath = path;
+		if (s_PendingScreenshotPath.empty())
+		{
+			char timestamp[32];
+			std::time_t now = std::time(nullptr);
+			std::strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+			s_PendingScreenshotPath = std::string(FRAME_CAPTURE_DIRECTORY) + "screenshot_" + timestamp + ".png";
+		}
+	}
+
+	void FrameCapture::BeginSequence(const std::string &directory, FrameCaptureFormat format, uint32_t frameCount)
+	{
+		s_SequenceActive = true;
+		s_SequenceDirectory = directory;
+		if (!s_SequenceDirectory.empty() && s_SequenceDirectory.back() != '/' && s_SequenceDirectory.back() != '\\')
+			s_SequenceDirectory += '/';
+		s_SequenceFormat = format;
+		s_SequenceFrameCount = frameCount;
+		s_SequenceFramesQueued = 0;
+		s_FramesDropped = 0;
+		CreateParentDirectories(s_SequenceDirectory);
+		ARC_LOG_INFO("Started capturing frames to {0}", s_SequenceDirectory);
+	}
+
+	void FrameCapture::EndSequence()
+	{
+		if (!s_SequenceActive)
+			return;
+
+		s_SequenceActive = false;
+		ARC_LOG_INFO("Stopped capturing frames, {0} queued and {1} dropped since the readback ring was full", s_SequenceFramesQueued, s_FramesDropped);
+	}
+
+	void FrameCapture::OnFrameRendered(Framebuffer *finalFramebuffer)
+	{
+		s_FrameIndex++;
+		bool hasWork = s_ScreenshotRequested || s_SequenceActive;
+		for (int i = 0; i < FRAME_CAPTURE_RING_SIZE && !hasWork; i++)
+			hasWork = s_Slots[i].State.load() == SlotState_Reading;
+		if (!hasWork)
+		{
+			s_RenderThreadMS = 0.0;
+			return;
+		}
+
+		double startTime = glfwGetTime();
+
+		// Readbacks that are old enough and whose fences have signalled go to the workers, the rest get checked again next frame
+		for (int i = 0; i < FRAME_CAPTURE_RING_SIZE; i++)
+		{
+			CaptureSlot &slot = s_Slots[i];
+			if (slot.State.load() == SlotState_Reading && s_FrameIndex - slot.QueuedFrame >= FRAME_CAPTURE_LATENCY_FRAMES && IsFenceSignalled(slot.Fence))
+				HandOffReadback(i);
+		}
+
+		// A screenshot that can't get a slot stays requested, a sequence frame that can't get one is dropped so the capture doesn't slow the frame down
+		if (s_ScreenshotRequested && QueueReadback(finalFramebuffer, s_PendingScreenshotPath, FrameCaptureFormat::PNG))
+		{
+			s_ScreenshotRequested = false;
+			CreateParentDirectories(s_PendingScreenshotPath);
+		}
+		if (s_SequenceActive)
+		{
+			char fileName[64];
+			const char *extension = s_SequenceFormat == FrameCaptureFormat::PNG ? "png" : "rgba";
+			if (s_SequenceFormat == FrameCaptureFormat::Raw)
+				snprintf(fileName, sizeof(fileName), "frame_%06u_%ux%u.%s", s_SequenceFramesQueued, finalFramebuffer->GetWidth(), finalFramebuffer->GetHeight(), extension);
+			else
+				snprintf(fileName, sizeof(fileName), "frame_%06u.%s", s_SequenceFramesQueued, extension);
+
+			if (QueueReadback(finalFramebuffer, s_SequenceDirectory + fileName, s_SequenceFormat))
+				s_SequenceFramesQueued++;
+			else
+				s_FramesDropped++;
+
+			if (s_SequenceFrameCount > 0 && s_SequenceFramesQueued >= s_SequenceFrameCount)
+				EndSequence();
+		}
+
+		s_RenderThreadMS = (glfwGetTime() - startTime) * 1000.0;
+	}
+
+	bool FrameCapture::QueueReadback(Framebuffer *framebuffer, const std::string &path, FrameCaptureFormat format)
+	{
+		// Several captures can be in flight at once (ie: a screenshot during a sequence), so take the first free slot from s_NextSlot on rather than only s_NextSlot.
+		// A slot only goes back to free once its fence signalled and a worker finished reading the mapped memory, so a pixel buffer is never overwritten early
+		int slotIndex = -1;
+		for (int i = 0; i < FRAME_CAPTURE_RING_SIZE && slotIndex < 0; i++)
+		{
+			int candidate = (s_NextSlot + i) % FRAME_CAPTURE_RING_SIZE;
+			if (s_Slots[candidate].State.load() == SlotState_Free)
+				slotIndex = candidate;
+		}
+		if (slotIndex < 0)
+			return false;
+
+		CaptureSlot &slot = s_Slots[slotIndex];
+		ARC_ASSERT(slot.Fence == nullptr, "Frame capture slot is free but its readback fence was never consumed");
+
+		// Buffers are immutable, so one that's too small gets replaced. Client storage keeps the mapping in cached system memory which is what the workers read from
+		size_t requiredSize = static_cast<size_t>(framebuffer->GetWidth()) * framebuffer->GetHeight() * 4;
+		if (slot.Capacity < requiredSize)
+		{
+			if (slot.PixelBuffer)
+			{
+				glUnmapNamedBuffer(slot.PixelBuffer);
+				glDeleteBuffers(1, &slot.PixelBuffer);
+			}
+
+			const GLbitfield mapFlags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glCreateBuffers(1, &slot.PixelBuffer);
+			glNamedBufferStorage(slot.PixelBuffer, requiredSize, nullptr, mapFlags | GL_CLIENT_STORAGE_BIT);
+			slot.MappedPixels = static_cast<const unsigned char*>(glMapNamedBufferRange(slot.PixelBuffer, 0, requiredSize, mapFlags));
+			slot.Capacity = requiredSize;
+		}
+
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer->GetFramebuffer());
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PixelBuffer);
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+		glReadPixels(0, 0, framebuffer->GetWidth(), framebuffer->GetHeight(), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+		slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		slot.QueuedFrame = s_FrameIndex;
+		slot.Width = framebuffer->GetWidth();
+		slot.Height = framebuffer->GetHeight();
+		slot.Format = format;
+		slot.Path = path;
+		slot.State.store(SlotState_Reading);
+
+		s_NextSlot = (slotIndex + 1) % FRAME_CAPTURE_RING_SIZE;
+		return true;
+	}
+
+	void FrameCapture::HandOffReadback(int slotIndex)
+	{
+		CaptureSlot &slot = s_Slots[slotIndex];
+		glDeleteSync(slot.Fence);
+		slot.Fence = nullptr;
+		slot.State.store(SlotState_Encoding);
+		s_JobQueue.Push(slotIndex);
+	}
+
+	void FrameCapture::WorkerLoop()
+	{
+		while (true)
+		{
+			int slotIndex = s_JobQueue.WaitAndPop();
+			if (slotIndex < 0)
+				return;
+
+			CaptureSlot &slot = s_Slots[slotIndex];
+			if (WriteCapture(slot))
+				s_FramesWritten++;
+			else
+				ARC_LOG_ERROR("Failed to write frame capture - {0}", slot.Path);
+			slot.State.store(SlotState_Free);
+		}
+	}
+
+	bool FrameCapture::WriteCapture(const CaptureSlot &slot)
+	{
+		// GL reads the bottom row first, both formats are written top row first
+		size_t rowSize = static_cast<size_t>(slot.Width) * 4;
+		if (slot.Format == FrameCaptureFormat::Raw)
+		{
+			std::ofstream ofs(slot.Path, std::ios::out | std::ios::binary);
+			for (uint32_t row = 0; row < slot.Height && ofs; row++)
+				ofs.write(reinterpret_cast<const char*>(slot.MappedPixels + rowSize * (slot.Height - 1 - row)), rowSize);
+			return ofs.good();
+		}
+
+		// Alpha of the final output isn't meaningful, so it gets dropped
+		std::vector<unsigned char> rgbPixels(static_cast<size_t>(slot.Width) * slot.Height * 3);
+		for (uint32_t row = 0; row < slot.Height; row++)
+		{
+			const unsigned char *source = slot.MappedPixels + rowSize * (slot.Height - 1 - row);
+			unsigned char *destination = &rgbPixels[static_cast<size_t>(row) * slot.Width * 3];
+			for (uint32_t x = 0; x < slot.Width; x++)
+			{
+				destination[x * 3 + 0] = source[x * 4 + 0];
+				destination[x * 3 + 1] = source[x * 4 + 1];
+				destination[x * 3 + 2] = source[x * 4 + 2];
+			}
+		}
+		return stbi_write_png(slot.Path.c_str(), static_cast<int>(slot.Width), static_cast<int>(slot.Height), 3, rgbPixels.data(), static_cast<int>(slot.Width * 3)) != 0;
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef FRAMECAPTURE_H
+#define FRAMECAPTURE_H
+
+#ifndef THREADSAFEQUEUE_H
+#include <Arcane/Core/Threads/ThreadSafeQueue.h>
+#endif
+
+/*
+	Screenshots and frame sequences of the final output (before ImGui) without stalling the GPU. Every captured frame is read back into a pixel buffer from a
+	small ring, those stay persistently mapped so nothing gets copied on the render thread. A readback is only handed over once its fence has signalled, which
+	is polled without waiting at least FRAME_CAPTURE_LATENCY_FRAMES frames later, then worker threads encode straight out of the mapped memory and write
+	the file. Any number of captures up to the ring size can be in flight, a slot is only reused once its fence signalled and its worker is done with the mapped
+	memory. If every slot of the ring is still busy the frame is dropped instead of waited on (use the raw format for sustained capture, PNG encoding is slow)
+*/
+
+namespace Arcane
+{
+	class Framebuffer;
+
+	enum class FrameCaptureFormat
+	{
+		PNG, // RGB, top row first
+		Raw // Tightly packed RGBA8, top row first. The size is in the file name
+	};
+
+	class FrameCapture
+	{
+	public:
+		static void Init();
+		static void Shutdown(); // Waits for the readbacks still in flight and writes them out
+
+		// Captures the next finished frame, an empty path writes a timestamped PNG to FRAME_CAPTURE_DIRECTORY
+		static void RequestScreenshot(const std::string &path = std::string());
+
+		// Captures every frame into directory/frame_000000.ext until EndSequence is called, or until frameCount frames were captured if it's above 0
+		static void BeginSequence(const std::string &directory, FrameCaptureFormat format = FrameCaptureFormat::Raw, uint32_t frameCount = 0);
+		static void EndSequence();
+
+		// Called once the frame's final output is done. Queues this frame's readback and hands any finished ones to the workers, never waits on the GPU
+		static void OnFrameRendered(Framebuffer *finalFramebuffer);
+
+		inline static bool IsScreenshotPending() { return s_ScreenshotRequested; } // Still waiting on a free slot, requesting another one now would replace it
+		inline static bool IsSequenceActive() { return s_SequenceActive; }
+		inline static uint32_t GetFramesWritten() { return s_FramesWritten.load(); }
+		inline static uint32_t GetFramesDropped() { return s_FramesDropped; }
+		inline static double GetRenderThreadMS() { return s_RenderThreadMS; } // Time OnFrameRendered took last frame
+	private:
+		enum SlotState : int
+		{
+			SlotState_Free,
+			SlotState_Reading, // Waiting on the GPU
+			SlotState_Encoding // Owned by a worker
+		};
+
+		struct CaptureSlot
+		{
+			unsigned int PixelBuffer = 0;
+			const unsigned char *MappedPixels = nullptr;
+			size_t Capacity = 0;
+			GLsync Fence = nullptr;
+			uint64_t QueuedFrame = 0;
+			uint32_t Width = 0, Height = 0;
+			FrameCaptureFormat Format = FrameCaptureFormat::PNG;
+			std::string Path;
+			std::atomic<int> State{ SlotState_Free };
+		};
+
+		static bool QueueReadback(Framebuffer *framebuffer, const std::string &path, FrameCaptureFormat format);
+		static void HandOffReadback(int slotIndex);
+		static void WorkerLoop();
+		static bool WriteCapture(const CaptureSlot &slot);
+	private:
+		static CaptureSlot s_Slots[FRAME_CAPTURE_RING_SIZE];
+		static int s_NextSlot; // Where the search for a free slot starts, keeps the ring in order while nothing is busy
+		static uint64_t s_FrameIndex;
+
+		static std::vector<std::thread> s_WorkerThreads;
+		static ThreadSafeQueue<int> s_JobQueue; // Slot indices, -1 tells a worker to exit
+
+		static std::string s_PendingScreenshotPath;
+		static bool s_ScreenshotRequested;
+
+		static bool s_SequenceActive;
+		static std::string s_SequenceDirectory;
+		static FrameCaptureFormat s_SequenceFormat;
+		static uint32_t s_SequenceFrameCount, s_SequenceFramesQueued;
+
+		static std::atomic<uint32_t> s_FramesWritten;
+		static uint32_t s_FramesDropped;
+		static double s_RenderThreadMS;
+	};
+}
+#endif
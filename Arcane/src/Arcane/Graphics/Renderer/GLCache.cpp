@@ -163,6 +163,12 @@ namespace Arcane
 		}
 	}
 
+	void GLCache::SetBlendFunc(unsigned int drawBuffer, GLenum src, GLenum dst) {
+		m_BlendSrc = GL_NONE;
+		m_BlendDst = GL_NONE;
+		glBlendFunci(drawBuffer, src, dst);
+	}
+
 	void GLCache::SetCullFace(GLenum faceToCull) {
 		if (m_FaceToCull != faceToCull) {
 			m_FaceToCull = faceToCull;
@@ -31,6 +31,7 @@ namespace Arcane
 		void SetStencilWriteMask(unsigned int bitmask);
 		void SetColourMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
 		void SetBlendFunc(GLenum src, GLenum dst);
+		void SetBlendFunc(unsigned int drawBuffer, GLenum src, GLenum dst); // Only changes one draw buffer, the next SetBlendFunc for all of them always goes through
 		void SetCullFace(GLenum faceToCull);
 		void SetClipPlane(glm::vec4 clipPlane);
 		void SetLineWidth(float lineThickness);
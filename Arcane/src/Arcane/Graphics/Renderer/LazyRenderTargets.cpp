@@ -0,0 +1,107 @@
+#include "arcpch.h"
+#include "LazyRenderTargets.h"
+
+namespace Arcane
+{
+	std::vector<LazyRenderTargets*> LazyRenderTargets::s_Instances;
+
+	LazyRenderTargets::LazyRenderTargets(const char *effectName) : m_EffectName(effectName), m_IsAllocated(false), m_UnusedTimer()
+	{
+		s_Instances.push_back(this);
+	}
+
+	LazyRenderTargets::~LazyRenderTargets()
+	{
+		s_Instances.erase(std::remove(s_Instances.begin(), s_Instances.end(), this), s_Instances.end());
+	}
+
+	LazyRenderTargets& LazyRenderTargets::AddTarget(Framebuffer *framebuffer, ColorAttachmentFormat colourFormat)
+	{
+		m_Targets.push_back({ framebuffer, colourFormat, false, NormalizedDepthOnly, false });
+		return *this;
+	}
+
+	LazyRenderTargets& LazyRenderTargets::AddTarget(Framebuffer *framebuffer, ColorAttachmentFormat colourFormat, DepthStencilAttachmentFormat depthStencilFormat, bool depthStencilTexture)
+	{
+		m_Targets.push_back({ framebuffer, colourFormat, true, depthStencilFormat, depthStencilTexture });
+		return *this;
+	}
+
+	LazyRenderTargets& LazyRenderTargets::AddTarget(ILazyRenderTarget *target)
+	{
+		m_CustomTargets.push_back(target);
+		return *this;
+	}
+
+	void LazyRenderTargets::Acquire()
+	{
+		m_UnusedTimer.Reset();
+		if (m_IsAllocated)
+			return;
+
+		for (TargetDescription &description : m_Targets)
+		{
+			description.Target->AddColorTexture(description.ColourFormat);
+			if (description.HasDepthStencil)
+			{
+				if (description.DepthStencilTexture)
+					description.Target->AddDepthStencilTexture(description.DepthStencilFormat);
+				else
+					description.Target->AddDepthStencilRBO(description.DepthStencilFormat);
+			}
+			description.Target->CreateFramebuffer();
+		}
+		for (ILazyRenderTarget *target : m_CustomTargets)
+		{
+			target->CreateTargets();
+		}
+		m_IsAllocated = true;
+
+		ARC_LOG_INFO("Allocated {0} render targets ({1:.2f} MB)", m_EffectName, GetMemorySize() / (1024.0 * 1024.0));
+	}
+
+	void LazyRenderTargets::ReleaseIfUnused()
+	{
+		if (!m_IsAllocated || m_UnusedTimer.Elapsed() < RENDER_TARGET_RELEASE_DELAY)
+			return;
+
+		for (TargetDescription &description : m_Targets)
+		{
+			description.Target->ReleaseAttachments();
+		}
+		for (ILazyRenderTarget *target : m_CustomTargets)
+		{
+			target->ReleaseTargets();
+		}
+		m_IsAllocated = false;
+
+		ARC_LOG_INFO("Released unused {0} render targets, freed {1:.2f} MB", m_EffectName, GetMemorySize() / (1024.0 * 1024.0));
+	}
+
+	size_t LazyRenderTargets::GetMemorySize() const
+	{
+		size_t memorySize = 0;
+		for (const TargetDescription &description : m_Targets)
+		{
+			size_t pixelSize = Framebuffer::GetFormatPixelSize(description.ColourFormat);
+			if (description.HasDepthStencil)
+				pixelSize += Framebuffer::GetFormatPixelSize(description.DepthStencilFormat);
+
+			size_t sampleCount = description.Target->IsMultisampled() ? MSAA_SAMPLE_AMOUNT : 1;
+			memorySize += static_cast<size_t>(description.Target->GetWidth()) * description.Target->GetHeight() * pixelSize * sampleCount;
+		}
+		for (const ILazyRenderTarget *target : m_CustomTargets)
+		{
+			memorySize += target->GetTargetsMemorySize();
+		}
+		return memorySize;
+	}
+
+	void LazyRenderTargets::ReleaseUnusedTargets()
+	{
+		for (LazyRenderTargets *targets : s_Instances)
+		{
+			targets->ReleaseIfUnused();
+		}
+	}
+}
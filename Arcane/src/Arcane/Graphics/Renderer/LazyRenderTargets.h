@@ -0,0 +1,69 @@
+#pragma once
+#ifndef LAZYRENDERTARGETS_H
+#define LAZYRENDERTARGETS_H
+
+#ifndef FRAMEBUFFER_H
+#include <Arcane/Platform/OpenGL/Framebuffer/Framebuffer.h>
+#endif
+
+#ifndef TIMER_H
+#include <Arcane/Util/Timer.h>
+#endif
+
+namespace Arcane
+{
+	// Targets with their own attachment layout (ie: multiple render targets) that LazyRenderTargets creates and releases as a whole
+	class ILazyRenderTarget
+	{
+	public:
+		virtual ~ILazyRenderTarget() = default;
+
+		virtual void CreateTargets() = 0;
+		virtual void ReleaseTargets() = 0;
+		virtual size_t GetTargetsMemorySize() const = 0; // What the targets take up while they are created
+	};
+
+	/*
+		Render targets of an optional effect that only hold GPU memory while the effect is used. The attachments are created the first time the effect
+		calls Acquire() and released once it hasn't been acquired for RENDER_TARGET_RELEASE_DELAY seconds, so toggling an effect on and off doesn't thrash allocations
+	*/
+	class LazyRenderTargets
+	{
+	public:
+		LazyRenderTargets(const char *effectName);
+		~LazyRenderTargets();
+
+		// The framebuffers should be constructed but have no attachments yet
+		LazyRenderTargets& AddTarget(Framebuffer *framebuffer, ColorAttachmentFormat colourFormat);
+		LazyRenderTargets& AddTarget(Framebuffer *framebuffer, ColorAttachmentFormat colourFormat, DepthStencilAttachmentFormat depthStencilFormat, bool depthStencilTexture);
+		LazyRenderTargets& AddTarget(ILazyRenderTarget *target); // Should be constructed without its targets
+
+		void Acquire(); // Call every frame the effect is used
+		void ReleaseIfUnused();
+
+		inline bool IsAllocated() const { return m_IsAllocated; }
+		inline const char* GetEffectName() const { return m_EffectName; }
+		size_t GetMemorySize() const; // What the targets take up while allocated (or save while they aren't)
+
+		static void ReleaseUnusedTargets(); // Should be called once a frame after rendering
+		static inline const std::vector<LazyRenderTargets*>& GetAll() { return s_Instances; }
+	private:
+		struct TargetDescription
+		{
+			Framebuffer *Target;
+			ColorAttachmentFormat ColourFormat;
+			bool HasDepthStencil;
+			DepthStencilAttachmentFormat DepthStencilFormat;
+			bool DepthStencilTexture; // Texture if it needs to be sampled, otherwise an RBO
+		};
+
+		const char *m_EffectName;
+		std::vector<TargetDescription> m_Targets;
+		std::vector<ILazyRenderTarget*> m_CustomTargets;
+		bool m_IsAllocated;
+		Timer m_UnusedTimer;
+
+		static std::vector<LazyRenderTargets*> s_Instances;
+	};
+}
+#endif
@@ -0,0 +1,111 @@
+#include "arcpch.h"
+#include "MeshletCuller.h"
+
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Graphics/Camera/ICamera.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+
+namespace Arcane
+{
+	// Must match the bindings in MeshletCull.glsl
+	enum MeshletBufferBinding : GLuint
+	{
+		MeshletBufferBinding_Meshlets = 0,
+		MeshletBufferBinding_DrawCommands = 1
+	};
+
+	static const uint32_t s_MeshletCullThreadGroupSize = 64; // Must match local_size_x in MeshletCull.glsl
+
+	Shader *MeshletCuller::s_CullShader = nullptr;
+	unsigned int MeshletCuller::s_CommandBuffer = 0;
+	uint32_t MeshletCuller::s_CommandCount = 0;
+	glm::vec4 MeshletCuller::s_FrustumPlanes[6];
+	glm::vec3 MeshletCuller::s_CameraPosition = glm::vec3(0.0f);
+
+	void MeshletCuller::Init()
+	{
+		s_CullShader = ShaderLoader::LoadShader("MeshletCull.glsl");
+
+		// Only ever written by the culling shader
+		glCreateBuffers(1, &s_CommandBuffer);
+		glNamedBufferStorage(s_CommandBuffer, sizeof(MeshletDrawCommand) * MESHLET_MAX_DRAWS_PER_FRAME, nullptr, 0);
+	}
+
+	void MeshletCuller::Shutdown()
+	{
+		glDeleteBuffers(1, &s_CommandBuffer);
+		s_CommandBuffer = 0;
+		s_CullShader = nullptr;
+	}
+
+	void MeshletCuller::BeginFrame()
+	{
+		s_CommandCount = 0;
+	}
+
+	void MeshletCuller::BeginCulling(ICamera *camera)
+	{
+		// Normalized frustum planes (Gribb/Hartmann) so the sphere test can compare against the radius directly
+		glm::mat4 rows = glm::transpose(camera->GetProjectionMatrix() * camera->GetViewMatrix());
+		s_FrustumPlanes[0] = rows[3] + rows[0];
+		s_FrustumPlanes[1] = rows[3] - rows[0];
+		s_FrustumPlanes[2] = rows[3] + rows[1];
+		s_FrustumPlanes[3] = rows[3] - rows[1];
+		s_FrustumPlanes[4] = rows[3] + rows[2];
+		s_FrustumPlanes[5] = rows[3] - rows[2];
+		for (glm::vec4 &plane : s_FrustumPlanes)
+			plane /= glm::length(glm::vec3(plane));
+		s_CameraPosition = camera->GetPosition();
+
+		GLCache::GetInstance()->SetShader(s_CullShader);
+		s_CullShader->SetUniformArray(ARC_UNIFORM("frustumPlanes"), 6, s_FrustumPlanes);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, MeshletBufferBinding_DrawCommands, s_CommandBuffer);
+	}
+
+	int MeshletCuller::CullModel(Model *model, const glm::mat4 &transform, bool cullBackfaces)
+	{
+		unsigned int meshletCount = model->GetMeshletCount();
+		if (meshletCount == 0 || s_CommandCount + meshletCount > MESHLET_MAX_DRAWS_PER_FRAME)
+			return -1;
+
+		// Cones are tested in mesh space, which only keeps their angles for uniform scales. Mirroring transforms flip the winding so the cones would point the wrong way
+		glm::vec3 scale = glm::vec3(glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])));
+		float maxScale = glm::max(scale.x, glm::max(scale.y, scale.z));
+		float minScale = glm::min(scale.x, glm::min(scale.y, scale.z));
+		bool coneCulling = cullBackfaces && maxScale - minScale <= maxScale * 0.01f && glm::determinant(glm::mat3(transform)) > 0.0f;
+		glm::vec3 cameraPositionMeshSpace = glm::vec3(glm::inverse(transform) * glm::vec4(s_CameraPosition, 1.0f));
+
+		s_CullShader->SetUniform(ARC_UNIFORM("model"), transform);
+		s_CullShader->SetUniform(ARC_UNIFORM("maxScale"), maxScale);
+		s_CullShader->SetUniform(ARC_UNIFORM("coneCulling"), coneCulling);
+		s_CullShader->SetUniform(ARC_UNIFORM("cameraPositionMeshSpace"), cameraPositionMeshSpace);
+
+		int firstCommand = static_cast<int>(s_CommandCount);
+		for (const Mesh &mesh : model->GetMeshes())
+		{
+			if (!mesh.HasMeshlets())
+				continue;
+
+			s_CullShader->SetUniform(ARC_UNIFORM("meshletCount"), static_cast<int>(mesh.GetMeshletCount()));
+			s_CullShader->SetUniform(ARC_UNIFORM("firstCommand"), static_cast<int>(s_CommandCount));
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, MeshletBufferBinding_Meshlets, mesh.GetMeshletBuffer());
+			glDispatchCompute((mesh.GetMeshletCount() + s_MeshletCullThreadGroupSize - 1) / s_MeshletCullThreadGroupSize, 1, 1);
+			s_CommandCount += mesh.GetMeshletCount();
+		}
+
+		return firstCommand;
+	}
+
+	void MeshletCuller::EndCulling()
+	{
+		glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, s_CommandBuffer);
+	}
+
+	void MeshletCuller::EndDrawing()
+	{
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+#ifndef MESHLETCULLER_H
+#define MESHLETCULLER_H
+
+namespace Arcane
+{
+	class ICamera;
+	class Model;
+	class Shader;
+
+	// Must match the layout of DrawElementsIndirectCommand
+	struct MeshletDrawCommand
+	{
+		uint32_t Count;
+		uint32_t InstanceCount;
+		uint32_t FirstIndex;
+		uint32_t BaseVertex;
+		uint32_t BaseInstance;
+	};
+
+	/*
+		GPU culling for meshes that were split into meshlets (see MeshletBuilder). A compute shader tests every meshlet of a model against the camera's frustum
+		and its normal cone, and writes one indexed indirect command per meshlet into a per frame command buffer. Culled meshlets get an empty command, so the
+		mesh is then drawn with a single multi draw without the CPU ever reading back what survived.
+		Culling for a batch of draws should happen before any of them are drawn so there is only one barrier between the dispatches and the draws
+	*/
+	class MeshletCuller
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		static void BeginFrame(); // Frees up the whole command buffer again
+
+		static void BeginCulling(ICamera *camera);
+		// Returns the index of the model's first command (pass it to Model::Draw), or -1 if the model has no meshlets or the frame's command buffer is full
+		static int CullModel(Model *model, const glm::mat4 &transform, bool cullBackfaces);
+		static void EndCulling(); // Waits on the culling writes and leaves the command buffer bound to GL_DRAW_INDIRECT_BUFFER for the draws
+		static void EndDrawing();
+
+		inline static bool IsInitialized() { return s_CullShader != nullptr; }
+	private:
+		static Shader *s_CullShader;
+		static unsigned int s_CommandBuffer;
+		static uint32_t s_CommandCount; // Commands handed out so far this frame
+
+		static glm::vec4 s_FrustumPlanes[6];
+		static glm::vec3 s_CameraPosition;
+	};
+}
+#endif
@@ -9,21 +9,42 @@
 #include <Arcane/Graphics/Camera/ICamera.h>
 #include <Arcane/Animation/PoseAnimator.h>
 #include <Arcane/Graphics/Renderer/DebugDraw3D.h>
+#include <Arcane/Graphics/Renderer/TextRenderer.h>
+#include <Arcane/Graphics/Renderer/MeshletCuller.h>
+#include <Arcane/Graphics/Renderer/FrameCapture.h>
+#include <Arcane/Math/BatchMath.h>
+#include <Arcane/Math/RadixSort.h>
+#include <Arcane/Graphics/Impostor/Impostor.h>
 
 namespace Arcane
 {
 	Quad* Renderer::s_NdcPlane = nullptr;
 	Cube* Renderer::s_NdcCube = nullptr;
+	Model* Renderer::s_ProxyModel = nullptr;
 	RendererData Renderer::s_RendererData = {};
 	GLCache* Renderer::s_GLCache = nullptr;
 	std::deque<MeshDrawCallInfo> Renderer::s_OpaqueMeshDrawCallQueue;
+	std::deque<MeshDrawCallInfo> Renderer::s_OpaqueLightmappedMeshDrawCallQueue;
 	std::deque<MeshDrawCallInfo> Renderer::s_OpaqueSkinnedMeshDrawCallQueue;
 	std::deque<MeshDrawCallInfo> Renderer::s_TransparentMeshDrawCallQueue;
 	std::deque<MeshDrawCallInfo> Renderer::s_TransparentSkinnedMeshDrawCallQueue;
 	std::deque<QuadDrawCallInfo> Renderer::s_QuadDrawCallQueue;
+	std::deque<ImpostorDrawCallInfo> Renderer::s_ImpostorDrawCallQueue;
+	unsigned int Renderer::s_ImpostorVAO = 0;
+	unsigned int Renderer::s_ImpostorInstanceVBO = 0;
+	unsigned int Renderer::s_ImpostorNormalMatrixVBO = 0;
+	std::vector<glm::mat4> Renderer::s_ImpostorInstanceTransforms;
+	std::vector<glm::mat3> Renderer::s_ImpostorInstanceNormalMatrices;
+	std::vector<uint32_t> Renderer::s_TransparentSortKeys;
+	std::vector<uint32_t> Renderer::s_TransparentDrawOrder;
+	std::vector<uint32_t> Renderer::s_TransparentSortScratch;
+	std::vector<int> Renderer::s_MeshletCommandIndices;
+	std::vector<glm::mat4> Renderer::s_NormalMatrixTransforms;
+	std::vector<glm::mat3> Renderer::s_NormalMatrices;
 	unsigned int Renderer::m_CurrentDrawCallCount = 0;
 	unsigned int Renderer::m_CurrentMeshesDrawnCount = 0;
 	unsigned int Renderer::m_CurrentQuadsDrawnCount = 0;
+	unsigned int Renderer::m_CurrentImpostorsDrawnCount = 0;
 
 	void Renderer::Init()
 	{
@@ -37,12 +58,51 @@ namespace Arcane
 		s_NdcPlane = new Quad();
 		s_NdcCube = new Cube();
 
+		// Shares the cube's buffers, untextured so it never waits on anything itself
+		s_ProxyModel = new Model(*s_NdcCube);
+		glm::vec4 proxyAlbedo = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
+		Material &proxyMaterial = s_ProxyModel->GetMeshes()[0].GetMaterial();
+		proxyMaterial.SetAlbedoColour(proxyAlbedo);
+		proxyMaterial.SetRoughnessValue(1.0f);
+		proxyMaterial.SetMetallicValue(0.0f);
+
+		// Per instance model matrix takes up attribute locations 0-3, followed by its normal matrix in 4-6
+		glGenVertexArrays(1, &s_ImpostorVAO);
+		glGenBuffers(1, &s_ImpostorInstanceVBO);
+		glGenBuffers(1, &s_ImpostorNormalMatrixVBO);
+		glBindVertexArray(s_ImpostorVAO);
+		glBindBuffer(GL_ARRAY_BUFFER, s_ImpostorInstanceVBO);
+		for (unsigned int i = 0; i < 4; i++)
+		{
+			glEnableVertexAttribArray(i);
+			glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), reinterpret_cast<void*>(sizeof(glm::vec4) * i));
+			glVertexAttribDivisor(i, 1);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, s_ImpostorNormalMatrixVBO);
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			glEnableVertexAttribArray(4 + i);
+			glVertexAttribPointer(4 + i, 3, GL_FLOAT, GL_FALSE, sizeof(glm::mat3), reinterpret_cast<void*>(sizeof(glm::vec3) * i));
+			glVertexAttribDivisor(4 + i, 1);
+		}
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
 		DebugDraw3D::Init();
+		TextRenderer::Init();
+		MeshletCuller::Init();
+		FrameCapture::Init();
 	}
 
 	void Renderer::Shutdown()
 	{
+		glDeleteBuffers(1, &s_ImpostorInstanceVBO);
+		glDeleteBuffers(1, &s_ImpostorNormalMatrixVBO);
+		glDeleteVertexArrays(1, &s_ImpostorVAO);
 
+		TextRenderer::Shutdown();
+		MeshletCuller::Shutdown();
+		FrameCapture::Shutdown();
 	}
 
 	void Renderer::BeginFrame()
@@ -50,8 +110,11 @@ namespace Arcane
 		m_CurrentDrawCallCount = 0;
 		m_CurrentMeshesDrawnCount = 0;
 		m_CurrentQuadsDrawnCount = 0;
+		m_CurrentImpostorsDrawnCount = 0;
 
 		DebugDraw3D::BeginBatch();
+		TextRenderer::BeginBatch();
+		MeshletCuller::BeginFrame();
 	}
 
 	void Renderer::EndFrame()
@@ -59,6 +122,7 @@ namespace Arcane
 		s_RendererData.DrawCallCount = m_CurrentDrawCallCount;
 		s_RendererData.MeshesDrawnCount = m_CurrentMeshesDrawnCount;
 		s_RendererData.QuadsDrawnCount = m_CurrentQuadsDrawnCount;
+		s_RendererData.ImpostorsDrawnCount = m_CurrentImpostorsDrawnCount;
 	}
 
 	void Renderer::QueueQuad(const glm::vec3 &position, const glm::vec2 &size, const Texture *texture)
@@ -72,8 +136,26 @@ namespace Arcane
 		s_QuadDrawCallQueue.emplace_back(QuadDrawCallInfo{ texture, transform });
 	}
 
-	void Renderer::QueueMesh(Model *model, const glm::mat4 &transform, PoseAnimator *animator/*= nullptr*/, bool isTransparent/*= false*/, bool cullBackface/*= true*/)
+	void Renderer::QueueImpostor(Impostor *impostor, const glm::mat4 &transform)
 	{
+		s_ImpostorDrawCallQueue.emplace_back(ImpostorDrawCallInfo{ impostor, transform });
+	}
+
+	void Renderer::QueueMesh(Model *model, const glm::mat4 &transform, PoseAnimator *animator/*= nullptr*/, bool isTransparent/*= false*/, bool cullBackface/*= true*/, bool isLightmapped/*= false*/, const glm::vec4 &lightmapScaleOffset/*= glm::vec4(0.0f)*/)
+	{
+		// A model that is still streaming in has its meshes written on a worker thread, so a fixed size cube marks where it will show up instead (the model's own scale means nothing without its bounds)
+		if (!model->IsLoaded())
+		{
+			if (STARTUP_PROXY_MESH_SIZE <= 0.0f)
+				return;
+
+			glm::mat4 proxyTransform = transform;
+			for (int i = 0; i < 3; i++)
+				proxyTransform[i] = glm::vec4(glm::normalize(glm::vec3(transform[i])) * STARTUP_PROXY_MESH_SIZE, 0.0f);
+			s_OpaqueMeshDrawCallQueue.emplace_back(MeshDrawCallInfo{ s_ProxyModel, nullptr, proxyTransform, true });
+			return;
+		}
+
 		if (isTransparent)
 		{
 			if (animator)
@@ -91,6 +173,10 @@ namespace Arcane
 			{
 				s_OpaqueSkinnedMeshDrawCallQueue.emplace_back(MeshDrawCallInfo{ model, animator, transform, cullBackface });
 			}
+			else if (isLightmapped)
+			{
+				s_OpaqueLightmappedMeshDrawCallQueue.emplace_back(MeshDrawCallInfo{ model, nullptr, transform, cullBackface, lightmapScaleOffset });
+			}
 			else
 			{
 				s_OpaqueMeshDrawCallQueue.emplace_back(MeshDrawCallInfo{ model, nullptr, transform, cullBackface });
@@ -105,6 +191,7 @@ namespace Arcane
 			s_GLCache->SetShader(skinnedShader);
 			BindModelCameraInfo(camera, skinnedShader);
 			SetupOpaqueRenderState();
+			ComputeNormalMatrices(s_OpaqueSkinnedMeshDrawCallQueue, renderPassType);
 
 			while (!s_OpaqueSkinnedMeshDrawCallQueue.empty())
 			{
@@ -122,86 +209,148 @@ namespace Arcane
 		}
 	}
 
-	void Renderer::FlushOpaqueNonSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader)
+	void Renderer::FlushOpaqueNonSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader, bool meshletCulling)
 	{
 		if (!s_OpaqueMeshDrawCallQueue.empty())
 		{
+			// Cull the meshlets of every draw up front, so there is a single barrier before all of the draws
+			meshletCulling = MESHLET_CULLING && meshletCulling && MeshletCuller::IsInitialized();
+			if (meshletCulling)
+			{
+				s_MeshletCommandIndices.resize(s_OpaqueMeshDrawCallQueue.size());
+				MeshletCuller::BeginCulling(camera);
+				for (size_t i = 0; i < s_OpaqueMeshDrawCallQueue.size(); i++)
+				{
+					MeshDrawCallInfo &current = s_OpaqueMeshDrawCallQueue[i];
+					s_MeshletCommandIndices[i] = MeshletCuller::CullModel(current.model, current.transform, current.cullBackface);
+				}
+				MeshletCuller::EndCulling();
+			}
+
 			s_GLCache->SetShader(shader);
 			BindModelCameraInfo(camera, shader);
 			SetupOpaqueRenderState();
+			ComputeNormalMatrices(s_OpaqueMeshDrawCallQueue, renderPassType);
 
+			size_t drawIndex = 0;
 			while (!s_OpaqueMeshDrawCallQueue.empty())
 			{
 				MeshDrawCallInfo &current = s_OpaqueMeshDrawCallQueue.front();
 
 				s_GLCache->SetFaceCull(current.cullBackface);
 				SetupModelMatrix(shader, current, renderPassType);
-				current.model->Draw(shader, renderPassType);
+				if (meshletCulling)
+					current.model->Draw(shader, renderPassType, s_MeshletCommandIndices[drawIndex++]);
+				else
+					current.model->Draw(shader, renderPassType);
 				m_CurrentDrawCallCount++;
 				m_CurrentMeshesDrawnCount++;
 
 				s_OpaqueMeshDrawCallQueue.pop_front();
 			}
+
+			if (meshletCulling)
+				MeshletCuller::EndDrawing();
 		}
 	}
 
-	void Renderer::FlushTransparentSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *skinnedShader)
+	void Renderer::FlushOpaqueLightmappedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader, bool additiveBlend)
 	{
-		// Sort from back to front, does not account for rotations, scaling, or animation
-		if (!s_TransparentSkinnedMeshDrawCallQueue.empty())
+		if (!s_OpaqueLightmappedMeshDrawCallQueue.empty())
 		{
-			s_GLCache->SetShader(skinnedShader);
-			BindModelCameraInfo(camera, skinnedShader);
-			SetupTransparentRenderState();
+			s_GLCache->SetShader(shader);
+			BindModelCameraInfo(camera, shader);
+			SetupOpaqueRenderState();
+			if (additiveBlend)
+			{
+				s_GLCache->SetBlend(true);
+				s_GLCache->SetBlendFunc(GL_ONE, GL_ONE);
+			}
+			ComputeNormalMatrices(s_OpaqueLightmappedMeshDrawCallQueue, renderPassType);
 
-			std::sort(s_TransparentSkinnedMeshDrawCallQueue.begin(), s_TransparentSkinnedMeshDrawCallQueue.end(),
-				[camera](MeshDrawCallInfo &a, MeshDrawCallInfo &b) -> bool
-				{
-					return glm::length2(camera->GetPosition() - glm::vec3(a.transform[3])) > glm::length2(camera->GetPosition() - glm::vec3(b.transform[3])); // transform[3] - Gets the translation part of the matrix
-				});
-			while (!s_TransparentSkinnedMeshDrawCallQueue.empty())
+			while (!s_OpaqueLightmappedMeshDrawCallQueue.empty())
 			{
-				MeshDrawCallInfo &current = s_TransparentSkinnedMeshDrawCallQueue.front();
+				MeshDrawCallInfo &current = s_OpaqueLightmappedMeshDrawCallQueue.front();
 
 				s_GLCache->SetFaceCull(current.cullBackface);
-				SetupModelMatrix(skinnedShader, current, renderPassType);
-				SetupBoneMatrices(skinnedShader, current);
-				current.model->Draw(skinnedShader, renderPassType);
+				SetupModelMatrix(shader, current, renderPassType);
+				shader->SetUniform(ARC_UNIFORM("lightmapScaleOffset"), current.lightmapScaleOffset);
+				current.model->Draw(shader, renderPassType);
 				m_CurrentDrawCallCount++;
 				m_CurrentMeshesDrawnCount++;
 
-				s_TransparentSkinnedMeshDrawCallQueue.pop_front();
+				s_OpaqueLightmappedMeshDrawCallQueue.pop_front();
 			}
 		}
 	}
 
-	void Renderer::FlushTransparentNonSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader)
+	void Renderer::FlushTransparentMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader, Shader *skinnedShader, bool orderIndependent)
 	{
-		// Sort from back to front, does not account for rotations or scaling
-		if (!s_TransparentMeshDrawCallQueue.empty())
+		// Skinned and non-skinned draws go out as one stream so they blend in the right order with each other. Indices below nonSkinnedCount are non-skinned draws
+		size_t nonSkinnedCount = s_TransparentMeshDrawCallQueue.size();
+		size_t drawCount = nonSkinnedCount + s_TransparentSkinnedMeshDrawCallQueue.size();
+		if (drawCount == 0)
+			return;
+
+		s_TransparentDrawOrder.resize(drawCount);
+		if (orderIndependent)
+		{
+			// Order independent transparency doesn't need any sorting
+			SetupOrderIndependentTransparentRenderState();
+			for (size_t i = 0; i < drawCount; i++)
+				s_TransparentDrawOrder[i] = static_cast<uint32_t>(i);
+		}
+		else
 		{
-			s_GLCache->SetShader(shader);
-			BindModelCameraInfo(camera, shader);
 			SetupTransparentRenderState();
 
-			std::sort(s_TransparentMeshDrawCallQueue.begin(), s_TransparentMeshDrawCallQueue.end(),
-				[camera](MeshDrawCallInfo &a, MeshDrawCallInfo &b) -> bool
-				{
-					return glm::length2(camera->GetPosition() - glm::vec3(a.transform[3])) > glm::length2(camera->GetPosition() - glm::vec3(b.transform[3])); // transform[3] - Gets the translation part of the matrix
-				});
-			while (!s_TransparentMeshDrawCallQueue.empty())
+			// Sort from back to front by view depth, computed once per draw instead of inside the comparator. Does not account for rotations, scaling, or animation
+			glm::mat4 view = camera->GetViewMatrix();
+			glm::vec3 viewDepthRow = glm::vec3(view[0][2], view[1][2], view[2][2]);
+			s_TransparentSortKeys.resize(drawCount);
+			s_TransparentSortScratch.resize(drawCount);
+			for (size_t i = 0; i < drawCount; i++)
 			{
-				MeshDrawCallInfo &current = s_TransparentMeshDrawCallQueue.front();
+				const MeshDrawCallInfo &current = i < nonSkinnedCount ? s_TransparentMeshDrawCallQueue[i] : s_TransparentSkinnedMeshDrawCallQueue[i - nonSkinnedCount];
+				float viewDepth = -(glm::dot(viewDepthRow, glm::vec3(current.transform[3])) + view[3][2]); // transform[3] - Gets the translation part of the matrix
+				s_TransparentSortKeys[i] = ~RadixSort::FloatToKey(viewDepth); // Flipped so the furthest draw sorts first
+			}
+			RadixSort::SortIndices(s_TransparentSortKeys.data(), s_TransparentDrawOrder.data(), s_TransparentSortScratch.data(), drawCount);
+		}
 
-				s_GLCache->SetFaceCull(current.cullBackface);
-				SetupModelMatrix(shader, current, renderPassType);
-				current.model->Draw(shader, renderPassType);
-				m_CurrentDrawCallCount++;
-				m_CurrentMeshesDrawnCount++;
+		ComputeNormalMatrices(s_TransparentMeshDrawCallQueue, renderPassType);
+		ComputeNormalMatrices(s_TransparentSkinnedMeshDrawCallQueue, renderPassType);
 
-				s_TransparentMeshDrawCallQueue.pop_front();
-			}
+		if (nonSkinnedCount != 0)
+		{
+			s_GLCache->SetShader(shader);
+			BindModelCameraInfo(camera, shader);
+		}
+		if (nonSkinnedCount != drawCount)
+		{
+			s_GLCache->SetShader(skinnedShader);
+			BindModelCameraInfo(camera, skinnedShader);
 		}
+
+		for (size_t i = 0; i < drawCount; i++)
+		{
+			uint32_t drawIndex = s_TransparentDrawOrder[i];
+			bool isSkinned = drawIndex >= nonSkinnedCount;
+			MeshDrawCallInfo &current = isSkinned ? s_TransparentSkinnedMeshDrawCallQueue[drawIndex - nonSkinnedCount] : s_TransparentMeshDrawCallQueue[drawIndex];
+			Shader *drawShader = isSkinned ? skinnedShader : shader;
+
+			s_GLCache->SetShader(drawShader); // Only rebinds when the stream switches between skinned and non-skinned
+			s_GLCache->SetFaceCull(current.cullBackface);
+			SetupModelMatrix(drawShader, current, renderPassType);
+			if (isSkinned)
+				SetupBoneMatrices(drawShader, current);
+			current.model->Draw(drawShader, renderPassType);
+			m_CurrentDrawCallCount++;
+			m_CurrentMeshesDrawnCount++;
+		}
+
+		s_TransparentMeshDrawCallQueue.clear();
+		s_TransparentSkinnedMeshDrawCallQueue.clear();
 	}
 
 	void Renderer::FlushQuads(ICamera *camera, Shader *shader)
@@ -218,7 +367,7 @@ namespace Arcane
 				QuadDrawCallInfo &current = s_QuadDrawCallQueue.front();
 
 				current.texture->Bind(5);
-				shader->SetUniform("sprite", 5);
+				shader->SetUniform(ARC_UNIFORM("sprite"), 5);
 				SetupModelMatrix(shader, current);
 				localQuad.Draw();
 				m_CurrentDrawCallCount++;
@@ -229,6 +378,76 @@ namespace Arcane
 		}
 	}
 
+	void Renderer::FlushImpostors(ICamera *camera, RenderPassType renderPassType, Shader *shader)
+	{
+		if (!s_ImpostorDrawCallQueue.empty())
+		{
+			s_GLCache->SetShader(shader);
+			BindModelCameraInfo(camera, shader);
+			SetupQuadRenderState();
+
+			// Group the instances by impostor so every impostor is a single instanced draw
+			std::sort(s_ImpostorDrawCallQueue.begin(), s_ImpostorDrawCallQueue.end(), [](const ImpostorDrawCallInfo &a, const ImpostorDrawCallInfo &b) { return a.impostor < b.impostor; });
+
+			glBindVertexArray(s_ImpostorVAO);
+			size_t batchStart = 0;
+			while (batchStart < s_ImpostorDrawCallQueue.size())
+			{
+				Impostor *impostor = s_ImpostorDrawCallQueue[batchStart].impostor;
+
+				s_ImpostorInstanceTransforms.clear();
+				size_t batchEnd = batchStart;
+				while (batchEnd < s_ImpostorDrawCallQueue.size() && s_ImpostorDrawCallQueue[batchEnd].impostor == impostor)
+				{
+					s_ImpostorInstanceTransforms.push_back(s_ImpostorDrawCallQueue[batchEnd].transform);
+					batchEnd++;
+				}
+
+				// The shader needs the inverse of every instance's rotation/scale, computing it once per instance here is far cheaper than per vertex
+				s_ImpostorInstanceNormalMatrices.resize(s_ImpostorInstanceTransforms.size());
+				BatchMath::NormalMatrices(&s_ImpostorInstanceTransforms[0], &s_ImpostorInstanceNormalMatrices[0], s_ImpostorInstanceTransforms.size());
+
+				// Orphan the buffers so we don't stall on the previous batch still being read
+				GLsizeiptr instanceDataSize = static_cast<GLsizeiptr>(sizeof(glm::mat4) * s_ImpostorInstanceTransforms.size());
+				glBindBuffer(GL_ARRAY_BUFFER, s_ImpostorInstanceVBO);
+				glBufferData(GL_ARRAY_BUFFER, instanceDataSize, nullptr, GL_STREAM_DRAW);
+				glBufferSubData(GL_ARRAY_BUFFER, 0, instanceDataSize, &s_ImpostorInstanceTransforms[0]);
+
+				GLsizeiptr normalMatrixDataSize = static_cast<GLsizeiptr>(sizeof(glm::mat3) * s_ImpostorInstanceNormalMatrices.size());
+				glBindBuffer(GL_ARRAY_BUFFER, s_ImpostorNormalMatrixVBO);
+				glBufferData(GL_ARRAY_BUFFER, normalMatrixDataSize, nullptr, GL_STREAM_DRAW);
+				glBufferSubData(GL_ARRAY_BUFFER, 0, normalMatrixDataSize, &s_ImpostorInstanceNormalMatrices[0]);
+
+				if (renderPassType == MaterialRequired)
+				{
+					impostor->GetAlbedoAtlas()->Bind(0);
+					shader->SetUniform(ARC_UNIFORM("albedoAtlas"), 0);
+					impostor->GetNormalAtlas()->Bind(1);
+					shader->SetUniform(ARC_UNIFORM("normalAtlas"), 1);
+					impostor->GetMaterialInfoAtlas()->Bind(2);
+					shader->SetUniform(ARC_UNIFORM("materialInfoAtlas"), 2);
+				}
+				impostor->GetDepthAtlas()->Bind(3);
+				shader->SetUniform(ARC_UNIFORM("depthAtlas"), 3);
+				shader->SetUniform(ARC_UNIFORM("framesPerSide"), static_cast<int>(impostor->GetFramesPerSide()));
+				shader->SetUniform(ARC_UNIFORM("hemispherical"), static_cast<int>(impostor->IsHemispherical()));
+				shader->SetUniform(ARC_UNIFORM("boundsCentre"), impostor->GetBoundsCentre());
+				shader->SetUniform(ARC_UNIFORM("boundsRadius"), impostor->GetBoundsRadius());
+
+				GLsizei instanceCount = static_cast<GLsizei>(s_ImpostorInstanceTransforms.size());
+				glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, instanceCount);
+				m_CurrentDrawCallCount++;
+				m_CurrentImpostorsDrawnCount += instanceCount;
+
+				batchStart = batchEnd;
+			}
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			glBindVertexArray(0);
+
+			s_ImpostorDrawCallQueue.clear();
+		}
+	}
+
 	void Renderer::DrawNdcPlane()
 	{
 		s_NdcPlane->Draw();
@@ -248,15 +467,32 @@ namespace Arcane
 
 	void Renderer::BindModelCameraInfo(ICamera *camera, Shader *shader)
 	{
-		shader->SetUniform("viewPos", camera->GetPosition());
-		shader->SetUniform("view", camera->GetViewMatrix());
-		shader->SetUniform("projection", camera->GetProjectionMatrix());
+		shader->SetUniform(ARC_UNIFORM("viewPos"), camera->GetPosition());
+		shader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+		shader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
 	}
 
 	void Renderer::BindQuadCameraInfo(ICamera *camera, Shader *shader)
 	{
-		shader->SetUniform("view", camera->GetViewMatrix());
-		shader->SetUniform("projection", camera->GetProjectionMatrix());
+		shader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+		shader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
+	}
+
+	void Renderer::ComputeNormalMatrices(std::deque<MeshDrawCallInfo> &drawCallQueue, RenderPassType pass)
+	{
+		// Only passes with materials upload the normal matrix
+		if (pass != MaterialRequired || drawCallQueue.empty())
+			return;
+
+		size_t drawCount = drawCallQueue.size();
+		s_NormalMatrixTransforms.resize(drawCount);
+		s_NormalMatrices.resize(drawCount);
+		for (size_t i = 0; i < drawCount; i++)
+			s_NormalMatrixTransforms[i] = drawCallQueue[i].transform;
+
+		BatchMath::NormalMatrices(&s_NormalMatrixTransforms[0], &s_NormalMatrices[0], drawCount);
+		for (size_t i = 0; i < drawCount; i++)
+			drawCallQueue[i].normalMatrix = s_NormalMatrices[i];
 	}
 
 	void Renderer::SetupModelMatrix(Shader *shader, MeshDrawCallInfo &drawCallInfo, RenderPassType pass)
@@ -268,12 +504,11 @@ namespace Arcane
 			model = glm::translate(glm::mat4(1.0f), entity->GetParent()->GetPosition()) * glm::toMat4(entity->GetParent()->GetOrientation()) * translate * rotate * scale; // translate, rotate, scale, are for the local object
 		}
 #endif
-		shader->SetUniform("model", drawCallInfo.transform);
+		shader->SetUniform(ARC_UNIFORM("model"), drawCallInfo.transform);
 
 		if (pass == MaterialRequired)
 		{
-			glm::mat3 normalMatrix = glm::mat3(glm::transpose(glm::inverse(drawCallInfo.transform)));
-			shader->SetUniform("normalMatrix", normalMatrix);
+			shader->SetUniform(ARC_UNIFORM("normalMatrix"), drawCallInfo.normalMatrix);
 		}
 	}
 
@@ -286,7 +521,7 @@ namespace Arcane
 			model = glm::translate(glm::mat4(1.0f), entity->GetParent()->GetPosition()) * glm::toMat4(entity->GetParent()->GetOrientation()) * translate * rotate * scale; // translate, rotate, scale, are for the local object
 		}
 #endif
-		shader->SetUniform("model", drawCallInfo.transform);
+		shader->SetUniform(ARC_UNIFORM("model"), drawCallInfo.transform);
 	}
 
 	void Renderer::SetupBoneMatrices(Shader *shader, MeshDrawCallInfo &drawCallInfo)
@@ -294,7 +529,7 @@ namespace Arcane
 		if (drawCallInfo.animator)
 		{
 			const std::vector<glm::mat4> &matrices = drawCallInfo.animator->GetFinalBoneMatrices();
-			shader->SetUniformArray("bonesMatrices", static_cast<int>(matrices.size()), &matrices[0]);
+			shader->SetUniformArray(ARC_UNIFORM("bonesMatrices"), static_cast<int>(matrices.size()), &matrices[0]);
 		}
 	}
 
@@ -313,6 +548,17 @@ namespace Arcane
 		s_GLCache->SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	}
 
+	void Renderer::SetupOrderIndependentTransparentRenderState()
+	{
+		// Accumulation is additive and revealage is multiplied by (1 - alpha), both are commutative so draw order doesn't matter
+		s_GLCache->SetDepthTest(true);
+		glDepthMask(GL_FALSE);
+		s_GLCache->SetBlend(true);
+		s_GLCache->SetCullFace(GL_BACK);
+		s_GLCache->SetBlendFunc(0, GL_ONE, GL_ONE);
+		s_GLCache->SetBlendFunc(1, GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+	}
+
 	void Renderer::SetupQuadRenderState()
 	{
 		s_GLCache->SetDepthTest(true);
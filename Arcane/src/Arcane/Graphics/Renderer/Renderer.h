@@ -17,6 +17,7 @@ namespace Arcane
 	class Cube;
 	class Quad;
 	class PoseAnimator;
+	class Impostor;
 
 	struct RendererData
 	{
@@ -28,6 +29,7 @@ namespace Arcane
 		unsigned int DrawCallCount;
 		unsigned int MeshesDrawnCount;
 		unsigned int QuadsDrawnCount;
+		unsigned int ImpostorsDrawnCount;
 	};
 
 	// TODO: Should eventually have a render ID and we can order drawcalls to avoid changing GPU state (shaders etc)
@@ -38,12 +40,19 @@ namespace Arcane
 		PoseAnimator *animator = nullptr;
 		glm::mat4 transform;
 		bool cullBackface;
+		glm::vec4 lightmapScaleOffset = glm::vec4(0.0f);
+		glm::mat3 normalMatrix = glm::mat3(1.0f); // Computed in a batch for the whole queue when it gets flushed by a pass that needs materials
 	};
 	struct QuadDrawCallInfo
 	{
 		const Texture *texture = nullptr;
 		glm::mat4 transform;
 	};
+	struct ImpostorDrawCallInfo
+	{
+		Impostor *impostor = nullptr;
+		glm::mat4 transform;
+	};
 
 	class Renderer
 	{
@@ -54,15 +63,20 @@ namespace Arcane
 		static void BeginFrame();
 		static void EndFrame();
 
-		static void QueueMesh(Model *model, const glm::mat4 &transform, PoseAnimator *animator = nullptr, bool isTransparent = false, bool cullBackface = true);
+		static void QueueMesh(Model *model, const glm::mat4 &transform, PoseAnimator *animator = nullptr, bool isTransparent = false, bool cullBackface = true, bool isLightmapped = false, const glm::vec4 &lightmapScaleOffset = glm::vec4(0.0f));
 		static void QueueQuad(const glm::vec3 &position, const glm::vec2 &size, const Texture *texture); // TODO: Should use batch rendering to efficiently render quads together
 		static void QueueQuad(const glm::mat4 &transform, const Texture *texture); // TODO: Should use batch rendering to efficiently render quads together
+		static void QueueImpostor(Impostor *impostor, const glm::mat4 &transform);
 
 		static void FlushOpaqueSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *skinnedShader);
-		static void FlushOpaqueNonSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader);
-		static void FlushTransparentSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *skinnedShader);
-		static void FlushTransparentNonSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader);
+		static void FlushOpaqueNonSkinnedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader, bool meshletCulling = false); // Meshlet culling uses the camera's frustum, only for passes that render from the camera
+		static void FlushOpaqueLightmappedMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader, bool additiveBlend = false); // Kept apart so passes can light them with only the dynamic lights, additive blending is for compositing the baked lighting
+		// orderIndependent skips the back to front sort and sets up the blending for an OITBuffer, depth writes are left off for the caller to restore
+		static void FlushTransparentMeshes(ICamera *camera, RenderPassType renderPassType, Shader *shader, Shader *skinnedShader, bool orderIndependent = false); // Skinned and non-skinned are sorted together into one back to front stream
 		static void FlushQuads(ICamera *camera, Shader *shader);
+		static void FlushImpostors(ICamera *camera, RenderPassType renderPassType, Shader *shader); // Instanced, one draw call per unique impostor. Depth only passes just get the depth atlas bound
+
+		inline static bool HasTransparentMeshesQueued() { return !s_TransparentMeshDrawCallQueue.empty() || !s_TransparentSkinnedMeshDrawCallQueue.empty(); }
 
 		static void DrawNdcPlane();
 		static void DrawNdcCube();
@@ -71,28 +85,45 @@ namespace Arcane
 	private:
 		static void BindModelCameraInfo(ICamera *camera, Shader *shader);
 		static void BindQuadCameraInfo(ICamera *camera, Shader *shader);
+		static void ComputeNormalMatrices(std::deque<MeshDrawCallInfo> &drawCallQueue, RenderPassType pass);
 		static void SetupModelMatrix(Shader *shader, MeshDrawCallInfo &drawCallInfo, RenderPassType pass);
 		static void SetupModelMatrix(Shader *shader, QuadDrawCallInfo &drawCallInfo);
 		static void SetupBoneMatrices(Shader *shader, MeshDrawCallInfo &drawCallInfo);
 		static void SetupOpaqueRenderState();
 		static void SetupTransparentRenderState();
+		static void SetupOrderIndependentTransparentRenderState();
 		static void SetupQuadRenderState();
 	private:
 		static Quad *s_NdcPlane;
 		static Cube *s_NdcCube;
+		static Model *s_ProxyModel; // Drawn in place of models that are still loading
 
 		static RendererData s_RendererData;
 		static GLCache *s_GLCache;
 
 		static std::deque<MeshDrawCallInfo> s_OpaqueMeshDrawCallQueue;
+		static std::deque<MeshDrawCallInfo> s_OpaqueLightmappedMeshDrawCallQueue;
 		static std::deque<MeshDrawCallInfo> s_OpaqueSkinnedMeshDrawCallQueue;
 		static std::deque<MeshDrawCallInfo> s_TransparentMeshDrawCallQueue;
 		static std::deque<MeshDrawCallInfo> s_TransparentSkinnedMeshDrawCallQueue;
 		static std::deque<QuadDrawCallInfo> s_QuadDrawCallQueue;
+		static std::deque<ImpostorDrawCallInfo> s_ImpostorDrawCallQueue;
+
+		// Scratch for sorting the transparent draws, kept around so the sort doesn't allocate every frame
+		static std::vector<uint32_t> s_TransparentSortKeys, s_TransparentDrawOrder, s_TransparentSortScratch;
+		static std::vector<int> s_MeshletCommandIndices; // First culled meshlet command of each opaque draw, -1 if it's drawn whole
+		static std::vector<glm::mat4> s_NormalMatrixTransforms; // Queue transforms gathered into a flat array for BatchMath
+		static std::vector<glm::mat3> s_NormalMatrices;
+
+		// Impostors are vertex pulled quads, the VAO only holds the per instance transforms and normal matrices
+		static unsigned int s_ImpostorVAO, s_ImpostorInstanceVBO, s_ImpostorNormalMatrixVBO;
+		static std::vector<glm::mat4> s_ImpostorInstanceTransforms;
+		static std::vector<glm::mat3> s_ImpostorInstanceNormalMatrices;
 
 		static unsigned int m_CurrentDrawCallCount;
 		static unsigned int m_CurrentMeshesDrawnCount;
 		static unsigned int m_CurrentQuadsDrawnCount;
+		static unsigned int m_CurrentImpostorsDrawnCount;
 	};
 }
 #endif
@@ -6,6 +6,7 @@
 #include <Arcane/Graphics/Camera/ICamera.h>
 #include <Arcane/Graphics/Renderer/GLCache.h>
 #include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
 #include <Arcane/Scene/Scene.h>
 #include <Arcane/Util/Loaders/ShaderLoader.h>
 #include <Arcane/Platform/OpenGL/Framebuffer/GBuffer.h>
@@ -14,28 +15,38 @@ namespace Arcane
 {
 	DeferredGeometryPass::DeferredGeometryPass(Scene *scene) : RenderPass(scene), m_AllocatedGBuffer(true)
 	{
+		m_GBuffer = new GBuffer(Window::GetRenderResolutionWidth(), Window::GetRenderResolutionHeight(), false);
+		m_GBufferTargets = new LazyRenderTargets("GBuffer");
+		m_GBufferTargets->AddTarget(m_GBuffer);
+
 		m_ModelShader = ShaderLoader::LoadShader("deferred/PBR_Model_GeometryPass.glsl");
 		m_SkinnedModelShader = ShaderLoader::LoadShader("deferred/PBR_Skinned_Model_GeometryPass.glsl");
 		m_TerrainShader = ShaderLoader::LoadShader("deferred/PBR_Terrain_GeometryPass.glsl");
-
-		m_GBuffer = new GBuffer(Window::GetRenderResolutionWidth(), Window::GetRenderResolutionHeight());
+		m_ImpostorShader = ShaderLoader::LoadShader("deferred/Impostor_GeometryPass.glsl");
+		m_FoliageShader = ShaderLoader::LoadShader("deferred/Foliage_GeometryPass.glsl");
 	}
 
-	DeferredGeometryPass::DeferredGeometryPass(Scene *scene, GBuffer *customGBuffer) : RenderPass(scene), m_AllocatedGBuffer(false), m_GBuffer(customGBuffer)
+	DeferredGeometryPass::DeferredGeometryPass(Scene *scene, GBuffer *customGBuffer) : RenderPass(scene), m_AllocatedGBuffer(false), m_GBuffer(customGBuffer), m_GBufferTargets(nullptr)
 	{
 		m_ModelShader = ShaderLoader::LoadShader("deferred/PBR_Model_GeometryPass.glsl");
 		m_TerrainShader = ShaderLoader::LoadShader("deferred/PBR_Terrain_GeometryPass.glsl");
+		m_ImpostorShader = ShaderLoader::LoadShader("deferred/Impostor_GeometryPass.glsl");
+		m_FoliageShader = ShaderLoader::LoadShader("deferred/Foliage_GeometryPass.glsl");
 	}
 
 	DeferredGeometryPass::~DeferredGeometryPass()
 	{
 		if (m_AllocatedGBuffer) {
+			delete m_GBufferTargets;
 			delete m_GBuffer;
 		}
 	}
 
 	GeometryPassOutput DeferredGeometryPass::ExecuteGeometryPass(ICamera *camera, bool renderOnlyStatic)
 	{
+		if (m_GBufferTargets)
+			m_GBufferTargets->Acquire();
+
 		glViewport(0, 0, m_GBuffer->GetWidth(), m_GBuffer->GetHeight());
 		m_GBuffer->Bind();
 		m_GBuffer->ClearAll();
@@ -50,11 +61,13 @@ namespace Arcane
 		// Setup model renderer for opaque objects only
 		if (renderOnlyStatic)
 		{
-			m_ActiveScene->AddModelsToRenderer(ModelFilterType::OpaqueStaticModels);
+			m_ActiveScene->AddModelsToRenderer(ModelFilterType::OpaqueStaticModels, camera);
 		}
 		else
 		{
-			m_ActiveScene->AddModelsToRenderer(ModelFilterType::OpaqueModels);
+			// PVS culling only applies to the main view, passes rendering into a custom GBuffer (probes) capture from outside of the baked cells
+			// Same goes for the lightmap, probes still want the static lights evaluated at runtime
+			m_ActiveScene->AddModelsToRenderer(ModelFilterType::OpaqueModels, camera, m_AllocatedGBuffer ? camera : nullptr, m_AllocatedGBuffer);
 		}
 
 		// Render opaque objects (use stencil to denote models for the deferred lighting pass)
@@ -64,7 +77,15 @@ namespace Arcane
 		Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_SkinnedModelShader);
 		ARC_POP_RENDER_TAG();
 		ARC_PUSH_RENDER_TAG("Non-Skinned Models");
-		Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader);
+		Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader, true);
+		ARC_POP_RENDER_TAG();
+		ARC_PUSH_RENDER_TAG("Lightmapped Models");
+		m_GLCache->SetStencilFunc(GL_ALWAYS, StencilValue::LightmappedModelStencilValue, 0xFF);
+		Renderer::FlushOpaqueLightmappedMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader);
+		m_GLCache->SetStencilFunc(GL_ALWAYS, StencilValue::ModelStencilValue, 0xFF);
+		ARC_POP_RENDER_TAG();
+		ARC_PUSH_RENDER_TAG("Impostors");
+		Renderer::FlushImpostors(camera, MaterialRequired, m_ImpostorShader);
 		ARC_POP_RENDER_TAG();
 		m_GLCache->SetStencilWriteMask(0x00);
 
@@ -74,8 +95,8 @@ namespace Arcane
 			// Setup terrain information
 			ARC_PUSH_RENDER_TAG("Terrain");
 			m_GLCache->SetShader(m_TerrainShader);
-			m_TerrainShader->SetUniform("view", camera->GetViewMatrix());
-			m_TerrainShader->SetUniform("projection", camera->GetProjectionMatrix());
+			m_TerrainShader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+			m_TerrainShader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
 
 			// Render the terrain (use stencil to denote the terrain for the deferred lighting pass)
 			m_GLCache->SetStencilWriteMask(0xFF);
@@ -83,6 +104,18 @@ namespace Arcane
 			terrain->Draw(m_TerrainShader, MaterialRequired);
 			m_GLCache->SetStencilWriteMask(0x00);
 			ARC_POP_RENDER_TAG();
+
+			// Foliage is lit like any other model
+			FoliageSystem *foliage = terrain->GetFoliageSystem();
+			if (foliage->HasLayers())
+			{
+				ARC_PUSH_RENDER_TAG("Foliage");
+				m_GLCache->SetStencilWriteMask(0xFF);
+				m_GLCache->SetStencilFunc(GL_ALWAYS, StencilValue::ModelStencilValue, 0xFF);
+				foliage->CullAndDraw(camera, m_FoliageShader);
+				m_GLCache->SetStencilWriteMask(0x00);
+				ARC_POP_RENDER_TAG();
+			}
 		}
 
 		// Reset state
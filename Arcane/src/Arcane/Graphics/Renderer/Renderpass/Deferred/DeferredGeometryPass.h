@@ -16,6 +16,7 @@ namespace Arcane
 	class Scene;
 	class ICamera;
 	class GBuffer;
+	class LazyRenderTargets;
 
 	class DeferredGeometryPass : public RenderPass {
 	public:
@@ -27,7 +28,8 @@ namespace Arcane
 	private:
 		bool m_AllocatedGBuffer;
 		GBuffer *m_GBuffer;
-		Shader *m_ModelShader, *m_SkinnedModelShader, *m_TerrainShader;
+		LazyRenderTargets *m_GBufferTargets; // Only set if we allocated the GBuffer, forward rendering never runs this pass so it never gets targets
+		Shader *m_ModelShader, *m_SkinnedModelShader, *m_TerrainShader, *m_ImpostorShader, *m_FoliageShader;
 	};
 }
 #endif
@@ -7,6 +7,7 @@
 #include <Arcane/Graphics/Renderer/GLCache.h>
 #include <Arcane/Graphics/Camera/ICamera.h>
 #include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
 #include <Arcane/Graphics/Renderer/Renderpass/Deferred/DeferredGeometryPass.h>
 #include <Arcane/Scene/Scene.h>
 #include <Arcane/Util/Loaders/ShaderLoader.h>
@@ -18,10 +19,11 @@ namespace Arcane
 		m_LightingShader = ShaderLoader::LoadShader("deferred/PBR_LightingPass.glsl");
 
 		m_Framebuffer = new Framebuffer(Window::GetRenderResolutionWidth(), Window::GetRenderResolutionHeight(), false);
-		m_Framebuffer->AddColorTexture(FloatingPoint16).AddDepthStencilTexture(NormalizedDepthStencil).CreateFramebuffer();
+		m_FramebufferTargets = new LazyRenderTargets("Deferred Lighting");
+		m_FramebufferTargets->AddTarget(m_Framebuffer, FloatingPoint16); // Depth + stencil is the GBuffer's, attached every frame
 	}
 
-	DeferredLightingPass::DeferredLightingPass(Scene *scene, Framebuffer *customFramebuffer) : RenderPass(scene), m_AllocatedFramebuffer(false), m_Framebuffer(customFramebuffer)
+	DeferredLightingPass::DeferredLightingPass(Scene *scene, Framebuffer *customFramebuffer) : RenderPass(scene), m_AllocatedFramebuffer(false), m_Framebuffer(customFramebuffer), m_FramebufferTargets(nullptr)
 	{
 		m_LightingShader = ShaderLoader::LoadShader("deferred/PBR_LightingPass.glsl");
 	}
@@ -29,6 +31,7 @@ namespace Arcane
 	DeferredLightingPass::~DeferredLightingPass()
 	{
 		if (m_AllocatedFramebuffer) {
+			delete m_FramebufferTargets;
 			delete m_Framebuffer;
 		}
 	}
@@ -36,18 +39,31 @@ namespace Arcane
 	LightingPassOutput DeferredLightingPass::ExecuteLightingPass(ShadowmapPassOutput &inputShadowmapData, GBuffer *inputGbuffer, PreLightingPassOutput &preLightingOutput, ICamera *camera, bool useIBL)
 	{
 		// Framebuffer setup
-		glViewport(0, 0, m_Framebuffer->GetWidth(), m_Framebuffer->GetHeight());
+		if (m_FramebufferTargets)
+		{
+			// Our framebuffer renders straight on top of the GBuffer's depth + stencil instead of getting a copy of them. The lighting shader samples the same
+			// texture, which is fine since depth testing is off and the stencil is never written while it is attached here
+			m_FramebufferTargets->Acquire();
+			m_Framebuffer->ShareDepthStencilTexture(inputGbuffer);
+		}
 		glViewport(0, 0, m_Framebuffer->GetWidth(), m_Framebuffer->GetHeight());
 		m_Framebuffer->Bind();
-		m_Framebuffer->ClearAll();
 		m_GLCache->SetDepthTest(false);
 		m_GLCache->SetMultisample(false);
 
-		// Move the depth + stencil of the GBuffer to our framebuffer
-		// NOTE: Framebuffers have to have identical depth + stencil formats for this to work
-		glBindFramebuffer(GL_READ_FRAMEBUFFER, inputGbuffer->GetFramebuffer());
-		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_Framebuffer->GetFramebuffer());
-		glBlitFramebuffer(0, 0, inputGbuffer->GetWidth(), inputGbuffer->GetHeight(), 0, 0, m_Framebuffer->GetWidth(), m_Framebuffer->GetHeight(), GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT, GL_NEAREST);
+		if (m_Framebuffer->IsDepthStencilShared())
+		{
+			m_Framebuffer->ClearColour();
+		}
+		else
+		{
+			// Custom framebuffers own their depth + stencil, so the GBuffer's gets copied over
+			// NOTE: Framebuffers have to have identical depth + stencil formats for this to work
+			m_Framebuffer->ClearAll();
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, inputGbuffer->GetFramebuffer());
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_Framebuffer->GetFramebuffer());
+			glBlitFramebuffer(0, 0, inputGbuffer->GetWidth(), inputGbuffer->GetHeight(), 0, 0, m_Framebuffer->GetWidth(), m_Framebuffer->GetHeight(), GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT, GL_NEAREST);
+		}
 
 		// Setup initial stencil state
 		m_GLCache->SetStencilTest(true);
@@ -58,25 +74,25 @@ namespace Arcane
 
 		m_GLCache->SetShader(m_LightingShader);
 		lightManager->BindLightingUniforms(m_LightingShader);
-		m_LightingShader->SetUniform("viewPos", camera->GetPosition());
-		m_LightingShader->SetUniform("viewInverse", glm::inverse(camera->GetViewMatrix()));
-		m_LightingShader->SetUniform("projectionInverse", glm::inverse(camera->GetProjectionMatrix()));
+		m_LightingShader->SetUniform(ARC_UNIFORM("viewPos"), camera->GetPosition());
+		m_LightingShader->SetUniform(ARC_UNIFORM("viewInverse"), glm::inverse(camera->GetViewMatrix()));
+		m_LightingShader->SetUniform(ARC_UNIFORM("projectionInverse"), glm::inverse(camera->GetProjectionMatrix()));
 
 		// Bind GBuffer data
 		inputGbuffer->GetAlbedo()->Bind(6);
-		m_LightingShader->SetUniform("albedoTexture", 6);
+		m_LightingShader->SetUniform(ARC_UNIFORM("albedoTexture"), 6);
 
 		inputGbuffer->GetNormal()->Bind(7);
-		m_LightingShader->SetUniform("normalTexture", 7);
+		m_LightingShader->SetUniform(ARC_UNIFORM("normalTexture"), 7);
 
 		inputGbuffer->GetMaterialInfo()->Bind(8);
-		m_LightingShader->SetUniform("materialInfoTexture", 8);
+		m_LightingShader->SetUniform(ARC_UNIFORM("materialInfoTexture"), 8);
 
 		preLightingOutput.ssaoTexture->Bind(9);
-		m_LightingShader->SetUniform("ssaoTexture", 9);
+		m_LightingShader->SetUniform(ARC_UNIFORM("ssaoTexture"), 9);
 
 		inputGbuffer->GetDepthStencilTexture()->Bind(10);
-		m_LightingShader->SetUniform("depthTexture", 10);
+		m_LightingShader->SetUniform(ARC_UNIFORM("depthTexture"), 10);
 
 		// Shadowmap code
 		BindShadowmap(m_LightingShader, inputShadowmapData);
@@ -87,27 +103,57 @@ namespace Arcane
 		glm::vec3 cameraPosition = camera->GetPosition();
 		probeManager->BindProbes(cameraPosition, m_LightingShader); // TODO: Should use camera component
 
-		// Perform lighting on the terrain (turn IBL off)
-		ARC_PUSH_RENDER_TAG("Terrain");
-		m_LightingShader->SetUniform("computeIBL", 0);
-		m_GLCache->SetStencilFunc(GL_EQUAL, StencilValue::TerrainStencilValue, 0xFF);
-		Renderer::DrawNdcPlane();
-		ARC_POP_RENDER_TAG();
-
-		// Perform lighting on the models in the scene
-		ARC_PUSH_RENDER_TAG("Opaque Models");
-		if (useIBL)
+		// Material classes that are lit the same way share a draw, the only difference between terrain and models is that terrain never gets IBL
+		// Without a lightmap the stencil only holds the terrain and model values, so anything that isn't background is one of the two
+		bool hasTerrain = m_ActiveScene->GetTerrain() != nullptr;
+		if (hasTerrain && !useIBL && !m_ActiveScene->GetLightmap())
 		{
-			m_LightingShader->SetUniform("computeIBL", 1);
+			ARC_PUSH_RENDER_TAG("Terrain + Opaque Models");
+			m_LightingShader->SetUniform(ARC_UNIFORM("computeIBL"), 0);
+			m_GLCache->SetStencilFunc(GL_NOTEQUAL, 0x00, 0xFF);
+			Renderer::DrawNdcPlane();
+			ARC_POP_RENDER_TAG();
 		}
 		else
 		{
-			m_LightingShader->SetUniform("computeIBL", 0);
+			// Perform lighting on the terrain (turn IBL off)
+			if (hasTerrain)
+			{
+				ARC_PUSH_RENDER_TAG("Terrain");
+				m_LightingShader->SetUniform(ARC_UNIFORM("computeIBL"), 0);
+				m_GLCache->SetStencilFunc(GL_EQUAL, StencilValue::TerrainStencilValue, 0xFF);
+				Renderer::DrawNdcPlane();
+				ARC_POP_RENDER_TAG();
+			}
+
+			// Perform lighting on the models in the scene
+			ARC_PUSH_RENDER_TAG("Opaque Models");
+			if (useIBL)
+			{
+				m_LightingShader->SetUniform(ARC_UNIFORM("computeIBL"), 1);
+			}
+			else
+			{
+				m_LightingShader->SetUniform(ARC_UNIFORM("computeIBL"), 0);
+			}
+			m_GLCache->SetStencilFunc(GL_EQUAL, StencilValue::ModelStencilValue, 0xFF);
+			Renderer::DrawNdcPlane();
+			ARC_POP_RENDER_TAG();
 		}
-		m_GLCache->SetStencilFunc(GL_EQUAL, StencilValue::ModelStencilValue, 0xFF);
-		Renderer::DrawNdcPlane();
-		ARC_POP_RENDER_TAG();
 
+		// Lightmapped models already have the static lights baked in (composited by the LightmapPass), so only the dynamic lights get evaluated
+		if (m_ActiveScene->GetLightmap())
+		{
+			ARC_PUSH_RENDER_TAG("Lightmapped Models");
+			lightManager->BindDynamicLightingUniforms(m_LightingShader);
+			glm::ivec3 dynamicShadowIndices = lightManager->GetDynamicShadowCasterIndices();
+			m_LightingShader->SetUniform(ARC_UNIFORM("dirLightShadowData.lightShadowIndex"), inputShadowmapData.directionalShadowmapFramebuffer ? dynamicShadowIndices.x : -1);
+			m_LightingShader->SetUniform(ARC_UNIFORM("spotLightShadowData.lightShadowIndex"), inputShadowmapData.spotLightShadowmapFramebuffer ? dynamicShadowIndices.y : -1);
+			m_LightingShader->SetUniform(ARC_UNIFORM("pointLightShadowData.lightShadowIndex"), inputShadowmapData.hasPointLightShadows ? dynamicShadowIndices.z : -1);
+			m_GLCache->SetStencilFunc(GL_EQUAL, StencilValue::LightmappedModelStencilValue, 0xFF);
+			Renderer::DrawNdcPlane();
+			ARC_POP_RENDER_TAG();
+		}
 
 		// Reset state
 		m_GLCache->SetDepthTest(true);
@@ -126,30 +172,30 @@ namespace Arcane
 		bool hasDirShadowMap = shadowmapData.directionalShadowmapFramebuffer != nullptr;
 		bool hasSpotShadowMap = shadowmapData.spotLightShadowmapFramebuffer != nullptr;
 
-		shader->SetUniform("dirLightShadowData.lightShadowIndex", hasDirShadowMap ? lightManager->GetDirectionalLightShadowCasterIndex() : -1);
-		shader->SetUniform("spotLightShadowData.lightShadowIndex", hasSpotShadowMap ? lightManager->GetSpotLightShadowCasterIndex() : -1);
-		shader->SetUniform("pointLightShadowData.lightShadowIndex", shadowmapData.hasPointLightShadows ? lightManager->GetPointLightShadowCasterIndex() : -1);
+		shader->SetUniform(ARC_UNIFORM("dirLightShadowData.lightShadowIndex"), hasDirShadowMap ? lightManager->GetDirectionalLightShadowCasterIndex() : -1);
+		shader->SetUniform(ARC_UNIFORM("spotLightShadowData.lightShadowIndex"), hasSpotShadowMap ? lightManager->GetSpotLightShadowCasterIndex() : -1);
+		shader->SetUniform(ARC_UNIFORM("pointLightShadowData.lightShadowIndex"), shadowmapData.hasPointLightShadows ? lightManager->GetPointLightShadowCasterIndex() : -1);
 
 		if (hasDirShadowMap)
 		{
 			shadowmapData.directionalShadowmapFramebuffer->GetDepthStencilTexture()->Bind(0);
-			shader->SetUniform("dirLightShadowmap", 0);
-			shader->SetUniform("dirLightShadowData.lightSpaceViewProjectionMatrix", shadowmapData.directionalLightViewProjMatrix);
-			shader->SetUniform("dirLightShadowData.shadowBias", shadowmapData.directionalShadowmapBias);
+			shader->SetUniform(ARC_UNIFORM("dirLightShadowmap"), 0);
+			shader->SetUniform(ARC_UNIFORM("dirLightShadowData.lightSpaceViewProjectionMatrix"), shadowmapData.directionalLightViewProjMatrix);
+			shader->SetUniform(ARC_UNIFORM("dirLightShadowData.shadowBias"), shadowmapData.directionalShadowmapBias);
 		}
 		if (hasSpotShadowMap)
 		{
 			shadowmapData.spotLightShadowmapFramebuffer->GetDepthStencilTexture()->Bind(1);
-			shader->SetUniform("spotLightShadowmap", 1);
-			shader->SetUniform("spotLightShadowData.lightSpaceViewProjectionMatrix", shadowmapData.spotLightViewProjMatrix);
-			shader->SetUniform("spotLightShadowData.shadowBias", shadowmapData.spotLightShadowmapBias);
+			shader->SetUniform(ARC_UNIFORM("spotLightShadowmap"), 1);
+			shader->SetUniform(ARC_UNIFORM("spotLightShadowData.lightSpaceViewProjectionMatrix"), shadowmapData.spotLightViewProjMatrix);
+			shader->SetUniform(ARC_UNIFORM("spotLightShadowData.shadowBias"), shadowmapData.spotLightShadowmapBias);
 		}
 		if (shadowmapData.hasPointLightShadows)
 		{
-			shader->SetUniform("pointLightShadowData.shadowBias", shadowmapData.pointLightShadowmapBias);
-			shader->SetUniform("pointLightShadowData.farPlane", shadowmapData.pointLightFarPlane);
+			shader->SetUniform(ARC_UNIFORM("pointLightShadowData.shadowBias"), shadowmapData.pointLightShadowmapBias);
+			shader->SetUniform(ARC_UNIFORM("pointLightShadowData.farPlane"), shadowmapData.pointLightFarPlane);
 		}
-		shader->SetUniform("pointLightShadowCubemap", 2);
+		shader->SetUniform(ARC_UNIFORM("pointLightShadowCubemap"), 2);
 		shadowmapData.pointLightShadowCubemap->Bind(2); // Must be bound even if there is no point light shadows. Thanks OpenGL Driver!
 	}
 }
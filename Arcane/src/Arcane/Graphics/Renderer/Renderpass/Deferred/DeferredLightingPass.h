@@ -15,6 +15,7 @@ namespace Arcane
 	class Shader;
 	class Scene;
 	class ICamera;
+	class LazyRenderTargets;
 
 	class DeferredLightingPass : public RenderPass {
 	public:
@@ -28,6 +29,7 @@ namespace Arcane
 	private:
 		bool m_AllocatedFramebuffer;
 		Framebuffer *m_Framebuffer;
+		LazyRenderTargets *m_FramebufferTargets; // Only set if we allocated the framebuffer, forward rendering never runs this pass so it never gets attachments
 		Shader *m_LightingShader;
 	};
 }
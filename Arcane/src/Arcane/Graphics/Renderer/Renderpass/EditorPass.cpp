@@ -8,6 +8,7 @@
 #include <Arcane/Util/Loaders/AssetManager.h>
 #include <Arcane/Scene/Scene.h>
 #include <Arcane/Graphics/Renderer/DebugDraw3D.h>
+#include <Arcane/Graphics/Renderer/TextRenderer.h>
 #include <Arcane/Graphics/Camera/ICamera.h>
 
 namespace Arcane
@@ -28,6 +29,11 @@ namespace Arcane
 
 	}
 
+	bool EditorPass::NeedsExtraFramebuffers()
+	{
+		return m_FocusedEntity.IsValid() && m_FocusedEntity.HasComponent<MeshComponent>();
+	}
+
 	EditorPassOutput EditorPass::ExecuteEditorPass(Framebuffer *sceneFramebuffer, Framebuffer *extraFramebuffer1, Framebuffer *extraFramebuffer2, ICamera *camera)
 	{
 		EditorPassOutput output;
@@ -35,7 +41,7 @@ namespace Arcane
 
 		// Entity highlighting (should be done first since it might use debug rendering to highlight objects if no mesh exists to highlight)
 		ARC_PUSH_RENDER_TAG("Entity Highlighting");
-		if (m_FocusedEntity.IsValid() && m_FocusedEntity.HasComponent<MeshComponent>())
+		if (NeedsExtraFramebuffers())
 		{
 			auto& meshComponent = m_FocusedEntity.GetComponent<MeshComponent>();
 			auto& transformComponent = m_FocusedEntity.GetComponent<TransformComponent>();
@@ -62,12 +68,12 @@ namespace Arcane
 			// Finally render our meshes (skinned and non-skinned)
 			{
 				m_GLCache->SetShader(m_ColourWriteShaderSkinned);
-				m_ColourWriteShaderSkinned->SetUniform("colour", glm::vec3(1.0, 1.0, 1.0));
+				m_ColourWriteShaderSkinned->SetUniform(ARC_UNIFORM("colour"), glm::vec3(1.0, 1.0, 1.0));
 				Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ColourWriteShaderSkinned);
 			}
 			{
 				m_GLCache->SetShader(m_ColourWriteShader);
-				m_ColourWriteShader->SetUniform("colour", glm::vec3(1.0, 1.0, 1.0));
+				m_ColourWriteShader->SetUniform(ARC_UNIFORM("colour"), glm::vec3(1.0, 1.0, 1.0));
 				Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ColourWriteShader);
 			}
 
@@ -77,11 +83,11 @@ namespace Arcane
 			extraFramebuffer2->ClearAll();
 
 			m_GLCache->SetShader(m_OutlineShader);
-			m_OutlineShader->SetUniform("outlineSize", m_OutlineSize);
-			m_OutlineShader->SetUniform("outlineColour", m_OutlineColour);
-			m_OutlineShader->SetUniform("sceneTexture", 0);
+			m_OutlineShader->SetUniform(ARC_UNIFORM("outlineSize"), m_OutlineSize);
+			m_OutlineShader->SetUniform(ARC_UNIFORM("outlineColour"), m_OutlineColour);
+			m_OutlineShader->SetUniform(ARC_UNIFORM("sceneTexture"), 0);
 			sceneFramebuffer->GetColourTexture()->Bind(0);
-			m_OutlineShader->SetUniform("highlightTexture", 1);
+			m_OutlineShader->SetUniform(ARC_UNIFORM("highlightTexture"), 1);
 			extraFramebuffer1->GetColourTexture()->Bind(1);
 			Renderer::DrawNdcPlane();
 
@@ -128,8 +134,8 @@ namespace Arcane
 			m_GLCache->SetMultisample(false);
 			
 			m_GLCache->SetShader(m_UnlitSpriteShader);
-			m_UnlitSpriteShader->SetUniform("view", camera->GetViewMatrix());
-			m_UnlitSpriteShader->SetUniform("projection", camera->GetProjectionMatrix());
+			m_UnlitSpriteShader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+			m_UnlitSpriteShader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
 
 			bool shouldRenderQuads = false;
 			auto group = m_ActiveScene->m_Registry.group<LightComponent>(entt::get<TransformComponent>);
@@ -160,6 +166,24 @@ namespace Arcane
 		}
 		ARC_POP_RENDER_TAG();
 
+		// Text queued by the scene and editor this frame, drawn last so labels end up on top of everything
+		ARC_PUSH_RENDER_TAG("Text");
+		{
+			if (m_FocusedEntity.IsValid() && m_FocusedEntity.HasComponent<TagComponent>() && m_FocusedEntity.HasComponent<TransformComponent>())
+			{
+				auto& transformComponent = m_FocusedEntity.GetComponent<TransformComponent>();
+				glm::vec3 labelPosition = transformComponent.Translation + glm::vec3(0.0f, transformComponent.Scale.y * 0.5f, 0.0f);
+				TextRenderer::QueueText(m_FocusedEntity.GetComponent<TagComponent>().Tag, labelPosition, m_LabelHeight, glm::vec4(m_OutlineColour, 1.0f));
+			}
+
+			glViewport(0, 0, output.outFramebuffer->GetWidth(), output.outFramebuffer->GetHeight());
+			output.outFramebuffer->Bind();
+			m_GLCache->SetMultisample(false);
+
+			TextRenderer::FlushBatch(camera, output.outFramebuffer->GetWidth(), output.outFramebuffer->GetHeight());
+		}
+		ARC_POP_RENDER_TAG();
+
 
 		return output;
 	}
@@ -25,6 +25,7 @@ namespace Arcane
 		EditorPassOutput ExecuteEditorPass(Framebuffer *sceneFramebuffer, Framebuffer *extraFramebuffer1, Framebuffer *extraFramebuffer2, ICamera *camera);
 
 		inline void SetFocusedEntity(Entity entity) { m_FocusedEntity = entity; }
+		bool NeedsExtraFramebuffers(); // The extra framebuffers are only rendered to when highlighting a mesh, they can be null otherwise
 	private:
 		Shader *m_ColourWriteShader, *m_ColourWriteShaderSkinned, *m_OutlineShader;
 		Shader *m_UnlitSpriteShader;
@@ -37,6 +38,7 @@ namespace Arcane
 		// Shader tweaks
 		float m_OutlineSize = 6.0f;
 		glm::vec3 m_OutlineColour = glm::vec3(0.68507f, 0.0f, 1.0f);
+		float m_LabelHeight = 0.25f; // World units
 	};
 }
 #endif
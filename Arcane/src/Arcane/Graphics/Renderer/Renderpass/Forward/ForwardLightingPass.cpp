@@ -8,21 +8,24 @@
 #include <Arcane/Graphics/Texture/Cubemap.h>
 #include <Arcane/Graphics/Renderer/GLCache.h>
 #include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
 #include <Arcane/Scene/Scene.h>
 #include <Arcane/Util/Loaders/ShaderLoader.h>
 #include <Arcane/Platform/OpenGL/Framebuffer/Framebuffer.h>
+#include <Arcane/Platform/OpenGL/Framebuffer/OITBuffer.h>
 
 namespace Arcane
 {
-	ForwardLightingPass::ForwardLightingPass(Scene *scene, bool shouldMultisample) : RenderPass(scene), m_AllocatedFramebuffer(true)
+	ForwardLightingPass::ForwardLightingPass(Scene *scene, bool shouldMultisample) : RenderPass(scene), m_AllocatedFramebuffer(true), m_OITBuffer(nullptr), m_OITTargets(nullptr)
 	{
 		Init();
 
 		m_Framebuffer = new Framebuffer(Window::GetRenderResolutionWidth(), Window::GetRenderResolutionHeight(), shouldMultisample);
-		m_Framebuffer->AddColorTexture(FloatingPoint16).AddDepthStencilRBO(NormalizedDepthStencil).CreateFramebuffer();
+		m_FramebufferTargets = new LazyRenderTargets("Forward Lighting");
+		m_FramebufferTargets->AddTarget(m_Framebuffer, FloatingPoint16, NormalizedDepthStencil, false);
 	}
 
-	ForwardLightingPass::ForwardLightingPass(Scene *scene, Framebuffer *customFramebuffer) : RenderPass(scene), m_AllocatedFramebuffer(false), m_Framebuffer(customFramebuffer)
+	ForwardLightingPass::ForwardLightingPass(Scene *scene, Framebuffer *customFramebuffer) : RenderPass(scene), m_AllocatedFramebuffer(false), m_Framebuffer(customFramebuffer), m_FramebufferTargets(nullptr), m_OITBuffer(nullptr), m_OITTargets(nullptr)
 	{
 		Init();
 	}
@@ -30,8 +33,11 @@ namespace Arcane
 	ForwardLightingPass::~ForwardLightingPass()
 	{
 		if (m_AllocatedFramebuffer) {
+			delete m_FramebufferTargets;
 			delete m_Framebuffer;
 		}
+		delete m_OITTargets;
+		delete m_OITBuffer;
 	}
 
 	void ForwardLightingPass::Init()
@@ -39,10 +45,21 @@ namespace Arcane
 		m_ModelShader = ShaderLoader::LoadShader("forward/PBR_Model.glsl");
 		m_SkinnedModelShader = ShaderLoader::LoadShader("forward/PBR_Skinned_Model.glsl");
 		m_TerrainShader = ShaderLoader::LoadShader("forward/PBR_Terrain.glsl");
+		m_OITCompositeShader = ShaderLoader::LoadShader("forward/OIT_Composite.glsl");
+
+		// The model shaders have to write the accumulation and revealage outputs when weightedBlendedOIT is set
+		m_SupportsOIT = m_ModelShader->HasUniform(ARC_UNIFORM("weightedBlendedOIT")) && m_SkinnedModelShader->HasUniform(ARC_UNIFORM("weightedBlendedOIT"));
+#if WEIGHTED_BLENDED_OIT
+		if (!m_SupportsOIT)
+			ARC_LOG_WARN("Forward model shaders don't support weighted blended OIT, falling back to sorted transparency");
+#endif
 	}
 
 	LightingPassOutput ForwardLightingPass::ExecuteOpaqueLightingPass(ShadowmapPassOutput &inputShadowmapData, ICamera *camera, bool renderOnlyStatic, bool useIBL)
 	{
+		if (m_FramebufferTargets)
+			m_FramebufferTargets->Acquire();
+
 		glViewport(0, 0, m_Framebuffer->GetWidth(), m_Framebuffer->GetHeight());
 		m_Framebuffer->Bind();
 		m_Framebuffer->ClearAll();
@@ -70,17 +87,17 @@ namespace Arcane
 			m_GLCache->SetShader(m_TerrainShader);
 			if (m_GLCache->GetUsesClipPlane())
 			{
-				m_TerrainShader->SetUniform("usesClipPlane", true);
-				m_TerrainShader->SetUniform("clipPlane", m_GLCache->GetActiveClipPlane());
+				m_TerrainShader->SetUniform(ARC_UNIFORM("usesClipPlane"), true);
+				m_TerrainShader->SetUniform(ARC_UNIFORM("clipPlane"), m_GLCache->GetActiveClipPlane());
 			}
 			else
 			{
-				m_TerrainShader->SetUniform("usesClipPlane", false);
+				m_TerrainShader->SetUniform(ARC_UNIFORM("usesClipPlane"), false);
 			}
 			(lightManager->*lightBindFunction) (m_TerrainShader);
-			m_TerrainShader->SetUniform("viewPos", camera->GetPosition());
-			m_TerrainShader->SetUniform("view", camera->GetViewMatrix());
-			m_TerrainShader->SetUniform("projection", camera->GetProjectionMatrix());
+			m_TerrainShader->SetUniform(ARC_UNIFORM("viewPos"), camera->GetPosition());
+			m_TerrainShader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+			m_TerrainShader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
 			BindShadowmap(m_TerrainShader, inputShadowmapData);
 			terrain->Draw(m_TerrainShader, MaterialRequired);
 			ARC_POP_RENDER_TAG();
@@ -94,7 +111,8 @@ namespace Arcane
 		}
 		else
 		{
-			m_ActiveScene->AddModelsToRenderer(ModelFilterType::OpaqueModels);
+			// PVS culling only applies to the main view, passes rendering into a custom framebuffer (probes, water reflections) use other viewpoints
+			m_ActiveScene->AddModelsToRenderer(ModelFilterType::OpaqueModels, nullptr, m_AllocatedFramebuffer ? camera : nullptr, m_AllocatedFramebuffer);
 		}
 
 		// Bind data to skinned shader and render skinned models
@@ -103,12 +121,12 @@ namespace Arcane
 			m_GLCache->SetShader(m_SkinnedModelShader);
 			if (m_GLCache->GetUsesClipPlane())
 			{
-				m_SkinnedModelShader->SetUniform("usesClipPlane", true);
-				m_SkinnedModelShader->SetUniform("clipPlane", m_GLCache->GetActiveClipPlane());
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), true);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("clipPlane"), m_GLCache->GetActiveClipPlane());
 			}
 			else
 			{
-				m_SkinnedModelShader->SetUniform("usesClipPlane", false);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), false);
 			}
 			(lightManager->*lightBindFunction) (m_SkinnedModelShader);
 
@@ -120,11 +138,11 @@ namespace Arcane
 			probeManager->BindProbes(cameraPosition, m_SkinnedModelShader); // TODO: Should use camera component
 			if (useIBL)
 			{
-				m_SkinnedModelShader->SetUniform("computeIBL", 1);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 1);
 			}
 			else
 			{
-				m_SkinnedModelShader->SetUniform("computeIBL", 0);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 0);
 			}
 
 			Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_SkinnedModelShader);
@@ -137,12 +155,12 @@ namespace Arcane
 			m_GLCache->SetShader(m_ModelShader);
 			if (m_GLCache->GetUsesClipPlane())
 			{
-				m_ModelShader->SetUniform("usesClipPlane", true);
-				m_ModelShader->SetUniform("clipPlane", m_GLCache->GetActiveClipPlane());
+				m_ModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), true);
+				m_ModelShader->SetUniform(ARC_UNIFORM("clipPlane"), m_GLCache->GetActiveClipPlane());
 			}
 			else
 			{
-				m_ModelShader->SetUniform("usesClipPlane", false);
+				m_ModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), false);
 			}
 			(lightManager->*lightBindFunction) (m_ModelShader);
 
@@ -154,14 +172,25 @@ namespace Arcane
 			probeManager->BindProbes(cameraPosition, m_ModelShader); // TODO: Should use camera component
 			if (useIBL)
 			{
-				m_ModelShader->SetUniform("computeIBL", 1);
+				m_ModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 1);
 			}
 			else
 			{
-				m_ModelShader->SetUniform("computeIBL", 0);
+				m_ModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 0);
 			}
 
-			Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader);
+			Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader, true);
+
+			// Lightmapped models already have the static lights baked in (composited by the LightmapPass), so only the dynamic lights get evaluated
+			if (m_ActiveScene->GetLightmap())
+			{
+				lightManager->BindDynamicLightingUniforms(m_ModelShader);
+				glm::ivec3 dynamicShadowIndices = lightManager->GetDynamicShadowCasterIndices();
+				m_ModelShader->SetUniform(ARC_UNIFORM("dirLightShadowData.lightShadowIndex"), inputShadowmapData.directionalShadowmapFramebuffer ? dynamicShadowIndices.x : -1);
+				m_ModelShader->SetUniform(ARC_UNIFORM("spotLightShadowData.lightShadowIndex"), inputShadowmapData.spotLightShadowmapFramebuffer ? dynamicShadowIndices.y : -1);
+				m_ModelShader->SetUniform(ARC_UNIFORM("pointLightShadowData.lightShadowIndex"), inputShadowmapData.hasPointLightShadows ? dynamicShadowIndices.z : -1);
+				Renderer::FlushOpaqueLightmappedMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader);
+			}
 		}
 		ARC_POP_RENDER_TAG();
 
@@ -208,21 +237,52 @@ namespace Arcane
 		}
 		else
 		{
-			m_ActiveScene->AddModelsToRenderer(ModelFilterType::TransparentModels);
+			m_ActiveScene->AddModelsToRenderer(ModelFilterType::TransparentModels, nullptr, m_AllocatedFramebuffer ? camera : nullptr);
 		}
 
-		// Bind data to skinned shader and render skinned models
-		ARC_PUSH_RENDER_TAG("Skinned Models");
+		// Transparent meshes get drawn unsorted into the OIT targets (sharing the input's depth), then composited over the input
+		bool orderIndependent = WEIGHTED_BLENDED_OIT && m_SupportsOIT && m_AllocatedFramebuffer && Renderer::HasTransparentMeshesQueued();
+		if (orderIndependent)
+		{
+			if (m_OITBuffer && (m_OITBuffer->GetWidth() != inputFramebuffer->GetWidth() || m_OITBuffer->GetHeight() != inputFramebuffer->GetHeight() || m_OITBuffer->IsMultisampled() != inputFramebuffer->IsMultisampled()))
+			{
+				delete m_OITTargets;
+				delete m_OITBuffer;
+				m_OITBuffer = nullptr;
+			}
+			if (!m_OITBuffer)
+			{
+				m_OITBuffer = new OITBuffer(inputFramebuffer->GetWidth(), inputFramebuffer->GetHeight(), inputFramebuffer->IsMultisampled(), false);
+				m_OITTargets = new LazyRenderTargets("Order Independent Transparency");
+				m_OITTargets->AddTarget(m_OITBuffer);
+			}
+			m_OITTargets->Acquire(); // Released again once there haven't been any transparent meshes for a while
+
+			m_OITBuffer->AttachDepthStencil(inputFramebuffer);
+			m_OITBuffer->Bind();
+			m_OITBuffer->ClearTargets();
+		}
+		if (m_SupportsOIT)
 		{
+			m_GLCache->SetShader(m_SkinnedModelShader);
+			m_SkinnedModelShader->SetUniform(ARC_UNIFORM("weightedBlendedOIT"), orderIndependent);
+			m_GLCache->SetShader(m_ModelShader);
+			m_ModelShader->SetUniform(ARC_UNIFORM("weightedBlendedOIT"), orderIndependent);
+		}
+
+		// Transparent skinned and non-skinned models are drawn as one stream so they blend in the right order with each other, bind both shaders first
+		ARC_PUSH_RENDER_TAG("Transparent Models");
+		{
+			// Bind data to skinned shader
 			m_GLCache->SetShader(m_SkinnedModelShader);
 			if (m_GLCache->GetUsesClipPlane())
 			{
-				m_SkinnedModelShader->SetUniform("usesClipPlane", true);
-				m_SkinnedModelShader->SetUniform("clipPlane", m_GLCache->GetActiveClipPlane());
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), true);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("clipPlane"), m_GLCache->GetActiveClipPlane());
 			}
 			else
 			{
-				m_SkinnedModelShader->SetUniform("usesClipPlane", false);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), false);
 			}
 			(lightManager->*lightBindFunction) (m_SkinnedModelShader);
 
@@ -234,29 +294,23 @@ namespace Arcane
 			probeManager->BindProbes(cameraPosition, m_SkinnedModelShader); // TODO: Should use camera component
 			if (useIBL)
 			{
-				m_SkinnedModelShader->SetUniform("computeIBL", 1);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 1);
 			}
 			else
 			{
-				m_SkinnedModelShader->SetUniform("computeIBL", 0);
+				m_SkinnedModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 0);
 			}
 
-			Renderer::FlushTransparentSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_SkinnedModelShader);
-		}
-		ARC_POP_RENDER_TAG();
-
-		// Bind data to non-skinned shader and render non-skinned models
-		ARC_PUSH_RENDER_TAG("Non-Skinned Models");
-		{
+			// Bind data to non-skinned shader
 			m_GLCache->SetShader(m_ModelShader);
 			if (m_GLCache->GetUsesClipPlane())
 			{
-				m_ModelShader->SetUniform("usesClipPlane", true);
-				m_ModelShader->SetUniform("clipPlane", m_GLCache->GetActiveClipPlane());
+				m_ModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), true);
+				m_ModelShader->SetUniform(ARC_UNIFORM("clipPlane"), m_GLCache->GetActiveClipPlane());
 			}
 			else
 			{
-				m_ModelShader->SetUniform("usesClipPlane", false);
+				m_ModelShader->SetUniform(ARC_UNIFORM("usesClipPlane"), false);
 			}
 			(lightManager->*lightBindFunction) (m_ModelShader);
 
@@ -264,27 +318,60 @@ namespace Arcane
 			BindShadowmap(m_ModelShader, inputShadowmapData);
 
 			// IBL Binding
-			glm::vec3 cameraPosition = camera->GetPosition();
 			probeManager->BindProbes(cameraPosition, m_ModelShader); // TODO: Should use camera component
 			if (useIBL)
 			{
-				m_ModelShader->SetUniform("computeIBL", 1);
+				m_ModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 1);
 			}
 			else
 			{
-				m_ModelShader->SetUniform("computeIBL", 0);
+				m_ModelShader->SetUniform(ARC_UNIFORM("computeIBL"), 0);
 			}
 
-			Renderer::FlushTransparentNonSkinnedMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader);
+			Renderer::FlushTransparentMeshes(camera, RenderPassType::MaterialRequired, m_ModelShader, m_SkinnedModelShader, orderIndependent);
 		}
 		ARC_POP_RENDER_TAG();
 
+		if (orderIndependent)
+		{
+			ARC_PUSH_RENDER_TAG("OIT Composite");
+			CompositeOrderIndependentTransparency(inputFramebuffer);
+			ARC_POP_RENDER_TAG();
+		}
+
 		// Render pass output
 		LightingPassOutput passOutput;
 		passOutput.outputFramebuffer = inputFramebuffer;
 		return passOutput;
 	}
 
+	void ForwardLightingPass::CompositeOrderIndependentTransparency(Framebuffer *outputFramebuffer)
+	{
+		// Restore the depth writes the OIT flushes turned off
+		glDepthMask(GL_TRUE);
+
+		outputFramebuffer->Bind();
+		m_GLCache->SetDepthTest(false);
+		m_GLCache->SetBlend(true);
+		m_GLCache->SetBlendFunc(GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA);
+
+		// Sampler types can't share units, so the multisampled and regular versions each get their own
+		m_GLCache->SetShader(m_OITCompositeShader);
+		m_OITCompositeShader->SetUniform(ARC_UNIFORM("multisampled"), m_OITBuffer->IsMultisampled());
+		m_OITCompositeShader->SetUniform(ARC_UNIFORM("accumulationTexture"), 0);
+		m_OITCompositeShader->SetUniform(ARC_UNIFORM("revealageTexture"), 1);
+		m_OITCompositeShader->SetUniform(ARC_UNIFORM("accumulationTextureMS"), 2);
+		m_OITCompositeShader->SetUniform(ARC_UNIFORM("revealageTextureMS"), 3);
+		int unitOffset = m_OITBuffer->IsMultisampled() ? 2 : 0;
+		m_OITBuffer->GetAccumulation()->Bind(unitOffset);
+		m_OITBuffer->GetRevealage()->Bind(unitOffset + 1);
+		Renderer::DrawNdcPlane();
+
+		// Reset state
+		m_GLCache->SetBlend(false);
+		m_GLCache->SetDepthTest(true);
+	}
+
 	void ForwardLightingPass::BindShadowmap(Shader *shader, ShadowmapPassOutput &shadowmapData)
 	{
 		LightManager *lightManager = m_ActiveScene->GetLightManager();
@@ -292,30 +379,30 @@ namespace Arcane
 		bool hasDirShadowMap = shadowmapData.directionalShadowmapFramebuffer != nullptr;
 		bool hasSpotShadowMap = shadowmapData.spotLightShadowmapFramebuffer != nullptr;
 
-		shader->SetUniform("dirLightShadowData.lightShadowIndex", hasDirShadowMap ? lightManager->GetDirectionalLightShadowCasterIndex() : -1);
-		shader->SetUniform("spotLightShadowData.lightShadowIndex", hasSpotShadowMap ? lightManager->GetSpotLightShadowCasterIndex() : -1);
-		shader->SetUniform("pointLightShadowData.lightShadowIndex", shadowmapData.hasPointLightShadows ? lightManager->GetPointLightShadowCasterIndex() : -1);
+		shader->SetUniform(ARC_UNIFORM("dirLightShadowData.lightShadowIndex"), hasDirShadowMap ? lightManager->GetDirectionalLightShadowCasterIndex() : -1);
+		shader->SetUniform(ARC_UNIFORM("spotLightShadowData.lightShadowIndex"), hasSpotShadowMap ? lightManager->GetSpotLightShadowCasterIndex() : -1);
+		shader->SetUniform(ARC_UNIFORM("pointLightShadowData.lightShadowIndex"), shadowmapData.hasPointLightShadows ? lightManager->GetPointLightShadowCasterIndex() : -1);
 
 		if (hasDirShadowMap)
 		{
 			shadowmapData.directionalShadowmapFramebuffer->GetDepthStencilTexture()->Bind(0);
-			shader->SetUniform("dirLightShadowmap", 0);
-			shader->SetUniform("dirLightShadowData.lightSpaceViewProjectionMatrix", shadowmapData.directionalLightViewProjMatrix);
-			shader->SetUniform("dirLightShadowData.shadowBias", shadowmapData.directionalShadowmapBias);
+			shader->SetUniform(ARC_UNIFORM("dirLightShadowmap"), 0);
+			shader->SetUniform(ARC_UNIFORM("dirLightShadowData.lightSpaceViewProjectionMatrix"), shadowmapData.directionalLightViewProjMatrix);
+			shader->SetUniform(ARC_UNIFORM("dirLightShadowData.shadowBias"), shadowmapData.directionalShadowmapBias);
 		}
 		if (hasSpotShadowMap)
 		{
 			shadowmapData.spotLightShadowmapFramebuffer->GetDepthStencilTexture()->Bind(1);
-			shader->SetUniform("spotLightShadowmap", 1);
-			shader->SetUniform("spotLightShadowData.lightSpaceViewProjectionMatrix", shadowmapData.spotLightViewProjMatrix);
-			shader->SetUniform("spotLightShadowData.shadowBias", shadowmapData.spotLightShadowmapBias);
+			shader->SetUniform(ARC_UNIFORM("spotLightShadowmap"), 1);
+			shader->SetUniform(ARC_UNIFORM("spotLightShadowData.lightSpaceViewProjectionMatrix"), shadowmapData.spotLightViewProjMatrix);
+			shader->SetUniform(ARC_UNIFORM("spotLightShadowData.shadowBias"), shadowmapData.spotLightShadowmapBias);
 		}
 		if (shadowmapData.hasPointLightShadows)
 		{
-			shader->SetUniform("pointLightShadowData.shadowBias", shadowmapData.pointLightShadowmapBias);
-			shader->SetUniform("pointLightShadowData.farPlane", shadowmapData.pointLightFarPlane);
+			shader->SetUniform(ARC_UNIFORM("pointLightShadowData.shadowBias"), shadowmapData.pointLightShadowmapBias);
+			shader->SetUniform(ARC_UNIFORM("pointLightShadowData.farPlane"), shadowmapData.pointLightFarPlane);
 		}
-		shader->SetUniform("pointLightShadowCubemap", 2);
+		shader->SetUniform(ARC_UNIFORM("pointLightShadowCubemap"), 2);
 		shadowmapData.pointLightShadowCubemap->Bind(2); // Must be bound even if there is no point light shadows. Thanks OpenGL Driver!
 	}
 }
@@ -16,6 +16,8 @@ namespace Arcane
 	class Scene;
 	class ICamera;
 	class Framebuffer;
+	class LazyRenderTargets;
+	class OITBuffer;
 
 	class ForwardLightingPass : public RenderPass {
 	public:
@@ -29,10 +31,18 @@ namespace Arcane
 		void Init();
 
 		void BindShadowmap(Shader *shader, ShadowmapPassOutput &shadowmapData);
+		void CompositeOrderIndependentTransparency(Framebuffer *outputFramebuffer);
 	private:
 		bool m_AllocatedFramebuffer;
 		Framebuffer *m_Framebuffer;
+		LazyRenderTargets *m_FramebufferTargets; // Only set if we allocated the framebuffer, deferred rendering never runs the opaque pass so it never gets attachments
 		Shader *m_ModelShader, *m_SkinnedModelShader, *m_TerrainShader;
+
+		// Weighted blended OIT, only used for the main view (passes rendering into a custom framebuffer keep sorting)
+		bool m_SupportsOIT;
+		OITBuffer *m_OITBuffer; // Created the first time there are transparent meshes to draw, recreated when the input framebuffer's size or sample count changes
+		LazyRenderTargets *m_OITTargets;
+		Shader *m_OITCompositeShader;
 	};
 }
 #endif
@@ -54,6 +54,10 @@ namespace Arcane
 		generateFallbackProbes();
 	}
 
+	void ForwardProbePass::regenerateFallbackProbes() {
+		generateFallbackProbes();
+	}
+
 	void ForwardProbePass::pregenerateProbes() {
 		// Temp for now, just generate a probe so we have something
 		glm::vec3 probePosition = glm::vec3(-32.60f, 10.0f, 48.48f);
@@ -113,16 +117,16 @@ namespace Arcane
 		m_GLCache->SetFaceCull(false);
 		m_GLCache->SetDepthTest(false); // Important cause the depth buffer isn't cleared so it has zero depth
 
-		m_ConvolutionShader->SetUniform("projection", m_CubemapCamera.GetProjectionMatrix());
+		m_ConvolutionShader->SetUniform(ARC_UNIFORM("projection"), m_CubemapCamera.GetProjectionMatrix());
 		m_ActiveScene->GetSkybox()->GetSkyboxCubemap()->Bind(0);
-		m_ConvolutionShader->SetUniform("sceneCaptureCubemap", 0);
+		m_ConvolutionShader->SetUniform(ARC_UNIFORM("sceneCaptureCubemap"), 0);
 
 		m_LightProbeConvolutionFramebuffer.Bind();
 		glViewport(0, 0, m_LightProbeConvolutionFramebuffer.GetWidth(), m_LightProbeConvolutionFramebuffer.GetHeight());
 		for (int i = 0; i < 6; i++) {
 			// Setup the camera's view
 			m_CubemapCamera.SwitchCameraToFace(i);
-			m_ConvolutionShader->SetUniform("view", m_CubemapCamera.GetViewMatrix());
+			m_ConvolutionShader->SetUniform(ARC_UNIFORM("view"), m_CubemapCamera.GetViewMatrix());
 
 			// Convolute the scene's capture and store it in the Light Probe's cubemap
 			m_LightProbeConvolutionFramebuffer.SetColorAttachment(fallbackLightProbe->GetIrradianceMap()->GetCubemapID(), GL_TEXTURE_CUBE_MAP_POSITIVE_X + i);
@@ -142,9 +146,9 @@ namespace Arcane
 		m_GLCache->SetFaceCull(false);
 		m_GLCache->SetDepthTest(false); // Important cause the depth buffer isn't cleared so it has zero depth
 
-		m_ImportanceSamplingShader->SetUniform("projection", m_CubemapCamera.GetProjectionMatrix());
+		m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("projection"), m_CubemapCamera.GetProjectionMatrix());
 		m_ActiveScene->GetSkybox()->GetSkyboxCubemap()->Bind(0);
-		m_ImportanceSamplingShader->SetUniform("sceneCaptureCubemap", 0);
+		m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("sceneCaptureCubemap"), 0);
 
 		m_ReflectionProbeSamplingFramebuffer.Bind();
 		for (int mip = 0; mip < REFLECTION_PROBE_MIP_COUNT; mip++) {
@@ -155,11 +159,11 @@ namespace Arcane
 			glViewport(0, 0, mipWidth, mipHeight);
 
 			float mipRoughnessLevel = (float)mip / (float)(REFLECTION_PROBE_MIP_COUNT - 1);
-			m_ImportanceSamplingShader->SetUniform("roughness", mipRoughnessLevel);
+			m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("roughness"), mipRoughnessLevel);
 			for (int i = 0; i < 6; i++) {
 				// Setup the camera's view
 				m_CubemapCamera.SwitchCameraToFace(i);
-				m_ImportanceSamplingShader->SetUniform("view", m_CubemapCamera.GetViewMatrix());
+				m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("view"), m_CubemapCamera.GetViewMatrix());
 
 				// Importance sample the scene's capture and store it in the Reflection Probe's cubemap
 				m_ReflectionProbeSamplingFramebuffer.SetColorAttachment(fallbackReflectionProbe->GetPrefilterMap()->GetCubemapID(), GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, mip);
@@ -205,16 +209,16 @@ namespace Arcane
 		m_GLCache->SetFaceCull(false);
 		m_GLCache->SetDepthTest(false); // Important cause the depth buffer isn't cleared so it has zero depth
 
-		m_ConvolutionShader->SetUniform("projection", m_CubemapCamera.GetProjectionMatrix());
+		m_ConvolutionShader->SetUniform(ARC_UNIFORM("projection"), m_CubemapCamera.GetProjectionMatrix());
 		m_SceneCaptureCubemap.Bind(0);
-		m_ConvolutionShader->SetUniform("sceneCaptureCubemap", 0);
+		m_ConvolutionShader->SetUniform(ARC_UNIFORM("sceneCaptureCubemap"), 0);
 
 		m_LightProbeConvolutionFramebuffer.Bind();
 		glViewport(0, 0, m_LightProbeConvolutionFramebuffer.GetWidth(), m_LightProbeConvolutionFramebuffer.GetHeight());
 		for (int i = 0; i < 6; i++) {
 			// Setup the camera's view
 			m_CubemapCamera.SwitchCameraToFace(i);
-			m_ConvolutionShader->SetUniform("view", m_CubemapCamera.GetViewMatrix());
+			m_ConvolutionShader->SetUniform(ARC_UNIFORM("view"), m_CubemapCamera.GetViewMatrix());
 
 			// Convolute the scene's capture and store it in the Light Probe's cubemap
 			m_LightProbeConvolutionFramebuffer.SetColorAttachment(lightProbe->GetIrradianceMap()->GetCubemapID(), GL_TEXTURE_CUBE_MAP_POSITIVE_X + i);
@@ -258,9 +262,9 @@ namespace Arcane
 		m_GLCache->SetFaceCull(false);
 		m_GLCache->SetDepthTest(false); // Important cause the depth buffer isn't cleared so it has zero depth
 
-		m_ImportanceSamplingShader->SetUniform("projection", m_CubemapCamera.GetProjectionMatrix());
+		m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("projection"), m_CubemapCamera.GetProjectionMatrix());
 		m_SceneCaptureCubemap.Bind(0);
-		m_ImportanceSamplingShader->SetUniform("sceneCaptureCubemap", 0);
+		m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("sceneCaptureCubemap"), 0);
 
 		m_ReflectionProbeSamplingFramebuffer.Bind();
 		for (int mip = 0; mip < REFLECTION_PROBE_MIP_COUNT; mip++) {
@@ -271,11 +275,11 @@ namespace Arcane
 			glViewport(0, 0, mipWidth, mipHeight);
 			
 			float mipRoughnessLevel = (float)mip / (float)(REFLECTION_PROBE_MIP_COUNT - 1);
-			m_ImportanceSamplingShader->SetUniform("roughness", mipRoughnessLevel);
+			m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("roughness"), mipRoughnessLevel);
 			for (int i = 0; i < 6; i++) {
 				// Setup the camera's view
 				m_CubemapCamera.SwitchCameraToFace(i);
-				m_ImportanceSamplingShader->SetUniform("view", m_CubemapCamera.GetViewMatrix());
+				m_ImportanceSamplingShader->SetUniform(ARC_UNIFORM("view"), m_CubemapCamera.GetViewMatrix());
 
 				// Importance sample the scene's capture and store it in the Reflection Probe's cubemap
 				m_ReflectionProbeSamplingFramebuffer.SetColorAttachment(reflectionProbe->GetPrefilterMap()->GetCubemapID(), GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, mip);
@@ -30,6 +30,7 @@ namespace Arcane
 
 		void pregenerateIBL();
 		void pregenerateProbes();
+		void regenerateFallbackProbes(); // The fallbacks are convolved from the skybox, so they need redoing if it wasn't loaded when pregenerateIBL ran
 
 		void generateLightProbe(glm::vec3& probePosition);
 		void generateReflectionProbe(glm::vec3& probePosition);
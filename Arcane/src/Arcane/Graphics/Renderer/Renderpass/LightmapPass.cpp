@@ -0,0 +1,72 @@
+#include "arcpch.h"
+#include "LightmapPass.h"
+
+#include <Arcane/Scene/Scene.h>
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Texture/Texture.h>
+#include <Arcane/Graphics/Camera/ICamera.h>
+#include <Arcane/Graphics/Lightmap/Lightmap.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+
+namespace Arcane
+{
+	LightmapPass::LightmapPass(Scene *scene) : RenderPass(scene)
+	{
+		m_CompositeShader = ShaderLoader::LoadShader("lightmap/Lightmap_Composite.glsl");
+	}
+
+	LightmapPass::~LightmapPass()
+	{
+
+	}
+
+	LightmapPassOutput LightmapPass::ExecuteLightmapPass(Framebuffer *inputFramebuffer, ICamera *camera)
+	{
+		LightmapPassOutput passOutput;
+		passOutput.outputFramebuffer = inputFramebuffer;
+
+		Lightmap *lightmap = m_ActiveScene->GetLightmap();
+		if (!lightmap || !lightmap->GetTexture())
+			return passOutput;
+
+		glViewport(0, 0, inputFramebuffer->GetWidth(), inputFramebuffer->GetHeight());
+		inputFramebuffer->Bind();
+		m_GLCache->SetMultisample(inputFramebuffer->IsMultisampled());
+
+		// Must make the same impostor and PVS decisions as the lighting passes so exactly the same models get the baked lighting added
+#if FORWARD_RENDER
+		m_ActiveScene->AddModelsToRenderer(ModelFilterType::LightmappedModels, nullptr, camera);
+#else
+		m_ActiveScene->AddModelsToRenderer(ModelFilterType::LightmappedModels, camera, camera);
+
+		// The lighting pass framebuffer has the GBuffer's stencil, so only touch pixels that are still showing a lightmapped model
+		m_GLCache->SetStencilTest(true);
+		m_GLCache->SetStencilWriteMask(0x00);
+		m_GLCache->SetStencilFunc(GL_EQUAL, StencilValue::LightmappedModelStencilValue, 0xFF);
+#endif
+
+		// Redrawn geometry won't produce bit exact depth with a different shader, so bias it towards the camera and don't write depth
+		m_GLCache->SetDepthFunc(GL_LEQUAL);
+		glDepthMask(GL_FALSE);
+		glEnable(GL_POLYGON_OFFSET_FILL);
+		glPolygonOffset(-1.0f, -1.0f);
+
+		m_GLCache->SetShader(m_CompositeShader);
+		lightmap->GetTexture()->Bind(0);
+		m_CompositeShader->SetUniform(ARC_UNIFORM("lightmapTexture"), 0);
+		Renderer::FlushOpaqueLightmappedMeshes(camera, RenderPassType::MaterialRequired, m_CompositeShader, true);
+
+		// Restore state
+		glDisable(GL_POLYGON_OFFSET_FILL);
+		glDepthMask(GL_TRUE);
+		m_GLCache->SetDepthFunc(GL_LESS);
+		m_GLCache->SetBlend(false);
+#if !FORWARD_RENDER
+		m_GLCache->SetStencilTest(false);
+#endif
+
+		return passOutput;
+	}
+}
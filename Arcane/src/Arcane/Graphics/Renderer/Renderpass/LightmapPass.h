@@ -0,0 +1,32 @@
+#pragma once
+#ifndef LIGHTMAPPASS_H
+#define LIGHTMAPPASS_H
+
+#ifndef RENDERPASS_H
+#include <Arcane/Graphics/Renderer/Renderpass/RenderPass.h>
+#endif
+
+#ifndef RENDERPASSTYPE_H
+#include <Arcane/Graphics/Renderer/Renderpass/RenderPassType.h>
+#endif
+
+namespace Arcane
+{
+	class Shader;
+	class Scene;
+	class ICamera;
+
+	// Adds the baked lighting of the scene's lightmap on top of the lit scene. Lightmapped models only get their dynamic lights evaluated by the lighting passes,
+	// so this redraws them with depth testing against the already rendered depth and additively blends albedo * baked lighting
+	class LightmapPass : public RenderPass
+	{
+	public:
+		LightmapPass(Scene *scene);
+		virtual ~LightmapPass() override;
+
+		LightmapPassOutput ExecuteLightmapPass(Framebuffer *inputFramebuffer, ICamera *camera);
+	private:
+		Shader *m_CompositeShader;
+	};
+}
+#endif
@@ -4,6 +4,8 @@
 #include <Arcane/Graphics/Window.h>
 #include <Arcane/Graphics/Shader.h>
 #include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
+#include <Arcane/Graphics/Renderer/FrameCapture.h>
 #include <Arcane/Graphics/Renderer/Renderer.h>
 #include <Arcane/Util/Loaders/ShaderLoader.h>
 #include <Arcane/Scene/Scene.h>
@@ -15,7 +17,7 @@
 namespace Arcane
 {
 	MasterRenderPass::MasterRenderPass(Scene *scene) : m_ActiveScene(scene),
-		m_ShadowmapPass(scene), m_PostProcessPass(scene), m_WaterPass(scene), m_EnvironmentProbePass(scene),
+		m_ShadowmapPass(scene), m_PostProcessPass(scene), m_WaterPass(scene), m_ParticlePass(scene), m_LightmapPass(scene), m_EnvironmentProbePass(scene),
 		m_DeferredGeometryPass(scene), m_DeferredLightingPass(scene),
 #if FORWARD_RENDER
 		m_ForwardLightingPass(scene, true),
@@ -34,15 +36,17 @@ namespace Arcane
 		// State that should never change
 		glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 
+		// Scene probes wait for OnAssetsResident, capturing them now would bake in proxy meshes and placeholder textures
 		m_EnvironmentProbePass.pregenerateIBL();
-		m_EnvironmentProbePass.pregenerateProbes();
 
 #ifdef ARC_DEV_BUILD
 	#if FORWARD_RENDER
 		m_ShadowPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Shadow Map Generation Pass (GPU)"));
 		m_ForwardOpaquePassTimer = GPUTimerManager::CreateGPUTimer(std::string("Forward Opaque Pass (GPU)"));
+		m_LightmapPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Lightmap Pass (GPU)"));
 		m_WaterPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Water Pass (GPU)"));
 		m_ForwardTransparentPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Forward Transparent Pass (GPU)"));
+		m_ParticlePassTimer = GPUTimerManager::CreateGPUTimer(std::string("Particle Pass (GPU)"));
 		m_PostProcessPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Post Process Pass (GPU)"));
 		m_EditorPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Editor Pass (GPU)"));
 	#else
@@ -50,14 +54,21 @@ namespace Arcane
 		m_DeferredGeometryPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Deferred Geometry Pass (GPU)"));
 		m_SSAOPassTimer = GPUTimerManager::CreateGPUTimer(std::string("SSAO Pass (GPU)"));
 		m_DeferredLightingPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Deferred Lighting Pass (GPU)"));
+		m_LightmapPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Lightmap Pass (GPU)"));
 		m_WaterPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Water Pass (GPU)"));
 		m_PostGBufferForwardPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Post GBuffer Forward Transparent Pass (GPU)"));
+		m_ParticlePassTimer = GPUTimerManager::CreateGPUTimer(std::string("Particle Pass (GPU)"));
 		m_PostProcessPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Post Process Pass (GPU)"));
 		m_EditorPassTimer = GPUTimerManager::CreateGPUTimer(std::string("Editor Pass (GPU)"));
 	#endif
 #endif
 	}
 
+	void MasterRenderPass::OnAssetsResident() {
+		m_EnvironmentProbePass.regenerateFallbackProbes();
+		m_EnvironmentProbePass.pregenerateProbes();
+	}
+
 	void MasterRenderPass::Render() {
 #if FORWARD_RENDER
 		/* Forward Rendering */
@@ -73,9 +84,15 @@ namespace Arcane
 		ARC_GPU_TIMER_END(m_ForwardOpaquePassTimer);
 		ARC_POP_RENDER_TAG();
 
+		ARC_PUSH_RENDER_TAG("Lightmap Pass");
+		ARC_GPU_TIMER_BEGIN(m_LightmapPassTimer);
+		LightmapPassOutput lightmapOutput = m_LightmapPass.ExecuteLightmapPass(lightingOutput.outputFramebuffer, m_ActiveScene->GetCamera());
+		ARC_GPU_TIMER_END(m_LightmapPassTimer);
+		ARC_POP_RENDER_TAG();
+
 		ARC_PUSH_RENDER_TAG("Water Pass");
 		ARC_GPU_TIMER_BEGIN(m_WaterPassTimer);
-		WaterPassOutput waterOutput = m_WaterPass.ExecuteWaterPass(shadowmapOutput, lightingOutput.outputFramebuffer, m_ActiveScene->GetCamera());
+		WaterPassOutput waterOutput = m_WaterPass.ExecuteWaterPass(shadowmapOutput, lightmapOutput.outputFramebuffer, m_ActiveScene->GetCamera());
 		ARC_GPU_TIMER_END(m_WaterPassTimer);
 		ARC_POP_RENDER_TAG();
 
@@ -85,16 +102,27 @@ namespace Arcane
 		ARC_GPU_TIMER_END(m_ForwardTransparentPassTimer);
 		ARC_POP_RENDER_TAG();
 
+		ARC_PUSH_RENDER_TAG("Particle Pass");
+		ARC_GPU_TIMER_BEGIN(m_ParticlePassTimer);
+		ParticlePassOutput particleOutput = m_ParticlePass.ExecuteParticlePass(postTransparencyOutput.outputFramebuffer, m_ActiveScene->GetCamera());
+		ARC_GPU_TIMER_END(m_ParticlePassTimer);
+		ARC_POP_RENDER_TAG();
+
 		ARC_PUSH_RENDER_TAG("Post Process Pass");
 		ARC_GPU_TIMER_BEGIN(m_PostProcessPassTimer);
-		PostProcessPassOutput postProcessOutput = m_PostProcessPass.ExecutePostProcessPass(postTransparencyOutput.outputFramebuffer);
+		PostProcessPassOutput postProcessOutput = m_PostProcessPass.ExecutePostProcessPass(particleOutput.outputFramebuffer);
 		ARC_GPU_TIMER_END(m_PostProcessPassTimer);
 		ARC_POP_RENDER_TAG();
 
 		ARC_PUSH_RENDER_TAG("Editor Pass");
 		ARC_GPU_TIMER_BEGIN(m_EditorPassTimer);
-		Framebuffer* extraFramebuffer = postProcessOutput.outFramebuffer == m_PostProcessPass.GetFullRenderTarget() ? m_PostProcessPass.GetTonemappedNonLinearTarget() : m_PostProcessPass.GetFullRenderTarget();
-		EditorPassOutput editorOutput = m_EditorPass.ExecuteEditorPass(postProcessOutput.outFramebuffer, m_PostProcessPass.GetResolveRenderTarget(), extraFramebuffer, m_ActiveScene->GetCamera());
+		Framebuffer *extraFramebuffer1 = nullptr, *extraFramebuffer2 = nullptr;
+		if (m_EditorPass.NeedsExtraFramebuffers())
+		{
+			extraFramebuffer1 = m_PostProcessPass.GetResolveRenderTarget();
+			extraFramebuffer2 = postProcessOutput.outFramebuffer == m_PostProcessPass.GetFullRenderTarget() ? m_PostProcessPass.GetTonemappedNonLinearTarget() : m_PostProcessPass.GetFullRenderTarget();
+		}
+		EditorPassOutput editorOutput = m_EditorPass.ExecuteEditorPass(postProcessOutput.outFramebuffer, extraFramebuffer1, extraFramebuffer2, m_ActiveScene->GetCamera());
 		ARC_GPU_TIMER_END(m_EditorPassTimer);
 		ARC_POP_RENDER_TAG();
 #else
@@ -123,9 +151,15 @@ namespace Arcane
 		ARC_GPU_TIMER_END(m_DeferredLightingPassTimer);
 		ARC_POP_RENDER_TAG();
 
+		ARC_PUSH_RENDER_TAG("Lightmap Pass");
+		ARC_GPU_TIMER_BEGIN(m_LightmapPassTimer);
+		LightmapPassOutput lightmapOutput = m_LightmapPass.ExecuteLightmapPass(deferredLightingOutput.outputFramebuffer, m_ActiveScene->GetCamera());
+		ARC_GPU_TIMER_END(m_LightmapPassTimer);
+		ARC_POP_RENDER_TAG();
+
 		ARC_PUSH_RENDER_TAG("Water Pass");
 		ARC_GPU_TIMER_BEGIN(m_WaterPassTimer);
-		WaterPassOutput waterOutput = m_WaterPass.ExecuteWaterPass(shadowmapOutput, deferredLightingOutput.outputFramebuffer, m_ActiveScene->GetCamera());
+		WaterPassOutput waterOutput = m_WaterPass.ExecuteWaterPass(shadowmapOutput, lightmapOutput.outputFramebuffer, m_ActiveScene->GetCamera());
 		ARC_GPU_TIMER_END(m_WaterPassTimer);
 		ARC_POP_RENDER_TAG();
 
@@ -135,16 +169,27 @@ namespace Arcane
 		ARC_GPU_TIMER_END(m_PostGBufferForwardPassTimer);
 		ARC_POP_RENDER_TAG();
 
+		ARC_PUSH_RENDER_TAG("Particle Pass");
+		ARC_GPU_TIMER_BEGIN(m_ParticlePassTimer);
+		ParticlePassOutput particleOutput = m_ParticlePass.ExecuteParticlePass(postGBufferForward.outputFramebuffer, m_ActiveScene->GetCamera());
+		ARC_GPU_TIMER_END(m_ParticlePassTimer);
+		ARC_POP_RENDER_TAG();
+
 		ARC_PUSH_RENDER_TAG("Post Process Pass");
 		ARC_GPU_TIMER_BEGIN(m_PostProcessPassTimer);
-		PostProcessPassOutput postProcessOutput = m_PostProcessPass.ExecutePostProcessPass(postGBufferForward.outputFramebuffer);
+		PostProcessPassOutput postProcessOutput = m_PostProcessPass.ExecutePostProcessPass(particleOutput.outputFramebuffer);
 		ARC_GPU_TIMER_END(m_PostProcessPassTimer);
 		ARC_POP_RENDER_TAG();
 
 		ARC_PUSH_RENDER_TAG("Editor Pass");
 		ARC_GPU_TIMER_BEGIN(m_EditorPassTimer);
-		Framebuffer* extraFramebuffer = postProcessOutput.outFramebuffer == m_PostProcessPass.GetFullRenderTarget() ? m_PostProcessPass.GetTonemappedNonLinearTarget() : m_PostProcessPass.GetFullRenderTarget();
-		EditorPassOutput editorOutput = m_EditorPass.ExecuteEditorPass(postProcessOutput.outFramebuffer, m_PostProcessPass.GetResolveRenderTarget(), extraFramebuffer, m_ActiveScene->GetCamera());
+		Framebuffer *extraFramebuffer1 = nullptr, *extraFramebuffer2 = nullptr;
+		if (m_EditorPass.NeedsExtraFramebuffers())
+		{
+			extraFramebuffer1 = m_PostProcessPass.GetResolveRenderTarget();
+			extraFramebuffer2 = postProcessOutput.outFramebuffer == m_PostProcessPass.GetFullRenderTarget() ? m_PostProcessPass.GetTonemappedNonLinearTarget() : m_PostProcessPass.GetFullRenderTarget();
+		}
+		EditorPassOutput editorOutput = m_EditorPass.ExecuteEditorPass(postProcessOutput.outFramebuffer, extraFramebuffer1, extraFramebuffer2, m_ActiveScene->GetCamera());
 		ARC_GPU_TIMER_END(m_EditorPassTimer);
 		ARC_POP_RENDER_TAG();
 #endif
@@ -156,9 +201,12 @@ namespace Arcane
 			Window::Bind();
 			Window::ClearAll();
 			m_GLCache->SetShader(m_PassthroughShader);
-			m_PassthroughShader->SetUniform("input_texture", 0);
+			m_PassthroughShader->SetUniform(ARC_UNIFORM("input_texture"), 0);
 			m_FinalOutputTexture->Bind(0);
 			Renderer::DrawNdcPlane();
 		}
+		FrameCapture::OnFrameRendered(editorOutput.outFramebuffer);
+
+		LazyRenderTargets::ReleaseUnusedTargets();
 	}
 }
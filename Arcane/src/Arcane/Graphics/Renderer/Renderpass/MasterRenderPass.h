@@ -26,6 +26,14 @@
 #include <Arcane/Graphics/Renderer/Renderpass/WaterPass.h>
 #endif
 
+#ifndef PARTICLEPASS_H
+#include <Arcane/Graphics/Renderer/Renderpass/ParticlePass.h>
+#endif
+
+#ifndef LIGHTMAPPASS_H
+#include <Arcane/Graphics/Renderer/Renderpass/LightmapPass.h>
+#endif
+
 #ifndef POSTPROCESSPASS_H
 #include <Arcane/Graphics/Renderer/Renderpass/PostProcessPass.h>
 #endif
@@ -46,6 +54,7 @@ namespace Arcane
 		MasterRenderPass(Scene *scene);
 
 		void Init();
+		void OnAssetsResident(); // Called once everything queued during startup has loaded, captures what shouldn't be captured from placeholder assets
 		void Render();
 
 		inline void SetRenderToSwapchain(bool choice) { m_RenderToSwapchain = choice; }
@@ -64,6 +73,8 @@ namespace Arcane
 		ShadowmapPass m_ShadowmapPass;
 		PostProcessPass m_PostProcessPass;
 		WaterPass m_WaterPass;
+		ParticlePass m_ParticlePass;
+		LightmapPass m_LightmapPass;
 		EditorPass m_EditorPass;
 
 		// Forward passes
@@ -79,9 +90,9 @@ namespace Arcane
 
 #ifdef ARC_DEV_BUILD
 	#if FORWARD_RENDER
-		GPUTimer *m_ShadowPassTimer, *m_ForwardOpaquePassTimer, *m_WaterPassTimer, *m_ForwardTransparentPassTimer, *m_PostProcessPassTimer, *m_EditorPassTimer;
+		GPUTimer *m_ShadowPassTimer, *m_ForwardOpaquePassTimer, *m_LightmapPassTimer, *m_WaterPassTimer, *m_ForwardTransparentPassTimer, *m_ParticlePassTimer, *m_PostProcessPassTimer, *m_EditorPassTimer;
 	#else
-		GPUTimer *m_ShadowPassTimer, *m_DeferredGeometryPassTimer, *m_SSAOPassTimer, *m_DeferredLightingPassTimer, *m_WaterPassTimer, *m_PostGBufferForwardPassTimer, *m_PostProcessPassTimer, *m_EditorPassTimer;
+		GPUTimer *m_ShadowPassTimer, *m_DeferredGeometryPassTimer, *m_SSAOPassTimer, *m_DeferredLightingPassTimer, *m_LightmapPassTimer, *m_WaterPassTimer, *m_PostGBufferForwardPassTimer, *m_ParticlePassTimer, *m_PostProcessPassTimer, *m_EditorPassTimer;
 	#endif
 #endif
 	};
@@ -0,0 +1,98 @@
+#include "arcpch.h"
+#include "ParticlePass.h"
+
+#include <Arcane/Scene/Scene.h>
+#include <Arcane/Scene/Components.h>
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Texture/Texture.h>
+#include <Arcane/Graphics/Camera/ICamera.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Graphics/Particles/ParticleManager.h>
+#include <Arcane/Graphics/Particles/GPUParticleEmitter.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+
+namespace Arcane
+{
+	ParticlePass::ParticlePass(Scene *scene) : RenderPass(scene), m_ParticlesEnabled(true)
+	{
+		m_ParticleShader = ShaderLoader::LoadShader("particles/ParticleRender.glsl");
+	}
+
+	ParticlePass::~ParticlePass()
+	{
+
+	}
+
+	ParticlePassOutput ParticlePass::ExecuteParticlePass(Framebuffer *inputFramebuffer, ICamera *camera)
+	{
+		ParticlePassOutput passOutput;
+		passOutput.outputFramebuffer = inputFramebuffer;
+		if (!m_ParticlesEnabled)
+			return passOutput;
+
+		ParticleManager *particleManager = m_ActiveScene->GetParticleManager();
+		auto group = m_ActiveScene->m_Registry.view<ParticleEmitterComponent>();
+		if (group.empty())
+			return passOutput;
+
+		glViewport(0, 0, inputFramebuffer->GetWidth(), inputFramebuffer->GetHeight());
+		inputFramebuffer->Bind();
+		m_GLCache->SetMultisample(inputFramebuffer->IsMultisampled());
+		m_GLCache->SetDepthTest(true);
+		m_GLCache->SetFaceCull(false);
+		m_GLCache->SetBlend(true);
+		glDepthMask(GL_FALSE);
+
+		glm::mat4 view = camera->GetViewMatrix();
+		glm::vec3 cameraRight = glm::vec3(view[0][0], view[1][0], view[2][0]);
+		glm::vec3 cameraUp = glm::vec3(view[0][1], view[1][1], view[2][1]);
+
+		for (auto entity : group)
+		{
+			auto &emitterComponent = group.get<ParticleEmitterComponent>(entity);
+			GPUParticleEmitter *emitter = particleManager->GetEmitter(entity);
+			if (!emitter)
+				continue;
+
+			// Additive blending is order independent so only alpha blended particles ever need sorting
+			bool sortParticles = !emitterComponent.AdditiveBlending && emitterComponent.SortParticles;
+			if (sortParticles)
+			{
+				ARC_PUSH_RENDER_TAG("Particle Sort");
+				emitter->SortBackToFront(camera->GetPosition(), particleManager->GetSortKeyShader(), particleManager->GetBitonicSortShader());
+				ARC_POP_RENDER_TAG();
+			}
+
+			if (emitterComponent.AdditiveBlending)
+				m_GLCache->SetBlendFunc(GL_SRC_ALPHA, GL_ONE);
+			else
+				m_GLCache->SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+			m_GLCache->SetShader(m_ParticleShader);
+			m_ParticleShader->SetUniform(ARC_UNIFORM("viewProjection"), camera->GetProjectionMatrix() * view);
+			m_ParticleShader->SetUniform(ARC_UNIFORM("cameraRight"), cameraRight);
+			m_ParticleShader->SetUniform(ARC_UNIFORM("cameraUp"), cameraUp);
+			m_ParticleShader->SetUniform(ARC_UNIFORM("sizeRange"), glm::vec2(emitterComponent.StartSize, emitterComponent.EndSize));
+			m_ParticleShader->SetUniform(ARC_UNIFORM("startColour"), emitterComponent.StartColour);
+			m_ParticleShader->SetUniform(ARC_UNIFORM("endColour"), emitterComponent.EndColour);
+			m_ParticleShader->SetUniform(ARC_UNIFORM("useSortedIndices"), static_cast<int>(sortParticles));
+			m_ParticleShader->SetUniform(ARC_UNIFORM("hasSpriteTexture"), static_cast<int>(emitterComponent.SpriteTexture != nullptr));
+			if (emitterComponent.SpriteTexture)
+			{
+				m_ParticleShader->SetUniform(ARC_UNIFORM("spriteTexture"), 0);
+				emitterComponent.SpriteTexture->Bind(0);
+			}
+
+			// Particle data was written by compute shaders, make sure it is visible to vertex pulling
+			glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+			emitter->Draw();
+		}
+
+		// Restore state
+		glDepthMask(GL_TRUE);
+		m_GLCache->SetBlend(false);
+		m_GLCache->SetFaceCull(true);
+
+		return passOutput;
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+#ifndef PARTICLEPASS_H
+#define PARTICLEPASS_H
+
+#ifndef RENDERPASS_H
+#include <Arcane/graphics/Renderer/Renderpass/RenderPass.h>
+#endif
+
+#ifndef RENDERPASSTYPE_H
+#include <Arcane/Graphics/Renderer/Renderpass/RenderPassType.h>
+#endif
+
+namespace Arcane
+{
+	class Shader;
+	class Scene;
+	class ICamera;
+
+	// Renders every GPU simulated particle emitter in the scene on top of the lit scene, particles test against the scene's depth but do not write to it
+	class ParticlePass : public RenderPass
+	{
+	public:
+		ParticlePass(Scene *scene);
+		virtual ~ParticlePass() override;
+
+		ParticlePassOutput ExecuteParticlePass(Framebuffer *inputFramebuffer, ICamera *camera);
+	private:
+		bool m_ParticlesEnabled;
+
+		Shader *m_ParticleShader;
+	};
+}
+#endif
@@ -18,6 +18,7 @@ namespace Arcane
 		m_BloomHalfRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 2.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 2.0f)), false), m_BloomQuarterRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 4.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 4.0f)), false), m_BloomEightRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 8.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 8.0f)), false),
 		m_BloomSixteenRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 16.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 16.0f)), false), m_BloomThirtyTwoRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 32.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 32.0f)), false), m_BloomSixtyFourRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 64.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 64.0f)), false),
 		m_FullRenderTarget(Window::GetRenderResolutionWidth(), Window::GetRenderResolutionHeight(), false), m_HalfRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 2.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 2.0f)), false), m_QuarterRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 4.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 4.0f)), false), m_EighthRenderTarget((unsigned int)(Window::GetRenderResolutionWidth() * (1.0f / 8.0f)), (unsigned int)(Window::GetRenderResolutionHeight() * (1.0f / 8.0f)), false),
+		m_SsaoTargets("SSAO"), m_ResolveTargets("MSAA Resolve"), m_BloomTargets("Bloom"), m_FullTargets("Post Process"), m_UtilityTargets("Post Process Utility"),
 		m_SsaoNoiseTexture(), m_EffectsTimer()
 	{
 		ARC_ASSERT(m_BloomSixtyFourRenderTarget.GetWidth() >= 1 && m_BloomSixtyFourRenderTarget.GetHeight() >= 1, "Render resolution is too low for bloom");
@@ -36,24 +37,15 @@ namespace Arcane
 		m_FilmGrainShader = ShaderLoader::LoadShader("post_process/film_grain/FilmGrain.glsl");
 
 		// Framebuffer setup
-		m_SsaoRenderTarget.AddColorTexture(NormalizedSingleChannel8).CreateFramebuffer();
-		m_SsaoBlurRenderTarget.AddColorTexture(NormalizedSingleChannel8).CreateFramebuffer();
 		m_TonemappedNonLinearTarget.AddColorTexture(Normalized8).AddDepthStencilRBO(NormalizedDepthOnly).CreateFramebuffer();
-		m_ResolveRenderTarget.AddColorTexture(FloatingPoint16).AddDepthStencilRBO(NormalizedDepthOnly).CreateFramebuffer();
-
-		m_FullRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_HalfRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_QuarterRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_EighthRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-
-		m_BrightPassRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		//m_BloomFullRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_BloomHalfRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_BloomQuarterRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_BloomEightRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_BloomSixteenRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_BloomThirtyTwoRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
-		m_BloomSixtyFourRenderTarget.AddColorTexture(FloatingPoint16).CreateFramebuffer();
+
+		m_SsaoTargets.AddTarget(&m_SsaoRenderTarget, NormalizedSingleChannel8).AddTarget(&m_SsaoBlurRenderTarget, NormalizedSingleChannel8);
+		m_ResolveTargets.AddTarget(&m_ResolveRenderTarget, FloatingPoint16, NormalizedDepthOnly, false);
+		m_BloomTargets.AddTarget(&m_BrightPassRenderTarget, FloatingPoint16);
+		m_BloomTargets.AddTarget(&m_BloomHalfRenderTarget, FloatingPoint16).AddTarget(&m_BloomQuarterRenderTarget, FloatingPoint16).AddTarget(&m_BloomEightRenderTarget, FloatingPoint16);
+		m_BloomTargets.AddTarget(&m_BloomSixteenRenderTarget, FloatingPoint16).AddTarget(&m_BloomThirtyTwoRenderTarget, FloatingPoint16).AddTarget(&m_BloomSixtyFourRenderTarget, FloatingPoint16);
+		m_FullTargets.AddTarget(&m_FullRenderTarget, FloatingPoint16);
+		m_UtilityTargets.AddTarget(&m_HalfRenderTarget, FloatingPoint16).AddTarget(&m_QuarterRenderTarget, FloatingPoint16).AddTarget(&m_EighthRenderTarget, FloatingPoint16);
 
 		// SSAO Hemisphere Sample Generation (tangent space)
 		std::uniform_real_distribution<float> randomFloats(0.0f, 1.0f);
@@ -103,6 +95,8 @@ namespace Arcane
 			return passOutput;
 		}
 
+		m_SsaoTargets.Acquire();
+
 		// Generate the AO factors for the scene
 		ARC_PUSH_RENDER_TAG("SSAO");
 		glViewport(0, 0, m_SsaoRenderTarget.GetWidth(), m_SsaoRenderTarget.GetHeight());
@@ -115,25 +109,25 @@ namespace Arcane
 		m_GLCache->SetShader(m_SsaoShader);
 
 		// Used to tile the noise texture across the screen every 4 texels (because our noise texture is 4x4)
-		m_SsaoShader->SetUniform("noiseScale", glm::vec2(m_SsaoRenderTarget.GetWidth() * 0.25f, m_SsaoRenderTarget.GetHeight() * 0.25f));
+		m_SsaoShader->SetUniform(ARC_UNIFORM("noiseScale"), glm::vec2(m_SsaoRenderTarget.GetWidth() * 0.25f, m_SsaoRenderTarget.GetHeight() * 0.25f));
 
-		m_SsaoShader->SetUniform("ssaoStrength", m_SsaoStrength);
-		m_SsaoShader->SetUniform("sampleRadius", m_SsaoSampleRadius);
-		m_SsaoShader->SetUniform("sampleRadius2", m_SsaoSampleRadius * m_SsaoSampleRadius);
-		m_SsaoShader->SetUniform("numKernelSamples", (int)m_SsaoKernel.size());
-		m_SsaoShader->SetUniformArray("samples", static_cast<int>(m_SsaoKernel.size()), &m_SsaoKernel[0]);
+		m_SsaoShader->SetUniform(ARC_UNIFORM("ssaoStrength"), m_SsaoStrength);
+		m_SsaoShader->SetUniform(ARC_UNIFORM("sampleRadius"), m_SsaoSampleRadius);
+		m_SsaoShader->SetUniform(ARC_UNIFORM("sampleRadius2"), m_SsaoSampleRadius * m_SsaoSampleRadius);
+		m_SsaoShader->SetUniform(ARC_UNIFORM("numKernelSamples"), (int)m_SsaoKernel.size());
+		m_SsaoShader->SetUniformArray(ARC_UNIFORM("samples"), static_cast<int>(m_SsaoKernel.size()), &m_SsaoKernel[0]);
 
-		m_SsaoShader->SetUniform("view", camera->GetViewMatrix());
-		m_SsaoShader->SetUniform("projection", camera->GetProjectionMatrix());
-		m_SsaoShader->SetUniform("viewInverse", glm::inverse(camera->GetViewMatrix()));
-		m_SsaoShader->SetUniform("projectionInverse", glm::inverse(camera->GetProjectionMatrix()));
+		m_SsaoShader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+		m_SsaoShader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
+		m_SsaoShader->SetUniform(ARC_UNIFORM("viewInverse"), glm::inverse(camera->GetViewMatrix()));
+		m_SsaoShader->SetUniform(ARC_UNIFORM("projectionInverse"), glm::inverse(camera->GetProjectionMatrix()));
 
 		inputGbuffer->GetNormal()->Bind(0);
-		m_SsaoShader->SetUniform("normalTexture", 0);
+		m_SsaoShader->SetUniform(ARC_UNIFORM("normalTexture"), 0);
 		inputGbuffer->GetDepthStencilTexture()->Bind(1);
-		m_SsaoShader->SetUniform("depthTexture", 1);
+		m_SsaoShader->SetUniform(ARC_UNIFORM("depthTexture"), 1);
 		m_SsaoNoiseTexture.Bind(2);
-		m_SsaoShader->SetUniform("texNoise", 2);
+		m_SsaoShader->SetUniform(ARC_UNIFORM("texNoise"), 2);
 
 		// Render our NDC quad to perform SSAO
 		Renderer::DrawNdcPlane();
@@ -142,8 +136,8 @@ namespace Arcane
 		m_SsaoBlurRenderTarget.Bind();
 		m_SsaoBlurShader->Enable();
 
-		m_SsaoBlurShader->SetUniform("numSamplesAroundTexel", 2); // 5x5 kernel blur
-		m_SsaoBlurShader->SetUniform("ssaoInput", 0); // Texture unit
+		m_SsaoBlurShader->SetUniform(ARC_UNIFORM("numSamplesAroundTexel"), 2); // 5x5 kernel blur
+		m_SsaoBlurShader->SetUniform(ARC_UNIFORM("ssaoInput"), 0); // Texture unit
 		m_SsaoRenderTarget.GetColourTexture()->Bind(0);
 
 		// Render our NDC quad to blur our SSAO texture
@@ -164,10 +158,15 @@ namespace Arcane
 
 		GLCache *glCache = GLCache::GetInstance();
 
+		// SDR effects ping-pong between the tonemapped and the full target
+		if (m_ChromaticAberrationEnabled || m_FilmGrainEnabled || m_VignetteEnabled || m_FxaaEnabled)
+			m_FullTargets.Acquire();
+
 		// If the framebuffer is multi-sampled, resolve it
 		Framebuffer *inputFramebuffer = framebufferToProcess;
 		if (framebufferToProcess->IsMultisampled())
 		{
+			m_ResolveTargets.Acquire();
 			glBindFramebuffer(GL_READ_FRAMEBUFFER, framebufferToProcess->GetFramebuffer());
 			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_ResolveRenderTarget.GetFramebuffer());
 			glBlitFramebuffer(0, 0, framebufferToProcess->GetWidth(), framebufferToProcess->GetHeight(), 0, 0, m_ResolveRenderTarget.GetWidth(), m_ResolveRenderTarget.GetHeight(), GL_COLOR_BUFFER_BIT, GL_NEAREST);
@@ -253,9 +252,9 @@ namespace Arcane
 		m_GLCache->SetStencilTest(false);
 		target->Bind();
 
-		m_TonemapGammaCorrectShader->SetUniform("gamma_inverse", 1.0f / m_GammaCorrection); 
-		m_TonemapGammaCorrectShader->SetUniform("exposure", m_Exposure);
-		m_TonemapGammaCorrectShader->SetUniform("input_texture", 0);
+		m_TonemapGammaCorrectShader->SetUniform(ARC_UNIFORM("gamma_inverse"), 1.0f / m_GammaCorrection); 
+		m_TonemapGammaCorrectShader->SetUniform(ARC_UNIFORM("exposure"), m_Exposure);
+		m_TonemapGammaCorrectShader->SetUniform(ARC_UNIFORM("input_texture"), 0);
 		hdrTexture->Bind(0);
 
 		Renderer::DrawNdcPlane();
@@ -274,8 +273,8 @@ namespace Arcane
 		m_GLCache->SetStencilTest(false);
 		target->Bind();
 
-		m_FxaaShader->SetUniform("texel_size", glm::vec2(1.0f / (float)texture->GetWidth(), 1.0f / (float)texture->GetHeight()));
-		m_FxaaShader->SetUniform("input_texture", 0);
+		m_FxaaShader->SetUniform(ARC_UNIFORM("texel_size"), glm::vec2(1.0f / (float)texture->GetWidth(), 1.0f / (float)texture->GetHeight()));
+		m_FxaaShader->SetUniform(ARC_UNIFORM("input_texture"), 0);
 		texture->Bind(0);
 
 		Renderer::DrawNdcPlane();
@@ -294,14 +293,14 @@ namespace Arcane
 		m_GLCache->SetStencilTest(false);
 		target->Bind();
 
-		m_VignetteShader->SetUniform("colour", m_VignetteColour);
-		m_VignetteShader->SetUniform("intensity", m_VignetteIntensity);
-		m_VignetteShader->SetUniform("input_texture", 0);
+		m_VignetteShader->SetUniform(ARC_UNIFORM("colour"), m_VignetteColour);
+		m_VignetteShader->SetUniform(ARC_UNIFORM("intensity"), m_VignetteIntensity);
+		m_VignetteShader->SetUniform(ARC_UNIFORM("input_texture"), 0);
 		texture->Bind(0);
 		if (optionalVignetteMask != nullptr)
 		{
-			m_VignetteShader->SetUniform("usesMask", 1);
-			m_VignetteShader->SetUniform("vignette_mask", 1);
+			m_VignetteShader->SetUniform(ARC_UNIFORM("usesMask"), 1);
+			m_VignetteShader->SetUniform(ARC_UNIFORM("vignette_mask"), 1);
 			optionalVignetteMask->Bind(1);
 		}
 
@@ -321,9 +320,9 @@ namespace Arcane
 		m_GLCache->SetStencilTest(false);
 		target->Bind();
 
-		m_ChromaticAberrationShader->SetUniform("intensity", m_ChromaticAberrationIntensity * 100);
-		m_ChromaticAberrationShader->SetUniform("texel_size", glm::vec2(1.0f / (float)texture->GetWidth(), 1.0f / (float)texture->GetHeight()));
-		m_ChromaticAberrationShader->SetUniform("input_texture", 0);
+		m_ChromaticAberrationShader->SetUniform(ARC_UNIFORM("intensity"), m_ChromaticAberrationIntensity * 100);
+		m_ChromaticAberrationShader->SetUniform(ARC_UNIFORM("texel_size"), glm::vec2(1.0f / (float)texture->GetWidth(), 1.0f / (float)texture->GetHeight()));
+		m_ChromaticAberrationShader->SetUniform(ARC_UNIFORM("input_texture"), 0);
 		texture->Bind(0);
 
 		Renderer::DrawNdcPlane();
@@ -342,9 +341,9 @@ namespace Arcane
 		m_GLCache->SetStencilTest(false);
 		target->Bind();
 
-		m_FilmGrainShader->SetUniform("intensity", m_FilmGrainIntensity * 100.0f);
-		m_FilmGrainShader->SetUniform("time", (float)(std::fmod(m_EffectsTimer.Elapsed(), 100.0)));
-		m_FilmGrainShader->SetUniform("input_texture", 0);
+		m_FilmGrainShader->SetUniform(ARC_UNIFORM("intensity"), m_FilmGrainIntensity * 100.0f);
+		m_FilmGrainShader->SetUniform(ARC_UNIFORM("time"), (float)(std::fmod(m_EffectsTimer.Elapsed(), 100.0)));
+		m_FilmGrainShader->SetUniform(ARC_UNIFORM("input_texture"), 0);
 		texture->Bind(0);
 
 		Renderer::DrawNdcPlane();
@@ -355,6 +354,9 @@ namespace Arcane
 	// Great summary of the advanced warfare bloom talk and what Arcane's implementation is based on
 	Texture* PostProcessPass::Bloom(Texture *hdrSceneTexture)
 	{
+		m_BloomTargets.Acquire();
+		m_FullTargets.Acquire(); // Bloom gets composited into the full target
+
 		ARC_PUSH_RENDER_TAG("Bloom");
 		m_GLCache->SetDepthTest(false);
 		m_GLCache->SetBlend(false);
@@ -373,8 +375,8 @@ namespace Arcane
 		filterValues.y = filterValues.x - knee;
 		filterValues.z = 2.0f * knee;
 		filterValues.w = 0.25f / (knee + 0.00001f);
-		m_BloomBrightPassShader->SetUniform("filterValues", filterValues);
-		m_BloomBrightPassShader->SetUniform("sceneCapture", 0);
+		m_BloomBrightPassShader->SetUniform(ARC_UNIFORM("filterValues"), filterValues);
+		m_BloomBrightPassShader->SetUniform(ARC_UNIFORM("sceneCapture"), 0);
 		hdrSceneTexture->Bind(0);
 		Renderer::DrawNdcPlane();
 
@@ -383,48 +385,48 @@ namespace Arcane
 		glViewport(0, 0, m_BloomHalfRenderTarget.GetWidth(), m_BloomHalfRenderTarget.GetHeight());
 		m_BloomHalfRenderTarget.Bind();
 		m_BloomHalfRenderTarget.ClearAll();
-		m_BloomDownsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomHalfRenderTarget.GetWidth(), 1.0f / m_BloomHalfRenderTarget.GetHeight()));
-		m_BloomDownsampleShader->SetUniform("textureToDownsample", 0);
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomHalfRenderTarget.GetWidth(), 1.0f / m_BloomHalfRenderTarget.GetHeight()));
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("textureToDownsample"), 0);
 		m_BrightPassRenderTarget.GetColourTexture()->Bind(0);
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomQuarterRenderTarget.GetWidth(), m_BloomQuarterRenderTarget.GetHeight());
 		m_BloomQuarterRenderTarget.Bind();
 		m_BloomQuarterRenderTarget.ClearAll();
-		m_BloomDownsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomQuarterRenderTarget.GetWidth(), 1.0f / m_BloomQuarterRenderTarget.GetHeight()));
-		m_BloomDownsampleShader->SetUniform("textureToDownsample", 0);
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomQuarterRenderTarget.GetWidth(), 1.0f / m_BloomQuarterRenderTarget.GetHeight()));
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("textureToDownsample"), 0);
 		m_BloomHalfRenderTarget.GetColourTexture()->Bind(0);
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomEightRenderTarget.GetWidth(), m_BloomEightRenderTarget.GetHeight());
 		m_BloomEightRenderTarget.Bind();
 		m_BloomEightRenderTarget.ClearAll();
-		m_BloomDownsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomEightRenderTarget.GetWidth(), 1.0f / m_BloomEightRenderTarget.GetHeight()));
-		m_BloomDownsampleShader->SetUniform("textureToDownsample", 0);
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomEightRenderTarget.GetWidth(), 1.0f / m_BloomEightRenderTarget.GetHeight()));
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("textureToDownsample"), 0);
 		m_BloomQuarterRenderTarget.GetColourTexture()->Bind(0);
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomSixteenRenderTarget.GetWidth(), m_BloomSixteenRenderTarget.GetHeight());
 		m_BloomSixteenRenderTarget.Bind();
 		m_BloomSixteenRenderTarget.ClearAll();
-		m_BloomDownsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomSixteenRenderTarget.GetWidth(), 1.0f / m_BloomSixteenRenderTarget.GetHeight()));
-		m_BloomDownsampleShader->SetUniform("textureToDownsample", 0);
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomSixteenRenderTarget.GetWidth(), 1.0f / m_BloomSixteenRenderTarget.GetHeight()));
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("textureToDownsample"), 0);
 		m_BloomEightRenderTarget.GetColourTexture()->Bind(0);
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomThirtyTwoRenderTarget.GetWidth(), m_BloomThirtyTwoRenderTarget.GetHeight());
 		m_BloomThirtyTwoRenderTarget.Bind();
 		m_BloomThirtyTwoRenderTarget.ClearAll();
-		m_BloomDownsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomThirtyTwoRenderTarget.GetWidth(), 1.0f / m_BloomThirtyTwoRenderTarget.GetHeight()));
-		m_BloomDownsampleShader->SetUniform("textureToDownsample", 0);
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomThirtyTwoRenderTarget.GetWidth(), 1.0f / m_BloomThirtyTwoRenderTarget.GetHeight()));
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("textureToDownsample"), 0);
 		m_BloomSixteenRenderTarget.GetColourTexture()->Bind(0);
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomSixtyFourRenderTarget.GetWidth(), m_BloomSixtyFourRenderTarget.GetHeight());
 		m_BloomSixtyFourRenderTarget.Bind();
 		m_BloomSixtyFourRenderTarget.ClearAll();
-		m_BloomDownsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomSixtyFourRenderTarget.GetWidth(), 1.0f / m_BloomSixtyFourRenderTarget.GetHeight()));
-		m_BloomDownsampleShader->SetUniform("textureToDownsample", 0);
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomSixtyFourRenderTarget.GetWidth(), 1.0f / m_BloomSixtyFourRenderTarget.GetHeight()));
+		m_BloomDownsampleShader->SetUniform(ARC_UNIFORM("textureToDownsample"), 0);
 		m_BloomThirtyTwoRenderTarget.GetColourTexture()->Bind(0);
 		Renderer::DrawNdcPlane();
 
@@ -434,41 +436,41 @@ namespace Arcane
 		m_GLCache->SetBlendFunc(GL_ONE, GL_ONE);
 		glViewport(0, 0, m_BloomThirtyTwoRenderTarget.GetWidth(), m_BloomThirtyTwoRenderTarget.GetHeight());
 		m_BloomThirtyTwoRenderTarget.Bind();
-		m_BloomUpsampleShader->SetUniform("sampleScale", glm::vec4(1.0, 1.0, 1.0, 1.0));
-		m_BloomUpsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomThirtyTwoRenderTarget.GetWidth(), 1.0f / m_BloomThirtyTwoRenderTarget.GetHeight()));
-		m_BloomUpsampleShader->SetUniform("textureToUpsample", 0);
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("sampleScale"), glm::vec4(1.0, 1.0, 1.0, 1.0));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomThirtyTwoRenderTarget.GetWidth(), 1.0f / m_BloomThirtyTwoRenderTarget.GetHeight()));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("textureToUpsample"), 0);
 		m_BloomSixtyFourRenderTarget.GetColourTexture()->Bind(0);
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomSixteenRenderTarget.GetWidth(), m_BloomSixteenRenderTarget.GetHeight());
 		m_BloomSixteenRenderTarget.Bind();
-		m_BloomUpsampleShader->SetUniform("sampleScale", glm::vec4(1.0, 1.0, 1.0, 1.0));
-		m_BloomUpsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomSixteenRenderTarget.GetWidth(), 1.0f / m_BloomSixteenRenderTarget.GetHeight()));
-		m_BloomUpsampleShader->SetUniform("textureToUpsample", 0);
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("sampleScale"), glm::vec4(1.0, 1.0, 1.0, 1.0));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomSixteenRenderTarget.GetWidth(), 1.0f / m_BloomSixteenRenderTarget.GetHeight()));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("textureToUpsample"), 0);
 		m_BloomThirtyTwoRenderTarget.GetColourTexture()->Bind();
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomEightRenderTarget.GetWidth(), m_BloomEightRenderTarget.GetHeight());
 		m_BloomEightRenderTarget.Bind();
-		m_BloomUpsampleShader->SetUniform("sampleScale", glm::vec4(1.0, 1.0, 1.0, 1.0));
-		m_BloomUpsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomEightRenderTarget.GetWidth(), 1.0f / m_BloomEightRenderTarget.GetHeight()));
-		m_BloomUpsampleShader->SetUniform("textureToUpsample", 0);
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("sampleScale"), glm::vec4(1.0, 1.0, 1.0, 1.0));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomEightRenderTarget.GetWidth(), 1.0f / m_BloomEightRenderTarget.GetHeight()));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("textureToUpsample"), 0);
 		m_BloomSixteenRenderTarget.GetColourTexture()->Bind();
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomQuarterRenderTarget.GetWidth(), m_BloomQuarterRenderTarget.GetHeight());
 		m_BloomQuarterRenderTarget.Bind();
-		m_BloomUpsampleShader->SetUniform("sampleScale", glm::vec4(1.0, 1.0, 1.0, 1.0));
-		m_BloomUpsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomQuarterRenderTarget.GetWidth(), 1.0f / m_BloomQuarterRenderTarget.GetHeight()));
-		m_BloomUpsampleShader->SetUniform("textureToUpsample", 0);
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("sampleScale"), glm::vec4(1.0, 1.0, 1.0, 1.0));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomQuarterRenderTarget.GetWidth(), 1.0f / m_BloomQuarterRenderTarget.GetHeight()));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("textureToUpsample"), 0);
 		m_BloomEightRenderTarget.GetColourTexture()->Bind();
 		Renderer::DrawNdcPlane();
 
 		glViewport(0, 0, m_BloomHalfRenderTarget.GetWidth(), m_BloomHalfRenderTarget.GetHeight());
 		m_BloomHalfRenderTarget.Bind();
-		m_BloomUpsampleShader->SetUniform("sampleScale", glm::vec4(1.0, 1.0, 1.0, 1.0));
-		m_BloomUpsampleShader->SetUniform("texelSize", glm::vec2(1.0f / m_BloomHalfRenderTarget.GetWidth(), 1.0f / m_BloomHalfRenderTarget.GetHeight()));
-		m_BloomUpsampleShader->SetUniform("textureToUpsample", 0);
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("sampleScale"), glm::vec4(1.0, 1.0, 1.0, 1.0));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("texelSize"), glm::vec2(1.0f / m_BloomHalfRenderTarget.GetWidth(), 1.0f / m_BloomHalfRenderTarget.GetHeight()));
+		m_BloomUpsampleShader->SetUniform(ARC_UNIFORM("textureToUpsample"), 0);
 		m_BloomQuarterRenderTarget.GetColourTexture()->Bind();
 		Renderer::DrawNdcPlane();
 
@@ -477,11 +479,11 @@ namespace Arcane
 		m_GLCache->SetShader(m_BloomCompositeShader);
 		glViewport(0, 0, m_FullRenderTarget.GetWidth(), m_FullRenderTarget.GetHeight());
 		m_FullRenderTarget.Bind();
-		m_BloomCompositeShader->SetUniform("bloomStrength", m_BloomStrength);
-		m_BloomCompositeShader->SetUniform("dirtMaskIntensity", m_BloomDirtMaskIntensity);
-		m_BloomCompositeShader->SetUniform("sceneTexture", 0);
-		m_BloomCompositeShader->SetUniform("bloomTexture", 1);
-		m_BloomCompositeShader->SetUniform("dirtMaskTexture", 2);
+		m_BloomCompositeShader->SetUniform(ARC_UNIFORM("bloomStrength"), m_BloomStrength);
+		m_BloomCompositeShader->SetUniform(ARC_UNIFORM("dirtMaskIntensity"), m_BloomDirtMaskIntensity);
+		m_BloomCompositeShader->SetUniform(ARC_UNIFORM("sceneTexture"), 0);
+		m_BloomCompositeShader->SetUniform(ARC_UNIFORM("bloomTexture"), 1);
+		m_BloomCompositeShader->SetUniform(ARC_UNIFORM("dirtMaskTexture"), 2);
 		hdrSceneTexture->Bind(0);
 		m_BloomHalfRenderTarget.GetColourTexture()->Bind(1);
 		if (m_BloomDirtTexture && m_BloomDirtTexture->IsGenerated())
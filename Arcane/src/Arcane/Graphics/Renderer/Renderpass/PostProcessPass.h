@@ -14,6 +14,10 @@
 #include <Arcane/Util/Timer.h>
 #endif
 
+#ifndef LAZYRENDERTARGETS_H
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
+#endif
+
 #ifndef RENDERPASSTYPE_H
 #include <Arcane/Graphics/Renderer/Renderpass/RenderPassType.h>
 #endif
@@ -76,11 +80,12 @@ namespace Arcane
 
 		// Render Target Access (TODO: Should use render target aliasing and have a system for sharing render targets for different render passes. But this will suffice for now)
 		// Silly to manage all of these like this
-		inline Framebuffer* GetFullRenderTarget() { return &m_FullRenderTarget; }
-		inline Framebuffer* GetHalfRenderTarget() { return &m_HalfRenderTarget; }
-		inline Framebuffer* GetQuarterRenderTarget() { return &m_QuarterRenderTarget; }
-		inline Framebuffer* GetEighthRenderTarget() { return &m_EighthRenderTarget; }
-		inline Framebuffer* GetResolveRenderTarget() { return &m_ResolveRenderTarget; }
+		// Most of these are only allocated while something uses them, so getting one allocates it and it needs to be fetched every frame it is used
+		inline Framebuffer* GetFullRenderTarget() { m_FullTargets.Acquire(); return &m_FullRenderTarget; }
+		inline Framebuffer* GetHalfRenderTarget() { m_UtilityTargets.Acquire(); return &m_HalfRenderTarget; }
+		inline Framebuffer* GetQuarterRenderTarget() { m_UtilityTargets.Acquire(); return &m_QuarterRenderTarget; }
+		inline Framebuffer* GetEighthRenderTarget() { m_UtilityTargets.Acquire(); return &m_EighthRenderTarget; }
+		inline Framebuffer* GetResolveRenderTarget() { m_ResolveTargets.Acquire(); return &m_ResolveRenderTarget; }
 		inline Framebuffer* GetTonemappedNonLinearTarget() { return &m_TonemappedNonLinearTarget; }
 
 		// Bloom settings
@@ -120,6 +125,13 @@ namespace Arcane
 		Framebuffer m_QuarterRenderTarget;
 		Framebuffer m_EighthRenderTarget;
 
+		// Attachments of the targets above are created when an effect that needs them is enabled (the tonemapped target is always needed)
+		LazyRenderTargets m_SsaoTargets;
+		LazyRenderTargets m_ResolveTargets;
+		LazyRenderTargets m_BloomTargets;
+		LazyRenderTargets m_FullTargets;
+		LazyRenderTargets m_UtilityTargets;
+
 		// Post Processing Tweaks
 		float m_GammaCorrection = 2.2f;
 		float m_Exposure = 1.0f;
@@ -17,7 +17,8 @@ namespace Arcane
 	enum RenderPassType
 	{
 		MaterialRequired,
-		NoMaterialRequired
+		NoMaterialRequired,
+		DepthOnly // No material and only the position stream (plus bones when skinned) is bound, so the shader can't read any other vertex attribute
 	};
 
 	struct PostProcessPassOutput
@@ -51,6 +52,16 @@ namespace Arcane
 		Framebuffer *outputFramebuffer = nullptr;
 	};
 
+	struct ParticlePassOutput
+	{
+		Framebuffer *outputFramebuffer = nullptr;
+	};
+
+	struct LightmapPassOutput
+	{
+		Framebuffer *outputFramebuffer = nullptr;
+	};
+
 	struct GeometryPassOutput
 	{
 		GBuffer *outputGBuffer = nullptr;
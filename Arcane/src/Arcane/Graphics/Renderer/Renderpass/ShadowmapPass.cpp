@@ -34,6 +34,7 @@ namespace Arcane
 		m_ShadowmapSkinnedShader = ShaderLoader::LoadShader("Shadowmap_Generation_Skinned.glsl");
 		m_ShadowmapLinearShader = ShaderLoader::LoadShader("Shadowmap_Generation_Linear.glsl");
 		m_ShadowmapLinearSkinnedShader = ShaderLoader::LoadShader("Shadowmap_Generation_Linear_Skinned.glsl");
+		m_ShadowmapImpostorShader = ShaderLoader::LoadShader("Shadowmap_Generation_Impostor.glsl");
 		m_EmptyFramebuffer.AddDepthStencilTexture(NormalizedDepthOnly, true).CreateFramebuffer();
 	}
 
@@ -76,30 +77,28 @@ namespace Arcane
 			m_GLCache->SetBlend(false);
 			m_GLCache->SetFaceCull(false); // For one sided objects - TODO: This will get overwritten by the renderer anyways
 
-			// Setup model renderer
+			// Setup model renderer, models the camera sees as impostors cast impostor shadows too
 			if (renderOnlyStatic)
 			{
-				m_ActiveScene->AddModelsToRenderer(ModelFilterType::StaticModels);
+				m_ActiveScene->AddModelsToRenderer(ModelFilterType::StaticModels, camera);
 			}
 			else
 			{
-				m_ActiveScene->AddModelsToRenderer(ModelFilterType::AllModels);
+				m_ActiveScene->AddModelsToRenderer(ModelFilterType::AllModels, camera);
 			}
 
 			// Render skinned models
 			{
 				m_GLCache->SetShader(m_ShadowmapSkinnedShader);
-				m_ShadowmapSkinnedShader->SetUniform("lightSpaceViewProjectionMatrix", directionalLightViewProjMatrix);
-				Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
-				Renderer::FlushTransparentSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+				m_ShadowmapSkinnedShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), directionalLightViewProjMatrix);
+				Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
 			}
 
 			// Render non-skinned models
 			{
 				m_GLCache->SetShader(m_ShadowmapShader);
-				m_ShadowmapShader->SetUniform("lightSpaceViewProjectionMatrix", directionalLightViewProjMatrix);
-				Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
-				Renderer::FlushTransparentNonSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+				m_ShadowmapShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), directionalLightViewProjMatrix);
+				Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
 			}
 
 			// Render terrain
@@ -109,6 +108,18 @@ namespace Arcane
 				terrain->Draw(m_ShadowmapShader, RenderPassType::NoMaterialRequired);
 			}
 
+			// Render impostors
+			{
+				m_GLCache->SetShader(m_ShadowmapImpostorShader);
+				m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), directionalLightViewProjMatrix);
+				m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("lightPos"), dirLightShadowmapEyePos);
+				m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("linearDepth"), 0);
+				Renderer::FlushImpostors(camera, RenderPassType::DepthOnly, m_ShadowmapImpostorShader);
+			}
+
+			// Render transparent models, skinned and non-skinned are sorted together
+			Renderer::FlushTransparentMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapShader, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+
 			// Update output
 			passOutput.directionalLightViewProjMatrix = directionalLightViewProjMatrix;
 			passOutput.directionalShadowmapBias = lightManager->GetDirectionalLightShadowCasterBias();
@@ -148,30 +159,28 @@ namespace Arcane
 			m_GLCache->SetBlend(false);
 			m_GLCache->SetFaceCull(false); // For one sided objects - TODO: This will get overwritten by the renderer anyways
 
-			// Setup model renderer
+			// Setup model renderer, models the camera sees as impostors cast impostor shadows too
 			if (renderOnlyStatic)
 			{
-				m_ActiveScene->AddModelsToRenderer(ModelFilterType::StaticModels);
+				m_ActiveScene->AddModelsToRenderer(ModelFilterType::StaticModels, camera);
 			}
 			else
 			{
-				m_ActiveScene->AddModelsToRenderer(ModelFilterType::AllModels);
+				m_ActiveScene->AddModelsToRenderer(ModelFilterType::AllModels, camera);
 			}
 
 			// Render skinned models
 			{
 				m_GLCache->SetShader(m_ShadowmapSkinnedShader);
-				m_ShadowmapSkinnedShader->SetUniform("lightSpaceViewProjectionMatrix", spotLightViewProjMatrix);
-				Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
-				Renderer::FlushTransparentSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+				m_ShadowmapSkinnedShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), spotLightViewProjMatrix);
+				Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
 			}
 
 			// Render non-skinned models
 			{
 				m_GLCache->SetShader(m_ShadowmapShader);
-				m_ShadowmapShader->SetUniform("lightSpaceViewProjectionMatrix", spotLightViewProjMatrix);
-				Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
-				Renderer::FlushTransparentNonSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+				m_ShadowmapShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), spotLightViewProjMatrix);
+				Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
 			}
 
 			// Render terrain
@@ -181,6 +190,18 @@ namespace Arcane
 				terrain->Draw(m_ShadowmapShader, RenderPassType::NoMaterialRequired);
 			}
 
+			// Render impostors
+			{
+				m_GLCache->SetShader(m_ShadowmapImpostorShader);
+				m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), spotLightViewProjMatrix);
+				m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("lightPos"), spotLightPos);
+				m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("linearDepth"), 0);
+				Renderer::FlushImpostors(camera, RenderPassType::DepthOnly, m_ShadowmapImpostorShader);
+			}
+
+			// Render transparent models, skinned and non-skinned are sorted together
+			Renderer::FlushTransparentMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapShader, m_ShadowmapSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+
 			// Update output
 			passOutput.spotLightViewProjMatrix = spotLightViewProjMatrix;
 			passOutput.spotLightShadowmapBias = lightManager->GetSpotLightShadowCasterBias();
@@ -230,34 +251,32 @@ namespace Arcane
 				m_EmptyFramebuffer.SetDepthAttachment(DepthStencilAttachmentFormat::NormalizedDepthOnly, pointLightShadowCubemap->GetCubemapID(), GL_TEXTURE_CUBE_MAP_POSITIVE_X + i);
 				m_EmptyFramebuffer.ClearDepth();
 
-				// Setup model renderer
+				// Setup model renderer, models the camera sees as impostors cast impostor shadows too
 				if (renderOnlyStatic)
 				{
-					m_ActiveScene->AddModelsToRenderer(ModelFilterType::StaticModels);
+					m_ActiveScene->AddModelsToRenderer(ModelFilterType::StaticModels, camera);
 				}
 				else
 				{
-					m_ActiveScene->AddModelsToRenderer(ModelFilterType::AllModels);
+					m_ActiveScene->AddModelsToRenderer(ModelFilterType::AllModels, camera);
 				}
 
 				// Render skinned models
 				{
 					m_GLCache->SetShader(m_ShadowmapLinearSkinnedShader);
-					m_ShadowmapLinearSkinnedShader->SetUniform("lightPos", m_CubemapCamera.GetPosition());
-					m_ShadowmapLinearSkinnedShader->SetUniform("lightFarPlane", nearFarPlane.y);
-					m_ShadowmapLinearSkinnedShader->SetUniform("lightSpaceViewProjectionMatrix", pointLightViewProjMatrix);
-					Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapLinearSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
-					Renderer::FlushTransparentSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapLinearSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+					m_ShadowmapLinearSkinnedShader->SetUniform(ARC_UNIFORM("lightPos"), m_CubemapCamera.GetPosition());
+					m_ShadowmapLinearSkinnedShader->SetUniform(ARC_UNIFORM("lightFarPlane"), nearFarPlane.y);
+					m_ShadowmapLinearSkinnedShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), pointLightViewProjMatrix);
+					Renderer::FlushOpaqueSkinnedMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapLinearSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
 				}
 
 				// Render non-skinned models
 				{
 					m_GLCache->SetShader(m_ShadowmapLinearShader);
-					m_ShadowmapLinearShader->SetUniform("lightPos", m_CubemapCamera.GetPosition());
-					m_ShadowmapLinearShader->SetUniform("lightFarPlane", nearFarPlane.y);
-					m_ShadowmapLinearShader->SetUniform("lightSpaceViewProjectionMatrix", pointLightViewProjMatrix);
-					Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapLinearShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
-					Renderer::FlushTransparentNonSkinnedMeshes(camera, RenderPassType::NoMaterialRequired, m_ShadowmapLinearShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
+					m_ShadowmapLinearShader->SetUniform(ARC_UNIFORM("lightPos"), m_CubemapCamera.GetPosition());
+					m_ShadowmapLinearShader->SetUniform(ARC_UNIFORM("lightFarPlane"), nearFarPlane.y);
+					m_ShadowmapLinearShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), pointLightViewProjMatrix);
+					Renderer::FlushOpaqueNonSkinnedMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapLinearShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
 				}
 
 				// Render terrain
@@ -266,6 +285,19 @@ namespace Arcane
 				{
 					terrain->Draw(m_ShadowmapLinearShader, RenderPassType::NoMaterialRequired);
 				}
+
+				// Render impostors
+				{
+					m_GLCache->SetShader(m_ShadowmapImpostorShader);
+					m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("lightSpaceViewProjectionMatrix"), pointLightViewProjMatrix);
+					m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("lightPos"), m_CubemapCamera.GetPosition());
+					m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("lightFarPlane"), nearFarPlane.y);
+					m_ShadowmapImpostorShader->SetUniform(ARC_UNIFORM("linearDepth"), 1);
+					Renderer::FlushImpostors(camera, RenderPassType::DepthOnly, m_ShadowmapImpostorShader);
+				}
+
+				// Render transparent models, skinned and non-skinned are sorted together
+				Renderer::FlushTransparentMeshes(camera, RenderPassType::DepthOnly, m_ShadowmapLinearShader, m_ShadowmapLinearSkinnedShader); // TODO: This should not use the camera's position for sorting we are rendering shadow maps for lights
 			}
 			// Reset state
 			m_EmptyFramebuffer.SetDepthAttachment(DepthStencilAttachmentFormat::NormalizedDepthOnly, 0, GL_TEXTURE_CUBE_MAP_POSITIVE_X);
@@ -32,7 +32,7 @@ namespace Arcane
 	private:
 		void Init();
 	private:
-		Shader *m_ShadowmapShader, *m_ShadowmapSkinnedShader, *m_ShadowmapLinearShader, *m_ShadowmapLinearSkinnedShader;
+		Shader *m_ShadowmapShader, *m_ShadowmapSkinnedShader, *m_ShadowmapLinearShader, *m_ShadowmapLinearSkinnedShader, *m_ShadowmapImpostorShader;
 		CubemapCamera m_CubemapCamera;
 		Framebuffer m_EmptyFramebuffer; // Used for attaching to when rendering (like cubemap faces)
 
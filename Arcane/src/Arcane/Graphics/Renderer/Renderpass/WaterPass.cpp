@@ -158,48 +158,48 @@ namespace Arcane
 			waterComponent.MoveTimer = static_cast<float>(std::fmod((double)waterComponent.MoveTimer, 1.0));
 
 			lightManager->BindLightingUniforms(m_WaterShader);
-			m_WaterShader->SetUniform("view", camera->GetViewMatrix());
-			m_WaterShader->SetUniform("projection", camera->GetProjectionMatrix());
-			m_WaterShader->SetUniform("viewInverse", glm::inverse(camera->GetViewMatrix()));
-			m_WaterShader->SetUniform("projectionInverse", glm::inverse(camera->GetProjectionMatrix()));
-			m_WaterShader->SetUniform("clearWater", waterComponent.ClearWater);
-			m_WaterShader->SetUniform("shouldShine", waterComponent.EnableShine);
-			m_WaterShader->SetUniform("viewPos", camera->GetPosition());
-			m_WaterShader->SetUniform("waterAlbedo", waterComponent.WaterAlbedo);
-			m_WaterShader->SetUniform("albedoPower", waterComponent.AlbedoPower);
-			m_WaterShader->SetUniform("model", model);
-			m_WaterShader->SetUniform("waveTiling", waterComponent.WaterTiling);
-			m_WaterShader->SetUniform("waveMoveFactor", waterComponent.MoveTimer);
-			m_WaterShader->SetUniform("waveStrength", waterComponent.WaveStrength);
-			m_WaterShader->SetUniform("shineDamper", waterComponent.ShineDamper);
-			m_WaterShader->SetUniform("waterNormalSmoothing", waterComponent.NormalSmoothing);
-			m_WaterShader->SetUniform("depthDampeningEffect", waterComponent.DepthDampening);
+			m_WaterShader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+			m_WaterShader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
+			m_WaterShader->SetUniform(ARC_UNIFORM("viewInverse"), glm::inverse(camera->GetViewMatrix()));
+			m_WaterShader->SetUniform(ARC_UNIFORM("projectionInverse"), glm::inverse(camera->GetProjectionMatrix()));
+			m_WaterShader->SetUniform(ARC_UNIFORM("clearWater"), waterComponent.ClearWater);
+			m_WaterShader->SetUniform(ARC_UNIFORM("shouldShine"), waterComponent.EnableShine);
+			m_WaterShader->SetUniform(ARC_UNIFORM("viewPos"), camera->GetPosition());
+			m_WaterShader->SetUniform(ARC_UNIFORM("waterAlbedo"), waterComponent.WaterAlbedo);
+			m_WaterShader->SetUniform(ARC_UNIFORM("albedoPower"), waterComponent.AlbedoPower);
+			m_WaterShader->SetUniform(ARC_UNIFORM("model"), model);
+			m_WaterShader->SetUniform(ARC_UNIFORM("waveTiling"), waterComponent.WaterTiling);
+			m_WaterShader->SetUniform(ARC_UNIFORM("waveMoveFactor"), waterComponent.MoveTimer);
+			m_WaterShader->SetUniform(ARC_UNIFORM("waveStrength"), waterComponent.WaveStrength);
+			m_WaterShader->SetUniform(ARC_UNIFORM("shineDamper"), waterComponent.ShineDamper);
+			m_WaterShader->SetUniform(ARC_UNIFORM("waterNormalSmoothing"), waterComponent.NormalSmoothing);
+			m_WaterShader->SetUniform(ARC_UNIFORM("depthDampeningEffect"), waterComponent.DepthDampening);
 
 			// Only setup reflections/refractions if it is the closest water component received by the WaterManager, and it has those options enabled
 			bool reflection = canReflectRefract && waterComponent.ReflectionEnabled;
 			bool refraction = canReflectRefract && waterComponent.RefractionEnabled;
-			m_WaterShader->SetUniform("reflectionEnabled", reflection);
+			m_WaterShader->SetUniform(ARC_UNIFORM("reflectionEnabled"), reflection);
 			if (reflection)
 			{
-				m_WaterShader->SetUniform("reflectionTexture", 0);
+				m_WaterShader->SetUniform(ARC_UNIFORM("reflectionTexture"), 0);
 				reflectionFramebuffer->GetColourTexture()->Bind(0);
 			}
-			m_WaterShader->SetUniform("refractionEnabled", refraction);
+			m_WaterShader->SetUniform(ARC_UNIFORM("refractionEnabled"), refraction);
 			if (refraction)
 			{
-				m_WaterShader->SetUniform("refractionTexture", 1);
+				m_WaterShader->SetUniform(ARC_UNIFORM("refractionTexture"), 1);
 				refractionFramebuffer->GetColourTexture()->Bind(1);
-				m_WaterShader->SetUniform("refractionDepthTexture", 4);
+				m_WaterShader->SetUniform(ARC_UNIFORM("refractionDepthTexture"), 4);
 				refractionFramebuffer->GetDepthStencilTexture()->Bind(4);
 			}
 
-			m_WaterShader->SetUniform("dudvWaveTexture", 2);
+			m_WaterShader->SetUniform(ARC_UNIFORM("dudvWaveTexture"), 2);
 			if (waterComponent.WaterDistortionTexture)
 				waterComponent.WaterDistortionTexture->Bind(2);
 			else
 				AssetManager::GetInstance().GetDefaultWaterDistortionTexture()->Bind(2);
 
-			m_WaterShader->SetUniform("normalMap", 3);
+			m_WaterShader->SetUniform(ARC_UNIFORM("normalMap"), 3);
 			if (waterComponent.WaterNormalMap)
 				waterComponent.WaterNormalMap->Bind(3);
 			else
@@ -0,0 +1,292 @@
+#include "arcpch.h"
+#include "TextRenderer.h"
+
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Platform/OpenGL/VertexArray.h>
+#include <Arcane/Platform/OpenGL/Buffer.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+#include <Arcane/Util/VirtualFileSystem.h>
+#include <Arcane/Util/StringId.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Graphics/Camera/ICamera.h>
+
+// ImGui already ships stb_truetype, compiled static here so it doesn't clash with ImGui's copy
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <Arcane/Vendor/Imgui/imstb_truetype.h>
+
+namespace Arcane
+{
+	static constexpr int s_GlyphCount = TEXT_LAST_CHARACTER - TEXT_FIRST_CHARACTER + 1;
+	static constexpr unsigned int s_AtlasWidth = 512;
+
+	GLCache *TextRenderer::s_GLCache = nullptr;
+	Shader *TextRenderer::s_TextShader = nullptr;
+	VertexArray *TextRenderer::s_EmptyVertexArray = nullptr;
+	Buffer *TextRenderer::s_GlyphInstanceBuffer = nullptr;
+	std::vector<GlyphInstance> TextRenderer::s_GlyphInstances;
+	Texture *TextRenderer::s_AtlasTexture = nullptr;
+	GlyphInfo TextRenderer::s_Glyphs[s_GlyphCount];
+	float TextRenderer::s_Kerning[s_GlyphCount][s_GlyphCount];
+	float TextRenderer::s_Ascent = 0.0f;
+	float TextRenderer::s_LineAdvance = 0.0f;
+	std::unordered_map<uint64_t, TextLayout> TextRenderer::s_LayoutCache;
+
+	static bool IsBakedCharacter(char c)
+	{
+		return static_cast<unsigned char>(c) >= TEXT_FIRST_CHARACTER && static_cast<unsigned char>(c) <= TEXT_LAST_CHARACTER;
+	}
+
+	void TextRenderer::Init()
+	{
+		s_GLCache = GLCache::GetInstance();
+
+		if (!BakeGlyphAtlas(TEXT_FONT_PATH))
+			return;
+
+		s_TextShader = ShaderLoader::LoadShader("SdfText.glsl");
+		s_EmptyVertexArray = new VertexArray();
+		s_GlyphInstanceBuffer = new Buffer(static_cast<uint32_t>(TEXT_MAX_GLYPHS_PER_FRAME * sizeof(GlyphInstance)));
+		s_GlyphInstances.reserve(TEXT_MAX_GLYPHS_PER_FRAME);
+	}
+
+	void TextRenderer::Shutdown()
+	{
+		delete s_AtlasTexture;
+		delete s_GlyphInstanceBuffer;
+		delete s_EmptyVertexArray;
+		s_AtlasTexture = nullptr;
+		s_GlyphInstanceBuffer = nullptr;
+		s_EmptyVertexArray = nullptr;
+		s_LayoutCache.clear();
+	}
+
+	bool TextRenderer::BakeGlyphAtlas(const std::string &fontPath)
+	{
+		VirtualFile fontFile = VirtualFileSystem::ReadFile(fontPath);
+		stbtt_fontinfo font;
+		if (!fontFile.IsValid() || !stbtt_InitFont(&font, fontFile.GetData(), stbtt_GetFontOffsetForIndex(fontFile.GetData(), 0)))
+		{
+			ARC_LOG_WARN("Failed to load font for the text renderer, text won't be drawn - {0}", fontPath);
+			return false;
+		}
+
+		// Everything is stored in line height units so it can be scaled to any size when queued
+		float scale = stbtt_ScaleForPixelHeight(&font, static_cast<float>(TEXT_SDF_GLYPH_SIZE));
+		float toLineUnits = 1.0f / TEXT_SDF_GLYPH_SIZE;
+		int ascent, descent, lineGap;
+		stbtt_GetFontVMetrics(&font, &ascent, &descent, &lineGap);
+		s_Ascent = ascent * scale * toLineUnits;
+		s_LineAdvance = (ascent - descent + lineGap) * scale * toLineUnits;
+
+		// Rasterize the distance fields and shelf pack them
+		struct GlyphBitmap { unsigned char *Data; int Width, Height, X, Y; };
+		GlyphBitmap bitmaps[s_GlyphCount];
+		int shelfX = 0, shelfY = 0, shelfHeight = 0;
+		const float pixelDistanceScale = 128.0f / TEXT_SDF_PADDING; // The full 0-255 range covers the padding on both sides of the edge
+		for (int i = 0; i < s_GlyphCount; i++)
+		{
+			int codepoint = TEXT_FIRST_CHARACTER + i;
+			GlyphBitmap &bitmap = bitmaps[i];
+			int xOffset = 0, yOffset = 0;
+			bitmap.Data = stbtt_GetCodepointSDF(&font, scale, codepoint, TEXT_SDF_PADDING, 128, pixelDistanceScale, &bitmap.Width, &bitmap.Height, &xOffset, &yOffset);
+			if (!bitmap.Data)
+			{
+				bitmap.Width = bitmap.Height = 0; // Whitespace
+			}
+
+			if (shelfX + bitmap.Width + 1 > static_cast<int>(s_AtlasWidth))
+			{
+				shelfX = 0;
+				shelfY += shelfHeight + 1;
+				shelfHeight = 0;
+			}
+			bitmap.X = shelfX;
+			bitmap.Y = shelfY;
+			shelfX += bitmap.Width + 1; // 1 texel gutter so bilinear filtering doesn't bleed between glyphs
+			shelfHeight = glm::max(shelfHeight, bitmap.Height);
+
+			int advance, leftSideBearing;
+			stbtt_GetCodepointHMetrics(&font, codepoint, &advance, &leftSideBearing);
+			GlyphInfo &glyph = s_Glyphs[i];
+			glyph.Advance = advance * scale * toLineUnits;
+			glyph.Offset = glm::vec2(xOffset, -(yOffset + bitmap.Height)) * toLineUnits; // stb's offsets are y down from the top left of the bitmap
+			glyph.Size = glm::vec2(bitmap.Width, bitmap.Height) * toLineUnits;
+
+			for (int j = 0; j < s_GlyphCount; j++)
+			{
+				s_Kerning[i][j] = stbtt_GetCodepointKernAdvance(&font, codepoint, TEXT_FIRST_CHARACTER + j) * scale * toLineUnits;
+			}
+		}
+
+		unsigned int atlasHeight = 1;
+		while (atlasHeight < static_cast<unsigned int>(shelfY + shelfHeight))
+			atlasHeight <<= 1;
+
+		std::vector<unsigned char> atlasData(static_cast<size_t>(s_AtlasWidth) * atlasHeight, 0);
+		for (int i = 0; i < s_GlyphCount; i++)
+		{
+			GlyphBitmap &bitmap = bitmaps[i];
+			for (int row = 0; row < bitmap.Height; row++)
+			{
+				memcpy(&atlasData[static_cast<size_t>(bitmap.Y + row) * s_AtlasWidth + bitmap.X], bitmap.Data + static_cast<size_t>(row) * bitmap.Width, bitmap.Width);
+			}
+			s_Glyphs[i].UVRect = glm::vec4(static_cast<float>(bitmap.X) / s_AtlasWidth, static_cast<float>(bitmap.Y) / atlasHeight, static_cast<float>(bitmap.X + bitmap.Width) / s_AtlasWidth, static_cast<float>(bitmap.Y + bitmap.Height) / atlasHeight);
+
+			if (bitmap.Data)
+				stbtt_FreeSDF(bitmap.Data, nullptr);
+		}
+
+		TextureSettings atlasSettings;
+		atlasSettings.TextureFormat = GL_R8;
+		atlasSettings.TextureWrapSMode = GL_CLAMP_TO_EDGE;
+		atlasSettings.TextureWrapTMode = GL_CLAMP_TO_EDGE;
+		atlasSettings.TextureMinificationFilterMode = GL_LINEAR;
+		atlasSettings.TextureMagnificationFilterMode = GL_LINEAR;
+		atlasSettings.TextureAnisotropyLevel = 1.0f;
+		atlasSettings.HasMips = false;
+		s_AtlasTexture = new Texture(atlasSettings);
+		s_AtlasTexture->Generate2DTexture(s_AtlasWidth, atlasHeight, GL_RED, GL_UNSIGNED_BYTE, atlasData.data());
+
+		ARC_LOG_INFO("Baked {0} glyph SDF atlas ({1}x{2}) - {3}", s_GlyphCount, s_AtlasWidth, atlasHeight, fontPath);
+		return true;
+	}
+
+	void TextRenderer::BeginBatch()
+	{
+		s_GlyphInstances.clear();
+	}
+
+	void TextRenderer::FlushBatch(ICamera *camera, unsigned int viewportWidth, unsigned int viewportHeight)
+	{
+		if (s_GlyphInstances.empty())
+			return;
+
+		s_GlyphInstanceBuffer->SetData(s_GlyphInstances.data(), static_cast<uint32_t>(s_GlyphInstances.size() * sizeof(GlyphInstance)));
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, s_GlyphInstanceBuffer->GetBufferId());
+
+		// Text is an overlay, it is blended over everything and never occluded
+		s_GLCache->SetDepthTest(false);
+		s_GLCache->SetStencilTest(false);
+		s_GLCache->SetFaceCull(false);
+		s_GLCache->SetBlend(true);
+		s_GLCache->SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+		glm::mat4 view = camera->GetViewMatrix();
+		s_GLCache->SetShader(s_TextShader);
+		s_TextShader->SetUniform(ARC_UNIFORM("viewProjection"), camera->GetProjectionMatrix() * view);
+		s_TextShader->SetUniform(ARC_UNIFORM("cameraRight"), glm::vec3(view[0][0], view[1][0], view[2][0]));
+		s_TextShader->SetUniform(ARC_UNIFORM("cameraUp"), glm::vec3(view[0][1], view[1][1], view[2][1]));
+		s_TextShader->SetUniform(ARC_UNIFORM("viewportSize"), glm::vec2(viewportWidth, viewportHeight));
+		s_TextShader->SetUniform(ARC_UNIFORM("glyphAtlas"), 0);
+		s_AtlasTexture->Bind(0);
+
+		s_EmptyVertexArray->Bind();
+		glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(s_GlyphInstances.size()));
+		s_EmptyVertexArray->Unbind();
+
+		// Reset state
+		s_GLCache->SetFaceCull(true);
+		s_GLCache->SetBlend(false);
+		s_GLCache->SetDepthTest(true);
+	}
+
+	void TextRenderer::QueueText(const std::string &text, const glm::vec3 &position, float height, const glm::vec4 &colour, bool centred)
+	{
+		if (!IsInitialized() || text.empty())
+			return;
+
+		// Centred labels sit on top of the position, otherwise the position is the top left of the text
+		const TextLayout &layout = GetLayout(text);
+		glm::vec2 offset = centred ? glm::vec2(-layout.Size.x * 0.5f, layout.Size.y) : glm::vec2(0.0f);
+		QueueLayout(layout, position, offset, height, 0.0f, colour);
+	}
+
+	void TextRenderer::QueueScreenText(const std::string &text, const glm::vec2 &position, float pixelHeight, const glm::vec4 &colour)
+	{
+		if (!IsInitialized() || text.empty())
+			return;
+
+		QueueLayout(GetLayout(text), glm::vec3(position, 0.0f), glm::vec2(0.0f), pixelHeight, 1.0f, colour);
+	}
+
+	glm::vec2 TextRenderer::GetTextSize(const std::string &text, float height)
+	{
+		if (!IsInitialized() || text.empty())
+			return glm::vec2(0.0f);
+
+		return GetLayout(text).Size * height;
+	}
+
+	void TextRenderer::QueueLayout(const TextLayout &layout, const glm::vec3 &anchor, const glm::vec2 &offset, float height, float space, const glm::vec4 &colour)
+	{
+		if (s_GlyphInstances.size() + layout.Quads.size() > TEXT_MAX_GLYPHS_PER_FRAME)
+		{
+			ARC_ASSERT(false, "TextRenderer hit the glyph limit, won't render additional text. Up the limit if you need it!");
+			return;
+		}
+
+		glm::vec4 anchorAndSpace(anchor, space);
+		for (const GlyphQuad &quad : layout.Quads)
+		{
+			GlyphInstance &instance = s_GlyphInstances.emplace_back();
+			instance.AnchorAndSpace = anchorAndSpace;
+			instance.Rect = glm::vec4((quad.Offset + offset) * height, quad.Size * height);
+			instance.UVRect = quad.UVRect;
+			instance.Colour = colour;
+		}
+	}
+
+	const TextLayout& TextRenderer::GetLayout(const std::string &text)
+	{
+		uint64_t key = HashString64(text.c_str(), text.size());
+		auto iter = s_LayoutCache.find(key);
+		if (iter != s_LayoutCache.end() && iter->second.Text == text)
+			return iter->second;
+
+		// Strings that change every frame (timings etc.) would grow the cache forever, so just start over once it is full
+		if (iter == s_LayoutCache.end() && s_LayoutCache.size() >= TEXT_LAYOUT_CACHE_SIZE)
+			s_LayoutCache.clear();
+
+		TextLayout &layout = s_LayoutCache[key];
+		layout.Text = text;
+		layout.Quads.clear();
+		layout.Quads.reserve(text.size());
+
+		float penX = 0.0f, baseline = -s_Ascent, width = 0.0f;
+		int lineCount = 1, previousGlyph = -1;
+		for (char c : text)
+		{
+			if (c == '\n')
+			{
+				penX = 0.0f;
+				baseline -= s_LineAdvance;
+				lineCount++;
+				previousGlyph = -1;
+				continue;
+			}
+			if (!IsBakedCharacter(c))
+				continue;
+
+			int glyphIndex = static_cast<unsigned char>(c) - TEXT_FIRST_CHARACTER;
+			const GlyphInfo &glyph = s_Glyphs[glyphIndex];
+			if (previousGlyph != -1)
+				penX += s_Kerning[previousGlyph][glyphIndex];
+
+			if (glyph.Size.x > 0.0f)
+			{
+				GlyphQuad &quad = layout.Quads.emplace_back();
+				quad.Offset = glm::vec2(penX, baseline) + glyph.Offset;
+				quad.Size = glyph.Size;
+				quad.UVRect = glyph.UVRect;
+			}
+
+			penX += glyph.Advance;
+			width = glm::max(width, penX);
+			previousGlyph = glyphIndex;
+		}
+		layout.Size = glm::vec2(width, lineCount * s_LineAdvance);
+
+		return layout;
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef TEXTRENDERER_H
+#define TEXTRENDERER_H
+
+#ifndef TEXTURE_H
+#include <Arcane/Graphics/Texture/Texture.h>
+#endif
+
+/*
+	Batched text rendering for debug labels and overlays, without going through ImGui's draw lists. Glyphs are rasterized once at startup as signed distance fields
+	into a single atlas, so text stays sharp at any size or distance. Every glyph queued during a frame (world space labels and screen space text alike) is drawn
+	with one instanced draw, the vertex shader pulls the glyph quads out of a storage buffer.
+	Layouts are cached per string, so labels that don't change between frames don't get laid out again
+*/
+
+namespace Arcane
+{
+	class ICamera;
+	class GLCache;
+	class Shader;
+	class VertexArray;
+	class Buffer;
+
+	struct GlyphInfo
+	{
+		glm::vec4 UVRect = glm::vec4(0.0f); // xy = top left, zw = bottom right
+		glm::vec2 Offset = glm::vec2(0.0f); // Bottom left of the quad relative to the pen position on the baseline
+		glm::vec2 Size = glm::vec2(0.0f);
+		float Advance = 0.0f;
+	};
+
+	struct GlyphQuad
+	{
+		glm::vec2 Offset; // Bottom left of the quad relative to the top left of the text
+		glm::vec2 Size;
+		glm::vec4 UVRect;
+	};
+
+	// Laid out in line height units with y up, the first line's top sits at 0 so every quad is below it
+	struct TextLayout
+	{
+		std::string Text; // Kept to catch hash collisions
+		std::vector<GlyphQuad> Quads;
+		glm::vec2 Size = glm::vec2(0.0f);
+	};
+
+	// Matches the GlyphInstance struct in SdfText.glsl
+	struct GlyphInstance
+	{
+		glm::vec4 AnchorAndSpace; // xyz = world position (or screen pixel position), w = 1 for screen space
+		glm::vec4 Rect; // xy = quad offset from the anchor, zw = quad size. World units for world space text, pixels for screen space text
+		glm::vec4 UVRect;
+		glm::vec4 Colour;
+	};
+
+	class TextRenderer
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		static void BeginBatch();
+		static void FlushBatch(ICamera *camera, unsigned int viewportWidth, unsigned int viewportHeight);
+
+		// Camera facing label, height is the line height in world units
+		static void QueueText(const std::string &text, const glm::vec3 &position, float height, const glm::vec4 &colour = glm::vec4(1.0f), bool centred = true);
+		// Screen space text, position is the top left in pixels from the top left of the viewport
+		static void QueueScreenText(const std::string &text, const glm::vec2 &position, float pixelHeight, const glm::vec4 &colour = glm::vec4(1.0f));
+
+		static glm::vec2 GetTextSize(const std::string &text, float height); // Size the text would take up when queued with this height
+
+		inline static bool IsInitialized() { return s_AtlasTexture != nullptr; }
+	private:
+		static bool BakeGlyphAtlas(const std::string &fontPath);
+		static const TextLayout& GetLayout(const std::string &text);
+		static void QueueLayout(const TextLayout &layout, const glm::vec3 &anchor, const glm::vec2 &offset, float height, float space, const glm::vec4 &colour);
+	private:
+		static GLCache *s_GLCache;
+
+		static Shader *s_TextShader;
+		static VertexArray *s_EmptyVertexArray; // Glyph quads are pulled from the instance buffer, nothing is sourced from vertex attributes
+		static Buffer *s_GlyphInstanceBuffer;
+		static std::vector<GlyphInstance> s_GlyphInstances;
+
+		static Texture *s_AtlasTexture;
+		static GlyphInfo s_Glyphs[TEXT_LAST_CHARACTER - TEXT_FIRST_CHARACTER + 1];
+		static float s_Kerning[TEXT_LAST_CHARACTER - TEXT_FIRST_CHARACTER + 1][TEXT_LAST_CHARACTER - TEXT_FIRST_CHARACTER + 1];
+		static float s_Ascent, s_LineAdvance; // Line height units
+
+		static std::unordered_map<uint64_t, TextLayout> s_LayoutCache;
+	};
+}
+
+#endif
@@ -12,6 +12,11 @@ namespace Arcane
 		Compile(shaderSources);
 	}
 
+	Shader::Shader(const std::string &path, std::string &source) : m_ShaderFilePath(path) {
+		auto shaderSources = PreProcessShaderBinary(source);
+		Compile(shaderSources);
+	}
+
 	Shader::~Shader() {
 		glDeleteProgram(m_ShaderID);
 	}
@@ -24,88 +29,107 @@ namespace Arcane
 		glUseProgram(0);
 	}
 
-	void Shader::SetUniform(const char* name, float value) {
+	void Shader::SetUniform(const UniformName &name, float value) {
 		glUniform1f(GetUniformLocation(name), value);
 	}
 
-	void Shader::SetUniform(const char* name, int value) {
+	void Shader::SetUniform(const UniformName &name, int value) {
 		glUniform1i(GetUniformLocation(name), value);
 	}
 
-	void Shader::SetUniform(const char* name, const glm::vec2& vector) {
+	void Shader::SetUniform(const UniformName &name, const glm::vec2& vector) {
 		glUniform2f(GetUniformLocation(name), vector.x, vector.y);
 	}
 
-	void Shader::SetUniform(const char *name, const glm::ivec2& vector) {
+	void Shader::SetUniform(const UniformName &name, const glm::ivec2& vector) {
 		glUniform2i(GetUniformLocation(name), vector.x, vector.y);
 	}
 
-	void Shader::SetUniform(const char* name, const glm::vec3& vector) {
+	void Shader::SetUniform(const UniformName &name, const glm::vec3& vector) {
 		glUniform3f(GetUniformLocation(name), vector.x, vector.y, vector.z);
 	}
 
-	void Shader::SetUniform(const char *name, const glm::ivec3& vector) {
+	void Shader::SetUniform(const UniformName &name, const glm::ivec3& vector) {
 		glUniform3i(GetUniformLocation(name), vector.x, vector.y, vector.z);
 	}
 
-	void Shader::SetUniform(const char* name, const glm::vec4& vector) {
+	void Shader::SetUniform(const UniformName &name, const glm::vec4& vector) {
 		glUniform4f(GetUniformLocation(name), vector.x, vector.y, vector.z, vector.w);
 	}
 
-	void Shader::SetUniform(const char* name, const glm::ivec4& vector) {
+	void Shader::SetUniform(const UniformName &name, const glm::ivec4& vector) {
 		glUniform4i(GetUniformLocation(name), vector.x, vector.y, vector.z, vector.w);
 	}
 
-	void Shader::SetUniform(const char* name, const glm::mat3& matrix) {
-		glUniformMatrix3fv(glGetUniformLocation(m_ShaderID, name), 1, GL_FALSE, glm::value_ptr(matrix));
+	void Shader::SetUniform(const UniformName &name, const glm::mat3& matrix) {
+		glUniformMatrix3fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
-	void Shader::SetUniform(const char* name, const glm::mat4& matrix) {
-		glUniformMatrix4fv(glGetUniformLocation(m_ShaderID, name), 1, GL_FALSE, glm::value_ptr(matrix));
+	void Shader::SetUniform(const UniformName &name, const glm::mat4& matrix) {
+		glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const float *value) {
-		glUniform1fv(glGetUniformLocation(m_ShaderID, name), arraySize, value);
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const float *value) {
+		glUniform1fv(GetUniformLocation(name), arraySize, value);
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const int *value) {
-		glUniform1iv(glGetUniformLocation(m_ShaderID, name), arraySize, value);
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const int *value) {
+		glUniform1iv(GetUniformLocation(name), arraySize, value);
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::vec2 *value) {
-		glUniform2fv(glGetUniformLocation(m_ShaderID, name), arraySize, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::vec2 *value) {
+		glUniform2fv(GetUniformLocation(name), arraySize, glm::value_ptr(*value));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::ivec2 *value) {
-		glUniform2iv(glGetUniformLocation(m_ShaderID, name), arraySize, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::ivec2 *value) {
+		glUniform2iv(GetUniformLocation(name), arraySize, glm::value_ptr(*value));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::vec3 *value) {
-		glUniform3fv(glGetUniformLocation(m_ShaderID, name), arraySize, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::vec3 *value) {
+		glUniform3fv(GetUniformLocation(name), arraySize, glm::value_ptr(*value));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::ivec3 *value) {
-		glUniform3iv(glGetUniformLocation(m_ShaderID, name), arraySize, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::ivec3 *value) {
+		glUniform3iv(GetUniformLocation(name), arraySize, glm::value_ptr(*value));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::vec4 *value) {
-		glUniform4fv(glGetUniformLocation(m_ShaderID, name), arraySize, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::vec4 *value) {
+		glUniform4fv(GetUniformLocation(name), arraySize, glm::value_ptr(*value));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::ivec4 *value) {
-		glUniform4iv(glGetUniformLocation(m_ShaderID, name), arraySize, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::ivec4 *value) {
+		glUniform4iv(GetUniformLocation(name), arraySize, glm::value_ptr(*value));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::mat3 *value) {
-		glUniformMatrix3fv(glGetUniformLocation(m_ShaderID, name), arraySize, GL_FALSE, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::mat3 *value) {
+		glUniformMatrix3fv(GetUniformLocation(name), arraySize, GL_FALSE, glm::value_ptr(*value));
 	}
 
-	void Shader::SetUniformArray(const char *name, int arraySize, const glm::mat4 *value) {
-		glUniformMatrix4fv(glGetUniformLocation(m_ShaderID, name), arraySize, GL_FALSE, glm::value_ptr(*value));
+	void Shader::SetUniformArray(const UniformName &name, int arraySize, const glm::mat4 *value) {
+		glUniformMatrix4fv(GetUniformLocation(name), arraySize, GL_FALSE, glm::value_ptr(*value));
 	}
 
-	int Shader::GetUniformLocation(const char* name) {
-		return glGetUniformLocation(m_ShaderID, name);
+	int Shader::GetUniformLocation(const UniformName &name) {
+		auto iter = m_UniformLocationCache.find(name.Id);
+		if (iter != m_UniformLocationCache.end())
+		{
+#if !ARC_FINAL
+			ARC_ASSERT(iter->second.Name == name.Name, "Uniform name hash collision detected");
+#endif
+			return iter->second.Location;
+		}
+
+		// Only interned on a cache miss so the registry lock isn't hit every call
+		size_t nameLength = strlen(name.Name);
+		name.Id.Intern(name.Name, nameLength);
+
+		CachedUniform uniform;
+		uniform.Location = glGetUniformLocation(m_ShaderID, name.Name);
+#if !ARC_FINAL
+		uniform.Name.assign(name.Name, nameLength);
+#endif
+		m_UniformLocationCache.emplace(name.Id, uniform);
+		return uniform.Location;
 	}
 
 	GLenum Shader::ShaderTypeFromString(const std::string &type) {
@@ -2,44 +2,63 @@
 #ifndef SHADER_H
 #define SHADER_H
 
+#ifndef STRINGID_H
+#include <Arcane/Util/StringId.h>
+#endif
+
 namespace Arcane
 {
+	/*
+		Uniform name along with its hash. Literal names should go through ARC_UNIFORM so the hash is computed at compile time, a plain const char* still works but
+		gets hashed on every call. The name is only read when the location isn't cached yet
+	*/
+	struct UniformName
+	{
+		constexpr UniformName(StringId id, const char *name) : Id(id), Name(name) {}
+		UniformName(const char *name) : Id(StringId::FromLiteral(name)), Name(name) {}
+
+		StringId Id;
+		const char *Name;
+	};
+
 	class Shader
 	{
 		friend class ShaderLoader;
 	private:
 		Shader(const std::string &path);
+		Shader(const std::string &path, std::string &source); // Compiles source that was already read from path
 	public:
 		~Shader();
 
 		void Enable() const;
 		void Disable() const;
 
-		void SetUniform(const char *name, float value);
-		void SetUniform(const char *name, int value);
-		void SetUniform(const char *name, const glm::vec2& vector);
-		void SetUniform(const char *name, const glm::ivec2& vector);
-		void SetUniform(const char *name, const glm::vec3& vector);
-		void SetUniform(const char *name, const glm::ivec3& vector);
-		void SetUniform(const char *name, const glm::vec4& vector);
-		void SetUniform(const char *name, const glm::ivec4& vector);
-		void SetUniform(const char *name, const glm::mat3& matrix);
-		void SetUniform(const char *name, const glm::mat4& matrix);
-
-		void SetUniformArray(const char *name, int arraySize, const float *value);
-		void SetUniformArray(const char *name, int arraySize, const int *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::vec2 *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::ivec2 *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::vec3 *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::ivec3 *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::vec4 *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::ivec4 *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::mat3 *value);
-		void SetUniformArray(const char *name, int arraySize, const glm::mat4 *value);
+		void SetUniform(const UniformName &name, float value);
+		void SetUniform(const UniformName &name, int value);
+		void SetUniform(const UniformName &name, const glm::vec2& vector);
+		void SetUniform(const UniformName &name, const glm::ivec2& vector);
+		void SetUniform(const UniformName &name, const glm::vec3& vector);
+		void SetUniform(const UniformName &name, const glm::ivec3& vector);
+		void SetUniform(const UniformName &name, const glm::vec4& vector);
+		void SetUniform(const UniformName &name, const glm::ivec4& vector);
+		void SetUniform(const UniformName &name, const glm::mat3& matrix);
+		void SetUniform(const UniformName &name, const glm::mat4& matrix);
+
+		void SetUniformArray(const UniformName &name, int arraySize, const float *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const int *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::vec2 *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::ivec2 *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::vec3 *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::ivec3 *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::vec4 *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::ivec4 *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::mat3 *value);
+		void SetUniformArray(const UniformName &name, int arraySize, const glm::mat4 *value);
 
+		inline bool HasUniform(const UniformName &name) { return GetUniformLocation(name) != -1; } // False if the shader doesn't declare it or the compiler stripped it as unused
 		inline unsigned int GetShaderID() { return m_ShaderID; }
 	private:
-		int GetUniformLocation(const char *name);
+		int GetUniformLocation(const UniformName &name);
 
 		static GLenum ShaderTypeFromString(const std::string &type);
 		std::unordered_map<GLenum, std::string> PreProcessShaderBinary(std::string &source);
@@ -47,6 +66,18 @@ namespace Arcane
 	private:
 		unsigned int m_ShaderID;
 		std::string m_ShaderFilePath;
+
+		struct CachedUniform
+		{
+			int Location;
+#if !ARC_FINAL
+			std::string Name; // Cache hits never intern their name, so this is what catches two uniform names hashing to the same id
+#endif
+		};
+		std::unordered_map<StringId, CachedUniform> m_UniformLocationCache; // Avoids querying the driver with a string lookup every time a uniform is set
 	};
 }
+
+// Uniform name with a compile-time hash, ie: shader->SetUniform(ARC_UNIFORM("view"), view)
+#define ARC_UNIFORM(str) (::Arcane::UniformName(ARC_SID(str), str))
 #endif
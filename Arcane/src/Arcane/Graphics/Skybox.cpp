@@ -34,13 +34,13 @@ namespace Arcane
 
 		// Pass the texture to the shader
 		m_SkyboxCubemap->Bind(0);
-		m_SkyboxShader->SetUniform("skyboxCubemap", 0);
+		m_SkyboxShader->SetUniform(ARC_UNIFORM("skyboxCubemap"), 0);
 
 		// Setup uniforms
-		m_SkyboxShader->SetUniform("view", camera->GetViewMatrix());
-		m_SkyboxShader->SetUniform("projection", camera->GetProjectionMatrix());
-		m_SkyboxShader->SetUniform("tintColour", m_TintColour);
-		m_SkyboxShader->SetUniform("lightIntensity", m_LightIntensity);
+		m_SkyboxShader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+		m_SkyboxShader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
+		m_SkyboxShader->SetUniform(ARC_UNIFORM("tintColour"), m_TintColour);
+		m_SkyboxShader->SetUniform(ARC_UNIFORM("lightIntensity"), m_LightIntensity);
 
 		// Since the vertex shader is gonna make the depth value 1.0, and the default value in the depth buffer is 1.0 so this is needed to draw the sky  box
 		m_GLCache->SetDepthTest(true);
@@ -1,11 +1,16 @@
 #include "arcpch.h"
 #include "Cubemap.h"
 
+#include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Graphics/Texture/MipChainGenerator.h>
+#include <Arcane/Graphics/Texture/SamplerCache.h>
+#include <Arcane/Graphics/Texture/Texture.h>
+
 namespace Arcane
 {
-	Cubemap::Cubemap() : m_CubemapID(0), m_FaceWidth(0), m_FaceHeight(0), m_FacesGenerated(0), m_CubemapSettings() {}
+	Cubemap::Cubemap() : m_CubemapID(0), m_SamplerId(0), m_FaceWidth(0), m_FaceHeight(0), m_FacesGenerated(0), m_CubemapSettings() {}
 
-	Cubemap::Cubemap(CubemapSettings &settings) : m_CubemapID(0), m_FaceWidth(0), m_FaceHeight(0), m_FacesGenerated(0), m_CubemapSettings(settings) {}
+	Cubemap::Cubemap(CubemapSettings &settings) : m_CubemapID(0), m_SamplerId(0), m_FaceWidth(0), m_FaceHeight(0), m_FacesGenerated(0), m_CubemapSettings(settings) {}
 
 	Cubemap::~Cubemap() {
 		glDeleteTextures(1, &m_CubemapID);
@@ -13,33 +18,32 @@ namespace Arcane
 
 	void Cubemap::ApplyCubemapSettings() {
 		// Texture wrapping
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, m_CubemapSettings.TextureWrapSMode);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, m_CubemapSettings.TextureWrapTMode);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, m_CubemapSettings.TextureWrapRMode);
+		glTextureParameteri(m_CubemapID, GL_TEXTURE_WRAP_S, m_CubemapSettings.TextureWrapSMode);
+		glTextureParameteri(m_CubemapID, GL_TEXTURE_WRAP_T, m_CubemapSettings.TextureWrapTMode);
+		glTextureParameteri(m_CubemapID, GL_TEXTURE_WRAP_R, m_CubemapSettings.TextureWrapRMode);
 
 		// Texture filtering
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, m_CubemapSettings.TextureMagnificationFilterMode);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, m_CubemapSettings.TextureMinificationFilterMode);
+		glTextureParameteri(m_CubemapID, GL_TEXTURE_MAG_FILTER, m_CubemapSettings.TextureMagnificationFilterMode);
+		glTextureParameteri(m_CubemapID, GL_TEXTURE_MIN_FILTER, m_CubemapSettings.TextureMinificationFilterMode);
 
 		// Mipmapping
 		if (m_CubemapSettings.HasMips) {
-			glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
-			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_LOD_BIAS, m_CubemapSettings.MipBias);
+			glGenerateTextureMipmap(m_CubemapID);
+			glTextureParameteri(m_CubemapID, GL_TEXTURE_LOD_BIAS, m_CubemapSettings.MipBias);
 		}
 
-		// Anisotropic filtering (TODO: Move the anistropyAmount calculation to Defs.h to avoid querying the OpenGL driver everytime)
-		float maxAnisotropy;
-		glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
-		float anistropyAmount = glm::min<float>(maxAnisotropy, m_CubemapSettings.TextureAnisotropyLevel);
-		glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, anistropyAmount);
+		// Anisotropic filtering (Check with renderer to see the max amount allowed
+		float anistropyAmount = glm::min<float>(m_CubemapSettings.TextureAnisotropyLevel, Renderer::GetRendererData().MaxAnisotropy);
+		glTextureParameterf(m_CubemapID, GL_TEXTURE_MAX_ANISOTROPY_EXT, anistropyAmount);
+
+		// Sampling goes through the shared sampler, the parameters above are only the fallback when no sampler is bound
+		m_SamplerId = SamplerCache::GetSampler(m_CubemapSettings);
 	}
 
 	void Cubemap::GenerateCubemapFace(GLenum face, unsigned int faceWidth, unsigned int faceHeight, GLenum dataFormat, const unsigned char *data)
 	{
 		// Generate cubemap if this is the first face being generated
 		if (m_CubemapID == 0) {
-			glGenTextures(1, &m_CubemapID);
-
 			m_FaceWidth = faceWidth;
 			m_FaceHeight = faceHeight;
 
@@ -54,26 +58,33 @@ namespace Arcane
 				case GL_RGBA: m_CubemapSettings.TextureFormat = GL_SRGB_ALPHA; break;
 				}
 			}
-		}
+			m_CubemapSettings.TextureFormat = Texture::GetSizedFormat(m_CubemapSettings.TextureFormat);
 
-		Bind();
+			// Storage for all six faces is allocated up front, so every face has to share the first one's size
+			int levelCount = m_CubemapSettings.HasMips ? MipChainGenerator::GetMipLevelCount(m_FaceWidth, m_FaceHeight) : 1;
+			glCreateTextures(GL_TEXTURE_CUBE_MAP, 1, &m_CubemapID);
+			glTextureStorage2D(m_CubemapID, levelCount, m_CubemapSettings.TextureFormat, m_FaceWidth, m_FaceHeight);
+		}
+		ARC_ASSERT(faceWidth == m_FaceWidth && faceHeight == m_FaceHeight, "Cubemap faces need to be the same size");
 
-		glTexImage2D(face, 0, m_CubemapSettings.TextureFormat, m_FaceWidth, m_FaceHeight, 0, dataFormat, GL_UNSIGNED_BYTE, data);
+		// Faces are the layers of the cubemap's storage, in the same order as the GL_TEXTURE_CUBE_MAP_POSITIVE_X... enums
+		if (data) {
+			glTextureSubImage3D(m_CubemapID, 0, 0, 0, face - GL_TEXTURE_CUBE_MAP_POSITIVE_X, m_FaceWidth, m_FaceHeight, 1, dataFormat, GL_UNSIGNED_BYTE, data);
+		}
 		++m_FacesGenerated;
 
 		if (m_FacesGenerated >= 6) {
 			ApplyCubemapSettings();
 		}
-
-		Unbind();
 	}
 
 	void Cubemap::Bind(int unit) {
-		glActiveTexture(GL_TEXTURE0 + unit);
-		glBindTexture(GL_TEXTURE_CUBE_MAP, m_CubemapID);
+		glBindTextureUnit(unit, m_CubemapID);
+		glBindSampler(unit, m_SamplerId);
 	}
 
-	void Cubemap::Unbind() {
-		glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+	void Cubemap::Unbind(int unit) {
+		glBindTextureUnit(unit, 0);
+		glBindSampler(unit, 0);
 	}
-}
+}
\ No newline at end of file
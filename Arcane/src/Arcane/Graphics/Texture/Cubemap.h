@@ -38,8 +38,8 @@ namespace Arcane
 
 		void GenerateCubemapFace(GLenum face, unsigned int faceWidth, unsigned int faceHeight, GLenum dataFormat, const unsigned char *data);
 
-		void Bind(int unit = 0);
-		void Unbind();
+		void Bind(int unit = 0); // Binds the shared sampler matching the settings along with the cubemap
+		void Unbind(int unit = 0);
 
 		// Pre-generation controls only
 		inline void SetCubemapSettings(CubemapSettings settings) { m_CubemapSettings = settings; }
@@ -52,6 +52,7 @@ namespace Arcane
 		void ApplyCubemapSettings();
 	private:
 		unsigned int m_CubemapID;
+		unsigned int m_SamplerId; // Owned by the SamplerCache
 
 		unsigned int m_FaceWidth, m_FaceHeight;
 		unsigned int m_FacesGenerated;
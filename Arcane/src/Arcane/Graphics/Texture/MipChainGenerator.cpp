@@ -0,0 +1,339 @@
+#include "arcpch.h"
+#include "MipChainGenerator.h"
+
+// x64 always has SSE2, on x86 MSVC reports it through _M_IX86_FP
+#if USE_SIMD_MATH && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define ARC_MIP_CHAIN_SSE 1
+#include <emmintrin.h>
+#else
+#define ARC_MIP_CHAIN_SSE 0
+#endif
+
+namespace Arcane
+{
+	// Same defaults as NVTT, the radius is in destination texels
+	static constexpr float s_KaiserRadius = 3.0f;
+	static constexpr float s_KaiserAlpha = 4.0f;
+
+	// Source texels (and their weights) that contribute to each destination texel along one axis
+	struct AxisFilter
+	{
+		std::vector<unsigned int> TapOffsets; // Destination texel d uses the taps [TapOffsets[d], TapOffsets[d + 1])
+		std::vector<unsigned int> SourceIndices;
+		std::vector<float> Weights;
+	};
+
+	static float BesselI0(float x)
+	{
+		// Power series, converges quickly for the small arguments the Kaiser window uses
+		float sum = 1.0f, term = 1.0f;
+		float halfX = x * 0.5f;
+		for (int k = 1; k < 32 && term > sum * 1e-8f; k++)
+		{
+			term *= (halfX / k) * (halfX / k);
+			sum += term;
+		}
+		return sum;
+	}
+
+	static float KaiserWeight(float x)
+	{
+		if (std::abs(x) >= s_KaiserRadius)
+			return 0.0f;
+
+		float sinc = x == 0.0f ? 1.0f : std::sin(glm::pi<float>() * x) / (glm::pi<float>() * x);
+		float t = x / s_KaiserRadius;
+		return sinc * BesselI0(s_KaiserAlpha * std::sqrt(1.0f - t * t)) / BesselI0(s_KaiserAlpha);
+	}
+
+	static AxisFilter BuildAxisFilter(unsigned int sourceSize, unsigned int destSize, MipFilter filter, bool wrap)
+	{
+		AxisFilter axis;
+		axis.TapOffsets.reserve(destSize + 1);
+
+		float scale = static_cast<float>(sourceSize) / destSize;
+		float radius = (filter == MipFilter::Box ? 0.5f : s_KaiserRadius) * scale;
+		for (unsigned int d = 0; d < destSize; d++)
+		{
+			axis.TapOffsets.push_back(static_cast<unsigned int>(axis.Weights.size()));
+
+			float center = (d + 0.5f) * scale;
+			int first = static_cast<int>(std::floor(center - radius));
+			int last = static_cast<int>(std::ceil(center + radius)) - 1;
+			float weightSum = 0.0f;
+			for (int i = first; i <= last; i++)
+			{
+				float weight;
+				if (filter == MipFilter::Box)
+					weight = glm::max(0.0f, glm::min(i + 1.0f, center + radius) - glm::max(static_cast<float>(i), center - radius)); // Coverage of the texel
+				else
+					weight = KaiserWeight((i + 0.5f - center) / scale);
+				if (weight == 0.0f)
+					continue;
+
+				int size = static_cast<int>(sourceSize);
+				int index = wrap ? ((i % size) + size) % size : glm::clamp(i, 0, size - 1);
+				axis.SourceIndices.push_back(static_cast<unsigned int>(index));
+				axis.Weights.push_back(weight);
+				weightSum += weight;
+			}
+
+			for (size_t tap = axis.TapOffsets.back(); tap < axis.Weights.size(); tap++)
+			{
+				axis.Weights[tap] /= weightSum;
+			}
+		}
+		axis.TapOffsets.push_back(static_cast<unsigned int>(axis.Weights.size()));
+
+		return axis;
+	}
+
+#if ARC_MIP_CHAIN_SSE
+	// RGB texels are read and written as 2 + 1 floats so the last texel of a row never touches memory past the end of the buffer
+	static inline __m128 LoadTexel(const float *texel, int components)
+	{
+		if (components == 4)
+			return _mm_loadu_ps(texel);
+
+		__m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(texel)));
+		return _mm_movelh_ps(xy, _mm_load_ss(texel + 2));
+	}
+
+	static inline void StoreTexel(float *texel, __m128 value, int components)
+	{
+		if (components == 4)
+		{
+			_mm_storeu_ps(texel, value);
+			return;
+		}
+
+		_mm_store_sd(reinterpret_cast<double*>(texel), _mm_castps_pd(value));
+		_mm_store_ss(texel + 2, _mm_movehl_ps(value, value));
+	}
+#endif
+
+	// Filters one row down to destWidth texels. With SSE an RGB(A) texel is accumulated as a single register
+	static void FilterRowHorizontal(const float *sourceRow, float *destRow, const AxisFilter &filterX, unsigned int destWidth, int components)
+	{
+#if ARC_MIP_CHAIN_SSE
+		if (components >= 3)
+		{
+			for (unsigned int x = 0; x < destWidth; x++)
+			{
+				__m128 sum = _mm_setzero_ps();
+				for (unsigned int tap = filterX.TapOffsets[x]; tap < filterX.TapOffsets[x + 1]; tap++)
+				{
+					__m128 sourceTexel = LoadTexel(sourceRow + static_cast<size_t>(filterX.SourceIndices[tap]) * components, components);
+					sum = _mm_add_ps(sum, _mm_mul_ps(sourceTexel, _mm_set1_ps(filterX.Weights[tap])));
+				}
+				StoreTexel(destRow + static_cast<size_t>(x) * components, sum, components);
+			}
+			return;
+		}
+#endif
+
+		for (unsigned int x = 0; x < destWidth; x++)
+		{
+			float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for (unsigned int tap = filterX.TapOffsets[x]; tap < filterX.TapOffsets[x + 1]; tap++)
+			{
+				const float *sourceTexel = sourceRow + static_cast<size_t>(filterX.SourceIndices[tap]) * components;
+				float weight = filterX.Weights[tap];
+				for (int channel = 0; channel < components; channel++)
+				{
+					sum[channel] += sourceTexel[channel] * weight;
+				}
+			}
+			for (int channel = 0; channel < components; channel++)
+			{
+				destRow[x * components + channel] = sum[channel];
+			}
+		}
+	}
+
+	// destRow += sourceRow * weight, 4 columns at a time with SSE
+	static void AccumulateRow(float *destRow, const float *sourceRow, float weight, size_t count)
+	{
+		size_t i = 0;
+#if ARC_MIP_CHAIN_SSE
+		__m128 weight4 = _mm_set1_ps(weight);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(destRow + i, _mm_add_ps(_mm_loadu_ps(destRow + i), _mm_mul_ps(_mm_loadu_ps(sourceRow + i), weight4)));
+		}
+#endif
+		for (; i < count; i++)
+		{
+			destRow[i] += sourceRow[i] * weight;
+		}
+	}
+
+	static float SRGBToLinear(float value)
+	{
+		return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	static float LinearToSRGB(float value)
+	{
+		return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	// 16 bit linear -> 8 bit sRGB, fine enough that even the darkest sRGB steps span a dozen entries, and far cheaper than a pow per channel
+	static const unsigned char* GetLinearToSRGB8Table()
+	{
+		static const std::vector<unsigned char> s_Table = []()
+		{
+			std::vector<unsigned char> table(65536);
+			for (size_t i = 0; i < table.size(); i++)
+			{
+				table[i] = static_cast<unsigned char>(LinearToSRGB(i / 65535.0f) * 255.0f + 0.5f);
+			}
+			return table;
+		}();
+		return s_Table.data();
+	}
+
+	int MipChainGenerator::GetMipLevelCount(unsigned int width, unsigned int height)
+	{
+		int levelCount = 1;
+		while (width > 1 || height > 1)
+		{
+			width = glm::max(width / 2, 1u);
+			height = glm::max(height / 2, 1u);
+			levelCount++;
+		}
+		return levelCount;
+	}
+
+	size_t MipChainGenerator::GetMipChainSize(unsigned int width, unsigned int height, int components)
+	{
+		size_t size = 0;
+		while (width > 1 || height > 1)
+		{
+			width = glm::max(width / 2, 1u);
+			height = glm::max(height / 2, 1u);
+			size += static_cast<size_t>(width) * height * components;
+		}
+		return size;
+	}
+
+	unsigned char* MipChainGenerator::Generate(const unsigned char *data, unsigned int width, unsigned int height, int components, const MipChainSettings &settings)
+	{
+		ARC_ASSERT(components >= 1 && components <= 4, "Mip chains can only be generated for 1 to 4 channel images");
+		size_t chainSize = GetMipChainSize(width, height, components);
+		if (chainSize == 0)
+			return nullptr;
+
+		// GL only treats RGB(A) data as sRGB, the same goes for what a normal needs
+		bool colourIsSRGB = settings.IsSRGB && components >= 3;
+		bool isNormalMap = settings.IsNormalMap && components >= 3;
+		bool channelIsSRGB[4] = { colourIsSRGB, colourIsSRGB, colourIsSRGB, false };
+
+		// Per channel lookup tables for decoding the 8 bit values into the space they get filtered in
+		float decodeTables[4][256];
+		for (int channel = 0; channel < components; channel++)
+		{
+			for (int i = 0; i < 256; i++)
+			{
+				float value = i / 255.0f;
+				if (channelIsSRGB[channel])
+					value = SRGBToLinear(value);
+				else if (isNormalMap && channel < 3)
+					value = value * 2.0f - 1.0f;
+				decodeTables[channel][i] = value;
+			}
+		}
+		const unsigned char *linearToSRGB8 = GetLinearToSRGB8Table();
+
+		unsigned char *chain = static_cast<unsigned char*>(malloc(chainSize));
+		unsigned char *levelOutput = chain;
+		std::vector<float> source, horizontal, dest;
+		std::vector<float> decodedRow(static_cast<size_t>(width) * components);
+		unsigned int sourceWidth = width, sourceHeight = height;
+		while (sourceWidth > 1 || sourceHeight > 1)
+		{
+			unsigned int destWidth = glm::max(sourceWidth / 2, 1u);
+			unsigned int destHeight = glm::max(sourceHeight / 2, 1u);
+			AxisFilter filterX = BuildAxisFilter(sourceWidth, destWidth, settings.Filter, settings.WrapS);
+			AxisFilter filterY = BuildAxisFilter(sourceHeight, destHeight, settings.Filter, settings.WrapT);
+
+			// Horizontal pass (destWidth x sourceHeight)
+			size_t destRowSize = static_cast<size_t>(destWidth) * components;
+			horizontal.resize(destRowSize * sourceHeight);
+			for (unsigned int y = 0; y < sourceHeight; y++)
+			{
+				// The base level gets decoded a row at a time as it is read, every later level reads the previous level's filtered values
+				const float *sourceRow;
+				if (sourceWidth == width && sourceHeight == height)
+				{
+					const unsigned char *dataRow = data + static_cast<size_t>(y) * width * components;
+					for (size_t i = 0; i < decodedRow.size(); i += components)
+					{
+						for (int channel = 0; channel < components; channel++)
+						{
+							decodedRow[i + channel] = decodeTables[channel][dataRow[i + channel]];
+						}
+					}
+					sourceRow = decodedRow.data();
+				}
+				else
+				{
+					sourceRow = &source[static_cast<size_t>(y) * sourceWidth * components];
+				}
+				FilterRowHorizontal(sourceRow, &horizontal[y * destRowSize], filterX, destWidth, components);
+			}
+
+			// Vertical pass, accumulates whole rows at a time
+			dest.assign(destRowSize * destHeight, 0.0f);
+			for (unsigned int y = 0; y < destHeight; y++)
+			{
+				float *destRow = &dest[y * destRowSize];
+				for (unsigned int tap = filterY.TapOffsets[y]; tap < filterY.TapOffsets[y + 1]; tap++)
+				{
+					AccumulateRow(destRow, &horizontal[filterY.SourceIndices[tap] * destRowSize], filterY.Weights[tap], destRowSize);
+				}
+			}
+
+			// Kaiser has negative lobes so clamp the ringing, then store the level. The filtered values are used for the next level as well
+			size_t destTexelCount = static_cast<size_t>(destWidth) * destHeight;
+			for (size_t texel = 0; texel < destTexelCount; texel++)
+			{
+				float *value = &dest[texel * components];
+				if (isNormalMap)
+				{
+					glm::vec3 normal = glm::clamp(glm::vec3(value[0], value[1], value[2]), -1.0f, 1.0f);
+					float length = glm::length(normal);
+					normal = length > 1e-6f ? normal / length : glm::vec3(0.0f, 0.0f, 1.0f);
+					value[0] = normal.x; value[1] = normal.y; value[2] = normal.z;
+				}
+
+				for (int channel = 0; channel < components; channel++)
+				{
+					float encoded;
+					if (isNormalMap && channel < 3)
+					{
+						encoded = value[channel] * 0.5f + 0.5f;
+					}
+					else
+					{
+						value[channel] = glm::clamp(value[channel], 0.0f, 1.0f);
+						if (channelIsSRGB[channel])
+						{
+							levelOutput[texel * components + channel] = linearToSRGB8[static_cast<int>(value[channel] * 65535.0f + 0.5f)];
+							continue;
+						}
+						encoded = value[channel];
+					}
+					levelOutput[texel * components + channel] = static_cast<unsigned char>(encoded * 255.0f + 0.5f);
+				}
+			}
+
+			levelOutput += destTexelCount * components;
+			source.swap(dest);
+			sourceWidth = destWidth;
+			sourceHeight = destHeight;
+		}
+
+		return chain;
+	}
+}
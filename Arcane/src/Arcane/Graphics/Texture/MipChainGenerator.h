@@ -0,0 +1,35 @@
+#pragma once
+#ifndef MIPCHAINGENERATOR_H
+#define MIPCHAINGENERATOR_H
+
+namespace Arcane
+{
+	enum class MipFilter
+	{
+		Box,	// Area average of the texels covered, soft
+		Kaiser	// Kaiser windowed sinc, keeps smaller mips sharper
+	};
+
+	struct MipChainSettings
+	{
+		MipFilter Filter = MipFilter::Kaiser;
+		bool IsSRGB = false; // RGB gets filtered in linear space, alpha is always linear
+		bool IsNormalMap = false; // XYZ gets decoded to [-1, 1] and renormalized after filtering
+		bool WrapS = true, WrapT = true; // Repeating textures filter across the opposite edge, others clamp at the edge
+	};
+
+	/*
+		Builds the mip chain of an 8 bit image on the CPU so it can happen on the loader threads instead of glGenerateMipmap on the main thread.
+		Every level is filtered from the previous one in floating point, one axis at a time. With USE_SIMD_MATH the vertical pass runs 4 columns at a time with SSE and the horizontal pass keeps an RGB(A) texel in one register
+	*/
+	class MipChainGenerator
+	{
+	public:
+		static int GetMipLevelCount(unsigned int width, unsigned int height); // Including the base level, down to 1x1
+		static size_t GetMipChainSize(unsigned int width, unsigned int height, int components); // Bytes of levels 1 and up
+
+		// Returns levels 1 to GetMipLevelCount() - 1 packed back to back, allocated with malloc so release it with free()
+		static unsigned char* Generate(const unsigned char *data, unsigned int width, unsigned int height, int components, const MipChainSettings &settings);
+	};
+}
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+#ifndef ORMTEXTURE_H
+#define ORMTEXTURE_H
+
+#ifndef TEXTURE_H
+#include <Arcane/Graphics/Texture/Texture.h>
+#endif
+
+namespace Arcane
+{
+	/*
+		Occlusion, roughness and metallic maps packed into the channels of one texture (see AssetManager::LoadOrmTextureAsync). Shaders that declare
+		material.texture_orm sample all three with one bind, the single channel views let shaders that still sample the maps separately share the same storage
+	*/
+	struct OrmTexture
+	{
+		Texture Packed; // Occlusion in R, roughness in G, metallic in B
+		Texture OcclusionView, RoughnessView, MetallicView; // Each channel swizzled into RGB, so sampling .r or .rgb reads the same as the separate map did
+		bool HasOcclusion = false, HasRoughness = false, HasMetallic = false; // Missing occlusion is packed as white, missing roughness and metallic fall back to the material's values
+
+		inline bool IsGenerated() const { return Packed.IsGenerated(); }
+	};
+}
+#endif
@@ -0,0 +1,65 @@
+#include "arcpch.h"
+#include "SamplerCache.h"
+
+#include <Arcane/Graphics/Texture/Texture.h>
+#include <Arcane/Graphics/Texture/Cubemap.h>
+#include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Util/StringId.h>
+
+namespace Arcane
+{
+	std::unordered_map<uint64_t, unsigned int> SamplerCache::s_Samplers;
+
+	unsigned int SamplerCache::GetSampler(const TextureSettings &settings)
+	{
+		// Zero initialized so the hash never sees uninitialized bytes
+		SamplerState state = {};
+		state.WrapS = settings.TextureWrapSMode;
+		state.WrapT = settings.TextureWrapTMode;
+		state.WrapR = GL_REPEAT;
+		state.MinFilter = settings.TextureMinificationFilterMode;
+		state.MagFilter = settings.TextureMagnificationFilterMode;
+		state.Anisotropy = glm::min<float>(settings.TextureAnisotropyLevel, Renderer::GetRendererData().MaxAnisotropy);
+		state.LodBias = settings.HasMips ? static_cast<float>(settings.MipBias) : 0.0f;
+		if (settings.HasBorder)
+			state.BorderColour = settings.BorderColour;
+
+		return GetSampler(state);
+	}
+
+	unsigned int SamplerCache::GetSampler(const CubemapSettings &settings)
+	{
+		SamplerState state = {};
+		state.WrapS = settings.TextureWrapSMode;
+		state.WrapT = settings.TextureWrapTMode;
+		state.WrapR = settings.TextureWrapRMode;
+		state.MinFilter = settings.TextureMinificationFilterMode;
+		state.MagFilter = settings.TextureMagnificationFilterMode;
+		state.Anisotropy = glm::min<float>(settings.TextureAnisotropyLevel, Renderer::GetRendererData().MaxAnisotropy);
+		state.LodBias = settings.HasMips ? static_cast<float>(settings.MipBias) : 0.0f;
+
+		return GetSampler(state);
+	}
+
+	unsigned int SamplerCache::GetSampler(const SamplerState &state)
+	{
+		uint64_t key = HashString64(reinterpret_cast<const char*>(&state), sizeof(SamplerState));
+		auto iter = s_Samplers.find(key);
+		if (iter != s_Samplers.end())
+			return iter->second;
+
+		unsigned int sampler;
+		glCreateSamplers(1, &sampler);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, state.WrapS);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, state.WrapT);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, state.WrapR);
+		glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, state.MinFilter);
+		glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, state.MagFilter);
+		glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY_EXT, state.Anisotropy);
+		glSamplerParameterf(sampler, GL_TEXTURE_LOD_BIAS, state.LodBias);
+		glSamplerParameterfv(sampler, GL_TEXTURE_BORDER_COLOR, glm::value_ptr(state.BorderColour));
+
+		s_Samplers.emplace(key, sampler);
+		return sampler;
+	}
+}
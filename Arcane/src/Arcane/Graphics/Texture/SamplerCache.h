@@ -0,0 +1,38 @@
+#pragma once
+#ifndef SAMPLERCACHE_H
+#define SAMPLERCACHE_H
+
+namespace Arcane
+{
+	struct TextureSettings;
+	struct CubemapSettings;
+
+	/*
+		Sampler objects shared by every texture with the same sampling state (wrapping, filtering, anisotropy, mip bias and border colour).
+		Textures and cubemaps bind the sampler alongside themselves, so the sampling state doesn't get revalidated per texture. The
+		texture's own parameters are still set for code that samples it without a sampler (ie: ImGui)
+	*/
+	class SamplerCache
+	{
+	public:
+		// Created the first time the state is asked for, the samplers live until shutdown
+		static unsigned int GetSampler(const TextureSettings &settings);
+		static unsigned int GetSampler(const CubemapSettings &settings);
+
+		inline static size_t GetSamplerCount() { return s_Samplers.size(); }
+	private:
+		struct SamplerState
+		{
+			GLenum WrapS, WrapT, WrapR;
+			GLenum MinFilter, MagFilter;
+			float Anisotropy; // Already clamped to what the hardware supports
+			float LodBias;
+			glm::vec4 BorderColour; // Left at zero for samplers without a border so they don't get split by it
+		};
+
+		static unsigned int GetSampler(const SamplerState &state);
+	private:
+		static std::unordered_map<uint64_t, unsigned int> s_Samplers; // Keyed by the hashed SamplerState
+	};
+}
+#endif
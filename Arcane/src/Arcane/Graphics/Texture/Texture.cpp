@@ -2,79 +2,165 @@
 #include "Texture.h"
 
 #include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Graphics/Texture/MipChainGenerator.h>
+#include <Arcane/Graphics/Texture/SamplerCache.h>
 
 namespace Arcane
 {
-	Texture::Texture() : m_TextureId(0), m_TextureTarget(0), m_Width(0), m_Height(0), m_TextureSettings() {}
+	Texture::Texture() : m_TextureId(0), m_TextureTarget(0), m_SamplerId(0), m_Width(0), m_Height(0), m_TextureSettings() {}
 
-	Texture::Texture(TextureSettings &settings) : m_TextureId(0), m_TextureTarget(0), m_Width(0), m_Height(0), m_TextureSettings(settings) {}
+	Texture::Texture(TextureSettings &settings) : m_TextureId(0), m_TextureTarget(0), m_SamplerId(0), m_Width(0), m_Height(0), m_TextureSettings(settings) {}
 
 	// TODO: Current Texture Copy implementation only copies the highest resolution mip (level 0)
 	// This implementation is fine when the hardware generates the mips because our newly created texture will do the same
 	// This only fails if the mip levels contain custom data that was generated by the hardware via glGenerateMipmap(...)
-	Texture::Texture(const Texture &texture) : m_TextureId(0), m_TextureTarget(texture.GetTextureTarget()), m_Width(texture.GetWidth()), m_Height(texture.GetHeight()), m_TextureSettings(texture.GetTextureSettings())
+	Texture::Texture(const Texture &texture) : m_TextureId(0), m_TextureTarget(texture.GetTextureTarget()), m_SamplerId(0), m_Width(texture.GetWidth()), m_Height(texture.GetHeight()), m_TextureSettings(texture.GetTextureSettings())
 	{
-		glGenTextures(1, &m_TextureId);
-		Bind();
-
-		glTexImage2D(m_TextureTarget, 0, m_TextureSettings.TextureFormat, m_Width, m_Height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
-		ApplyTextureSettings();
+		glCreateTextures(m_TextureTarget, 1, &m_TextureId);
+		glTextureStorage2D(m_TextureId, GetStorageLevelCount(), m_TextureSettings.TextureFormat, m_Width, m_Height);
 		glCopyImageSubData(texture.GetTextureId(), texture.GetTextureTarget(), 0, 0, 0, 0, m_TextureId, m_TextureTarget, 0, 0, 0, 0, m_Width, m_Height, 1);
-
-		Unbind();
+		ApplyTextureSettings();
 	}
 
 	Texture::~Texture() {
 		glDeleteTextures(1, &m_TextureId);
 	}
 
-	void Texture::ApplyTextureSettings() {
+	void Texture::Release() {
+		glDeleteTextures(1, &m_TextureId);
+		m_TextureId = 0;
+		m_SamplerId = 0;
+		m_Width = 0;
+		m_Height = 0;
+	}
+
+	GLenum Texture::GetSizedFormat(GLenum format) {
+		switch (format) {
+		case GL_RED: return GL_R8;
+		case GL_RG: return GL_RG8;
+		case GL_RGB: return GL_RGB8;
+		case GL_RGBA: return GL_RGBA8;
+		case GL_SRGB: return GL_SRGB8;
+		case GL_SRGB_ALPHA: return GL_SRGB8_ALPHA8;
+		case GL_DEPTH_COMPONENT: return GL_DEPTH_COMPONENT24;
+		case GL_DEPTH_STENCIL: return GL_DEPTH24_STENCIL8;
+		default: return format; // Already sized
+		}
+	}
+
+	int Texture::GetStorageLevelCount() const {
+		if (!m_TextureSettings.HasMips)
+			return 1;
+
+		return MipChainGenerator::GetMipLevelCount(m_Width, m_Height);
+	}
+
+	void Texture::ResolveTextureFormat(GLenum dataFormat) {
+		// If GL_NONE is specified, set the texture format to the data format
+		if (m_TextureSettings.TextureFormat == GL_NONE) {
+			m_TextureSettings.TextureFormat = dataFormat;
+		}
+		// Check if the texture is SRGB, if so change the texture format
+		if (m_TextureSettings.IsSRGB) {
+			switch (dataFormat) {
+			case GL_RGB: m_TextureSettings.TextureFormat = GL_SRGB; break;
+			case GL_RGBA: m_TextureSettings.TextureFormat = GL_SRGB_ALPHA; break;
+			}
+		}
+
+		// Immutable storage only takes sized formats
+		m_TextureSettings.TextureFormat = GetSizedFormat(m_TextureSettings.TextureFormat);
+	}
+
+	void Texture::ApplyTextureSettings(bool generateMips) {
 		// Texture wrapping
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, m_TextureSettings.TextureWrapSMode);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, m_TextureSettings.TextureWrapTMode);
+		glTextureParameteri(m_TextureId, GL_TEXTURE_WRAP_S, m_TextureSettings.TextureWrapSMode);
+		glTextureParameteri(m_TextureId, GL_TEXTURE_WRAP_T, m_TextureSettings.TextureWrapTMode);
 		if (m_TextureSettings.HasBorder) {
-			glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, glm::value_ptr(m_TextureSettings.BorderColour));
+			glTextureParameterfv(m_TextureId, GL_TEXTURE_BORDER_COLOR, glm::value_ptr(m_TextureSettings.BorderColour));
 		}
 
 		// Texture filtering
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_TextureSettings.TextureMinificationFilterMode);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_TextureSettings.TextureMagnificationFilterMode);
+		glTextureParameteri(m_TextureId, GL_TEXTURE_MIN_FILTER, m_TextureSettings.TextureMinificationFilterMode);
+		glTextureParameteri(m_TextureId, GL_TEXTURE_MAG_FILTER, m_TextureSettings.TextureMagnificationFilterMode);
 
 		// Mipmapping
 		if (m_TextureSettings.HasMips) {
-			glGenerateMipmap(GL_TEXTURE_2D);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_LOD_BIAS, m_TextureSettings.MipBias);
+			if (generateMips)
+				glGenerateTextureMipmap(m_TextureId);
+			glTextureParameteri(m_TextureId, GL_TEXTURE_LOD_BIAS, m_TextureSettings.MipBias);
 		}
 
 		// Anisotropic filtering (Check with renderer to see the max amount allowed
 		float anistropyAmount = glm::min<float>(m_TextureSettings.TextureAnisotropyLevel, Renderer::GetRendererData().MaxAnisotropy);
-		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, anistropyAmount);
+		glTextureParameterf(m_TextureId, GL_TEXTURE_MAX_ANISOTROPY_EXT, anistropyAmount);
+
+		// The parameters above only matter to code sampling the texture without our sampler, the sampler is what the renderer samples with
+		m_SamplerId = SamplerCache::GetSampler(m_TextureSettings);
 	}
 
 	void Texture::Generate2DTexture(unsigned int width, unsigned int height, GLenum dataFormat, GLenum pixelDataType, const void *data) {
 		m_TextureTarget = GL_TEXTURE_2D;
 		m_Width = width;
 		m_Height = height;
+		ResolveTextureFormat(dataFormat);
 
-		// If GL_NONE is specified, set the texture format to the data format
-		if (m_TextureSettings.TextureFormat == GL_NONE) {
-			m_TextureSettings.TextureFormat = dataFormat;
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_TextureId);
+		glTextureStorage2D(m_TextureId, GetStorageLevelCount(), m_TextureSettings.TextureFormat, width, height);
+		if (data) {
+			glTextureSubImage2D(m_TextureId, 0, 0, 0, width, height, dataFormat, pixelDataType, data);
 		}
-		// Check if the texture is SRGB, if so change the texture format
-		if (m_TextureSettings.IsSRGB) {
-			switch (dataFormat) {
-			case GL_RGB: m_TextureSettings.TextureFormat = GL_SRGB; break;
-			case GL_RGBA: m_TextureSettings.TextureFormat = GL_SRGB_ALPHA; break;
-			}
+		ApplyTextureSettings(data != nullptr);
+	}
+
+	void Texture::Generate2DTextureWithMips(unsigned int width, unsigned int height, GLenum dataFormat, const unsigned char *data, const unsigned char *mipData, int mipLevelCount) {
+		m_TextureTarget = GL_TEXTURE_2D;
+		m_Width = width;
+		m_Height = height;
+		ResolveTextureFormat(dataFormat);
+		mipLevelCount = glm::max(mipLevelCount, 1);
+
+		int components = 4;
+		switch (dataFormat) {
+		case GL_RED: components = 1; break;
+		case GL_RG: components = 2; break;
+		case GL_RGB: components = 3; break;
 		}
 
-		glGenTextures(1, &m_TextureId);
-		Bind();
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_TextureId);
+		glTextureStorage2D(m_TextureId, mipLevelCount, m_TextureSettings.TextureFormat, width, height);
+
+		// Mip rows are tightly packed, so odd widths wouldn't match the default 4 byte row alignment
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTextureSubImage2D(m_TextureId, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, data);
+		unsigned int levelWidth = width, levelHeight = height;
+		for (int level = 1; level < mipLevelCount; level++) {
+			levelWidth = glm::max(levelWidth / 2, 1u);
+			levelHeight = glm::max(levelHeight / 2, 1u);
+			glTextureSubImage2D(m_TextureId, level, 0, 0, levelWidth, levelHeight, dataFormat, GL_UNSIGNED_BYTE, mipData);
+			mipData += static_cast<size_t>(levelWidth) * levelHeight * components;
+		}
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-		glTexImage2D(GL_TEXTURE_2D, 0, m_TextureSettings.TextureFormat, width, height, 0, dataFormat, pixelDataType, data);
-		ApplyTextureSettings();
+		ApplyTextureSettings(false);
+	}
+
+	void Texture::Generate2DChannelView(const Texture &source, GLenum channel) {
+		m_TextureTarget = GL_TEXTURE_2D;
+		m_Width = source.m_Width;
+		m_Height = source.m_Height;
+		m_TextureSettings = source.m_TextureSettings;
 
-		Unbind();
+		GLint levelCount = 1;
+		glGetTextureParameteriv(source.m_TextureId, GL_TEXTURE_IMMUTABLE_LEVELS, &levelCount);
+
+		// glTextureView needs a name that doesn't have an object yet, so this is the one place glGenTextures is still used instead of glCreateTextures
+		glGenTextures(1, &m_TextureId);
+		glTextureView(m_TextureId, GL_TEXTURE_2D, source.m_TextureId, source.m_TextureSettings.TextureFormat, 0, levelCount, 0, 1);
+
+		GLint swizzle[4] = { static_cast<GLint>(channel), static_cast<GLint>(channel), static_cast<GLint>(channel), GL_ONE };
+		glTextureParameteriv(m_TextureId, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+		ApplyTextureSettings(false);
 	}
 
 	void Texture::Generate2DMultisampleTexture(unsigned int width, unsigned int height) {
@@ -82,41 +168,39 @@ namespace Arcane
 		m_TextureTarget = GL_TEXTURE_2D_MULTISAMPLE;
 		m_Width = width;
 		m_Height = height;
+		m_TextureSettings.TextureFormat = GetSizedFormat(m_TextureSettings.TextureFormat);
 
-		glGenTextures(1, &m_TextureId);
-		Bind();
-		glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, MSAA_SAMPLE_AMOUNT, m_TextureSettings.TextureFormat, m_Width, m_Height, GL_TRUE);
-		Unbind();
+		glCreateTextures(GL_TEXTURE_2D_MULTISAMPLE, 1, &m_TextureId);
+		glTextureStorage2DMultisample(m_TextureId, MSAA_SAMPLE_AMOUNT, m_TextureSettings.TextureFormat, m_Width, m_Height, GL_TRUE);
 	}
 
+	// Storage is immutable so this can only fill in levels that were allocated at generation (HasMips was set then)
 	void Texture::GenerateMips() {
 		m_TextureSettings.HasMips = true;
 		if (IsGenerated()) {
-			Bind();
-			glGenerateMipmap(m_TextureTarget);
+			glGenerateTextureMipmap(m_TextureId);
 		}
 	}
 
 	void Texture::Bind(int unit) const
 	{
-		glActiveTexture(GL_TEXTURE0 + unit);
-		glBindTexture(m_TextureTarget, m_TextureId);
+		glBindTextureUnit(unit, m_TextureId);
+		glBindSampler(unit, m_SamplerId);
 	}
 
-	void Texture::Unbind() const
+	void Texture::Unbind(int unit) const
 	{
-		glBindTexture(m_TextureTarget, 0);
+		glBindTextureUnit(unit, 0);
+		glBindSampler(unit, 0);
 	}
 
-
-
 	void Texture::SetTextureWrapS(GLenum textureWrapMode) {
 		if (m_TextureSettings.TextureWrapSMode == textureWrapMode)
 			return;
 
 		m_TextureSettings.TextureWrapSMode = textureWrapMode;
 		if (IsGenerated()) {
-			glTexParameteri(m_TextureTarget, GL_TEXTURE_WRAP_S, m_TextureSettings.TextureWrapSMode);
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -126,7 +210,7 @@ namespace Arcane
 
 		m_TextureSettings.TextureWrapTMode = textureWrapMode;
 		if (IsGenerated()) {
-			glTexParameteri(m_TextureTarget, GL_TEXTURE_WRAP_T, m_TextureSettings.TextureWrapTMode);
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -136,7 +220,7 @@ namespace Arcane
 
 		m_TextureSettings.HasBorder = hasBorder;
 		if (IsGenerated()) {
-			glTexParameterfv(m_TextureTarget, GL_TEXTURE_BORDER_COLOR, glm::value_ptr(m_TextureSettings.BorderColour));
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -146,7 +230,7 @@ namespace Arcane
 
 		m_TextureSettings.BorderColour = borderColour;
 		if (IsGenerated()) {
-			glTexParameterfv(m_TextureTarget, GL_TEXTURE_BORDER_COLOR, glm::value_ptr(m_TextureSettings.BorderColour));
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -156,7 +240,7 @@ namespace Arcane
 
 		m_TextureSettings.TextureMinificationFilterMode = textureFilterMode;
 		if (IsGenerated()) {
-			glTexParameteri(m_TextureTarget, GL_TEXTURE_MIN_FILTER, m_TextureSettings.TextureMinificationFilterMode);
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -168,7 +252,7 @@ namespace Arcane
 
 		m_TextureSettings.TextureMagnificationFilterMode = textureFilterMode;
 		if (IsGenerated()) {
-			glTexParameteri(m_TextureTarget, GL_TEXTURE_MAG_FILTER, m_TextureSettings.TextureMagnificationFilterMode);
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -178,10 +262,7 @@ namespace Arcane
 
 		m_TextureSettings.TextureAnisotropyLevel = textureAnisotropyLevel;
 		if (IsGenerated()) {
-			float maxAnisotropy;
-			glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
-			float anistropyAmount = glm::min<float>(maxAnisotropy, m_TextureSettings.TextureAnisotropyLevel);
-			glTexParameterf(m_TextureTarget, GL_TEXTURE_MAX_ANISOTROPY_EXT, anistropyAmount);
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -191,7 +272,7 @@ namespace Arcane
 
 		m_TextureSettings.MipBias = mipBias;
 		if (IsGenerated()) {
-			glTexParameteri(m_TextureTarget, GL_TEXTURE_LOD_BIAS, m_TextureSettings.MipBias);
+			ApplyTextureSettings(false);
 		}
 	}
 
@@ -200,8 +281,8 @@ namespace Arcane
 			return;
 
 		m_TextureSettings.HasMips = hasMips;
-		if (IsGenerated() && hasMips == true) {
-			glGenerateMipmap(m_TextureTarget);
+		if (IsGenerated()) {
+			ApplyTextureSettings(hasMips);
 		}
 	}
 }
@@ -12,6 +12,7 @@ namespace Arcane
 		 * Anything that will be used for colour in a renderer should be linearlized. However textures that contain data (Heightfields, normal maps, metallic maps etc.) should not be,
 		 * thus they are not in SRGB space. Note: If you generate your own data and it is already in linear space (like light probes), be careful */
 		bool IsSRGB = false;
+		bool IsNormalMap = false; // Mips generated on the CPU get renormalized
 
 		// Texture wrapping options
 		GLenum TextureWrapSMode = GL_REPEAT;
@@ -38,13 +39,16 @@ namespace Arcane
 
 		// Generation functions
 		void Generate2DTexture(unsigned int width, unsigned int height, GLenum dataFormat, GLenum pixelDataType = GL_UNSIGNED_BYTE, const void *data = nullptr);
+		void Generate2DTextureWithMips(unsigned int width, unsigned int height, GLenum dataFormat, const unsigned char *data, const unsigned char *mipData, int mipLevelCount); // mipData holds levels 1 to mipLevelCount - 1 packed back to back (see MipChainGenerator)
+		void Generate2DChannelView(const Texture &source, GLenum channel); // View of one channel (GL_RED to GL_ALPHA) of another texture, replicated into RGB. Shares the source's storage
 		void Generate2DMultisampleTexture(unsigned int width, unsigned int height);
-		void GenerateMips(); // Will attempt to generate mipmaps, only works if the texture has already been generated
+		void GenerateMips(); // Will attempt to generate mipmaps, only works if the texture has already been generated with HasMips set (storage is immutable)
+		void Release(); // Frees the GPU storage, settings are kept so the texture can be generated again
 
-		void Bind(int unit = 0) const;
-		void Unbind() const;
+		void Bind(int unit = 0) const; // Binds the shared sampler matching the settings along with the texture
+		void Unbind(int unit = 0) const;
 
-		// Texture Tuning Functions (Works for pre-generation and post-generation). For post generation you need to bind the texture before calling
+		// Texture Tuning Functions (Works for pre-generation and post-generation)
 		void SetTextureWrapS(GLenum textureWrapMode);
 		void SetTextureWrapT(GLenum textureWrapMode);
 		void SetHasBorder(bool hasBorder);
@@ -66,11 +70,16 @@ namespace Arcane
 		inline unsigned int GetWidth() const { return m_Width; }
 		inline unsigned int GetHeight() const { return m_Height; }
 		inline const TextureSettings& GetTextureSettings() const { return m_TextureSettings; }
+
+		static GLenum GetSizedFormat(GLenum format); // Immutable storage only takes sized formats, ie: GL_RGB -> GL_RGB8
 	private:
-		void ApplyTextureSettings();
+		void ResolveTextureFormat(GLenum dataFormat);
+		int GetStorageLevelCount() const;
+		void ApplyTextureSettings(bool generateMips = true);
 	private:
 		unsigned int m_TextureId;
 		GLenum m_TextureTarget;
+		unsigned int m_SamplerId; // Owned by the SamplerCache
 
 		unsigned int m_Width, m_Height;
 
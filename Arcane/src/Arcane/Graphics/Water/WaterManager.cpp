@@ -8,7 +8,7 @@
 
 namespace Arcane
 {
-	WaterManager::WaterManager(Scene *scene) : m_Scene(scene), m_ReflectionFramebuffer(nullptr), m_RefractionFramebuffer(nullptr), m_ClosestWaterComponent(nullptr), m_ResolveReflectionFramebuffer(nullptr), m_ResolveRefractionFramebuffer(nullptr)
+	WaterManager::WaterManager(Scene *scene) : m_Scene(scene), m_ReflectionFramebuffer(nullptr), m_RefractionFramebuffer(nullptr), m_ClosestWaterComponent(nullptr), m_ResolveReflectionFramebuffer(nullptr), m_ResolveRefractionFramebuffer(nullptr), m_TargetsUnusedTimer()
 	{
 
 	}
@@ -21,6 +21,22 @@ namespace Arcane
 		delete m_ResolveRefractionFramebuffer;
 	}
 
+	void WaterManager::ReleaseTargets()
+	{
+		size_t freedMemory = 0;
+		for (Framebuffer **framebuffer : { &m_ReflectionFramebuffer, &m_RefractionFramebuffer, &m_ResolveReflectionFramebuffer, &m_ResolveRefractionFramebuffer })
+		{
+			if (*framebuffer)
+			{
+				freedMemory += (*framebuffer)->GetGpuMemorySize();
+				delete *framebuffer;
+				*framebuffer = nullptr;
+			}
+		}
+
+		ARC_LOG_INFO("Released unused water reflection/refraction targets, freed {0:.2f} MB", freedMemory / (1024.0 * 1024.0));
+	}
+
 	void WaterManager::Init()
 	{
 		FindClosestWater();
@@ -94,6 +110,16 @@ namespace Arcane
 				ReallocateRefractionTarget(&m_ResolveRefractionFramebuffer, requiredRefractionResolution, false);
 			}
 		}
+
+		// Keep the targets around for a bit so water coming back into view (or toggling reflection/refraction) doesn't reallocate them
+		if (m_ClosestWaterComponent && (m_ClosestWaterComponent->ReflectionEnabled || m_ClosestWaterComponent->RefractionEnabled))
+		{
+			m_TargetsUnusedTimer.Reset();
+		}
+		else if ((m_ReflectionFramebuffer || m_RefractionFramebuffer || m_ResolveReflectionFramebuffer || m_ResolveRefractionFramebuffer) && m_TargetsUnusedTimer.Elapsed() >= RENDER_TARGET_RELEASE_DELAY)
+		{
+			ReleaseTargets();
+		}
 	}
 
 	glm::uvec2 WaterManager::GetWaterReflectionRefractionQualityResolution(WaterReflectionRefractionQuality quality)
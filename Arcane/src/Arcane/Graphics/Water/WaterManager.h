@@ -2,6 +2,10 @@
 #ifndef WATERMANAGER_H
 #define WATERMANAGER_H
 
+#ifndef TIMER_H
+#include <Arcane/Util/Timer.h>
+#endif
+
 namespace Arcane
 {
 	class Scene;
@@ -44,6 +48,7 @@ namespace Arcane
 
 		void ReallocateReflectionTarget(Framebuffer **framebuffer, glm::uvec2 newResolution, bool multisampled);
 		void ReallocateRefractionTarget(Framebuffer **framebuffer, glm::uvec2 newResolution, bool multisampled);
+		void ReleaseTargets();
 	private:
 		Scene *m_Scene;
 
@@ -52,6 +57,7 @@ namespace Arcane
 		TransformComponent *m_ClosestWaterTransform;
 		Framebuffer *m_ReflectionFramebuffer, *m_RefractionFramebuffer;
 		Framebuffer *m_ResolveReflectionFramebuffer, *m_ResolveRefractionFramebuffer; // Only used for MSAA
+		Timer m_TargetsUnusedTimer; // The targets get released once no water has needed them for RENDER_TARGET_RELEASE_DELAY seconds
 	};
 }
 
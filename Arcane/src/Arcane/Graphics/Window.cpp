@@ -3,6 +3,8 @@
 
 #include <Arcane/Vendor/Imgui/examples/imgui_impl_glfw.h>
 #include <Arcane/Input/InputManager.h>
+#include <Arcane/Core/Application.h>
+#include <Arcane/Core/Events/EventQueue.h>
 
 namespace Arcane
 {
@@ -15,7 +17,7 @@ namespace Arcane
 	bool Window::s_EnableImGui;
 
 	Window::Window(Application *application, const ApplicationSpecification &specification)
-		: m_Application(application), m_Title(specification.Name.c_str())
+		: m_Application(application), m_Title(specification.Name.c_str()), m_LastPresentTime(0.0)
 	{
 		s_Width = specification.WindowWidth;
 		s_Height = specification.WindowHeight;
@@ -53,7 +55,7 @@ namespace Arcane
 
 		// Context hints
 		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5); // 4.5 for direct state access
 		glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_FALSE);
 		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
 
@@ -94,6 +96,8 @@ namespace Arcane
 		glfwSetWindowCloseCallback(m_Window, window_close_callback);
 		glfwSetWindowSizeCallback(m_Window, window_resize_callback);
 		glfwSetFramebufferSizeCallback(m_Window, framebuffer_resize_callback);
+		glfwSetWindowFocusCallback(m_Window, window_focus_callback);
+		glfwSetWindowIconifyCallback(m_Window, window_iconify_callback);
 		glfwSetCursorPosCallback(m_Window, cursor_position_callback);
 		glfwSetJoystickCallback(joystick_callback);
 		if (s_EnableImGui)
@@ -160,6 +164,13 @@ namespace Arcane
 
 		// Handle Window updating
 		glfwSwapBuffers(m_Window);
+		m_LastPresentTime = glfwGetTime();
+
+		PollEvents();
+	}
+
+	void Window::PollEvents()
+	{
 		glfwPollEvents();
 	}
 
@@ -198,16 +209,45 @@ namespace Arcane
 	}
 
 	/*              Callback Functions              */
+	static void QueueEvent(BufferedEvent &event)
+	{
+		event.Timestamp = glfwGetTime();
+		Application::GetInstance().GetEventQueue()->Push(event);
+	}
+
+	static void QueueKeyEvent(int key, int scancode, int action, int mods)
+	{
+		BufferedEvent event;
+		event.Type = action == GLFW_RELEASE ? EventType::KeyReleased : EventType::KeyPressed;
+		event.Key = { key, scancode, action, mods };
+		QueueEvent(event);
+	}
+
+	static void QueueMouseButtonEvent(int button, int action, int mods)
+	{
+		BufferedEvent event;
+		event.Type = action == GLFW_RELEASE ? EventType::MouseButtonReleased : EventType::MouseButtonPressed;
+		event.MouseButton = { button, action, mods };
+		QueueEvent(event);
+	}
+
+	static void QueueScrollEvent(double xoffset, double yoffset)
+	{
+		BufferedEvent event;
+		event.Type = EventType::MouseScrolled;
+		event.Scroll = { xoffset, yoffset };
+		QueueEvent(event);
+	}
+
 	static void error_callback(int error, const char* description) {
 		ARC_LOG_ERROR("Error: {0} - {1}", error, description);
 	}
 
 	static void window_close_callback(GLFWwindow *window)
 	{
-		Window* win = (Window*)glfwGetWindowUserPointer(window);
-
-		WindowCloseEvent event;
-		win->m_Application->OnEvent(event);
+		BufferedEvent event;
+		event.Type = EventType::WindowClose;
+		QueueEvent(event);
 	}
 
 	static void window_resize_callback(GLFWwindow *window, int width, int height) {
@@ -222,14 +262,29 @@ namespace Arcane
 		}
 		glViewport(0, 0, win->s_Width, win->s_Height);
 
-		WindowResizeEvent event(static_cast<uint32_t>(win->s_Width), static_cast<uint32_t>(win->s_Height));
-		win->m_Application->OnEvent(event);
+		BufferedEvent event;
+		event.Type = EventType::WindowResize;
+		event.Resize = { static_cast<uint32_t>(win->s_Width), static_cast<uint32_t>(win->s_Height) };
+		QueueEvent(event);
 	}
 
 	static void framebuffer_resize_callback(GLFWwindow *window, int width, int height) {
 		Window* win = (Window*)glfwGetWindowUserPointer(window);
 	}
 
+	static void window_focus_callback(GLFWwindow *window, int focused) {
+		BufferedEvent event;
+		event.Type = focused ? EventType::WindowFocus : EventType::WindowLostFocus;
+		QueueEvent(event);
+	}
+
+	static void window_iconify_callback(GLFWwindow *window, int iconified) {
+		BufferedEvent event;
+		event.Type = EventType::WindowIconify;
+		event.Iconify = { iconified };
+		QueueEvent(event);
+	}
+
 #ifdef ARC_DEV_BUILD
 	static void UpdateUIState(GLFWwindow *window, int key, int scancode, int action, int mods)
 	{
@@ -248,39 +303,42 @@ namespace Arcane
 #endif // ARC_DEV_BUILD
 
 	static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods) {
-		InputManager::GetInstance().KeyCallback(key, scancode, action, mods);
+		QueueKeyEvent(key, scancode, action, mods);
 
 		ARC_DEV_ONLY(UpdateUIState(window, key, scancode, action, mods));
 	}
 
 	static void key_callback_imgui(GLFWwindow *window, int key, int scancode, int action, int mods)
 	{
-		InputManager::GetInstance().KeyCallback(key, scancode, action, mods);
+		QueueKeyEvent(key, scancode, action, mods);
 		ImGui_ImplGlfw_KeyCallback(window, key, scancode, action, mods);
 
 		ARC_DEV_ONLY(UpdateUIState(window, key, scancode, action, mods));
 	}
 
 	static void mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
-		InputManager::GetInstance().MouseButtonCallback(button, action, mods);
+		QueueMouseButtonEvent(button, action, mods);
 	}
 
 	static void mouse_button_callback_imgui(GLFWwindow* window, int button, int action, int mods)
 	{
-		InputManager::GetInstance().MouseButtonCallback(button, action, mods);
+		QueueMouseButtonEvent(button, action, mods);
 		ImGui_ImplGlfw_MouseButtonCallback(window, button, action, mods);
 	}
 
 	static void cursor_position_callback(GLFWwindow* window, double xpos, double ypos) {
-		InputManager::GetInstance().CursorPositionCallback(xpos, ypos);
+		BufferedEvent event;
+		event.Type = EventType::MouseMoved;
+		event.Cursor = { xpos, ypos };
+		QueueEvent(event);
 	}
 	
 	static void scroll_callback(GLFWwindow* window, double xoffset, double yoffset) {
-		InputManager::GetInstance().ScrollCallback(xoffset, yoffset);
+		QueueScrollEvent(xoffset, yoffset);
 	}
 
 	static void scroll_callback_imgui(GLFWwindow* window, double xoffset, double yoffset) {
-		InputManager::GetInstance().ScrollCallback(xoffset, yoffset);
+		QueueScrollEvent(xoffset, yoffset);
 		ImGui_ImplGlfw_ScrollCallback(window, xoffset, yoffset);
 	}
 
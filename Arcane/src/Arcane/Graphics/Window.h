@@ -20,6 +20,11 @@ namespace Arcane
 		* Will swap the screen buffers and will poll all window/input events
 		*/
 		void Update();
+
+		/**
+		* Polls window/input events without swapping, the events get buffered in the application's event queue
+		*/
+		void PollEvents();
 		bool Closed() const;
 		static void ClearAll();
 		static void ClearColour();
@@ -28,6 +33,7 @@ namespace Arcane
 		static void Bind();
 
 		inline GLFWwindow* GetNativeWindow() { return m_Window; }
+		inline double GetLastPresentTime() const { return m_LastPresentTime; }
 		static inline bool GetHideCursor() { return s_HideCursor; }
 		static inline bool GetHideUI() { return s_HideUI; }
 		static inline int GetWidth() { return s_Width; }
@@ -47,6 +53,8 @@ namespace Arcane
 		static friend void window_close_callback(GLFWwindow *window);
 		static friend void window_resize_callback(GLFWwindow *window, int width, int height);
 		static friend void framebuffer_resize_callback(GLFWwindow *window, int width, int height);
+		static friend void window_focus_callback(GLFWwindow *window, int focused);
+		static friend void window_iconify_callback(GLFWwindow *window, int iconified);
 		static friend void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods);
 		static friend void key_callback_imgui(GLFWwindow *window, int key, int scancode, int action, int mods);
 		static friend void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
@@ -61,6 +69,7 @@ namespace Arcane
 		Application *m_Application;
 		const char *m_Title;
 		GLFWwindow *m_Window;
+		double m_LastPresentTime;
 
 		static bool s_HideCursor;
 		static bool s_HideUI;
@@ -115,16 +115,17 @@ namespace Arcane
 
 	void InputManager::CursorPositionCallback(double xpos, double ypos) 
 	{
-		s_MouseXDelta = xpos - s_MouseX;
-		s_MouseYDelta = ypos - s_MouseY;
+		// Accumulate since multiple cursor events can get buffered and processed in the same frame
+		s_MouseXDelta += xpos - s_MouseX;
+		s_MouseYDelta += ypos - s_MouseY;
 		s_MouseX = xpos;
 		s_MouseY = ypos;
 	}
 
 	void InputManager::ScrollCallback(double xoffset, double yoffset) 
 	{
-		s_ScrollXDelta = xoffset;
-		s_ScrollYDelta = yoffset;
+		s_ScrollXDelta += xoffset;
+		s_ScrollYDelta += yoffset;
 	}
 
 	void InputManager::JoystickCallback(int joystick, int event) 
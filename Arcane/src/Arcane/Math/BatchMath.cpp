@@ -0,0 +1,260 @@
+#include "arcpch.h"
+#include "BatchMath.h"
+
+// x64 always has SSE2, on x86 MSVC reports it through _M_IX86_FP
+#if USE_SIMD_MATH && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define ARC_BATCH_MATH_SSE 1
+#include <emmintrin.h>
+#else
+#define ARC_BATCH_MATH_SSE 0
+#endif
+
+namespace Arcane
+{
+#if ARC_BATCH_MATH_SSE
+	static inline __m128 Splat(__m128 v, int lane)
+	{
+		switch (lane)
+		{
+		case 0: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+		case 1: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+		case 2: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+		default: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+		}
+	}
+
+	// out = lhs * rhs, all column major
+	static inline void MultiplyMatrixSSE(const float *lhs, const float *rhs, float *out)
+	{
+		__m128 lhsCol0 = _mm_loadu_ps(lhs + 0);
+		__m128 lhsCol1 = _mm_loadu_ps(lhs + 4);
+		__m128 lhsCol2 = _mm_loadu_ps(lhs + 8);
+		__m128 lhsCol3 = _mm_loadu_ps(lhs + 12);
+
+		for (int col = 0; col < 4; col++)
+		{
+			__m128 rhsCol = _mm_loadu_ps(rhs + col * 4);
+			__m128 result = _mm_mul_ps(lhsCol0, Splat(rhsCol, 0));
+			result = _mm_add_ps(result, _mm_mul_ps(lhsCol1, Splat(rhsCol, 1)));
+			result = _mm_add_ps(result, _mm_mul_ps(lhsCol2, Splat(rhsCol, 2)));
+			result = _mm_add_ps(result, _mm_mul_ps(lhsCol3, Splat(rhsCol, 3)));
+			_mm_storeu_ps(out + col * 4, result);
+		}
+	}
+#endif
+
+	static inline void ComposeTRSScalar(const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale, glm::mat4 &outMatrix)
+	{
+		glm::mat3 rotationMatrix = glm::mat3_cast(rotation);
+		outMatrix[0] = glm::vec4(rotationMatrix[0] * scale.x, 0.0f);
+		outMatrix[1] = glm::vec4(rotationMatrix[1] * scale.y, 0.0f);
+		outMatrix[2] = glm::vec4(rotationMatrix[2] * scale.z, 0.0f);
+		outMatrix[3] = glm::vec4(translation, 1.0f);
+	}
+
+	void BatchMath::ComposeTRS(const glm::vec3 *translations, const glm::quat *rotations, const glm::vec3 *scales, glm::mat4 *outMatrices, size_t count)
+	{
+		size_t i = 0;
+#if ARC_BATCH_MATH_SSE
+		// Work on 4 transforms at a time in SoA form, each register holds the same element for 4 different transforms
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+		for (; i + 4 <= count; i += 4)
+		{
+			const glm::quat *r = rotations + i;
+			const glm::vec3 *s = scales + i;
+			__m128 x = _mm_setr_ps(r[0].x, r[1].x, r[2].x, r[3].x);
+			__m128 y = _mm_setr_ps(r[0].y, r[1].y, r[2].y, r[3].y);
+			__m128 z = _mm_setr_ps(r[0].z, r[1].z, r[2].z, r[3].z);
+			__m128 w = _mm_setr_ps(r[0].w, r[1].w, r[2].w, r[3].w);
+			__m128 scaleX = _mm_setr_ps(s[0].x, s[1].x, s[2].x, s[3].x);
+			__m128 scaleY = _mm_setr_ps(s[0].y, s[1].y, s[2].y, s[3].y);
+			__m128 scaleZ = _mm_setr_ps(s[0].z, s[1].z, s[2].z, s[3].z);
+
+			__m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+			__m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+			__m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+			// Same layout as glm::mat3_cast, mCR = column C row R
+			__m128 m00 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), scaleX);
+			__m128 m01 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), scaleX);
+			__m128 m02 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), scaleX);
+			__m128 m10 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), scaleY);
+			__m128 m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), scaleY);
+			__m128 m12 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), scaleY);
+			__m128 m20 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), scaleZ);
+			__m128 m21 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), scaleZ);
+			__m128 m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), scaleZ);
+			__m128 col0W = _mm_setzero_ps(), col1W = _mm_setzero_ps(), col2W = _mm_setzero_ps();
+
+			// Back to AoS, after the transpose each register is a column for one transform
+			_MM_TRANSPOSE4_PS(m00, m01, m02, col0W);
+			_MM_TRANSPOSE4_PS(m10, m11, m12, col1W);
+			_MM_TRANSPOSE4_PS(m20, m21, m22, col2W);
+			__m128 col0[4] = { m00, m01, m02, col0W };
+			__m128 col1[4] = { m10, m11, m12, col1W };
+			__m128 col2[4] = { m20, m21, m22, col2W };
+
+			for (int lane = 0; lane < 4; lane++)
+			{
+				float *out = &outMatrices[i + lane][0][0];
+				const glm::vec3 &t = translations[i + lane];
+				_mm_storeu_ps(out + 0, col0[lane]);
+				_mm_storeu_ps(out + 4, col1[lane]);
+				_mm_storeu_ps(out + 8, col2[lane]);
+				_mm_storeu_ps(out + 12, _mm_setr_ps(t.x, t.y, t.z, 1.0f));
+			}
+		}
+#endif
+		for (; i < count; i++)
+		{
+			ComposeTRSScalar(translations[i], rotations[i], scales[i], outMatrices[i]);
+		}
+	}
+
+	void BatchMath::MultiplyMatrices(const glm::mat4 *lhs, const glm::mat4 *rhs, glm::mat4 *outMatrices, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+#if ARC_BATCH_MATH_SSE
+			MultiplyMatrixSSE(&lhs[i][0][0], &rhs[i][0][0], &outMatrices[i][0][0]);
+#else
+			outMatrices[i] = lhs[i] * rhs[i];
+#endif
+		}
+	}
+
+	void BatchMath::MultiplyMatrices(const glm::mat4 &lhs, const glm::mat4 *rhs, glm::mat4 *outMatrices, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+#if ARC_BATCH_MATH_SSE
+			MultiplyMatrixSSE(&lhs[0][0], &rhs[i][0][0], &outMatrices[i][0][0]);
+#else
+			outMatrices[i] = lhs * rhs[i];
+#endif
+		}
+	}
+
+	void BatchMath::TransformAABBs(const AABB *aabbs, const glm::mat4 *transforms, AABB *outAABBs, size_t count)
+	{
+#if ARC_BATCH_MATH_SSE
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+#endif
+		for (size_t i = 0; i < count; i++)
+		{
+			const AABB &aabb = aabbs[i];
+#if ARC_BATCH_MATH_SSE
+			const float *m = &transforms[i][0][0];
+			__m128 col0 = _mm_loadu_ps(m + 0);
+			__m128 col1 = _mm_loadu_ps(m + 4);
+			__m128 col2 = _mm_loadu_ps(m + 8);
+			__m128 col3 = _mm_loadu_ps(m + 12);
+
+			__m128 min = _mm_setr_ps(aabb.Min.x, aabb.Min.y, aabb.Min.z, 0.0f);
+			__m128 max = _mm_setr_ps(aabb.Max.x, aabb.Max.y, aabb.Max.z, 0.0f);
+			__m128 center = _mm_mul_ps(_mm_add_ps(min, max), half);
+			__m128 extent = _mm_mul_ps(_mm_sub_ps(max, min), half);
+
+			__m128 newCenter = col3;
+			newCenter = _mm_add_ps(newCenter, _mm_mul_ps(col0, Splat(center, 0)));
+			newCenter = _mm_add_ps(newCenter, _mm_mul_ps(col1, Splat(center, 1)));
+			newCenter = _mm_add_ps(newCenter, _mm_mul_ps(col2, Splat(center, 2)));
+
+			__m128 newExtent = _mm_mul_ps(_mm_andnot_ps(signMask, col0), Splat(extent, 0));
+			newExtent = _mm_add_ps(newExtent, _mm_mul_ps(_mm_andnot_ps(signMask, col1), Splat(extent, 1)));
+			newExtent = _mm_add_ps(newExtent, _mm_mul_ps(_mm_andnot_ps(signMask, col2), Splat(extent, 2)));
+
+			alignas(16) float newMin[4], newMax[4];
+			_mm_store_ps(newMin, _mm_sub_ps(newCenter, newExtent));
+			_mm_store_ps(newMax, _mm_add_ps(newCenter, newExtent));
+			outAABBs[i].Min = glm::vec3(newMin[0], newMin[1], newMin[2]);
+			outAABBs[i].Max = glm::vec3(newMax[0], newMax[1], newMax[2]);
+#else
+			const glm::mat4 &transform = transforms[i];
+			glm::vec3 center = (aabb.Min + aabb.Max) * 0.5f;
+			glm::vec3 extent = (aabb.Max - aabb.Min) * 0.5f;
+
+			glm::vec3 newCenter = glm::vec3(transform * glm::vec4(center, 1.0f));
+			glm::vec3 newExtent = glm::abs(glm::vec3(transform[0])) * extent.x + glm::abs(glm::vec3(transform[1])) * extent.y + glm::abs(glm::vec3(transform[2])) * extent.z;
+			outAABBs[i].Min = newCenter - newExtent;
+			outAABBs[i].Max = newCenter + newExtent;
+#endif
+		}
+	}
+
+	void BatchMath::SlerpQuaternions(const glm::quat *from, const glm::quat *to, const float *t, glm::quat *outQuats, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			const glm::quat &a = from[i];
+			const glm::quat &b = to[i];
+
+			// Take the shortest path, and fall back to a normalized lerp when the quats are nearly parallel to avoid dividing by sin(~0)
+			float cosTheta = glm::dot(a, b);
+			float sign = 1.0f;
+			if (cosTheta < 0.0f)
+			{
+				cosTheta = -cosTheta;
+				sign = -1.0f;
+			}
+
+			float weightA, weightB;
+			if (cosTheta > 1.0f - glm::epsilon<float>())
+			{
+				weightA = 1.0f - t[i];
+				weightB = t[i];
+			}
+			else
+			{
+				float angle = std::acos(cosTheta);
+				float invSinAngle = 1.0f / std::sin(angle);
+				weightA = std::sin((1.0f - t[i]) * angle) * invSinAngle;
+				weightB = std::sin(t[i] * angle) * invSinAngle;
+			}
+			weightB *= sign;
+
+			// Each quat is a single 4 wide register so the blend + normalize is done in SIMD
+#if ARC_BATCH_MATH_SSE
+			__m128 quatA = _mm_setr_ps(a.x, a.y, a.z, a.w);
+			__m128 quatB = _mm_setr_ps(b.x, b.y, b.z, b.w);
+			__m128 result = _mm_add_ps(_mm_mul_ps(quatA, _mm_set1_ps(weightA)), _mm_mul_ps(quatB, _mm_set1_ps(weightB)));
+
+			__m128 lengthSquared = _mm_mul_ps(result, result);
+			lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(2, 3, 0, 1)));
+			lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(1, 0, 3, 2)));
+			result = _mm_div_ps(result, _mm_sqrt_ps(lengthSquared));
+
+			alignas(16) float out[4];
+			_mm_store_ps(out, result);
+			outQuats[i] = glm::quat(out[3], out[0], out[1], out[2]);
+#else
+			outQuats[i] = glm::normalize(a * weightA + b * weightB);
+#endif
+		}
+	}
+
+	void BatchMath::NormalMatrices(const glm::mat4 *modelMatrices, glm::mat3 *outNormalMatrices, size_t count)
+	{
+		// The inverse transpose of a 3x3 is its cofactor matrix divided by the determinant, which is just 3 cross products and is much cheaper than a general inverse
+		for (size_t i = 0; i < count; i++)
+		{
+			glm::vec3 col0 = glm::vec3(modelMatrices[i][0]);
+			glm::vec3 col1 = glm::vec3(modelMatrices[i][1]);
+			glm::vec3 col2 = glm::vec3(modelMatrices[i][2]);
+
+			glm::vec3 cofactor0 = glm::cross(col1, col2);
+			glm::vec3 cofactor1 = glm::cross(col2, col0);
+			glm::vec3 cofactor2 = glm::cross(col0, col1);
+			float invDeterminant = 1.0f / glm::dot(col0, cofactor0);
+
+			outNormalMatrices[i] = glm::mat3(cofactor0 * invDeterminant, cofactor1 * invDeterminant, cofactor2 * invDeterminant);
+		}
+	}
+
+	bool BatchMath::IsSIMDEnabled()
+	{
+		return ARC_BATCH_MATH_SSE != 0;
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#ifndef BATCHMATH_H
+#define BATCHMATH_H
+
+namespace Arcane
+{
+	struct AABB
+	{
+		glm::vec3 Min = glm::vec3(0.0f);
+		glm::vec3 Max = glm::vec3(0.0f);
+	};
+
+	/*
+		Batched versions of the hot transform math. Inputs are plain arrays (the arrays of a component pool/draw queue can be passed straight in) and every
+		function processes count elements. If USE_SIMD_MATH is set and the target supports SSE the work is done 4 lanes at a time, otherwise it falls back to GLM.
+		Results match the scalar GLM versions (up to float rounding) so they can be swapped in freely. Output arrays must not alias the inputs
+	*/
+	class BatchMath
+	{
+	public:
+		// Same result as glm::translate(T) * glm::toMat4(R) * glm::scale(S) for each transform
+		static void ComposeTRS(const glm::vec3 *translations, const glm::quat *rotations, const glm::vec3 *scales, glm::mat4 *outMatrices, size_t count);
+
+		// outMatrices[i] = lhs[i] * rhs[i]
+		static void MultiplyMatrices(const glm::mat4 *lhs, const glm::mat4 *rhs, glm::mat4 *outMatrices, size_t count);
+
+		// outMatrices[i] = lhs * rhs[i], useful for applying a parent/view-projection to a batch of transforms
+		static void MultiplyMatrices(const glm::mat4 &lhs, const glm::mat4 *rhs, glm::mat4 *outMatrices, size_t count);
+
+		// Transforms local space AABBs by their matrices, the result is the tightest AABB that fits the transformed box (Arvo's method)
+		static void TransformAABBs(const AABB *aabbs, const glm::mat4 *transforms, AABB *outAABBs, size_t count);
+
+		// outQuats[i] = glm::slerp(from[i], to[i], t[i]) taking the shortest path
+		static void SlerpQuaternions(const glm::quat *from, const glm::quat *to, const float *t, glm::quat *outQuats, size_t count);
+
+		// Inverse transpose of the upper 3x3 for each model matrix
+		static void NormalMatrices(const glm::mat4 *modelMatrices, glm::mat3 *outNormalMatrices, size_t count);
+
+		static bool IsSIMDEnabled();
+	};
+}
+#endif
@@ -0,0 +1,56 @@
+#include "arcpch.h"
+#include "RadixSort.h"
+
+namespace Arcane
+{
+	void RadixSort::SortIndices(const uint32_t *keys, uint32_t *outIndices, uint32_t *scratchIndices, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			outIndices[i] = static_cast<uint32_t>(i);
+		if (count < 2)
+			return;
+
+		// Build all four histograms in a single pass over the keys
+		uint32_t histograms[4][256] = {};
+		for (size_t i = 0; i < count; i++)
+		{
+			uint32_t key = keys[i];
+			histograms[0][key & 0xFF]++;
+			histograms[1][(key >> 8) & 0xFF]++;
+			histograms[2][(key >> 16) & 0xFF]++;
+			histograms[3][key >> 24]++;
+		}
+
+		uint32_t *source = outIndices;
+		uint32_t *destination = scratchIndices;
+		for (int pass = 0; pass < 4; pass++)
+		{
+			uint32_t *histogram = histograms[pass];
+			unsigned int shift = pass * 8;
+
+			// Every key shares this byte (common for the high bytes of nearby depths), the pass wouldn't change the order
+			if (histogram[(keys[source[0]] >> shift) & 0xFF] == count)
+				continue;
+
+			// Turn the counts into the offset each bucket starts at
+			uint32_t offset = 0;
+			for (int bucket = 0; bucket < 256; bucket++)
+			{
+				uint32_t bucketCount = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; i++)
+			{
+				uint32_t index = source[i];
+				destination[histogram[(keys[index] >> shift) & 0xFF]++] = index;
+			}
+			std::swap(source, destination);
+		}
+
+		// An odd number of passes ran so the result ended up in the scratch array
+		if (source != outIndices)
+			std::memcpy(outIndices, source, count * sizeof(uint32_t));
+	}
+}
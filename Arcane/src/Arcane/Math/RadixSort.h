@@ -0,0 +1,26 @@
+#pragma once
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+namespace Arcane
+{
+	/*
+		LSD radix sort over 32 bit keys, 8 bits per pass. Rather than moving the sorted items around it sorts an array of indices into them, so the keys can be
+		computed once up front and the (possibly large) items never get copied. Stable, so items with equal keys keep their submission order
+	*/
+	class RadixSort
+	{
+	public:
+		// Fills outIndices with 0..count-1 ordered so that keys[outIndices[i]] is ascending. scratchIndices needs room for count indices as well
+		static void SortIndices(const uint32_t *keys, uint32_t *outIndices, uint32_t *scratchIndices, size_t count);
+
+		// Maps a float to a key that sorts in the same order as the float does (negatives included), flip all the bits of the key to sort descending
+		inline static uint32_t FloatToKey(float value)
+		{
+			uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+		}
+	};
+}
+#endif
@@ -0,0 +1,178 @@
+#include "arcpch.h"
+#include "TriangleBVH.h"
+
+namespace Arcane
+{
+	static constexpr uint32_t s_MaxTrianglesPerLeaf = 4;
+
+	static bool RayIntersectsAABB(const AABB &aabb, const glm::vec3 &origin, const glm::vec3 &inverseDirection, float maxDistance)
+	{
+		glm::vec3 t0 = (aabb.Min - origin) * inverseDirection;
+		glm::vec3 t1 = (aabb.Max - origin) * inverseDirection;
+		glm::vec3 tMin = glm::min(t0, t1);
+		glm::vec3 tMax = glm::max(t0, t1);
+		float enter = glm::max(glm::max(tMin.x, tMin.y), glm::max(tMin.z, 0.0f));
+		float exit = glm::min(glm::min(tMax.x, tMax.y), glm::min(tMax.z, maxDistance));
+		return enter <= exit;
+	}
+
+	// Two sided Moller-Trumbore, returns the hit distance along the normalized direction or a negative value on a miss
+	static float RayIntersectsTriangle(const TriangleBVH::Triangle &triangle, const glm::vec3 &origin, const glm::vec3 &direction)
+	{
+		glm::vec3 p = glm::cross(direction, triangle.Edge2);
+		float determinant = glm::dot(triangle.Edge1, p);
+		if (glm::abs(determinant) < 1e-8f)
+			return -1.0f;
+
+		float inverseDeterminant = 1.0f / determinant;
+		glm::vec3 s = origin - triangle.V0;
+		float u = glm::dot(s, p) * inverseDeterminant;
+		if (u < 0.0f || u > 1.0f)
+			return -1.0f;
+
+		glm::vec3 q = glm::cross(s, triangle.Edge1);
+		float v = glm::dot(direction, q) * inverseDeterminant;
+		if (v < 0.0f || u + v > 1.0f)
+			return -1.0f;
+
+		return glm::dot(triangle.Edge2, q) * inverseDeterminant;
+	}
+
+	void TriangleBVH::AddTriangle(const glm::vec3 &v0, const glm::vec3 &v1, const glm::vec3 &v2, uint32_t owner)
+	{
+		m_Triangles.push_back({ v0, v1 - v0, v2 - v0, owner });
+	}
+
+	void TriangleBVH::Build()
+	{
+		m_Nodes.clear();
+		if (m_Triangles.empty())
+			return;
+
+		std::vector<glm::vec3> centroids(m_Triangles.size());
+		for (size_t i = 0; i < m_Triangles.size(); i++)
+		{
+			const Triangle &triangle = m_Triangles[i];
+			centroids[i] = triangle.V0 + (triangle.Edge1 + triangle.Edge2) / 3.0f;
+		}
+
+		m_Nodes.reserve(m_Triangles.size() * 2 / s_MaxTrianglesPerLeaf + 1);
+		m_Nodes.push_back({ AABB(), 0, static_cast<uint32_t>(m_Triangles.size()) });
+		BuildNode(0, centroids);
+	}
+
+	void TriangleBVH::BuildNode(uint32_t nodeIndex, std::vector<glm::vec3> &centroids)
+	{
+		Node &node = m_Nodes[nodeIndex];
+		node.Bounds.Min = glm::vec3(std::numeric_limits<float>::max());
+		node.Bounds.Max = glm::vec3(-std::numeric_limits<float>::max());
+		glm::vec3 centroidMin = node.Bounds.Min, centroidMax = node.Bounds.Max;
+		for (uint32_t i = node.First; i < node.First + node.Count; i++)
+		{
+			const Triangle &triangle = m_Triangles[i];
+			glm::vec3 v1 = triangle.V0 + triangle.Edge1;
+			glm::vec3 v2 = triangle.V0 + triangle.Edge2;
+			node.Bounds.Min = glm::min(node.Bounds.Min, glm::min(triangle.V0, glm::min(v1, v2)));
+			node.Bounds.Max = glm::max(node.Bounds.Max, glm::max(triangle.V0, glm::max(v1, v2)));
+			centroidMin = glm::min(centroidMin, centroids[i]);
+			centroidMax = glm::max(centroidMax, centroids[i]);
+		}
+
+		if (node.Count <= s_MaxTrianglesPerLeaf)
+			return;
+
+		// Median split on the longest axis of the centroid bounds, triangles and centroids are sorted together through an index list
+		glm::vec3 extent = centroidMax - centroidMin;
+		int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+		uint32_t first = node.First, count = node.Count, half = count / 2;
+
+		std::vector<uint32_t> order(count);
+		for (uint32_t i = 0; i < count; i++)
+			order[i] = first + i;
+		std::nth_element(order.begin(), order.begin() + half, order.end(), [&centroids, axis](uint32_t a, uint32_t b) { return centroids[a][axis] < centroids[b][axis]; });
+
+		std::vector<Triangle> sortedTriangles(count);
+		std::vector<glm::vec3> sortedCentroids(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			sortedTriangles[i] = m_Triangles[order[i]];
+			sortedCentroids[i] = centroids[order[i]];
+		}
+		std::copy(sortedTriangles.begin(), sortedTriangles.end(), m_Triangles.begin() + first);
+		std::copy(sortedCentroids.begin(), sortedCentroids.end(), centroids.begin() + first);
+
+		uint32_t leftChild = static_cast<uint32_t>(m_Nodes.size());
+		m_Nodes.push_back({ AABB(), first, half });
+		m_Nodes.push_back({ AABB(), first + half, count - half });
+
+		// Node reference is invalidated by the push_backs
+		m_Nodes[nodeIndex].First = leftChild;
+		m_Nodes[nodeIndex].Count = 0;
+
+		BuildNode(leftChild, centroids);
+		BuildNode(leftChild + 1, centroids);
+	}
+
+	bool TriangleBVH::TraceClosest(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, Hit &outHit) const
+	{
+		return Trace<false>(origin, direction, maxDistance, outHit);
+	}
+
+	bool TriangleBVH::IsOccluded(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance) const
+	{
+		Hit hit;
+		return Trace<true>(origin, direction, maxDistance, hit);
+	}
+
+	template<bool AnyHit>
+	bool TriangleBVH::Trace(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, Hit &outHit) const
+	{
+		if (m_Nodes.empty())
+			return false;
+
+		glm::vec3 inverseDirection = 1.0f / direction;
+		float closestDistance = maxDistance;
+		uint32_t closestTriangle = InvalidIndex;
+
+		uint32_t stack[64];
+		int stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			const Node &node = m_Nodes[stack[--stackSize]];
+			if (!RayIntersectsAABB(node.Bounds, origin, inverseDirection, closestDistance))
+				continue;
+
+			if (node.Count > 0)
+			{
+				for (uint32_t i = node.First; i < node.First + node.Count; i++)
+				{
+					float distance = RayIntersectsTriangle(m_Triangles[i], origin, direction);
+					if (distance > 0.0f && distance < closestDistance)
+					{
+						closestDistance = distance;
+						closestTriangle = i;
+						if (AnyHit)
+						{
+							outHit.Distance = closestDistance;
+							outHit.TriangleIndex = closestTriangle;
+							return true;
+						}
+					}
+				}
+			}
+			else
+			{
+				stack[stackSize++] = node.First;
+				stack[stackSize++] = node.First + 1;
+			}
+		}
+
+		if (closestTriangle == InvalidIndex)
+			return false;
+
+		outHit.Distance = closestDistance;
+		outHit.TriangleIndex = closestTriangle;
+		return true;
+	}
+}
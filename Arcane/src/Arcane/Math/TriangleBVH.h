@@ -0,0 +1,61 @@
+#pragma once
+#ifndef TRIANGLEBVH_H
+#define TRIANGLEBVH_H
+
+#ifndef BATCHMATH_H
+#include <Arcane/Math/BatchMath.h>
+#endif
+
+namespace Arcane
+{
+	/*
+		Static bounding volume hierarchy over world space triangles for the offline CPU tools (PVS and lightmap bakers). Built once with a median split on
+		the longest axis, queries are read only so any amount of threads can trace against it at the same time
+	*/
+	class TriangleBVH
+	{
+	public:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+		struct Triangle
+		{
+			glm::vec3 V0, Edge1, Edge2;
+			uint32_t Owner; // User data, ie: the index of the entity the triangle belongs to
+		};
+
+		struct Hit
+		{
+			float Distance = 0.0f;
+			uint32_t TriangleIndex = InvalidIndex; // Index into GetTriangles()
+		};
+
+		TriangleBVH() = default;
+
+		void AddTriangle(const glm::vec3 &v0, const glm::vec3 &v1, const glm::vec3 &v2, uint32_t owner);
+		void Build(); // Must be called after all triangles are added and before tracing, reorders the triangles
+
+		// Closest two sided hit along the normalized direction within maxDistance
+		bool TraceClosest(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, Hit &outHit) const;
+		// Any hit, cheaper than TraceClosest since it can stop at the first intersection
+		bool IsOccluded(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance) const;
+
+		inline const std::vector<Triangle>& GetTriangles() const { return m_Triangles; }
+		inline bool IsEmpty() const { return m_Triangles.empty(); }
+	private:
+		// Leaves have a non zero count of triangles starting at First, interior nodes store their two children at First and First + 1
+		struct Node
+		{
+			AABB Bounds;
+			uint32_t First;
+			uint32_t Count;
+		};
+
+		void BuildNode(uint32_t nodeIndex, std::vector<glm::vec3> &centroids);
+		template<bool AnyHit>
+		bool Trace(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, Hit &outHit) const;
+	private:
+		std::vector<Triangle> m_Triangles;
+		std::vector<Node> m_Nodes;
+	};
+}
+#endif
@@ -3,22 +3,21 @@
 
 namespace Arcane
 {
-	Buffer::Buffer() : m_ComponentCount(0)
+	Buffer::Buffer() : m_ComponentCount(0), m_Size(0)
 	{
-		glGenBuffers(1, &m_BufferID);
+		glCreateBuffers(1, &m_BufferID);
 	}
 
 	// Can be used to allocate a big buffer then you can use SetData to vary its size
-	Buffer::Buffer(uint32_t size)
+	Buffer::Buffer(uint32_t size) : m_ComponentCount(0), m_Size(size)
 	{
-		glGenBuffers(1, &m_BufferID);
-		Bind();
-		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW); // Dynamic since this will change size and what were drawing
+		glCreateBuffers(1, &m_BufferID);
+		glNamedBufferStorage(m_BufferID, size, nullptr, GL_DYNAMIC_STORAGE_BIT); // Dynamic storage since the contents get replaced with SetData
 	}
 
-	Buffer::Buffer(float *data, int amount, unsigned int componentCount)
+	Buffer::Buffer(float *data, int amount, unsigned int componentCount) : m_ComponentCount(0), m_Size(0)
 	{
-		glGenBuffers(1, &m_BufferID);
+		glCreateBuffers(1, &m_BufferID);
 		Load(data, amount, componentCount);
 	}
 
@@ -29,16 +28,18 @@ namespace Arcane
 
 	void Buffer::SetData(const void *data, uint32_t size)
 	{
-		Bind();
-		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+		ARC_ASSERT(size <= m_Size, "Buffer's storage is too small for the data being set");
+		glNamedBufferSubData(m_BufferID, 0, size, data);
 	}
 
 	void Buffer::Load(float *data, int amount, unsigned int componentCount)
 	{
+		ARC_ASSERT(m_Size == 0, "Buffer storage is immutable so a buffer can only be loaded once");
 		m_ComponentCount = componentCount;
+		m_Size = static_cast<uint32_t>(amount * sizeof(float));
 
-		Bind();
-		glBufferData(GL_ARRAY_BUFFER, amount * sizeof(float), data, GL_STATIC_DRAW);
+		// No flags since static data is never updated from the CPU
+		glNamedBufferStorage(m_BufferID, m_Size, data, 0);
 	}
 
 	void Buffer::Bind() const
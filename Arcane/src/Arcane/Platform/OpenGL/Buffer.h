@@ -21,9 +21,11 @@ namespace Arcane
 
 		inline void SetComponentCount(unsigned int count) { m_ComponentCount = count; }
 		inline unsigned int GetComponentCount() const { return m_ComponentCount; }
+		inline unsigned int GetBufferId() const { return m_BufferID; }
 	private:
 		unsigned int m_BufferID;
 		unsigned int m_ComponentCount;
+		uint32_t m_Size; // Storage is immutable, so this is fixed once allocated
 	};
 }
 #endif
@@ -3,10 +3,21 @@
 
 namespace Arcane
 {
+	// Cubemap faces are layers of the cubemap's storage, everything else is attached whole
+	static void AttachTexture(unsigned int fbo, GLenum attachmentType, unsigned int target, unsigned int targetType, int mip)
+	{
+		if (targetType >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && targetType <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z) {
+			glNamedFramebufferTextureLayer(fbo, attachmentType, target, mip, targetType - GL_TEXTURE_CUBE_MAP_POSITIVE_X);
+		}
+		else {
+			glNamedFramebufferTexture(fbo, attachmentType, target, mip);
+		}
+	}
+
 	Framebuffer::Framebuffer(unsigned int width, unsigned int height, bool isMultisampled)
-		: m_FBO(0), m_Width(width), m_Height(height), m_IsMultisampled(isMultisampled), m_ColourTexture(), m_DepthStencilTexture(), m_DepthStencilRBO(0)
+		: m_FBO(0), m_Width(width), m_Height(height), m_IsMultisampled(isMultisampled), m_ColourTexture(), m_DepthStencilTexture(), m_SharedDepthStencilTexture(nullptr), m_SharedDepthStencilTextureId(0), m_DepthStencilRBO(0), m_DepthStencilRBOFormat(GL_NONE)
 	{
-		glGenFramebuffers(1, &m_FBO);
+		glCreateFramebuffers(1, &m_FBO);
 	}
 
 	Framebuffer::~Framebuffer() {
@@ -16,19 +27,17 @@ namespace Arcane
 	}
 
 	void Framebuffer::CreateFramebuffer() {
-		Bind();
 		if (!m_ColourTexture.IsGenerated()) {
 			// Indicate that there won't be a colour buffer for this FBO
-			glDrawBuffer(GL_NONE);
-			glReadBuffer(GL_NONE);
+			glNamedFramebufferDrawBuffer(m_FBO, GL_NONE);
+			glNamedFramebufferReadBuffer(m_FBO, GL_NONE);
 		}
 
 		// Check if the creation failed
-		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		if (glCheckNamedFramebufferStatus(m_FBO, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
 			ARC_LOG_FATAL("Could not initialize the framebuffer");
 			return;
 		}
-		Unbind();
 	}
 
 	Framebuffer& Framebuffer::AddColorTexture(ColorAttachmentFormat textureFormat) {
@@ -40,8 +49,6 @@ namespace Arcane
 #endif // ARC_DEV_BUILD
 		ARC_ASSERT(m_Width > 0 && m_Height > 0, "Framebuffer width and height need to be > 0 to generate color texture");
 
-		Bind();
-
 		TextureSettings colourTextureSettings;
 		colourTextureSettings.TextureFormat = textureFormat;
 		colourTextureSettings.TextureWrapSMode = GL_CLAMP_TO_EDGE;
@@ -62,7 +69,6 @@ namespace Arcane
 			SetColorAttachment(m_ColourTexture.GetTextureId(), GL_TEXTURE_2D);
 		}
 
-		Unbind();
 		return *this;
 	}
 
@@ -80,8 +86,6 @@ namespace Arcane
 			attachmentType = GL_DEPTH_ATTACHMENT;
 		}
 
-		Bind();
-
 		TextureSettings depthStencilSettings;
 		depthStencilSettings.TextureFormat = textureFormat;
 		depthStencilSettings.TextureWrapSMode = GL_CLAMP_TO_BORDER;
@@ -105,17 +109,30 @@ namespace Arcane
 		// Generate depth attachment
 		if (m_IsMultisampled) {
 			m_DepthStencilTexture.Generate2DMultisampleTexture(m_Width, m_Height);
-			glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentType, GL_TEXTURE_2D_MULTISAMPLE, m_DepthStencilTexture.GetTextureId(), 0);
 		}
 		else {
 			m_DepthStencilTexture.Generate2DTexture(m_Width, m_Height, GL_DEPTH_COMPONENT);
-			glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentType, GL_TEXTURE_2D, m_DepthStencilTexture.GetTextureId(), 0);
 		}
+		glNamedFramebufferTexture(m_FBO, attachmentType, m_DepthStencilTexture.GetTextureId(), 0);
 
-		Unbind();
 		return *this;
 	}
 
+	void Framebuffer::ShareDepthStencilTexture(Framebuffer *source) {
+		ARC_ASSERT(source->GetWidth() == m_Width && source->GetHeight() == m_Height && source->IsMultisampled() == m_IsMultisampled, "Framebuffer has to match the framebuffer it shares depth/stencil with");
+		ARC_ASSERT(!m_DepthStencilTexture.IsGenerated() && m_DepthStencilRBO == 0, "Framebuffer already owns a depth/stencil attachment");
+
+		Texture *sourceTexture = source->GetDepthStencilTexture();
+		if (sourceTexture == m_SharedDepthStencilTexture && sourceTexture->GetTextureId() == m_SharedDepthStencilTextureId)
+			return;
+
+		GLenum format = sourceTexture->GetTextureSettings().TextureFormat;
+		GLenum attachmentType = (format == GL_DEPTH_COMPONENT24 || format == GL_DEPTH_COMPONENT) ? GL_DEPTH_ATTACHMENT : GL_DEPTH_STENCIL_ATTACHMENT;
+		glNamedFramebufferTexture(m_FBO, attachmentType, sourceTexture->GetTextureId(), 0);
+		m_SharedDepthStencilTexture = sourceTexture;
+		m_SharedDepthStencilTextureId = sourceTexture->GetTextureId();
+	}
+
 	Framebuffer& Framebuffer::AddDepthStencilRBO(DepthStencilAttachmentFormat textureFormat) {
 #ifdef ARC_DEV_BUILD
 		if (m_DepthStencilRBO != 0) {
@@ -125,33 +142,77 @@ namespace Arcane
 #endif // ARC_DEV_BUILD
 		ARC_ASSERT(m_Width > 0 && m_Height > 0, "Framebuffer width and height need to be > 0 to generate depth/stencil attachment");
 
-		Bind();
-
 		GLenum attachmentType = GL_DEPTH_STENCIL_ATTACHMENT;
 		if (textureFormat == NormalizedDepthOnly) {
 			attachmentType = GL_DEPTH_ATTACHMENT;
 		}
 
 		// Generate depth+stencil RBO attachment
-		glGenRenderbuffers(1, &m_DepthStencilRBO);
-		glBindRenderbuffer(GL_RENDERBUFFER, m_DepthStencilRBO);
+		m_DepthStencilRBOFormat = textureFormat;
+		glCreateRenderbuffers(1, &m_DepthStencilRBO);
 
 		if (m_IsMultisampled) {
-			glRenderbufferStorageMultisample(GL_RENDERBUFFER, MSAA_SAMPLE_AMOUNT, textureFormat, m_Width, m_Height);
+			glNamedRenderbufferStorageMultisample(m_DepthStencilRBO, MSAA_SAMPLE_AMOUNT, Texture::GetSizedFormat(textureFormat), m_Width, m_Height);
 		}
 		else {
-			glRenderbufferStorage(GL_RENDERBUFFER, textureFormat, m_Width, m_Height);
+			glNamedRenderbufferStorage(m_DepthStencilRBO, Texture::GetSizedFormat(textureFormat), m_Width, m_Height);
 		}
 
 		// Attach depth+stencil attachment
-		glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachmentType, GL_RENDERBUFFER, m_DepthStencilRBO);
+		glNamedFramebufferRenderbuffer(m_FBO, attachmentType, GL_RENDERBUFFER, m_DepthStencilRBO);
 
-		Unbind();
 		return *this;
 	}
 
+	void Framebuffer::ReleaseAttachments() {
+		glDeleteRenderbuffers(1, &m_DepthStencilRBO);
+		m_DepthStencilRBO = 0;
+		m_ColourTexture.Release();
+		m_DepthStencilTexture.Release();
+		m_SharedDepthStencilTexture = nullptr;
+		m_SharedDepthStencilTextureId = 0;
+
+		// Deleted attachments keep their storage alive while they are still attached to a framebuffer that isn't bound, so start over with a fresh FBO
+		glDeleteFramebuffers(1, &m_FBO);
+		glCreateFramebuffers(1, &m_FBO);
+	}
+
+	size_t Framebuffer::GetGpuMemorySize() const {
+		size_t pixelSize = 0;
+		if (m_ColourTexture.IsGenerated())
+			pixelSize += GetFormatPixelSize(m_ColourTexture.GetTextureSettings().TextureFormat);
+		if (m_DepthStencilTexture.IsGenerated())
+			pixelSize += GetFormatPixelSize(m_DepthStencilTexture.GetTextureSettings().TextureFormat);
+		if (m_DepthStencilRBO != 0)
+			pixelSize += GetFormatPixelSize(m_DepthStencilRBOFormat);
+
+		size_t sampleCount = m_IsMultisampled ? MSAA_SAMPLE_AMOUNT : 1;
+		return static_cast<size_t>(m_Width) * m_Height * pixelSize * sampleCount;
+	}
+
+	size_t Framebuffer::GetFormatPixelSize(GLenum format) {
+		switch (format) {
+		case GL_RED: case GL_R8:
+			return 1;
+		case GL_RGBA16: case GL_RGBA16F:
+			return 8;
+		case GL_RGB16F:
+			return 6;
+		case GL_RGB8: case GL_SRGB8:
+			return 3;
+		case GL_RGB32F:
+			return 12;
+		case GL_RGBA32F:
+			return 16;
+		case GL_DEPTH32F_STENCIL8:
+			return 8; // Drivers pad the stencil out
+		default: // GL_RGBA8, GL_DEPTH_COMPONENT24 (padded on most drivers) & GL_DEPTH24_STENCIL8
+			return 4;
+		}
+	}
+
 	void Framebuffer::SetColorAttachment(unsigned int target, unsigned int targetType, int mipToWriteTo) {
-		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, targetType, target, mipToWriteTo);
+		AttachTexture(m_FBO, GL_COLOR_ATTACHMENT0, target, targetType, mipToWriteTo);
 	}
 
 	void Framebuffer::SetDepthAttachment(DepthStencilAttachmentFormat textureFormat, unsigned int target, unsigned int targetType) {
@@ -161,7 +222,7 @@ namespace Arcane
 			attachmentType = GL_DEPTH_ATTACHMENT;
 		}
 
-		glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentType, targetType, target, 0);
+		AttachTexture(m_FBO, attachmentType, target, targetType, 0);
 	}
 
 	void Framebuffer::Bind() {
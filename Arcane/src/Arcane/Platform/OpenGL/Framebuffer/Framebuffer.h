@@ -25,7 +25,8 @@ namespace Arcane
 	enum StencilValue : int
 	{
 		ModelStencilValue = 0x01,
-		TerrainStencilValue = 0x02
+		TerrainStencilValue = 0x02,
+		LightmappedModelStencilValue = 0x03 // Static lights are baked into the lightmap, the lighting pass only applies dynamic lights
 	};
 
 	class Framebuffer
@@ -39,11 +40,13 @@ namespace Arcane
 		Framebuffer& AddColorTexture(ColorAttachmentFormat textureFormat);
 		Framebuffer& AddDepthStencilTexture(DepthStencilAttachmentFormat textureFormat, bool bilinearFiltering = false); // bilinearFiltering should be false for GBuffer but shadowmaps can set this to true to get some free bilinear sampling
 		Framebuffer& AddDepthStencilRBO(DepthStencilAttachmentFormat rboFormat);
+		void ShareDepthStencilTexture(Framebuffer *source); // Attaches the source's depth/stencil texture instead of owning one, it stays owned (and sized) by the source
+		void ReleaseAttachments(); // Frees every attachment, they can be added again afterwards
 
 		void Bind();
 		void Unbind();
 
-		// Assumes framebuffer is bound
+		// Attachments don't need the framebuffer bound, clearing does
 		void SetColorAttachment(unsigned int target, unsigned int targetType, int mipToWriteTo = 0);
 		void SetDepthAttachment(DepthStencilAttachmentFormat textureFormat, unsigned int target, unsigned int targetType);
 		void ClearAll();
@@ -61,8 +64,15 @@ namespace Arcane
 
 		inline Texture* GetColourTexture() { return &m_ColourTexture; }
 
-		inline Texture* GetDepthStencilTexture() { return &m_DepthStencilTexture; }
+		inline Texture* GetDepthStencilTexture() { return m_SharedDepthStencilTexture ? m_SharedDepthStencilTexture : &m_DepthStencilTexture; }
+		inline bool IsDepthStencilShared() const { return m_SharedDepthStencilTexture != nullptr; }
 		inline unsigned int GetDepthStencilRBO() { return m_DepthStencilRBO; }
+		inline GLenum GetDepthStencilRBOFormat() const { return m_DepthStencilRBOFormat; }
+
+		inline bool HasAttachments() const { return m_ColourTexture.IsGenerated() || m_DepthStencilTexture.IsGenerated() || m_DepthStencilRBO != 0; }
+		size_t GetGpuMemorySize() const; // Estimate of the VRAM used by the attachments
+
+		static size_t GetFormatPixelSize(GLenum format);
 	protected:
 		unsigned int m_FBO;
 
@@ -72,7 +82,10 @@ namespace Arcane
 		// Render Targets (Attachments)
 		Texture m_ColourTexture;
 		Texture m_DepthStencilTexture;
+		Texture *m_SharedDepthStencilTexture;
+		unsigned int m_SharedDepthStencilTextureId; // What is actually attached, the source's texture can be regenerated behind the same pointer
 		unsigned int m_DepthStencilRBO;
+		GLenum m_DepthStencilRBOFormat;
 	};
 }
 #endif
@@ -3,18 +3,30 @@
 
 namespace Arcane
 {
-	GBuffer::GBuffer(unsigned int width, unsigned int height) : Framebuffer(width, height, false)
+	GBuffer::GBuffer(unsigned int width, unsigned int height, bool createTargets) : Framebuffer(width, height, false)
 	{
-		Init();
+		if (createTargets)
+			CreateTargets();
 	}
 
 	GBuffer::~GBuffer() {}
 
-	void GBuffer::Init()
+	void GBuffer::ReleaseTargets()
 	{
-		AddDepthStencilTexture(NormalizedDepthStencil);
+		for (Texture &renderTarget : m_GBufferRenderTargets)
+			renderTarget.Release();
+		ReleaseAttachments();
+	}
 
-		Bind();
+	size_t GBuffer::GetTargetsMemorySize() const
+	{
+		size_t pixelSize = GetFormatPixelSize(GL_RGBA8) + GetFormatPixelSize(GL_RGB32F) + GetFormatPixelSize(GL_RGBA8) + GetFormatPixelSize(NormalizedDepthStencil);
+		return static_cast<size_t>(m_Width) * m_Height * pixelSize;
+	}
+
+	void GBuffer::CreateTargets()
+	{
+		AddDepthStencilTexture(NormalizedDepthStencil);
 
 		// Render Target 1
 		{
@@ -28,7 +40,7 @@ namespace Arcane
 			renderTarget1.HasMips = false;
 			m_GBufferRenderTargets[0].SetTextureSettings(renderTarget1);
 			m_GBufferRenderTargets[0].Generate2DTexture(m_Width, m_Height, GL_RGB);
-			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_GBufferRenderTargets[0].GetTextureId(), 0);
+			glNamedFramebufferTexture(m_FBO, GL_COLOR_ATTACHMENT0, m_GBufferRenderTargets[0].GetTextureId(), 0);
 		}
 
 		// Render Target 2
@@ -43,7 +55,7 @@ namespace Arcane
 			renderTarget2.HasMips = false;
 			m_GBufferRenderTargets[1].SetTextureSettings(renderTarget2);
 			m_GBufferRenderTargets[1].Generate2DTexture(m_Width, m_Height, GL_RGB);
-			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, m_GBufferRenderTargets[1].GetTextureId(), 0);
+			glNamedFramebufferTexture(m_FBO, GL_COLOR_ATTACHMENT1, m_GBufferRenderTargets[1].GetTextureId(), 0);
 		}
 
 		// Render Target 3
@@ -58,19 +70,18 @@ namespace Arcane
 			renderTarget3.HasMips = false;
 			m_GBufferRenderTargets[2].SetTextureSettings(renderTarget3);
 			m_GBufferRenderTargets[2].Generate2DTexture(m_Width, m_Height, GL_RGB);
-			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT2, GL_TEXTURE_2D, m_GBufferRenderTargets[2].GetTextureId(), 0);
+			glNamedFramebufferTexture(m_FBO, GL_COLOR_ATTACHMENT2, m_GBufferRenderTargets[2].GetTextureId(), 0);
 		}
 
 		// Finally tell OpenGL that we will be rendering to all of the attachments
 		unsigned int attachments[3] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2 };
-		glDrawBuffers(3, attachments);
+		glNamedFramebufferDrawBuffers(m_FBO, 3, attachments);
 
 		// Check if the creation failed
-		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		if (glCheckNamedFramebufferStatus(m_FBO, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 		{
 			ARC_LOG_FATAL("Could not initialize GBuffer");
 			return;
 		}
-		Unbind();
 	}
 }
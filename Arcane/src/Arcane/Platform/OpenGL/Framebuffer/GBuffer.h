@@ -6,19 +6,25 @@
 #include <Arcane/Platform/OpenGL/Framebuffer/Framebuffer.h>
 #endif
 
+#ifndef LAZYRENDERTARGETS_H
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
+#endif
+
 namespace Arcane
 {
-	class GBuffer : public Framebuffer
+	class GBuffer : public Framebuffer, public ILazyRenderTarget
 	{
 	public:
-		GBuffer(unsigned int width, unsigned int height);
+		GBuffer(unsigned int width, unsigned int height, bool createTargets = true);
 		~GBuffer();
 
+		virtual void CreateTargets() override; // Only needed when the targets weren't created on construction or have been released
+		virtual void ReleaseTargets() override;
+		virtual size_t GetTargetsMemorySize() const override;
+
 		inline Texture* GetAlbedo() { return &m_GBufferRenderTargets[0]; }
 		inline Texture* GetNormal() { return &m_GBufferRenderTargets[1]; }
 		inline Texture* GetMaterialInfo() { return &m_GBufferRenderTargets[2]; }
-	private:
-		void Init();
 	private:
 		// 0 RGBA8  ->       albedo.r     albedo.g        albedo.b             albedo's alpha       (can replaced with emission colour for emissive fragments)
 		// 1 RGB32F ->       normal.x     normal.y        normal.z
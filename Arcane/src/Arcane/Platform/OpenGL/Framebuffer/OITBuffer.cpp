@@ -0,0 +1,88 @@
+#include "arcpch.h"
+#include "OITBuffer.h"
+
+namespace Arcane
+{
+	OITBuffer::OITBuffer(unsigned int width, unsigned int height, bool isMultisampled, bool createTargets) : Framebuffer(width, height, isMultisampled)
+	{
+		if (createTargets)
+			CreateTargets();
+	}
+
+	OITBuffer::~OITBuffer() {}
+
+	void OITBuffer::ReleaseTargets()
+	{
+		m_RevealageTexture.Release();
+		ReleaseAttachments();
+	}
+
+	size_t OITBuffer::GetTargetsMemorySize() const
+	{
+		size_t pixelSize = GetFormatPixelSize(FloatingPoint16) + 2; // R16F revealage
+		size_t sampleCount = m_IsMultisampled ? MSAA_SAMPLE_AMOUNT : 1;
+		return static_cast<size_t>(m_Width) * m_Height * pixelSize * sampleCount;
+	}
+
+	void OITBuffer::CreateTargets()
+	{
+		// Accumulation, the weights get large so it needs to be floating point
+		AddColorTexture(FloatingPoint16);
+
+		// Revealage
+		{
+			TextureSettings revealageSettings;
+			revealageSettings.TextureFormat = GL_R16F;
+			revealageSettings.TextureWrapSMode = GL_CLAMP_TO_EDGE;
+			revealageSettings.TextureWrapTMode = GL_CLAMP_TO_EDGE;
+			revealageSettings.TextureMinificationFilterMode = GL_NEAREST;
+			revealageSettings.TextureMagnificationFilterMode = GL_NEAREST;
+			revealageSettings.TextureAnisotropyLevel = 1.0f;
+			revealageSettings.HasMips = false;
+			m_RevealageTexture.SetTextureSettings(revealageSettings);
+			if (m_IsMultisampled) {
+				m_RevealageTexture.Generate2DMultisampleTexture(m_Width, m_Height);
+			}
+			else {
+				m_RevealageTexture.Generate2DTexture(m_Width, m_Height, GL_RED, GL_FLOAT);
+			}
+			glNamedFramebufferTexture(m_FBO, GL_COLOR_ATTACHMENT1, m_RevealageTexture.GetTextureId(), 0);
+		}
+
+		unsigned int attachments[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+		glNamedFramebufferDrawBuffers(m_FBO, 2, attachments);
+
+		// Check if the creation failed
+		if (glCheckNamedFramebufferStatus(m_FBO, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			ARC_LOG_FATAL("Could not initialize OIT buffer");
+			return;
+		}
+	}
+
+	void OITBuffer::AttachDepthStencil(Framebuffer *source)
+	{
+		ARC_ASSERT(source->GetWidth() == m_Width && source->GetHeight() == m_Height && source->IsMultisampled() == m_IsMultisampled, "OIT buffer has to match the framebuffer it shares depth with");
+
+		// Only the attachment changes, so this is cheap enough to do every frame
+		Texture *depthTexture = source->GetDepthStencilTexture();
+		if (depthTexture->IsGenerated()) {
+			GLenum format = depthTexture->GetTextureSettings().TextureFormat;
+			GLenum attachmentType = (format == GL_DEPTH_COMPONENT24 || format == GL_DEPTH_COMPONENT) ? GL_DEPTH_ATTACHMENT : GL_DEPTH_STENCIL_ATTACHMENT;
+			glNamedFramebufferTexture(m_FBO, attachmentType, depthTexture->GetTextureId(), 0);
+		}
+		else {
+			GLenum format = source->GetDepthStencilRBOFormat();
+			GLenum attachmentType = (format == GL_DEPTH_COMPONENT24 || format == GL_DEPTH_COMPONENT) ? GL_DEPTH_ATTACHMENT : GL_DEPTH_STENCIL_ATTACHMENT;
+			glNamedFramebufferRenderbuffer(m_FBO, attachmentType, GL_RENDERBUFFER, source->GetDepthStencilRBO());
+		}
+	}
+
+	void OITBuffer::ClearTargets()
+	{
+		const float accumulationClear[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		const float revealageClear[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		glClearNamedFramebufferfv(m_FBO, GL_COLOR, 0, accumulationClear);
+		glClearNamedFramebufferfv(m_FBO, GL_COLOR, 1, revealageClear);
+	}
+}
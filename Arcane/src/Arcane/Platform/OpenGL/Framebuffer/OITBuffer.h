@@ -0,0 +1,41 @@
+#pragma once
+#ifndef OITBUFFER_H
+#define OITBUFFER_H
+
+#ifndef FRAMEBUFFER_H
+#include <Arcane/Platform/OpenGL/Framebuffer/Framebuffer.h>
+#endif
+
+#ifndef LAZYRENDERTARGETS_H
+#include <Arcane/Graphics/Renderer/LazyRenderTargets.h>
+#endif
+
+namespace Arcane
+{
+	/*
+		Targets for weighted blended order independent transparency. Transparent fragments add their weighted premultiplied colour into the accumulation
+		target and multiply their coverage into the revealage target, neither depends on draw order. Depth is shared with the framebuffer the transparents
+		are composited onto so they are still occluded by opaque geometry
+	*/
+	class OITBuffer : public Framebuffer, public ILazyRenderTarget
+	{
+	public:
+		OITBuffer(unsigned int width, unsigned int height, bool isMultisampled, bool createTargets = true);
+		~OITBuffer();
+
+		virtual void CreateTargets() override; // Only needed when the targets weren't created on construction or have been released
+		virtual void ReleaseTargets() override;
+		virtual size_t GetTargetsMemorySize() const override;
+
+		void AttachDepthStencil(Framebuffer *source); // Source needs the same size and sample count
+		void ClearTargets(); // Accumulation to 0 and revealage to 1
+
+		inline Texture* GetAccumulation() { return &m_ColourTexture; }
+		inline Texture* GetRevealage() { return &m_RevealageTexture; }
+	private:
+		// Colour texture  RGBA16F ->  sum of weighted premultiplied colour (rgb) and weighted alpha (a)
+		// Revealage       R16F    ->  product of (1 - alpha), how much of the background is still visible
+		Texture m_RevealageTexture;
+	};
+}
+#endif
@@ -3,14 +3,14 @@
 
 namespace Arcane
 {
-	IndexBuffer::IndexBuffer()
+	IndexBuffer::IndexBuffer() : m_Count(0)
 	{
-		glGenBuffers(1, &m_BufferID);
+		glCreateBuffers(1, &m_BufferID);
 	}
 
-	IndexBuffer::IndexBuffer(unsigned int *data, int amount)
+	IndexBuffer::IndexBuffer(unsigned int *data, int amount) : m_Count(0)
 	{
-		glGenBuffers(1, &m_BufferID);
+		glCreateBuffers(1, &m_BufferID);
 		Load(data, amount);
 	}
 
@@ -21,10 +21,10 @@ namespace Arcane
 
 	void IndexBuffer::Load(unsigned int *data, int amount)
 	{
+		ARC_ASSERT(m_Count == 0, "Index buffer storage is immutable so it can only be loaded once");
 		m_Count = amount;
 
-		Bind();
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, amount * sizeof(unsigned int), data, GL_STATIC_DRAW);
+		glNamedBufferStorage(m_BufferID, amount * sizeof(unsigned int), data, 0);
 	}
 
 	void IndexBuffer::Bind() const
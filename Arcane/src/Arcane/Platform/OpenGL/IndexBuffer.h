@@ -17,6 +17,7 @@ namespace Arcane
 		void Unbind() const;
 
 		inline int GetCount() const { return m_Count; }
+		inline unsigned int GetBufferId() const { return m_BufferID; }
 	private:
 		unsigned int m_BufferID;
 		int m_Count;
@@ -7,7 +7,7 @@ namespace Arcane
 {
 	VertexArray::VertexArray()
 	{
-		glGenVertexArrays(1, &m_VertexArrayID);
+		glCreateVertexArrays(1, &m_VertexArrayID);
 	}
 
 	VertexArray::~VertexArray()
@@ -22,14 +22,12 @@ namespace Arcane
 
 	void VertexArray::AddBuffer(Buffer *buffer, int index, size_t stride /* = 0*/, size_t offset /*= 0*/)
 	{
-		Bind();
-
-		buffer->Bind();
-		glEnableVertexAttribArray(index);
-		glVertexAttribPointer(index, buffer->GetComponentCount(), GL_FLOAT, GL_FALSE, static_cast<GLsizei>(stride), (void*)offset);
-		buffer->Unbind();
-
-		Unbind();
+		// Each attribute gets the binding point of the same index. Unlike glVertexAttribPointer a stride of 0 isn't tightly packed here, so work it out
+		GLsizei bindingStride = stride != 0 ? static_cast<GLsizei>(stride) : static_cast<GLsizei>(buffer->GetComponentCount() * sizeof(float));
+		glEnableVertexArrayAttrib(m_VertexArrayID, index);
+		glVertexArrayVertexBuffer(m_VertexArrayID, index, buffer->GetBufferId(), static_cast<GLintptr>(offset), bindingStride);
+		glVertexArrayAttribFormat(m_VertexArrayID, index, buffer->GetComponentCount(), GL_FLOAT, GL_FALSE, 0);
+		glVertexArrayAttribBinding(m_VertexArrayID, index, index);
 	}
 
 	void VertexArray::Bind() const
@@ -26,6 +26,7 @@ namespace Arcane
 {
 	class ICamera;
 	class Model;
+	class Impostor;
 
 	struct TagComponent
 	{
@@ -91,6 +92,17 @@ namespace Arcane
 		bool IsTransparent = false; // Should be true if the model contains any translucent material
 		bool IsStatic = false;		// Should be true if the model will never have its transform modified
 		bool ShouldBackfaceCull = true; // Should be true for majority of models, unless a model isn't double sided
+
+		uint32_t PVSIndex = 0xFFFFFFFF; // Bit of this entity in the scene's baked PVS, assigned by Scene::SetPVS and should not be modified by the user
+		uint32_t LightmapIndex = 0xFFFFFFFF; // Region of this entity in the scene's lightmap, assigned by Scene::SetLightmap and should not be modified by the user
+	};
+
+	// Swaps the entity's MeshComponent model with a baked octahedral impostor once it gets small enough on screen. Used by the deferred renderer and the shadow passes
+	struct ImpostorComponent
+	{
+		Impostor *AssetImpostor = nullptr;
+		float ScreenSizeThreshold = IMPOSTOR_SCREEN_SIZE_THRESHOLD_DEFAULT;
+		bool Enabled = true;
 	};
 
 	struct LightComponent
@@ -153,6 +165,30 @@ namespace Arcane
 		Texture *WaterNormalMap = nullptr;
 	};
 
+	// Particles are simulated and rendered fully on the GPU by the ParticleManager/ParticlePass, this only holds the emitter's settings
+	struct ParticleEmitterComponent
+	{
+		uint32_t MaxParticles = 100000; // Changing this reallocates the emitter's GPU buffers
+		float SpawnRate = 5000.0f; // Particles per second
+		bool IsEmitting = true;
+
+		float SpawnRadius = 0.5f;
+		float LifetimeMin = 1.0f, LifetimeMax = 3.0f;
+		glm::vec3 InitialVelocity = glm::vec3(0.0f, 5.0f, 0.0f);
+		glm::vec3 VelocityRandomness = glm::vec3(2.0f, 1.0f, 2.0f); // Random velocity added to the initial velocity in the range [-VelocityRandomness, VelocityRandomness]
+		glm::vec3 Acceleration = glm::vec3(0.0f, -9.81f, 0.0f);
+
+		float StartSize = 0.1f, EndSize = 0.02f;
+		glm::vec4 StartColour = glm::vec4(1.0f, 0.6f, 0.2f, 1.0f);
+		glm::vec4 EndColour = glm::vec4(1.0f, 0.1f, 0.0f, 0.0f);
+		Texture *SpriteTexture = nullptr; // Soft circle is used if this is null
+
+		bool AdditiveBlending = true; // Additive particles are order independent, alpha blended particles get sorted back to front on the GPU
+		bool SortParticles = true; // Only used for alpha blended particles, can be turned off when the particles look fine unsorted to skip the sort
+
+		float EmitAccumulator = 0.0f; // Should not be set or used by the user. Fractional particles carried over between frames
+	};
+
 	// TODO: Eventually needs to be added and used for the runtime. The editor will always have a "camera" but will be needed for runtime eventually
 	struct CameraComponent
 	{
@@ -4,6 +4,9 @@
 #include <Arcane/Graphics/Window.h>
 #include <Arcane/Graphics/Skybox.h>
 #include <Arcane/Graphics/Mesh/Mesh.h>
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Graphics/Impostor/ImpostorBaker.h>
+#include <Arcane/Graphics/Lightmap/LightmapUVGenerator.h>
 #include <Arcane/Graphics/Renderer/GLCache.h>
 #include <Arcane/Graphics/Renderer/Renderer.h>
 #include <Arcane/Scene/Entity.h>
@@ -11,11 +14,12 @@
 #include <Arcane/Graphics/Camera/CameraController.h>
 #include <Arcane/Graphics/Camera/PerspectiveCamera.h>
 #include <Arcane/Graphics/Camera/OrthographicCamera.h>
+#include <Arcane/Core/Events/EventQueue.h>
 
 namespace Arcane
 {
 	Scene::Scene(Window *window)
-		: m_Terrain(nullptr), m_LightManager(this), m_ProbeManager(m_SceneProbeBlendSetting), m_WaterManager(this)
+		: m_Terrain(nullptr), m_PVS(nullptr), m_Lightmap(nullptr), m_LightManager(this), m_ProbeManager(m_SceneProbeBlendSetting), m_WaterManager(this), m_ParticleManager(this)
 	{
 #if USE_PERSPECTIVE_PROJ
 		m_SceneCamera = new PerspectiveCamera();
@@ -29,7 +33,10 @@ namespace Arcane
 
 	Scene::~Scene()
 	{
-
+		delete m_PVS;
+		delete m_Lightmap;
+		for (auto &bakedImpostor : m_BakedImpostors)
+			delete bakedImpostor.second;
 	}
 
 	void Scene::PreInit()
@@ -59,6 +66,7 @@ namespace Arcane
 	{
 		m_LightManager.Init();
 		m_WaterManager.Init();
+		m_ParticleManager.Init();
 	}
 
 	Entity Scene::CreateEntity(const std::string &name)
@@ -81,6 +89,9 @@ namespace Arcane
 		// Update Water
 		m_WaterManager.Update();
 
+		// Update Particles
+		m_ParticleManager.Update(deltaTime);
+
 		// Update Animated Entities
 		auto animatedView = m_Registry.view<PoseAnimatorComponent>();
 		for (auto entity : animatedView)
@@ -91,12 +102,124 @@ namespace Arcane
 		}
 	}
 
-	void Scene::AddModelsToRenderer(ModelFilterType filter)
+	void Scene::LateLatchInput(const EventQueue &eventQueue)
+	{
+		// Apply any mouse movement that came in after the scene update so the view matrix is as fresh as possible
+		double mouseX, mouseY, timestamp;
+		if (eventQueue.PeekLatestCursorPosition(mouseX, mouseY, timestamp))
+		{
+			m_SceneCamera->LateLatchInput(mouseX, mouseY);
+		}
+	}
+
+	void Scene::SetPVS(PotentiallyVisibleSet *pvs)
+	{
+		if (m_PVS != pvs)
+			delete m_PVS;
+		m_PVS = pvs;
+
+		auto view = m_Registry.view<MeshComponent>();
+		for (auto entity : view)
+		{
+			view.get<MeshComponent>(entity).PVSIndex = PotentiallyVisibleSet::InvalidIndex;
+		}
+		if (!m_PVS)
+			return;
+
+		// Entities that no longer exist or lost their mesh since the bake are skipped, new static entities never get rejected
+		const std::vector<entt::entity> &pvsEntities = m_PVS->GetEntities();
+		for (uint32_t i = 0; i < static_cast<uint32_t>(pvsEntities.size()); i++)
+		{
+			if (m_Registry.valid(pvsEntities[i]) && m_Registry.all_of<MeshComponent>(pvsEntities[i]))
+			{
+				m_Registry.get<MeshComponent>(pvsEntities[i]).PVSIndex = i;
+			}
+		}
+	}
+
+	void Scene::SetLightmap(Lightmap *lightmap)
+	{
+		if (m_Lightmap != lightmap)
+			delete m_Lightmap;
+		m_Lightmap = lightmap;
+
+		auto view = m_Registry.view<MeshComponent>();
+		for (auto entity : view)
+		{
+			view.get<MeshComponent>(entity).LightmapIndex = Lightmap::InvalidIndex;
+		}
+		if (!m_Lightmap)
+			return;
+
+		// Lightmap UVs are not stored with the lightmap, they are deterministic so a loaded lightmap just regenerates them
+		const std::vector<entt::entity> &lightmapEntities = m_Lightmap->GetEntities();
+		for (uint32_t i = 0; i < static_cast<uint32_t>(lightmapEntities.size()); i++)
+		{
+			if (m_Registry.valid(lightmapEntities[i]) && m_Registry.all_of<MeshComponent>(lightmapEntities[i]))
+			{
+				MeshComponent &meshComponent = m_Registry.get<MeshComponent>(lightmapEntities[i]);
+				if (meshComponent.AssetModel)
+				{
+					LightmapUVGenerator::Generate(meshComponent.AssetModel);
+					meshComponent.LightmapIndex = i;
+				}
+			}
+		}
+
+		if (!m_Lightmap->GetTexture())
+			m_Lightmap->GenerateTexture();
+	}
+
+	void Scene::BakeImpostors()
+	{
+		auto view = m_Registry.view<MeshComponent, ImpostorComponent>();
+		for (auto entity : view)
+		{
+			Model *model = view.get<MeshComponent>(entity).AssetModel;
+			ImpostorComponent &impostorComponent = view.get<ImpostorComponent>(entity);
+			if (impostorComponent.AssetImpostor || !model || !model->IsLoaded())
+				continue;
+
+			auto iter = m_BakedImpostors.find(model);
+			if (iter == m_BakedImpostors.end())
+				iter = m_BakedImpostors.emplace(model, ImpostorBaker::Bake(model)).first;
+			impostorComponent.AssetImpostor = iter->second;
+		}
+	}
+
+	void Scene::AddModelsToRenderer(ModelFilterType filter, ICamera *impostorCamera, ICamera *pvsCamera, bool separateLightmapped)
 	{
+		// The camera cell is resolved once, rejection is then a single bit test per static entity
+		uint32_t pvsCell = PotentiallyVisibleSet::InvalidIndex;
+		if (pvsCamera && m_PVS)
+		{
+			pvsCell = m_PVS->FindCell(pvsCamera->GetPosition());
+		}
+
+		// Every transform is composed in one batch up front, the second loop walks the group in the same order
 		auto group = m_Registry.group<TransformComponent, MeshComponent>();
+		m_BatchTranslations.clear();
+		m_BatchRotations.clear();
+		m_BatchScales.clear();
 		for (auto entity : group)
 		{
+			const TransformComponent &transform = group.get<TransformComponent>(entity);
+			m_BatchTranslations.push_back(transform.Translation);
+			m_BatchRotations.push_back(glm::quat(transform.Rotation));
+			m_BatchScales.push_back(transform.Scale);
+		}
+		m_BatchTransforms.resize(m_BatchTranslations.size());
+		if (!m_BatchTransforms.empty())
+			BatchMath::ComposeTRS(&m_BatchTranslations[0], &m_BatchRotations[0], &m_BatchScales[0], &m_BatchTransforms[0], m_BatchTransforms.size());
+
+		size_t entityIndex = 0;
+		for (auto entity : group)
+		{
+			const glm::mat4 &modelTransform = m_BatchTransforms[entityIndex++];
 			auto&[transform, model] = group.get<TransformComponent, MeshComponent>(entity);
+			if (pvsCell != PotentiallyVisibleSet::InvalidIndex && model.IsStatic && model.PVSIndex != PotentiallyVisibleSet::InvalidIndex && !m_PVS->IsVisible(pvsCell, model.PVSIndex))
+				continue;
+
 			Entity currentEntity(this, entity);
 
 			PoseAnimator *poseAnimator = nullptr;
@@ -105,41 +228,66 @@ namespace Arcane
 				poseAnimator = &currentEntity.GetComponent<PoseAnimatorComponent>().PoseAnimator;
 			}
 
+			bool passesFilter = false;
 			switch (filter)
 			{
 			case ModelFilterType::AllModels:
-				Renderer::QueueMesh(model.AssetModel, transform.GetTransform(), poseAnimator, model.IsTransparent, model.ShouldBackfaceCull);
+				passesFilter = true;
 				break;
 			case ModelFilterType::StaticModels:
-				if (model.IsStatic)
-				{
-					Renderer::QueueMesh(model.AssetModel, transform.GetTransform(), poseAnimator, model.IsTransparent, model.ShouldBackfaceCull);
-				}
+				passesFilter = model.IsStatic;
 				break;
 			case ModelFilterType::OpaqueModels:
-				if (model.IsTransparent == false)
-				{
-					Renderer::QueueMesh(model.AssetModel, transform.GetTransform(), poseAnimator, model.IsTransparent, model.ShouldBackfaceCull);
-				}
+				passesFilter = !model.IsTransparent;
 				break;
 			case ModelFilterType::OpaqueStaticModels:
-				if (model.IsTransparent == false && model.IsStatic)
-				{
-					Renderer::QueueMesh(model.AssetModel, transform.GetTransform(), poseAnimator, model.IsTransparent, model.ShouldBackfaceCull);
-				}
+				passesFilter = !model.IsTransparent && model.IsStatic;
 				break;
 			case ModelFilterType::TransparentModels:
-				if (model.IsTransparent)
-				{
-					Renderer::QueueMesh(model.AssetModel, transform.GetTransform(), poseAnimator, model.IsTransparent, model.ShouldBackfaceCull);
-				}
+				passesFilter = model.IsTransparent;
 				break;
 			case ModelFilterType::TransparentStaticModels:
-				if (model.IsTransparent && model.IsStatic)
+				passesFilter = model.IsTransparent && model.IsStatic;
+				break;
+			case ModelFilterType::LightmappedModels:
+				passesFilter = m_Lightmap && model.LightmapIndex != Lightmap::InvalidIndex && !poseAnimator && !model.IsTransparent;
+				break;
+			}
+			if (!passesFilter)
+				continue;
+
+			// Opaque, non-animated models can be swapped for their impostor if the pass supports it and the model is small enough on screen
+			if (impostorCamera && !poseAnimator && !model.IsTransparent && currentEntity.HasComponent<ImpostorComponent>())
+			{
+				ImpostorComponent &impostorComponent = currentEntity.GetComponent<ImpostorComponent>();
+				if (impostorComponent.Enabled && impostorComponent.AssetImpostor)
 				{
-					Renderer::QueueMesh(model.AssetModel, transform.GetTransform(), poseAnimator, model.IsTransparent, model.ShouldBackfaceCull);
+					Impostor *impostor = impostorComponent.AssetImpostor;
+					glm::vec3 worldCentre = glm::vec3(modelTransform * glm::vec4(impostor->GetBoundsCentre(), 1.0f));
+					glm::vec3 absScale = glm::abs(transform.Scale);
+					float worldRadius = impostor->GetBoundsRadius() * glm::max(absScale.x, glm::max(absScale.y, absScale.z));
+					float distance = glm::max(glm::distance(worldCentre, impostorCamera->GetPosition()), 0.0001f);
+
+					// Fraction of the screen height covered by the bounding sphere (projection[1][1] = 1 / tan(fov / 2))
+					float screenSize = worldRadius * impostorCamera->GetProjectionMatrix()[1][1] / distance;
+					if (screenSize < impostorComponent.ScreenSizeThreshold)
+					{
+						// Impostors are fully lit at runtime, there is nothing to composite the baked lighting onto
+						if (filter != ModelFilterType::LightmappedModels)
+							Renderer::QueueImpostor(impostor, modelTransform);
+						continue;
+					}
 				}
-				break;
+			}
+
+			bool isLightmapped = (separateLightmapped || filter == ModelFilterType::LightmappedModels) && m_Lightmap && model.LightmapIndex != Lightmap::InvalidIndex && !poseAnimator && !model.IsTransparent;
+			if (isLightmapped)
+			{
+				Renderer::QueueMesh(model.AssetModel, modelTransform, nullptr, false, model.ShouldBackfaceCull, true, m_Lightmap->GetScaleOffset(model.LightmapIndex));
+			}
+			else
+			{
+				Renderer::QueueMesh(model.AssetModel, modelTransform, poseAnimator, model.IsTransparent, model.ShouldBackfaceCull);
 			}
 		}
 	}
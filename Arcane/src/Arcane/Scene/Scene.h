@@ -14,6 +14,10 @@
 #include <Arcane/Graphics/IBL/ProbeManager.h>
 #endif
 
+#ifndef PARTICLEMANAGER_H
+#include <Arcane/Graphics/Particles/ParticleManager.h>
+#endif
+
 #ifndef TERRAIN_H
 #include <Arcane/Terrain/Terrain.h>
 #endif
@@ -22,6 +26,14 @@
 #include <Arcane/Graphics/Renderer/Renderpass/WaterPass.h>
 #endif
 
+#ifndef POTENTIALLYVISIBLESET_H
+#include <Arcane/Graphics/Culling/PotentiallyVisibleSet.h>
+#endif
+
+#ifndef LIGHTMAP_H
+#include <Arcane/Graphics/Lightmap/Lightmap.h>
+#endif
+
 #ifndef ENTT_CONFIG_CONFIG_H
 #include "entt.hpp"
 #endif
@@ -33,6 +45,9 @@ namespace Arcane
 	class Skybox;
 	class GLCache;
 	class CameraController;
+	class EventQueue;
+	class Impostor;
+	class Model;
 
 	enum class ModelFilterType
 	{
@@ -41,7 +56,8 @@ namespace Arcane
 		OpaqueModels,
 		OpaqueStaticModels,
 		TransparentModels,
-		TransparentStaticModels
+		TransparentStaticModels,
+		LightmappedModels // Only the models with baked lighting, always queued as lightmapped
 	};
 
 	class Scene
@@ -52,6 +68,11 @@ namespace Arcane
 		friend class WaterManager;
 		friend class ScenePanel;
 		friend class WaterPass;
+		friend class ParticleManager;
+		friend class ParticlePass;
+		friend class PVSBaker;
+		friend class LightmapBaker;
+		friend class LightmapPass;
 	public:
 		Scene(Window *window);
 		~Scene();
@@ -60,14 +81,28 @@ namespace Arcane
 
 		void Init();
 		void OnUpdate(float deltaTime);
+		void LateLatchInput(const EventQueue &eventQueue);
+
+		// If a camera is provided, models with an ImpostorComponent that are small enough on screen from it get queued as impostors instead
+		// If a PVS camera is provided, static models that are not in the potentially visible set of the camera's cell are rejected
+		// If separateLightmapped is set, models covered by the scene's lightmap are queued apart so the pass can skip the static lights for them
+		void AddModelsToRenderer(ModelFilterType filter, ICamera *impostorCamera = nullptr, ICamera *pvsCamera = nullptr, bool separateLightmapped = false);
 
-		void AddModelsToRenderer(ModelFilterType filter);
+		// Takes ownership of the PVS (can be null to disable PVS culling) and assigns the PVS bits to the static entities it was baked with
+		void SetPVS(PotentiallyVisibleSet *pvs);
+		// Takes ownership of the lightmap (can be null to go back to fully dynamic lighting), lightmap UVs get generated for models that are missing them
+		void SetLightmap(Lightmap *lightmap);
+		// Bakes the impostor of every ImpostorComponent that doesn't have one yet, entities sharing a model share its impostor. Models and their textures must be loaded
+		void BakeImpostors();
 
 		inline Terrain* GetTerrain() { return m_Terrain; }
 		inline LightManager* GetLightManager() { return &m_LightManager; }
 		inline WaterManager* GetWaterManager() { return &m_WaterManager; }
 		inline ProbeManager* GetProbeManager() { return &m_ProbeManager; }
+		inline ParticleManager* GetParticleManager() { return &m_ParticleManager; }
 		inline Skybox* GetSkybox() { return m_Skybox; }
+		inline PotentiallyVisibleSet* GetPVS() { return m_PVS; }
+		inline Lightmap* GetLightmap() { return m_Lightmap; }
 		ICamera* GetCamera();
 	private:
 		void PreInit();
@@ -88,6 +123,15 @@ namespace Arcane
 		LightManager m_LightManager;
 		ProbeManager m_ProbeManager;
 		WaterManager m_WaterManager;
+		ParticleManager m_ParticleManager;
+		PotentiallyVisibleSet *m_PVS;
+		Lightmap *m_Lightmap;
+		std::unordered_map<Model*, Impostor*> m_BakedImpostors; // Owned by the scene
+
+		// Scratch for composing the transforms of every mesh entity in one batch, kept around so it doesn't allocate every call
+		std::vector<glm::vec3> m_BatchTranslations, m_BatchScales;
+		std::vector<glm::quat> m_BatchRotations;
+		std::vector<glm::mat4> m_BatchTransforms;
 	};
 }
 #endif
@@ -0,0 +1,119 @@
+#include "arcpch.h"
+#include "FoliageScatter.h"
+
+namespace Arcane
+{
+	// PCG hash
+	static uint32_t FoliageHash(uint32_t input)
+	{
+		uint32_t state = input * 747796405u + 2891336453u;
+		uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+		return (word >> 22u) ^ word;
+	}
+
+	static float FoliageRandom(uint32_t &state)
+	{
+		state = FoliageHash(state);
+		return static_cast<float>(state) / 4294967296.0f;
+	}
+
+	float FoliageImage::SampleBilinear(float u, float v, int channel) const
+	{
+		float x = glm::clamp(u, 0.0f, 1.0f) * (Width - 1);
+		float y = glm::clamp(v, 0.0f, 1.0f) * (Height - 1);
+		int x0 = static_cast<int>(x), y0 = static_cast<int>(y);
+		int x1 = std::min(x0 + 1, Width - 1), y1 = std::min(y0 + 1, Height - 1);
+		float fracX = x - x0, fracY = y - y0;
+		channel = glm::clamp(channel, 0, Channels - 1);
+
+		auto texel = [this, channel](int px, int py) { return Data[(px + py * Width) * Channels + channel] / 255.0f; };
+		return glm::mix(glm::mix(texel(x0, y0), texel(x1, y0), fracX), glm::mix(texel(x0, y1), texel(x1, y1), fracX), fracY);
+	}
+
+	float FoliageHeightfield::SampleHeight(float localX, float localZ) const
+	{
+		float spacing = GetSpacing();
+		float x = glm::clamp(localX / spacing, 0.0f, static_cast<float>(SideVertexCount - 1));
+		float z = glm::clamp(localZ / spacing, 0.0f, static_cast<float>(SideVertexCount - 1));
+		unsigned int x0 = static_cast<unsigned int>(x), z0 = static_cast<unsigned int>(z);
+		unsigned int x1 = std::min(x0 + 1, SideVertexCount - 1), z1 = std::min(z0 + 1, SideVertexCount - 1);
+		float fracX = x - x0, fracZ = z - z0;
+
+		float topLeft = Heights[x0 + z0 * SideVertexCount];
+		float topRight = Heights[x1 + z0 * SideVertexCount];
+		float bottomLeft = Heights[x0 + z1 * SideVertexCount];
+		float bottomRight = Heights[x1 + z1 * SideVertexCount];
+		return glm::mix(glm::mix(topLeft, topRight, fracX), glm::mix(bottomLeft, bottomRight, fracX), fracZ);
+	}
+
+	glm::vec3 FoliageHeightfield::SampleNormal(float localX, float localZ) const
+	{
+		float spacing = GetSpacing();
+		float heightR = SampleHeight(localX + spacing, localZ);
+		float heightL = SampleHeight(localX - spacing, localZ);
+		float heightU = SampleHeight(localX, localZ + spacing);
+		float heightD = SampleHeight(localX, localZ - spacing);
+		return glm::normalize(glm::vec3(heightL - heightR, 2.0f * spacing, heightD - heightU));
+	}
+
+	void FoliageScatter::Scatter(const FoliageHeightfield &heightfield, const FoliageImage &splatmap, const FoliageImage &densityMap, const FoliageScatterSettings &settings, std::vector<FoliageInstance> &outInstances)
+	{
+		outInstances.clear();
+		if (!heightfield.Heights || heightfield.SideVertexCount < 2 || settings.Density <= 0.0f)
+			return;
+
+		bool useSplatmap = settings.SplatChannel >= 0 && splatmap.IsValid();
+		bool useDensityMap = densityMap.IsValid();
+		float minSlopeCos = glm::cos(glm::radians(settings.MaxSlopeDegrees));
+
+		// Only the area covered by the terrain mesh gets foliage, and the maps are sampled with the same UVs the terrain uses
+		float extent = heightfield.GetExtent();
+		float cellSize = 1.0f / glm::sqrt(settings.Density);
+		uint32_t cellsPerSide = static_cast<uint32_t>(glm::ceil(extent / cellSize));
+
+		for (uint32_t cellZ = 0; cellZ < cellsPerSide; cellZ++)
+		{
+			for (uint32_t cellX = 0; cellX < cellsPerSide; cellX++)
+			{
+				uint32_t rngState = FoliageHash(settings.Seed ^ FoliageHash(cellX + FoliageHash(cellZ)));
+
+				// Always consume the same amount of random values per cell so a rejected candidate doesn't shift its neighbours
+				float jitterX = FoliageRandom(rngState);
+				float jitterZ = FoliageRandom(rngState);
+				float acceptance = FoliageRandom(rngState);
+				float scale = glm::mix(settings.MinScale, settings.MaxScale, FoliageRandom(rngState));
+				float rotation = FoliageRandom(rngState) * glm::two_pi<float>();
+				float variation = FoliageRandom(rngState);
+
+				float localX = (cellX + jitterX) * cellSize;
+				float localZ = (cellZ + jitterZ) * cellSize;
+				if (localX >= extent || localZ >= extent)
+					continue;
+
+				float u = localX / extent;
+				float v = localZ / extent;
+				float probability = 1.0f;
+				if (useDensityMap)
+					probability *= densityMap.SampleBilinear(u, v, 0);
+				if (useSplatmap)
+					probability *= splatmap.SampleBilinear(u, v, settings.SplatChannel);
+				if (acceptance >= probability)
+					continue;
+
+				if (heightfield.SampleNormal(localX, localZ).y < minSlopeCos)
+					continue;
+
+				FoliageInstance instance;
+				instance.PositionAndScale = glm::vec4(heightfield.Origin + glm::vec3(localX, heightfield.SampleHeight(localX, localZ), localZ), scale);
+				instance.Params = glm::vec4(rotation, variation, 0.0f, 0.0f);
+				outInstances.push_back(instance);
+
+				if (outInstances.size() >= settings.MaxInstances)
+				{
+					ARC_LOG_WARN("Foliage layer hit its instance limit of {0}, the rest of the terrain will be left empty", settings.MaxInstances);
+					return;
+				}
+			}
+		}
+	}
+}
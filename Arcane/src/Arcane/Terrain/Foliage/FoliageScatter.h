@@ -0,0 +1,60 @@
+#pragma once
+#ifndef FOLIAGESCATTER_H
+#define FOLIAGESCATTER_H
+
+namespace Arcane
+{
+	// Must match the FoliageInstance struct in the foliage shaders (std430)
+	struct FoliageInstance
+	{
+		glm::vec4 PositionAndScale;	// xyz = world position, w = uniform scale
+		glm::vec4 Params;			// x = rotation around the up axis in radians, y = random value in [0, 1) for per instance variation
+	};
+
+	// Read-only view of an 8 bit image (splatmap/density map) in memory, sampled with normalized coordinates
+	struct FoliageImage
+	{
+		const unsigned char *Data = nullptr;
+		int Width = 0, Height = 0, Channels = 0;
+
+		inline bool IsValid() const { return Data != nullptr && Width > 0 && Height > 0 && Channels > 0; }
+		float SampleBilinear(float u, float v, int channel) const; // Returns [0, 1]
+	};
+
+	// Read-only view of a terrain's vertex heights. Vertices are SizeXZ / SideVertexCount apart like the terrain mesh, so positions are in the terrain's local space [0, GetExtent()]
+	struct FoliageHeightfield
+	{
+		const float *Heights = nullptr;
+		unsigned int SideVertexCount = 0;
+		float SizeXZ = 0.0f;
+		glm::vec3 Origin = glm::vec3(0.0f);
+
+		inline float GetSpacing() const { return SizeXZ / static_cast<float>(SideVertexCount); }
+		inline float GetExtent() const { return GetSpacing() * (SideVertexCount - 1); } // Distance from the first to the last vertex, the terrain's UVs span [0, 1] over this
+
+		float SampleHeight(float localX, float localZ) const;
+		glm::vec3 SampleNormal(float localX, float localZ) const;
+	};
+
+	struct FoliageScatterSettings
+	{
+		uint32_t Seed = 0;
+		float Density = 4.0f; // Max instances per square meter, scaled by the density map and splat weight
+		int SplatChannel = -1; // Splatmap channel (0-3) that gates placement, -1 ignores the splatmap
+		float MinScale = 0.8f, MaxScale = 1.2f;
+		float MaxSlopeDegrees = 35.0f;
+		uint32_t MaxInstances = FOLIAGE_MAX_INSTANCES_PER_LAYER;
+	};
+
+	/*
+		Deterministic CPU placement. The terrain is split into a jittered grid with one candidate per cell (cell size derived from the density), every
+		random value is a hash of the cell coordinates and seed so the same inputs always produce the same instances in the same order. Has no GL
+		dependencies so it can be run and validated headlessly
+	*/
+	class FoliageScatter
+	{
+	public:
+		static void Scatter(const FoliageHeightfield &heightfield, const FoliageImage &splatmap, const FoliageImage &densityMap, const FoliageScatterSettings &settings, std::vector<FoliageInstance> &outInstances);
+	};
+}
+#endif
@@ -0,0 +1,218 @@
+#include "arcpch.h"
+#include "FoliageSystem.h"
+
+#include <Arcane/Terrain/Terrain.h>
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Graphics/Camera/ICamera.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+#include <Arcane/Util/VirtualFileSystem.h>
+
+namespace Arcane
+{
+	// Must match the bindings in the foliage shaders
+	enum FoliageBufferBinding : GLuint
+	{
+		FoliageBufferBinding_Instances = 0,
+		FoliageBufferBinding_VisibleIndices = 1,
+		FoliageBufferBinding_DrawCommands = 2
+	};
+
+	static const uint32_t s_FoliageCullThreadGroupSize = 256; // Must match local_size_x in FoliageCull.glsl
+
+	FoliageSystem::FoliageSystem() : m_CullShader(nullptr)
+	{
+
+	}
+
+	FoliageSystem::~FoliageSystem()
+	{
+		Clear();
+	}
+
+	bool FoliageSystem::AddLayer(Terrain *terrain, Model *model, const FoliageLayerSettings &settings)
+	{
+		if (!terrain->IsLoaded() || !model->IsLoaded() || model->GetMeshes().empty())
+		{
+			ARC_LOG_WARN("Foliage layer needs a loaded terrain and a model with meshes");
+			return false;
+		}
+
+		if (!m_CullShader)
+			m_CullShader = ShaderLoader::LoadShader("terrain/FoliageCull.glsl");
+
+		FoliageHeightfield heightfield;
+		heightfield.Heights = &terrain->GetVertexHeights()[0];
+		heightfield.SideVertexCount = terrain->GetSideVertexCount();
+		heightfield.SizeXZ = terrain->GetSizeXZ();
+		heightfield.Origin = terrain->GetPosition();
+
+		// Maps are only needed for placement so they never get uploaded to the GPU
+		FoliageImage splatmap, densityMap;
+		unsigned char *splatmapData = nullptr, *densityMapData = nullptr;
+		if (!settings.SplatmapPath.empty())
+		{
+			VirtualFile splatmapFile = VirtualFileSystem::ReadFile(settings.SplatmapPath);
+			if (splatmapFile.IsValid())
+				splatmapData = stbi_load_from_memory(splatmapFile.GetData(), static_cast<int>(splatmapFile.GetSize()), &splatmap.Width, &splatmap.Height, &splatmap.Channels, 0);
+			splatmap.Data = splatmapData;
+			if (!splatmapData)
+				ARC_LOG_WARN("Failed to load foliage splatmap: {0}", settings.SplatmapPath);
+		}
+		if (!settings.DensityMapPath.empty())
+		{
+			VirtualFile densityMapFile = VirtualFileSystem::ReadFile(settings.DensityMapPath);
+			if (densityMapFile.IsValid())
+				densityMapData = stbi_load_from_memory(densityMapFile.GetData(), static_cast<int>(densityMapFile.GetSize()), &densityMap.Width, &densityMap.Height, &densityMap.Channels, 1);
+			densityMap.Data = densityMapData;
+			densityMap.Channels = 1;
+			if (!densityMapData)
+				ARC_LOG_WARN("Failed to load foliage density map: {0}", settings.DensityMapPath);
+		}
+
+		std::vector<FoliageInstance> instances;
+		FoliageScatter::Scatter(heightfield, splatmap, densityMap, settings.Scatter, instances);
+		if (splatmapData)
+			stbi_image_free(splatmapData);
+		if (densityMapData)
+			stbi_image_free(densityMapData);
+
+		if (instances.empty())
+		{
+			ARC_LOG_WARN("Foliage layer for model {0} didn't place any instances", model->GetName());
+			return false;
+		}
+
+		FoliageLayer layer;
+		layer.FoliageModel = model;
+		layer.Settings = settings;
+		layer.InstanceCount = static_cast<uint32_t>(instances.size());
+
+		AABB bounds = model->ComputeBounds();
+		layer.BoundsCentre = (bounds.Min + bounds.Max) * 0.5f;
+		layer.BoundsRadius = glm::length(bounds.Max - bounds.Min) * 0.5f;
+
+		std::vector<FoliageDrawCommand> drawCommands;
+		for (const Mesh &mesh : model->GetMeshes())
+		{
+			FoliageDrawCommand command = {};
+			command.Count = mesh.IsIndexed() ? mesh.GetIndexCount() : mesh.GetVertexCount();
+			drawCommands.push_back(command);
+		}
+
+		glGenBuffers(1, &layer.InstanceBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, layer.InstanceBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(FoliageInstance) * instances.size(), &instances[0], GL_STATIC_DRAW);
+
+		glGenBuffers(1, &layer.VisibleIndexBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, layer.VisibleIndexBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(uint32_t) * instances.size(), nullptr, GL_DYNAMIC_COPY);
+
+		glGenBuffers(1, &layer.DrawCommandBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, layer.DrawCommandBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(FoliageDrawCommand) * drawCommands.size(), &drawCommands[0], GL_DYNAMIC_COPY);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		ARC_LOG_INFO("Scattered {0} instances of {1} across the terrain", layer.InstanceCount, model->GetName());
+		m_Layers.push_back(layer);
+		return true;
+	}
+
+	void FoliageSystem::Clear()
+	{
+		for (FoliageLayer &layer : m_Layers)
+		{
+			glDeleteBuffers(1, &layer.InstanceBuffer);
+			glDeleteBuffers(1, &layer.VisibleIndexBuffer);
+			glDeleteBuffers(1, &layer.DrawCommandBuffer);
+		}
+		m_Layers.clear();
+	}
+
+	void FoliageSystem::CullAndDraw(ICamera *camera, Shader *shader)
+	{
+		if (m_Layers.empty())
+			return;
+
+		// Extract the frustum planes from the view projection (Gribb/Hartmann), normalized so the distance test can use the bounding radius directly
+		glm::mat4 viewProjection = camera->GetProjectionMatrix() * camera->GetViewMatrix();
+		glm::mat4 rows = glm::transpose(viewProjection);
+		glm::vec4 frustumPlanes[6] = { rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1], rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2] };
+		for (glm::vec4 &plane : frustumPlanes)
+			plane /= glm::length(glm::vec3(plane));
+
+		for (FoliageLayer &layer : m_Layers)
+			Cull(layer, frustumPlanes, camera->GetPosition());
+
+		// Visible lists and instance counts were written by the culling dispatches
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+
+		GLCache *glCache = GLCache::GetInstance();
+		glCache->SetShader(shader);
+		shader->SetUniform(ARC_UNIFORM("view"), camera->GetViewMatrix());
+		shader->SetUniform(ARC_UNIFORM("projection"), camera->GetProjectionMatrix());
+		shader->SetUniform(ARC_UNIFORM("viewPos"), camera->GetPosition());
+		glCache->SetDepthTest(true);
+		glCache->SetBlend(false);
+		glCache->SetFaceCull(false); // Foliage cards are usually single quads seen from both sides
+
+		for (FoliageLayer &layer : m_Layers)
+			Draw(layer, shader);
+
+		glCache->SetFaceCull(true);
+	}
+
+	void FoliageSystem::Cull(FoliageLayer &layer, const glm::vec4 *frustumPlanes, const glm::vec3 &cameraPosition)
+	{
+		// Reset the visible count, the culling shader only increments the first command so it gets copied to the other meshes afterwards
+		const GLuint zero = 0;
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, layer.DrawCommandBuffer);
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, offsetof(FoliageDrawCommand, InstanceCount), sizeof(GLuint), &zero);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		GLCache::GetInstance()->SetShader(m_CullShader);
+		m_CullShader->SetUniformArray(ARC_UNIFORM("frustumPlanes"), 6, frustumPlanes);
+		m_CullShader->SetUniform(ARC_UNIFORM("cameraPosition"), cameraPosition);
+		m_CullShader->SetUniform(ARC_UNIFORM("maxDrawDistance"), layer.Settings.MaxDrawDistance);
+		m_CullShader->SetUniform(ARC_UNIFORM("boundsCentre"), layer.BoundsCentre);
+		m_CullShader->SetUniform(ARC_UNIFORM("boundsRadius"), layer.BoundsRadius);
+		m_CullShader->SetUniform(ARC_UNIFORM("instanceCount"), static_cast<int>(layer.InstanceCount));
+
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, FoliageBufferBinding_Instances, layer.InstanceBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, FoliageBufferBinding_VisibleIndices, layer.VisibleIndexBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, FoliageBufferBinding_DrawCommands, layer.DrawCommandBuffer);
+		glDispatchCompute((layer.InstanceCount + s_FoliageCullThreadGroupSize - 1) / s_FoliageCullThreadGroupSize, 1, 1);
+
+		size_t meshCount = layer.FoliageModel->GetMeshes().size();
+		if (meshCount > 1)
+		{
+			glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+			glBindBuffer(GL_COPY_READ_BUFFER, layer.DrawCommandBuffer);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, layer.DrawCommandBuffer);
+			for (size_t i = 1; i < meshCount; i++)
+			{
+				glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offsetof(FoliageDrawCommand, InstanceCount),
+					sizeof(FoliageDrawCommand) * i + offsetof(FoliageDrawCommand, InstanceCount), sizeof(GLuint));
+			}
+			glBindBuffer(GL_COPY_READ_BUFFER, 0);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		}
+	}
+
+	void FoliageSystem::Draw(FoliageLayer &layer, Shader *shader)
+	{
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, FoliageBufferBinding_Instances, layer.InstanceBuffer);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, FoliageBufferBinding_VisibleIndices, layer.VisibleIndexBuffer);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, layer.DrawCommandBuffer);
+
+		std::vector<Mesh> &meshes = layer.FoliageModel->GetMeshes();
+		for (size_t i = 0; i < meshes.size(); i++)
+		{
+			meshes[i].GetMaterial().BindMaterialInformation(shader);
+			meshes[i].DrawIndirect(reinterpret_cast<const void*>(sizeof(FoliageDrawCommand) * i));
+		}
+
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+#ifndef FOLIAGESYSTEM_H
+#define FOLIAGESYSTEM_H
+
+#ifndef FOLIAGESCATTER_H
+#include <Arcane/Terrain/Foliage/FoliageScatter.h>
+#endif
+
+namespace Arcane
+{
+	class Model;
+	class Shader;
+	class ICamera;
+	class Terrain;
+
+	struct FoliageLayerSettings
+	{
+		FoliageScatterSettings Scatter;
+		std::string SplatmapPath; // Optional, only used if Scatter.SplatChannel is set
+		std::string DensityMapPath; // Optional, red channel scales the density
+		float MaxDrawDistance = FOLIAGE_MAX_DRAW_DISTANCE_DEFAULT;
+	};
+
+	// Must match the layout of DrawElementsIndirectCommand, also used for non-indexed meshes (DrawArraysIndirectCommand uses the first 4 values)
+	struct FoliageDrawCommand
+	{
+		uint32_t Count;
+		uint32_t InstanceCount;
+		uint32_t FirstIndex;
+		uint32_t BaseVertex;
+		uint32_t BaseInstance;
+	};
+
+	struct FoliageLayer
+	{
+		Model *FoliageModel = nullptr;
+		FoliageLayerSettings Settings;
+		uint32_t InstanceCount = 0;
+		glm::vec3 BoundsCentre = glm::vec3(0.0f); // Model space bounding sphere
+		float BoundsRadius = 0.0f;
+
+		unsigned int InstanceBuffer = 0, VisibleIndexBuffer = 0, DrawCommandBuffer = 0; // One draw command per mesh in the model
+	};
+
+	/*
+		Instanced terrain vegetation. Layers are scattered once on the CPU (see FoliageScatter) and uploaded, then every frame a compute shader culls each
+		instance against the camera's frustum and draw distance and appends the survivors to a visible list. The instance count of the layer's indirect
+		draw commands is written on the GPU, so drawing a layer never needs the CPU to know how many instances are visible
+	*/
+	class FoliageSystem
+	{
+	public:
+		FoliageSystem();
+		~FoliageSystem();
+
+		// Scatters the model across the terrain and uploads the instances. Terrain must be loaded and positioned
+		bool AddLayer(Terrain *terrain, Model *model, const FoliageLayerSettings &settings);
+		void Clear();
+
+		// Culls every layer for the camera then issues its indirect draws, assumes the GBuffer is bound. Shader must be the foliage geometry shader
+		void CullAndDraw(ICamera *camera, Shader *shader);
+
+		inline bool HasLayers() const { return !m_Layers.empty(); }
+	private:
+		void Cull(FoliageLayer &layer, const glm::vec4 *frustumPlanes, const glm::vec3 &cameraPosition);
+		void Draw(FoliageLayer &layer, Shader *shader);
+	private:
+		std::vector<FoliageLayer> m_Layers;
+		Shader *m_CullShader;
+	};
+}
+#endif
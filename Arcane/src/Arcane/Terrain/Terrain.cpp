@@ -4,7 +4,9 @@
 #include <Arcane/Graphics/Mesh/Mesh.h>
 #include <Arcane/Graphics/Renderer/GLCache.h>
 #include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Texture/OrmTexture.h>
 #include <Arcane/Util/Loaders/AssetManager.h>
+#include <Arcane/Util/VirtualFileSystem.h>
 
 namespace Arcane
 {
@@ -25,31 +27,25 @@ namespace Arcane
 		m_Textures[2] = assetManager.Load2DTextureAsync(std::string("res/terrain/branches/branchesAlbedo.tga"), &srgbTextureSettings);
 		m_Textures[3] = assetManager.Load2DTextureAsync(std::string("res/terrain/rock/rockAlbedo.tga"), &srgbTextureSettings);
 
-		m_Textures[4] = assetManager.Load2DTextureAsync(std::string("res/terrain/grass/grassNormal.tga"));
-		m_Textures[5] = assetManager.Load2DTextureAsync(std::string("res/terrain/dirt/dirtNormal.tga"));
-		m_Textures[6] = assetManager.Load2DTextureAsync(std::string("res/terrain/branches/branchesNormal.tga"));
-		m_Textures[7] = assetManager.Load2DTextureAsync(std::string("res/terrain/rock/rockNormal.tga"));
+		TextureSettings normalTextureSettings;
+		normalTextureSettings.IsNormalMap = true;
 
-		// We do not want these texture treated as one channel so store it as RGB
-		TextureSettings textureSettings;
-		textureSettings.TextureFormat = GL_RGB;
-
-		m_Textures[8] = assetManager.Load2DTextureAsync(std::string("res/terrain/grass/grassRoughness.tga"), &textureSettings);
-		m_Textures[9] = assetManager.Load2DTextureAsync(std::string("res/terrain/dirt/dirtRoughness.tga"), &textureSettings);
-		m_Textures[10] = assetManager.Load2DTextureAsync(std::string("res/terrain/branches/branchesRoughness.tga"), &textureSettings);
-		m_Textures[11] = assetManager.Load2DTextureAsync(std::string("res/terrain/rock/rockRoughness.tga"), &textureSettings);
+		m_Textures[4] = assetManager.Load2DTextureAsync(std::string("res/terrain/grass/grassNormal.tga"), &normalTextureSettings);
+		m_Textures[5] = assetManager.Load2DTextureAsync(std::string("res/terrain/dirt/dirtNormal.tga"), &normalTextureSettings);
+		m_Textures[6] = assetManager.Load2DTextureAsync(std::string("res/terrain/branches/branchesNormal.tga"), &normalTextureSettings);
+		m_Textures[7] = assetManager.Load2DTextureAsync(std::string("res/terrain/rock/rockNormal.tga"), &normalTextureSettings);
 
-		m_Textures[12] = assetManager.Load2DTextureAsync(std::string("res/terrain/grass/grassMetallic.tga"), &textureSettings);
-		m_Textures[13] = assetManager.Load2DTextureAsync(std::string("res/terrain/dirt/dirtMetallic.tga"), &textureSettings);
-		m_Textures[14] = assetManager.Load2DTextureAsync(std::string("res/terrain/branches/branchesMetallic.tga"), &textureSettings);
-		m_Textures[15] = assetManager.Load2DTextureAsync(std::string("res/terrain/rock/rockMetallic.tga"), &textureSettings);
+		// Each layer's roughness, metallic and AO are single channel, so they get packed into one texture per layer
+		m_OrmTextures[0] = assetManager.LoadOrmTextureAsync(std::string("res/terrain/grass/grassAO.tga"), std::string("res/terrain/grass/grassRoughness.tga"), std::string("res/terrain/grass/grassMetallic.tga"));
+		m_OrmTextures[1] = assetManager.LoadOrmTextureAsync(std::string("res/terrain/dirt/dirtAO.tga"), std::string("res/terrain/dirt/dirtRoughness.tga"), std::string("res/terrain/dirt/dirtMetallic.tga"));
+		m_OrmTextures[2] = assetManager.LoadOrmTextureAsync(std::string("res/terrain/branches/branchesAO.tga"), std::string("res/terrain/branches/branchesRoughness.tga"), std::string("res/terrain/branches/branchesMetallic.tga"));
+		m_OrmTextures[3] = assetManager.LoadOrmTextureAsync(std::string("res/terrain/rock/rockAO.tga"), std::string("res/terrain/rock/rockRoughness.tga"), std::string("res/terrain/rock/rockMetallic.tga"));
 
-		m_Textures[16] = assetManager.Load2DTextureAsync(std::string("res/terrain/grass/grassAO.tga"), &textureSettings);
-		m_Textures[17] = assetManager.Load2DTextureAsync(std::string("res/terrain/dirt/dirtAO.tga"), &textureSettings);
-		m_Textures[18] = assetManager.Load2DTextureAsync(std::string("res/terrain/branches/branchesAO.tga"), &textureSettings);
-		m_Textures[19] = assetManager.Load2DTextureAsync(std::string("res/terrain/rock/rockAO.tga"), &textureSettings);
+		// We do not want the blendmap treated as one channel so store it as RGB
+		TextureSettings textureSettings;
+		textureSettings.TextureFormat = GL_RGB;
 
-		m_Textures[20] = assetManager.Load2DTextureAsync(std::string("res/terrain/blendMap.tga"), &textureSettings);
+		m_Textures[8] = assetManager.Load2DTextureAsync(std::string("res/terrain/blendMap.tga"), &textureSettings);
 	}
 
 	Terrain::~Terrain()
@@ -63,12 +59,14 @@ namespace Arcane
 		{
 			ARC_LOG_INFO("Unloading the old terrain in order to load a new terrain");
 			delete m_Mesh;
+			m_FoliageSystem.Clear(); // Foliage was placed on the old heightfield
 		}
 		ARC_LOG_INFO("Loading the terrain from texture path: {0}", texturePath);
 
 		// Height map
 		int mapWidth, mapHeight;
-		unsigned char* heightMapImage = stbi_load("res/terrain/heightMap.png", &mapWidth, &mapHeight, 0, 1);
+		VirtualFile heightMapFile = VirtualFileSystem::ReadFile("res/terrain/heightMap.png");
+		unsigned char* heightMapImage = stbi_load_from_memory(heightMapFile.GetData(), static_cast<int>(heightMapFile.GetSize()), &mapWidth, &mapHeight, 0, 1);
 		if (mapWidth != mapHeight) {
 			ARC_LOG_FATAL("Can't use a heightmap with a different width and height for the terrain");
 			return;
@@ -93,6 +91,8 @@ namespace Arcane
 		positions.reserve(m_SideVertexCount * m_SideVertexCount);
 		uvs.reserve(m_SideVertexCount * m_SideVertexCount);
 		normals.reserve(m_SideVertexCount * m_SideVertexCount);
+		m_VertexHeights.clear();
+		m_VertexHeights.reserve(m_SideVertexCount * m_SideVertexCount);
 		indices.reserve((m_SideVertexCount - 1) * (m_SideVertexCount - 1) * 6);
 
 		// Vertex generation
@@ -103,6 +103,7 @@ namespace Arcane
 				glm::vec2 positionXZ(x * m_SpaceBetweenVertices, z * m_SpaceBetweenVertices);
 
 				positions.push_back(glm::vec3(positionXZ.x, SampleHeightfieldBilinear(positionXZ.x, positionXZ.y, heightMapImage), positionXZ.y));
+				m_VertexHeights.push_back(positions.back().y);
 				uvs.push_back(glm::vec2((float)x / (float)(m_SideVertexCount - 1), (float)z / (float)(m_SideVertexCount - 1)));
 				normals.push_back(CalculateNormal(positionXZ.x, positionXZ.y, heightMapImage));
 			}
@@ -192,63 +193,68 @@ namespace Arcane
 			int currentTextureUnit = 3;
 			// Textures
 			m_Textures[0]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_albedo1", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_albedo1"), currentTextureUnit++);
 			m_Textures[1]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_albedo2", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_albedo2"), currentTextureUnit++);
 			m_Textures[2]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_albedo3", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_albedo3"), currentTextureUnit++);
 			m_Textures[3]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_albedo4", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_albedo4"), currentTextureUnit++);
 
 			m_Textures[4]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_normal1", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_normal1"), currentTextureUnit++);
 			m_Textures[5]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_normal2", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_normal2"), currentTextureUnit++);
 			m_Textures[6]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_normal3", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_normal3"), currentTextureUnit++);
 			m_Textures[7]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_normal4", currentTextureUnit++);
-
-			m_Textures[8]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_roughness1", currentTextureUnit++);
-			m_Textures[9]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_roughness2", currentTextureUnit++);
-			m_Textures[10]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_roughness3", currentTextureUnit++);
-			m_Textures[11]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_roughness4", currentTextureUnit++);
-
-			m_Textures[12]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_metallic1", currentTextureUnit++);
-			m_Textures[13]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_metallic2", currentTextureUnit++);
-			m_Textures[14]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_metallic3", currentTextureUnit++);
-			m_Textures[15]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_metallic4", currentTextureUnit++);
-
-			m_Textures[16]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_AO1", currentTextureUnit++);
-			m_Textures[17]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_AO2", currentTextureUnit++);
-			m_Textures[18]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_AO3", currentTextureUnit++);
-			m_Textures[19]->Bind(currentTextureUnit);
-			shader->SetUniform("material.texture_AO4", currentTextureUnit++);
-
- 			m_Textures[20]->Bind(currentTextureUnit);
- 			shader->SetUniform("material.blendmap", currentTextureUnit++);
+			shader->SetUniform(ARC_UNIFORM("material.texture_normal4"), currentTextureUnit++);
+
+			static const UniformName s_OrmUniforms[4] = { ARC_UNIFORM("material.texture_orm1"), ARC_UNIFORM("material.texture_orm2"), ARC_UNIFORM("material.texture_orm3"), ARC_UNIFORM("material.texture_orm4") };
+			if (shader->HasUniform(s_OrmUniforms[0]))
+			{
+				for (int i = 0; i < 4; i++)
+				{
+					m_OrmTextures[i]->Packed.Bind(currentTextureUnit);
+					shader->SetUniform(s_OrmUniforms[i], currentTextureUnit++);
+				}
+			}
+			else
+			{
+				// Shader samples the maps separately, bind the views into the packed textures instead
+				static const UniformName s_RoughnessUniforms[4] = { ARC_UNIFORM("material.texture_roughness1"), ARC_UNIFORM("material.texture_roughness2"), ARC_UNIFORM("material.texture_roughness3"), ARC_UNIFORM("material.texture_roughness4") };
+				static const UniformName s_MetallicUniforms[4] = { ARC_UNIFORM("material.texture_metallic1"), ARC_UNIFORM("material.texture_metallic2"), ARC_UNIFORM("material.texture_metallic3"), ARC_UNIFORM("material.texture_metallic4") };
+				static const UniformName s_AOUniforms[4] = { ARC_UNIFORM("material.texture_AO1"), ARC_UNIFORM("material.texture_AO2"), ARC_UNIFORM("material.texture_AO3"), ARC_UNIFORM("material.texture_AO4") };
+				for (int i = 0; i < 4; i++)
+				{
+					m_OrmTextures[i]->RoughnessView.Bind(currentTextureUnit);
+					shader->SetUniform(s_RoughnessUniforms[i], currentTextureUnit++);
+				}
+				for (int i = 0; i < 4; i++)
+				{
+					m_OrmTextures[i]->MetallicView.Bind(currentTextureUnit);
+					shader->SetUniform(s_MetallicUniforms[i], currentTextureUnit++);
+				}
+				for (int i = 0; i < 4; i++)
+				{
+					m_OrmTextures[i]->OcclusionView.Bind(currentTextureUnit);
+					shader->SetUniform(s_AOUniforms[i], currentTextureUnit++);
+				}
+			}
+
+ 			m_Textures[8]->Bind(currentTextureUnit);
+ 			shader->SetUniform(ARC_UNIFORM("material.blendmap"), currentTextureUnit++);
 
 			// Normal matrix
 			glm::mat3 normalMatrix = glm::mat3(glm::transpose(glm::inverse(m_ModelMatrix)));
-			shader->SetUniform("normalMatrix", normalMatrix);
+			shader->SetUniform(ARC_UNIFORM("normalMatrix"), normalMatrix);
 
 			// Tiling amount
-			shader->SetUniform("material.tilingAmount", m_TextureTilingAmount);
+			shader->SetUniform(ARC_UNIFORM("material.tilingAmount"), m_TextureTilingAmount);
 		}
 
 		// Only set normal matrix for non shadowmap pass
-		shader->SetUniform("model", m_ModelMatrix);
+		shader->SetUniform(ARC_UNIFORM("model"), m_ModelMatrix);
 
 		m_GLCache->SetDepthTest(true);
 		m_GLCache->SetDepthFunc(GL_LESS);
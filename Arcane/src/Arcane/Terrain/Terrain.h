@@ -6,11 +6,16 @@
 #include <Arcane/Graphics/Renderer/Renderpass/RenderPassType.h>
 #endif
 
+#ifndef FOLIAGESYSTEM_H
+#include <Arcane/Terrain/Foliage/FoliageSystem.h>
+#endif
+
 namespace Arcane
 {
 	class Shader;
 	class Mesh;
 	class GLCache;
+	struct OrmTexture;
 
 	class Terrain
 	{
@@ -25,6 +30,13 @@ namespace Arcane
 		inline void SetPosition(glm::vec3& pos) { m_Position = pos; m_ModelMatrix = glm::translate(glm::mat4(1.0f), pos); }
 		inline const glm::vec3& GetPosition() const { return m_Position; }
 		inline bool IsLoaded() { return m_Mesh != nullptr; }
+
+		// CPU copy of the mesh's vertex heights (local space, row major in z), used to place things on the terrain like foliage
+		inline const std::vector<float>& GetVertexHeights() const { return m_VertexHeights; }
+		inline unsigned int GetSideVertexCount() const { return m_SideVertexCount; }
+		inline float GetSizeXZ() const { return m_TerrainSizeXZ; }
+
+		inline FoliageSystem* GetFoliageSystem() { return &m_FoliageSystem; }
 	private:
 		glm::vec3 CalculateNormal(float worldPosX, float worldPosZ, unsigned char *heightMapData);
 
@@ -48,7 +60,10 @@ namespace Arcane
 		glm::mat4 m_ModelMatrix;
 		glm::vec3 m_Position;
 		Mesh* m_Mesh;
-		std::array<Texture*, 21> m_Textures; // Represents all the textures supported by the terrain's texure splatting (rgba and the default value)
+		std::vector<float> m_VertexHeights;
+		FoliageSystem m_FoliageSystem;
+		std::array<Texture*, 9> m_Textures; // Albedo and normal of each of the terrain's texture splatting layers (rgba and the default value), followed by the blendmap
+		std::array<OrmTexture*, 4> m_OrmTextures; // Occlusion, roughness and metallic of each layer packed into one texture
 	};
 }
 #endif
@@ -0,0 +1,417 @@
+#include "arcpch.h"
+#include "AssetBaker.h"
+
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Util/AssetPack.h>
+#include <Arcane/Util/AssetPackBuilder.h>
+#include <Arcane/Util/Loaders/CookedAsset.h>
+#include <Arcane/Util/Loaders/TextureLoader.h>
+
+namespace Arcane
+{
+	static constexpr uint32_t s_BakeCacheMagic = 0x434B4241; // "ABKC"
+	static constexpr uint32_t s_BakeCacheVersion = 1;
+	static constexpr const char *s_BakeCacheFileName = "bake_cache.bin";
+
+	static const char *s_TextureExtensions[] = { ".png", ".jpg", ".jpeg", ".tga", ".bmp", ".psd", ".gif" };
+	static const char *s_ModelExtensions[] = { ".obj", ".fbx", ".dae", ".gltf", ".glb", ".3ds", ".blend" };
+
+	enum class BakeAssetType
+	{
+		None, Texture, Model
+	};
+
+	struct BakeFileStamp
+	{
+		std::string Path;
+		uint64_t Size = 0;
+		int64_t WriteTime = 0;
+		uint64_t Hash = 0;
+	};
+
+	struct BakeRecord
+	{
+		uint32_t CookedVersion = 0;
+		std::vector<BakeFileStamp> Inputs; // The source is always the first input
+	};
+
+	struct BakeJob
+	{
+		std::string SourcePath;
+		std::string CookedPath; // Path on disk
+		BakeAssetType Type;
+
+		BakeRecord Record;
+		bool Cooked = false, Failed = false;
+	};
+
+	static BakeAssetType GetBakeAssetType(const std::filesystem::path &path)
+	{
+		std::string extension = path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+		for (const char *textureExtension : s_TextureExtensions)
+		{
+			if (extension == textureExtension)
+				return BakeAssetType::Texture;
+		}
+		for (const char *modelExtension : s_ModelExtensions)
+		{
+			if (extension == modelExtension)
+				return BakeAssetType::Model;
+		}
+		return BakeAssetType::None;
+	}
+
+	static bool GetFileTimes(const std::string &path, uint64_t &outSize, int64_t &outWriteTime)
+	{
+		std::error_code error;
+		outSize = static_cast<uint64_t>(std::filesystem::file_size(path, error));
+		if (error)
+			return false;
+		outWriteTime = static_cast<int64_t>(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+		return !error;
+	}
+
+	static bool StampFile(const std::string &path, BakeFileStamp &outStamp)
+	{
+		outStamp.Path = path;
+		return GetFileTimes(path, outStamp.Size, outStamp.WriteTime) && CookedAsset::HashFile(path, outStamp.Hash);
+	}
+
+	// Untouched files are trusted by size and write time, the rest get hashed so a touched but identical file (ie: version control checkout) doesn't cause a recook
+	static bool IsRecordUpToDate(BakeRecord &record, uint32_t cookedVersion, const std::string &cookedPath)
+	{
+		std::error_code error;
+		if (record.Inputs.empty() || record.CookedVersion != cookedVersion || !std::filesystem::is_regular_file(cookedPath, error))
+			return false;
+
+		for (BakeFileStamp &stamp : record.Inputs)
+		{
+			uint64_t size;
+			int64_t writeTime;
+			if (!GetFileTimes(stamp.Path, size, writeTime))
+				return false;
+			if (size == stamp.Size && writeTime == stamp.WriteTime)
+				continue;
+
+			uint64_t hash;
+			if (size != stamp.Size || !CookedAsset::HashFile(stamp.Path, hash) || hash != stamp.Hash)
+				return false;
+			stamp.WriteTime = writeTime;
+		}
+		return true;
+	}
+
+	static void WriteBakeString(std::ostream &stream, const std::string &str)
+	{
+		uint32_t length = static_cast<uint32_t>(str.size());
+		stream.write(reinterpret_cast<const char*>(&length), sizeof(uint32_t));
+		stream.write(str.data(), str.size());
+	}
+
+	static bool ReadBakeString(std::istream &stream, std::string &outStr)
+	{
+		uint32_t length = 0;
+		if (!stream.read(reinterpret_cast<char*>(&length), sizeof(uint32_t)))
+			return false;
+		outStr.resize(length);
+		return length == 0 || static_cast<bool>(stream.read(&outStr[0], length));
+	}
+
+	static std::unordered_map<std::string, BakeRecord> LoadBakeCache(const std::string &path)
+	{
+		std::unordered_map<std::string, BakeRecord> records;
+		std::ifstream ifs(path, std::ios::in | std::ios::binary);
+		if (!ifs)
+			return records;
+
+		uint32_t magic = 0, version = 0, recordCount = 0;
+		ifs.read(reinterpret_cast<char*>(&magic), sizeof(uint32_t));
+		ifs.read(reinterpret_cast<char*>(&version), sizeof(uint32_t));
+		ifs.read(reinterpret_cast<char*>(&recordCount), sizeof(uint32_t));
+		if (!ifs || magic != s_BakeCacheMagic || version != s_BakeCacheVersion)
+		{
+			ARC_LOG_WARN("Invalid or outdated bake cache, every asset will be recooked - {0}", path);
+			return records;
+		}
+
+		for (uint32_t i = 0; i < recordCount; i++)
+		{
+			std::string sourcePath;
+			BakeRecord record;
+			uint32_t inputCount = 0;
+			ReadBakeString(ifs, sourcePath);
+			ifs.read(reinterpret_cast<char*>(&record.CookedVersion), sizeof(uint32_t));
+			ifs.read(reinterpret_cast<char*>(&inputCount), sizeof(uint32_t));
+			for (uint32_t j = 0; j < inputCount && ifs; j++)
+			{
+				BakeFileStamp stamp;
+				ReadBakeString(ifs, stamp.Path);
+				ifs.read(reinterpret_cast<char*>(&stamp.Size), sizeof(uint64_t));
+				ifs.read(reinterpret_cast<char*>(&stamp.WriteTime), sizeof(int64_t));
+				ifs.read(reinterpret_cast<char*>(&stamp.Hash), sizeof(uint64_t));
+				record.Inputs.push_back(std::move(stamp));
+			}
+
+			if (!ifs)
+			{
+				ARC_LOG_WARN("Corrupt bake cache, every asset will be recooked - {0}", path);
+				records.clear();
+				break;
+			}
+			records[sourcePath] = std::move(record);
+		}
+
+		return records;
+	}
+
+	static bool SaveBakeCache(const std::string &path, const std::vector<BakeJob> &jobs)
+	{
+		std::ofstream ofs(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!ofs)
+		{
+			ARC_LOG_ERROR("Failed to open bake cache for writing - {0}", path);
+			return false;
+		}
+
+		// Failed assets are left out so they are retried next time
+		uint32_t recordCount = 0;
+		for (const BakeJob &job : jobs)
+			recordCount += job.Failed ? 0 : 1;
+
+		ofs.write(reinterpret_cast<const char*>(&s_BakeCacheMagic), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&s_BakeCacheVersion), sizeof(uint32_t));
+		ofs.write(reinterpret_cast<const char*>(&recordCount), sizeof(uint32_t));
+		for (const BakeJob &job : jobs)
+		{
+			if (job.Failed)
+				continue;
+
+			uint32_t inputCount = static_cast<uint32_t>(job.Record.Inputs.size());
+			WriteBakeString(ofs, job.SourcePath);
+			ofs.write(reinterpret_cast<const char*>(&job.Record.CookedVersion), sizeof(uint32_t));
+			ofs.write(reinterpret_cast<const char*>(&inputCount), sizeof(uint32_t));
+			for (const BakeFileStamp &stamp : job.Record.Inputs)
+			{
+				WriteBakeString(ofs, stamp.Path);
+				ofs.write(reinterpret_cast<const char*>(&stamp.Size), sizeof(uint64_t));
+				ofs.write(reinterpret_cast<const char*>(&stamp.WriteTime), sizeof(int64_t));
+				ofs.write(reinterpret_cast<const char*>(&stamp.Hash), sizeof(uint64_t));
+			}
+		}
+
+		return ofs.good();
+	}
+
+	void AssetBaker::CookAsset(BakeJob &job)
+	{
+		BakeRecord record;
+		record.CookedVersion = job.Type == BakeAssetType::Model ? CookedAsset::ModelVersion : CookedAsset::TextureVersion;
+		record.Inputs.emplace_back();
+
+		// Stamp the source before cooking, an edit made while cooking then just causes a recook on the next run
+		if (!StampFile(job.SourcePath, record.Inputs[0]))
+		{
+			ARC_LOG_ERROR("Failed to read source asset - {0}", job.SourcePath);
+			job.Failed = true;
+			return;
+		}
+
+		std::error_code error;
+		std::filesystem::create_directories(std::filesystem::path(job.CookedPath).parent_path(), error);
+
+		bool cooked = false;
+		if (job.Type == BakeAssetType::Texture)
+		{
+			cooked = TextureLoader::CookTexture(job.SourcePath, job.CookedPath, record.Inputs[0].Hash);
+		}
+		else
+		{
+			std::vector<std::string> dependencies;
+			cooked = Model::Cook(job.SourcePath, job.CookedPath, record.Inputs[0].Hash, dependencies);
+			for (const std::string &dependency : dependencies)
+			{
+				if (AssetPack::NormalizePath(dependency) == AssetPack::NormalizePath(job.SourcePath))
+					continue;
+
+				BakeFileStamp stamp;
+				if (StampFile(dependency, stamp))
+					record.Inputs.push_back(std::move(stamp));
+			}
+		}
+
+		if (!cooked)
+		{
+			std::filesystem::remove(job.CookedPath, error);
+			job.Failed = true;
+			return;
+		}
+
+		job.Record = std::move(record);
+		job.Cooked = true;
+	}
+
+	AssetBakeResult AssetBaker::Bake(const AssetBakeSettings &settings)
+	{
+		AssetBakeResult result;
+		int threadCount = settings.ThreadCount > 0 ? settings.ThreadCount : static_cast<int>(std::thread::hardware_concurrency());
+		threadCount = std::max(threadCount, 1);
+
+		std::filesystem::path outputDirectory(settings.OutputDirectory);
+		std::string cachePath = (outputDirectory / s_BakeCacheFileName).string();
+
+		// Gather the work
+		std::vector<BakeJob> jobs;
+		std::vector<std::string> uncookedFiles;
+		std::error_code error;
+		for (const auto &directoryEntry : std::filesystem::recursive_directory_iterator(settings.SourceDirectory, error))
+		{
+			if (!directoryEntry.is_regular_file())
+				continue;
+
+			std::string sourcePath = directoryEntry.path().generic_string();
+			BakeAssetType type = GetBakeAssetType(directoryEntry.path());
+			if (type == BakeAssetType::None)
+			{
+				uncookedFiles.push_back(sourcePath);
+				continue;
+			}
+
+			BakeJob job;
+			job.SourcePath = sourcePath;
+			job.CookedPath = (outputDirectory / (AssetPack::NormalizePath(sourcePath) + (type == BakeAssetType::Model ? CookedAsset::ModelExtension : CookedAsset::TextureExtension))).string();
+			job.Type = type;
+			jobs.push_back(std::move(job));
+		}
+		if (error)
+		{
+			ARC_LOG_ERROR("Failed to walk the asset directory {0} - {1}", settings.SourceDirectory, error.message());
+			result.Failed++;
+			return result;
+		}
+
+		std::unordered_map<std::string, BakeRecord> previousRecords;
+		if (!settings.Force)
+			previousRecords = LoadBakeCache(cachePath);
+
+		ARC_LOG_INFO("Baking {0} assets from {1} on {2} threads", jobs.size(), settings.SourceDirectory, threadCount);
+
+		// Cook
+		std::atomic<size_t> next(0);
+		auto worker = [&]()
+		{
+			for (size_t i = next++; i < jobs.size(); i = next++)
+			{
+				BakeJob &job = jobs[i];
+				auto iter = previousRecords.find(job.SourcePath);
+				if (iter != previousRecords.end())
+				{
+					BakeRecord record = iter->second;
+					if (IsRecordUpToDate(record, job.Type == BakeAssetType::Model ? CookedAsset::ModelVersion : CookedAsset::TextureVersion, job.CookedPath))
+					{
+						job.Record = std::move(record);
+						continue;
+					}
+				}
+
+				CookAsset(job);
+				if (job.Cooked)
+					ARC_LOG_INFO("Cooked {0}", job.SourcePath);
+			}
+		};
+
+		std::vector<std::thread> workerThreads;
+		for (int i = 1; i < threadCount; i++)
+			workerThreads.push_back(std::thread(worker));
+		worker();
+		for (std::thread &thread : workerThreads)
+			thread.join();
+
+		// Remove what was cooked from sources that no longer exist
+		std::unordered_set<std::string> liveSources;
+		for (const BakeJob &job : jobs)
+		{
+			liveSources.insert(job.SourcePath);
+			result.Cooked += job.Cooked ? 1 : 0;
+			result.Failed += job.Failed ? 1 : 0;
+			result.UpToDate += (!job.Cooked && !job.Failed) ? 1 : 0;
+		}
+		for (const auto &pair : previousRecords)
+		{
+			if (liveSources.find(pair.first) != liveSources.end())
+				continue;
+
+			BakeAssetType type = GetBakeAssetType(std::filesystem::path(pair.first));
+			const char *extension = type == BakeAssetType::Model ? CookedAsset::ModelExtension : CookedAsset::TextureExtension;
+			std::filesystem::remove(outputDirectory / (AssetPack::NormalizePath(pair.first) + extension), error);
+		}
+
+		std::filesystem::create_directories(outputDirectory, error);
+		SaveBakeCache(cachePath, jobs);
+		ARC_LOG_INFO("Bake finished - cooked: {0}, up to date: {1}, failed: {2}", result.Cooked, result.UpToDate, result.Failed);
+
+		// Cooked assets replace their sources in the pack, failed ones keep the source so the runtime can still fall back to it
+		if (!settings.PackPath.empty())
+		{
+			AssetPackBuilder packBuilder;
+			for (const BakeJob &job : jobs)
+			{
+				if (job.Failed)
+				{
+					packBuilder.AddFile(job.SourcePath, job.SourcePath);
+					continue;
+				}
+				packBuilder.AddFile(job.CookedPath, CookedAsset::GetCookedPath(job.SourcePath, job.Type == BakeAssetType::Model ? CookedAsset::ModelExtension : CookedAsset::TextureExtension));
+			}
+			for (const std::string &uncookedFile : uncookedFiles)
+			{
+				packBuilder.AddFile(uncookedFile, uncookedFile);
+			}
+
+			if (!packBuilder.Write(settings.PackPath))
+				result.Failed++;
+		}
+
+		return result;
+	}
+
+	int AssetBaker::RunCommandLine(int argc, char **argv)
+	{
+		AssetBakeSettings settings;
+		int positionalCount = 0;
+		for (int i = 0; i < argc; i++)
+		{
+			std::string argument(argv[i]);
+			if (argument == "--force")
+			{
+				settings.Force = true;
+			}
+			else if (argument == "--pack" && i + 1 < argc)
+			{
+				settings.PackPath = argv[++i];
+			}
+			else if (argument == "--threads" && i + 1 < argc)
+			{
+				settings.ThreadCount = std::atoi(argv[++i]);
+			}
+			else if (argument.rfind("--", 0) != 0 && positionalCount < 2)
+			{
+				(positionalCount++ == 0 ? settings.SourceDirectory : settings.OutputDirectory) = argument;
+			}
+			else
+			{
+				ARC_LOG_ERROR("Unknown bake argument {0} - usage: --bake [sourceDirectory] [outputDirectory] [--pack path] [--threads count] [--force]", argument);
+				return 1;
+			}
+		}
+
+		AssetBakeResult result = Bake(settings);
+		return result.Failed == 0 ? 0 : 1;
+	}
+
+	bool AssetBaker::IsModelFile(const std::filesystem::path &path)
+	{
+		return GetBakeAssetType(path) == BakeAssetType::Model;
+	}
+}
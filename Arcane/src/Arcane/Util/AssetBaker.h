@@ -0,0 +1,47 @@
+#pragma once
+#ifndef ASSETBAKER_H
+#define ASSETBAKER_H
+
+namespace Arcane
+{
+	struct BakeJob;
+
+	struct AssetBakeSettings
+	{
+		std::string SourceDirectory = "res"; // Relative to the working directory, exactly like the paths the loaders are given
+		std::string OutputDirectory = COOKED_ASSET_DIRECTORY; // The runtime looks under COOKED_ASSET_DIRECTORY, other directories are only useful for building packs
+		std::string PackPath; // If set, an asset pack with the cooked assets plus every source file that has no cooked version is written after the bake
+		int ThreadCount = 0; // 0 uses every hardware thread
+		bool Force = false; // Ignores the cache and recooks everything
+	};
+
+	struct AssetBakeResult
+	{
+		int Cooked = 0;
+		int UpToDate = 0;
+		int Failed = 0;
+	};
+
+	/*
+		Offline cook of the assets under a source directory into the runtime-ready forms the loaders pick up (see CookedAsset): models are imported with
+		Assimp once and stored as their final vertex streams, textures are stored decoded. Assets are cooked in parallel on all cores.
+
+		A cache next to the output records the size, write time and content hash of every input of a cooked asset (the source plus any files Assimp pulled
+		in, like .mtl or .bin files). A re-run only recooks assets whose inputs' contents changed, only touched files get hashed again. Cooked assets of deleted
+		sources are removed.
+		Doesn't need a GL context, so it runs before any window is created (see ArcaneEntryPoint)
+	*/
+	class AssetBaker
+	{
+	public:
+		static AssetBakeResult Bake(const AssetBakeSettings &settings = AssetBakeSettings());
+
+		// Arguments following --bake: [sourceDirectory] [outputDirectory] [--pack path] [--threads count] [--force]. Returns the process exit code
+		static int RunCommandLine(int argc, char **argv);
+
+		static bool IsModelFile(const std::filesystem::path &path); // By extension, the same check the bake uses to pick what gets cooked as a model
+	private:
+		static void CookAsset(BakeJob &job); // Called from the worker threads
+	};
+}
+#endif
@@ -0,0 +1,179 @@
+#include "arcpch.h"
+#include "AssetPack.h"
+
+#ifdef ARC_PLATFORM_WINDOWS
+#include <Windows.h>
+#endif
+
+namespace Arcane
+{
+	AssetPack::~AssetPack()
+	{
+		Close();
+	}
+
+	bool AssetPack::Open(const std::string &path)
+	{
+		Close();
+		if (!MapFile(path))
+		{
+			ARC_LOG_ERROR("Failed to open asset pack - {0}", path);
+			return false;
+		}
+
+		AssetPackHeader header;
+		if (m_MappedSize < sizeof(AssetPackHeader))
+		{
+			ARC_LOG_ERROR("Corrupt asset pack - {0}", path);
+			Close();
+			return false;
+		}
+		memcpy(&header, m_MappedData, sizeof(AssetPackHeader));
+		if (header.Magic != FileMagic || header.Version != FileVersion)
+		{
+			ARC_LOG_ERROR("Invalid or outdated asset pack, it needs to be rebuilt - {0}", path);
+			Close();
+			return false;
+		}
+
+		// Validate the whole table of contents up front so lookups never have to
+		uint64_t tocSize = static_cast<uint64_t>(header.EntryCount) * sizeof(AssetPackEntry);
+		bool valid = header.TocOffset + tocSize <= m_MappedSize && header.StringTableOffset + header.StringTableSize <= m_MappedSize;
+		if (valid)
+		{
+			m_Entries.resize(header.EntryCount);
+			memcpy(m_Entries.data(), m_MappedData + header.TocOffset, tocSize);
+			m_StringTable = reinterpret_cast<const char*>(m_MappedData + header.StringTableOffset);
+
+			for (const AssetPackEntry &entry : m_Entries)
+			{
+				valid &= entry.DataOffset + entry.StoredSize <= m_MappedSize;
+				valid &= static_cast<uint64_t>(entry.PathOffset) + entry.PathLength <= header.StringTableSize;
+				valid &= entry.Compression == CompressionType::None ? entry.StoredSize == entry.Size : entry.Compression == CompressionType::LZ4;
+			}
+			valid &= std::is_sorted(m_Entries.begin(), m_Entries.end(), [](const AssetPackEntry &a, const AssetPackEntry &b) { return a.PathHash < b.PathHash; });
+		}
+		if (!valid)
+		{
+			ARC_LOG_ERROR("Corrupt asset pack - {0}", path);
+			Close();
+			return false;
+		}
+
+		m_Path = path;
+		ARC_LOG_INFO("Mounted asset pack {0} ({1} entries)", path, header.EntryCount);
+		return true;
+	}
+
+	void AssetPack::Close()
+	{
+		UnmapFile();
+		m_Path.clear();
+		m_Entries.clear();
+		m_StringTable = nullptr;
+	}
+
+	const AssetPackEntry* AssetPack::FindEntry(const std::string &normalizedPath) const
+	{
+		uint64_t hash = HashPath(normalizedPath);
+		auto iter = std::lower_bound(m_Entries.begin(), m_Entries.end(), hash, [](const AssetPackEntry &entry, uint64_t value) { return entry.PathHash < value; });
+
+		// Entries sharing a hash are adjacent, compare the actual paths so a collision can never return the wrong file
+		for (; iter != m_Entries.end() && iter->PathHash == hash; ++iter)
+		{
+			if (iter->PathLength == normalizedPath.size() && memcmp(m_StringTable + iter->PathOffset, normalizedPath.data(), normalizedPath.size()) == 0)
+				return &(*iter);
+		}
+		return nullptr;
+	}
+
+	std::string AssetPack::NormalizePath(const std::string &path)
+	{
+		std::string normalized = path;
+		std::replace(normalized.begin(), normalized.end(), '\\', '/');
+		normalized = std::filesystem::path(normalized).lexically_normal().generic_string();
+		if (normalized.compare(0, 2, "./") == 0)
+			normalized.erase(0, 2);
+
+		std::transform(normalized.begin(), normalized.end(), normalized.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return normalized;
+	}
+
+#ifdef ARC_PLATFORM_WINDOWS
+	bool AssetPack::MapFile(const std::string &path)
+	{
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (!view)
+		{
+			if (mapping)
+				CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_FileHandle = file;
+		m_MappingHandle = mapping;
+		m_MappedData = static_cast<const unsigned char*>(view);
+		m_MappedSize = static_cast<size_t>(fileSize.QuadPart);
+		return true;
+	}
+
+	void AssetPack::UnmapFile()
+	{
+		if (m_MappedData)
+			UnmapViewOfFile(m_MappedData);
+		if (m_MappingHandle)
+			CloseHandle(m_MappingHandle);
+		if (m_FileHandle)
+			CloseHandle(m_FileHandle);
+
+		m_MappedData = nullptr;
+		m_MappedSize = 0;
+		m_MappingHandle = nullptr;
+		m_FileHandle = nullptr;
+	}
+#else
+	bool AssetPack::MapFile(const std::string &path)
+	{
+		std::ifstream ifs(path, std::ios::in | std::ios::binary | std::ios::ate);
+		if (!ifs)
+			return false;
+
+		std::streamoff fileSize = ifs.tellg();
+		if (fileSize <= 0)
+			return false;
+
+		m_FileData.resize(static_cast<size_t>(fileSize));
+		ifs.seekg(0);
+		if (!ifs.read(reinterpret_cast<char*>(m_FileData.data()), fileSize))
+		{
+			m_FileData.clear();
+			return false;
+		}
+
+		m_MappedData = m_FileData.data();
+		m_MappedSize = m_FileData.size();
+		return true;
+	}
+
+	void AssetPack::UnmapFile()
+	{
+		m_FileData.clear();
+		m_FileData.shrink_to_fit();
+		m_MappedData = nullptr;
+		m_MappedSize = 0;
+	}
+#endif
+}
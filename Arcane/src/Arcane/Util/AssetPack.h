@@ -0,0 +1,85 @@
+#pragma once
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#ifndef COMPRESSION_H
+#include <Arcane/Util/Compression.h>
+#endif
+
+#ifndef STRINGID_H
+#include <Arcane/Util/StringId.h>
+#endif
+
+namespace Arcane
+{
+	struct AssetPackHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t EntryCount;
+		uint32_t Reserved;
+		uint64_t TocOffset; // AssetPackEntry[EntryCount] sorted by PathHash
+		uint64_t StringTableOffset; // Normalized entry paths, used to resolve hash collisions
+		uint64_t StringTableSize;
+	};
+
+	struct AssetPackEntry
+	{
+		uint64_t PathHash;
+		uint64_t DataOffset;
+		uint64_t StoredSize; // Size inside of the pack, differs from Size when the entry is compressed
+		uint64_t Size;
+		uint32_t PathOffset;
+		uint32_t PathLength;
+		CompressionType Compression;
+		uint32_t Reserved;
+	};
+
+	/*
+		Read side of a pack file (see AssetPackBuilder). The whole pack is memory mapped and the table of contents is read once on open, so finding an entry
+		is a binary search over path hashes and uncompressed entries can be used straight from the mapping without any copies.
+		Immutable once opened, so any number of threads can read from it at the same time
+	*/
+	class AssetPack
+	{
+	public:
+		static constexpr uint32_t FileMagic = 0x4B415041; // "APAK"
+		static constexpr uint32_t FileVersion = 1;
+
+		AssetPack() = default;
+		~AssetPack();
+		AssetPack(const AssetPack&) = delete;
+		AssetPack& operator=(const AssetPack&) = delete;
+
+		bool Open(const std::string &path);
+		void Close();
+
+		// Path must already be normalized (see NormalizePath)
+		const AssetPackEntry* FindEntry(const std::string &normalizedPath) const;
+		inline const unsigned char* GetEntryData(const AssetPackEntry &entry) const { return m_MappedData + entry.DataOffset; }
+		inline std::string GetEntryPath(const AssetPackEntry &entry) const { return std::string(m_StringTable + entry.PathOffset, entry.PathLength); }
+
+		inline const std::string& GetPath() const { return m_Path; }
+		inline const std::vector<AssetPackEntry>& GetEntries() const { return m_Entries; }
+
+		// Packed paths are case insensitive and always use forward slashes, ie: "./res\Textures/../Textures/a.png" -> "res/textures/a.png"
+		static std::string NormalizePath(const std::string &path);
+		static inline uint64_t HashPath(const std::string &normalizedPath) { return HashString64(normalizedPath.c_str(), normalizedPath.size()); }
+	private:
+		bool MapFile(const std::string &path);
+		void UnmapFile();
+	private:
+		std::string m_Path;
+		const unsigned char *m_MappedData = nullptr;
+		size_t m_MappedSize = 0;
+#ifdef ARC_PLATFORM_WINDOWS
+		void *m_FileHandle = nullptr, *m_MappingHandle = nullptr;
+#else
+		std::vector<unsigned char> m_FileData; // No memory mapping on other platforms, the pack is read in fully
+#endif
+
+		std::vector<AssetPackEntry> m_Entries;
+		const char *m_StringTable = nullptr;
+	};
+}
+#endif
@@ -0,0 +1,131 @@
+#include "arcpch.h"
+#include "AssetPackBuilder.h"
+
+namespace Arcane
+{
+	static uint64_t AlignEntryOffset(uint64_t offset, uint64_t size)
+	{
+		const uint64_t alignment = ASSET_PACK_ENTRY_ALIGNMENT;
+		uint64_t offsetInBlock = offset % alignment;
+		if (offsetInBlock != 0 && (size >= alignment || offsetInBlock + size > alignment))
+			return offset + (alignment - offsetInBlock);
+		return offset;
+	}
+
+	static void WritePadding(std::ofstream &ofs, uint64_t currentOffset, uint64_t targetOffset)
+	{
+		static const char zeroes[4096] = {};
+		while (currentOffset < targetOffset)
+		{
+			uint64_t count = std::min<uint64_t>(targetOffset - currentOffset, sizeof(zeroes));
+			ofs.write(zeroes, count);
+			currentOffset += count;
+		}
+	}
+
+	void AssetPackBuilder::AddFile(const std::string &diskPath, const std::string &packPath)
+	{
+		std::string normalizedPath = AssetPack::NormalizePath(packPath);
+		m_Files[normalizedPath] = PendingFile{ diskPath, normalizedPath };
+	}
+
+	void AssetPackBuilder::AddDirectory(const std::string &diskDirectory, const std::string &packDirectory)
+	{
+		std::error_code error;
+		for (const auto &directoryEntry : std::filesystem::recursive_directory_iterator(diskDirectory, error))
+		{
+			if (!directoryEntry.is_regular_file())
+				continue;
+
+			std::filesystem::path relativePath = std::filesystem::relative(directoryEntry.path(), diskDirectory);
+			AddFile(directoryEntry.path().string(), (std::filesystem::path(packDirectory) / relativePath).generic_string());
+		}
+
+		if (error)
+		{
+			ARC_LOG_ERROR("Failed to add directory {0} to the asset pack - {1}", diskDirectory, error.message());
+		}
+	}
+
+	bool AssetPackBuilder::Write(const std::string &outputPath, bool compress)
+	{
+		std::ofstream ofs(outputPath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!ofs)
+		{
+			ARC_LOG_ERROR("Failed to open asset pack for writing - {0}", outputPath);
+			return false;
+		}
+
+		// Header gets rewritten at the end once the table of contents location is known
+		AssetPackHeader header = {};
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(AssetPackHeader));
+		uint64_t offset = sizeof(AssetPackHeader);
+
+		std::vector<AssetPackEntry> entries;
+		std::string stringTable;
+		std::vector<unsigned char> fileData, compressedData;
+		uint64_t totalSize = 0, totalStoredSize = 0;
+		entries.reserve(m_Files.size());
+		for (const auto &pair : m_Files)
+		{
+			const PendingFile &file = pair.second;
+			std::ifstream ifs(file.DiskPath, std::ios::in | std::ios::binary);
+			if (!ifs)
+			{
+				ARC_LOG_ERROR("Failed to read {0} while building asset pack - skipping it", file.DiskPath);
+				continue;
+			}
+			fileData.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+			AssetPackEntry entry = {};
+			entry.PathHash = AssetPack::HashPath(file.PackPath);
+			entry.PathOffset = static_cast<uint32_t>(stringTable.size());
+			entry.PathLength = static_cast<uint32_t>(file.PackPath.size());
+			entry.Size = fileData.size();
+			stringTable += file.PackPath;
+
+			const std::vector<unsigned char> *storedData = &fileData;
+			entry.Compression = CompressionType::None;
+			if (compress && Compression::CompressLZ4(fileData.data(), fileData.size(), compressedData))
+			{
+				storedData = &compressedData;
+				entry.Compression = CompressionType::LZ4;
+			}
+			entry.StoredSize = storedData->size();
+
+			uint64_t alignedOffset = AlignEntryOffset(offset, entry.StoredSize);
+			WritePadding(ofs, offset, alignedOffset);
+			entry.DataOffset = alignedOffset;
+			ofs.write(reinterpret_cast<const char*>(storedData->data()), storedData->size());
+			offset = alignedOffset + entry.StoredSize;
+
+			totalSize += entry.Size;
+			totalStoredSize += entry.StoredSize;
+			entries.push_back(entry);
+		}
+
+		std::stable_sort(entries.begin(), entries.end(), [](const AssetPackEntry &a, const AssetPackEntry &b) { return a.PathHash < b.PathHash; });
+
+		header.Magic = AssetPack::FileMagic;
+		header.Version = AssetPack::FileVersion;
+		header.EntryCount = static_cast<uint32_t>(entries.size());
+		header.TocOffset = offset;
+		ofs.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetPackEntry));
+		offset += entries.size() * sizeof(AssetPackEntry);
+
+		header.StringTableOffset = offset;
+		header.StringTableSize = stringTable.size();
+		ofs.write(stringTable.data(), stringTable.size());
+
+		ofs.seekp(0);
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(AssetPackHeader));
+		if (!ofs.good())
+		{
+			ARC_LOG_ERROR("Failed writing asset pack - {0}", outputPath);
+			return false;
+		}
+
+		ARC_LOG_INFO("Built asset pack {0}: {1} entries, {2} bytes stored for {3} bytes of assets", outputPath, entries.size(), totalStoredSize, totalSize);
+		return true;
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+#ifndef ASSETPACKBUILDER_H
+#define ASSETPACKBUILDER_H
+
+#ifndef ASSETPACK_H
+#include <Arcane/Util/AssetPack.h>
+#endif
+
+namespace Arcane
+{
+	/*
+		Writes pack files read by AssetPack/VirtualFileSystem. Entries are LZ4 compressed when it actually saves space (already compressed formats like
+		png/jpg are stored as is so they can be used straight from the memory mapping). Layout:
+			[AssetPackHeader][entry data...][AssetPackEntry table sorted by hash][path string table]
+		Entries bigger than ASSET_PACK_ENTRY_ALIGNMENT start on that boundary, smaller ones are packed tightly but never straddle one
+	*/
+	class AssetPackBuilder
+	{
+	public:
+		// packPath is the path the loaders will ask for, ie: AddFile("C:/Build/res/a.png", "res/a.png"). Adding the same pack path twice keeps the last one
+		void AddFile(const std::string &diskPath, const std::string &packPath);
+		// Recursively adds every file, packed paths are packDirectory + the path relative to diskDirectory
+		void AddDirectory(const std::string &diskDirectory, const std::string &packDirectory);
+
+		bool Write(const std::string &outputPath, bool compress = true);
+	private:
+		struct PendingFile
+		{
+			std::string DiskPath;
+			std::string PackPath; // Normalized
+		};
+		std::map<std::string, PendingFile> m_Files; // Keyed by the normalized pack path so output is deterministic
+	};
+}
+#endif
@@ -0,0 +1,34 @@
+#include "arcpch.h"
+#include "Compression.h"
+
+// LZ4 is vendored as a single source file (with renderdoc), so it just gets compiled as part of this translation unit
+#include <Arcane/Vendor/renderdoc-1.x/renderdoc/3rdparty/lz4/lz4.c>
+
+namespace Arcane
+{
+	bool Compression::CompressLZ4(const unsigned char *source, size_t sourceSize, std::vector<unsigned char> &outCompressed)
+	{
+		if (sourceSize == 0 || sourceSize > LZ4_MAX_INPUT_SIZE)
+			return false;
+
+		outCompressed.resize(LZ4_compressBound(static_cast<int>(sourceSize)));
+		int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(source), reinterpret_cast<char*>(outCompressed.data()), static_cast<int>(sourceSize), static_cast<int>(outCompressed.size()));
+		if (compressedSize <= 0 || static_cast<size_t>(compressedSize) >= sourceSize)
+		{
+			outCompressed.clear();
+			return false;
+		}
+
+		outCompressed.resize(compressedSize);
+		return true;
+	}
+
+	bool Compression::DecompressLZ4(const unsigned char *source, size_t sourceSize, unsigned char *destination, size_t destinationSize)
+	{
+		if (sourceSize > LZ4_MAX_INPUT_SIZE || destinationSize > LZ4_MAX_INPUT_SIZE)
+			return false;
+
+		int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(source), reinterpret_cast<char*>(destination), static_cast<int>(sourceSize), static_cast<int>(destinationSize));
+		return decompressedSize >= 0 && static_cast<size_t>(decompressedSize) == destinationSize;
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+namespace Arcane
+{
+	enum class CompressionType : uint32_t
+	{
+		None = 0,
+		LZ4 = 1
+	};
+
+	class Compression
+	{
+	public:
+		// Returns false if the data couldn't be compressed or wouldn't get any smaller, callers should then store it uncompressed
+		static bool CompressLZ4(const unsigned char *source, size_t sourceSize, std::vector<unsigned char> &outCompressed);
+		static bool DecompressLZ4(const unsigned char *source, size_t sourceSize, unsigned char *destination, size_t destinationSize);
+	};
+}
+#endif
@@ -1,24 +1,19 @@
 #include "arcpch.h"
 #include "FileUtils.h"
 
+#include <Arcane/Util/VirtualFileSystem.h>
+
 namespace Arcane
 {
 	std::string FileUtils::ReadFile(const std::string &filepath)
 	{
-		std::ifstream ifs(filepath, std::ios::in, std::ios::binary);
-		std::string result;
-
-		if (ifs)
-		{
-			result = std::string((std::istreambuf_iterator<char>(ifs)),
-				(std::istreambuf_iterator<char>()));
-			ifs.close();
-		}
-		else
+		VirtualFile file = VirtualFileSystem::ReadFile(filepath);
+		if (!file.IsValid())
 		{
 			ARC_LOG_WARN("Failed to read file: {0}", filepath);
+			return std::string();
 		}
 
-		return result;
+		return file.ToString();
 	}
 }
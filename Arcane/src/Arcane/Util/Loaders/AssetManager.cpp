@@ -2,6 +2,7 @@
 #include "AssetManager.h"
 
 #include <Arcane/Graphics/Texture/Cubemap.h>
+#include <Arcane/Graphics/Texture/OrmTexture.h>
 #include <Arcane/Graphics/Mesh/Model.h>
 
 namespace Arcane
@@ -35,7 +36,8 @@ namespace Arcane
 	Model* AssetManager::LoadModel(const std::string &path)
 	{
 		// Check the cache
-		Model *modelCached = FetchModelFromCache(path);
+		StringId64 cacheKey = StringId64::HashOnly(path);
+		Model *modelCached = FetchModelFromCache(cacheKey);
 		if (modelCached)
 			return modelCached;
 
@@ -43,16 +45,19 @@ namespace Arcane
 
 		model->LoadModel(path);
 		model->GenerateGpuData();
+		model->m_IsLoaded = true;
 
-		m_ModelCache.insert(std::pair<std::string, Model*>(path, model));
+		cacheKey.Intern(path);
+		m_ModelCache.insert(std::pair<StringId64, Model*>(cacheKey, model));
 
 		return model;
 	}
 
-	Model* AssetManager::LoadModelAsync(const std::string &path, std::function<void(Model*)> callback)
+	Model* AssetManager::LoadModelAsync(const std::string &path, std::function<void(Model*)> callback, std::function<void()> failedCallback)
 	{
 		// Check the cache
-		Model *modelCached = FetchModelFromCache(path);
+		StringId64 cacheKey = StringId64::HashOnly(path);
+		Model *modelCached = FetchModelFromCache(cacheKey);
 		if (modelCached)
 			return modelCached;
 
@@ -60,10 +65,14 @@ namespace Arcane
 
 		ModelLoadJob job;
 		job.path = path;
+		job.cacheKey = cacheKey;
 		job.model = model;
 		if (callback)
 			job.callback = callback;
-		m_ModelCache.insert(std::pair<std::string, Model*>(path, model));
+		if (failedCallback)
+			job.failedCallback = failedCallback;
+		cacheKey.Intern(path);
+		m_ModelCache.insert(std::pair<StringId64, Model*>(cacheKey, model));
 		
 		++m_AssetsInFlight;
 		m_LoadingModelQueue.Push(job);
@@ -71,9 +80,21 @@ namespace Arcane
 		return model;
 	}
 
-	Model* AssetManager::FetchModelFromCache(const std::string &path)
+	void AssetManager::UnloadModel(const std::string &path)
 	{
-		auto iter = m_ModelCache.find(path);
+		auto iter = m_ModelCache.find(StringId64::HashOnly(path));
+		if (iter == m_ModelCache.end())
+			return;
+
+		iter->second->ReleaseGpuData();
+		iter->second->ReleaseMaterialTextures();
+		delete iter->second;
+		m_ModelCache.erase(iter);
+	}
+
+	Model* AssetManager::FetchModelFromCache(StringId64 key)
+	{
+		auto iter = m_ModelCache.find(key);
 		if (iter != m_ModelCache.end())
 		{
 			return iter->second;
@@ -86,7 +107,8 @@ namespace Arcane
 	Texture* AssetManager::Load2DTexture(const std::string &path, TextureSettings *settings)
 	{
 		// Check the cache
-		Texture *textureCached = FetchTextureFromCache(path);
+		StringId64 cacheKey = StringId64::HashOnly(path);
+		Texture *textureCached = FetchTextureFromCache(cacheKey);
 		if (textureCached)
 			return textureCached;
 
@@ -112,7 +134,10 @@ namespace Arcane
 
 		TextureLoader::Generate2DTexture(path, genData);
 
-		m_TextureCache.insert(std::pair<std::string, Texture*>(path, texture));
+		cacheKey.Intern(path);
+		std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+		m_TextureCache.insert(std::pair<StringId64, Texture*>(cacheKey, texture));
+		m_TextureReferences[cacheKey] = 1;
 
 		return texture;
 	}
@@ -121,7 +146,8 @@ namespace Arcane
 	Texture* AssetManager::Load2DTextureAsync(const std::string &path, TextureSettings *settings, std::function<void(Texture*)> callback)
 	{
 		// Check the cache
-		Texture *textureCached = FetchTextureFromCache(path);
+		StringId64 cacheKey = StringId64::HashOnly(path);
+		Texture *textureCached = FetchTextureFromCache(cacheKey);
 		if (textureCached)
 			return textureCached;
 
@@ -138,10 +164,16 @@ namespace Arcane
 		// Create the job for the worker threads, but before adding it to the queue, add it to the texture cache
 		TextureLoadJob job;
 		job.texturePath = path;
+		job.cacheKey = cacheKey;
 		job.generationData.texture = texture;
 		if (callback)
 			job.callback = callback;
-		m_TextureCache.insert(std::pair<std::string, Texture*>(path, texture));
+		cacheKey.Intern(path);
+		{
+			std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+			m_TextureCache.insert(std::pair<StringId64, Texture*>(cacheKey, texture));
+			m_TextureReferences[cacheKey] = 1;
+		}
 
 		++m_AssetsInFlight;
 		m_LoadingTexturesQueue.Push(job);
@@ -149,17 +181,130 @@ namespace Arcane
 		return texture;
 	}
 
-	Texture* AssetManager::FetchTextureFromCache(const std::string &path)
+	Texture* AssetManager::FetchTextureFromCache(StringId64 key)
 	{
-		auto iter = m_TextureCache.find(path);
+		std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+		auto iter = m_TextureCache.find(key);
 		if (iter != m_TextureCache.end())
 		{
+			m_TextureReferences[key]++;
 			return iter->second;
 		}
 
 		return nullptr;
 	}
 
+	void AssetManager::ReleaseTexture(const std::string &path)
+	{
+		StringId64 key = StringId64::HashOnly(path);
+		std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+		auto referenceIter = m_TextureReferences.find(key);
+		if (referenceIter == m_TextureReferences.end() || --referenceIter->second > 0)
+			return;
+
+		// One that is still loading gets freed by Update once it is generated, the load job still points at it
+		auto iter = m_TextureCache.find(key);
+		if (iter != m_TextureCache.end() && iter->second->IsGenerated())
+		{
+			delete iter->second;
+			m_TextureCache.erase(iter);
+			m_TextureReferences.erase(referenceIter);
+		}
+	}
+
+	bool AssetManager::FreeIfUnreferenced(StringId64 key, Texture *texture)
+	{
+		std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+		auto referenceIter = m_TextureReferences.find(key);
+		if (referenceIter == m_TextureReferences.end() || referenceIter->second > 0)
+			return false;
+
+		delete texture;
+		m_TextureCache.erase(key);
+		m_TextureReferences.erase(referenceIter);
+		return true;
+	}
+
+	std::string AssetManager::GetOrmCacheName(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath)
+	{
+		return occlusionPath + "|" + roughnessPath + "|" + metallicPath;
+	}
+
+	OrmTexture* AssetManager::LoadOrmTextureAsync(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath, TextureSettings *settings, std::function<void(OrmTexture*)> callback)
+	{
+		// Check the cache
+		std::string cacheName = GetOrmCacheName(occlusionPath, roughnessPath, metallicPath);
+		StringId64 cacheKey = StringId64::HashOnly(cacheName);
+		{
+			std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+			auto iter = m_OrmTextureCache.find(cacheKey);
+			if (iter != m_OrmTextureCache.end())
+			{
+				m_OrmTextureReferences[cacheKey]++;
+				return iter->second;
+			}
+		}
+
+		// The packed channels hold data so they are never sRGB, and views need a sized format
+		OrmTexture *ormTexture = new OrmTexture();
+		TextureSettings packedSettings = settings != nullptr ? *settings : TextureSettings();
+		packedSettings.TextureFormat = GL_RGB8;
+		packedSettings.IsSRGB = false;
+		packedSettings.IsNormalMap = false;
+		ormTexture->Packed.SetTextureSettings(packedSettings);
+
+		OrmTextureLoadJob job;
+		job.occlusionPath = occlusionPath;
+		job.roughnessPath = roughnessPath;
+		job.metallicPath = metallicPath;
+		job.cacheKey = cacheKey;
+		job.generationData.texture = ormTexture;
+		if (callback)
+			job.callback = callback;
+		cacheKey.Intern(cacheName);
+		{
+			std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+			m_OrmTextureCache.insert(std::pair<StringId64, OrmTexture*>(cacheKey, ormTexture));
+			m_OrmTextureReferences[cacheKey] = 1;
+		}
+
+		++m_AssetsInFlight;
+		m_LoadingOrmTexturesQueue.Push(job);
+
+		return ormTexture;
+	}
+
+	void AssetManager::ReleaseOrmTexture(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath)
+	{
+		StringId64 key = StringId64::HashOnly(GetOrmCacheName(occlusionPath, roughnessPath, metallicPath));
+		std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+		auto referenceIter = m_OrmTextureReferences.find(key);
+		if (referenceIter == m_OrmTextureReferences.end() || --referenceIter->second > 0)
+			return;
+
+		// One that is still loading gets freed by Update once it is generated, the load job still points at it
+		auto iter = m_OrmTextureCache.find(key);
+		if (iter != m_OrmTextureCache.end() && iter->second->IsGenerated())
+		{
+			delete iter->second;
+			m_OrmTextureCache.erase(iter);
+			m_OrmTextureReferences.erase(referenceIter);
+		}
+	}
+
+	bool AssetManager::FreeIfUnreferenced(StringId64 key, OrmTexture *ormTexture)
+	{
+		std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+		auto referenceIter = m_OrmTextureReferences.find(key);
+		if (referenceIter == m_OrmTextureReferences.end() || referenceIter->second > 0)
+			return false;
+
+		delete ormTexture;
+		m_OrmTextureCache.erase(key);
+		m_OrmTextureReferences.erase(referenceIter);
+		return true;
+	}
+
 	Cubemap* AssetManager::LoadCubemapTexture(const std::string &right, const std::string &left, const std::string &top, const std::string &bottom, const std::string &back, const std::string &front, CubemapSettings *settings)
 	{
 		Cubemap *cubemap = new Cubemap();
@@ -221,6 +366,15 @@ namespace Arcane
 					m_GenerateTexturesQueue.Push(loadJob);
 				}
 			}
+			if (!m_LoadingOrmTexturesQueue.Empty())
+			{
+				OrmTextureLoadJob loadJob;
+				if (m_LoadingOrmTexturesQueue.TryPop(loadJob))
+				{
+					TextureLoader::LoadOrmTextureData(loadJob.occlusionPath, loadJob.roughnessPath, loadJob.metallicPath, loadJob.generationData);
+					m_GenerateOrmTexturesQueue.Push(loadJob);
+				}
+			}
 			if (!m_LoadingCubemapQueue.Empty())
 			{
 				CubemapLoadJob loadJob;
@@ -241,7 +395,7 @@ namespace Arcane
 			}
 
 			// Should these asset threads be sleeping?
-			unsigned int workLoadSizeRemaining = m_LoadingTexturesQueue.Size() + m_LoadingCubemapQueue.Size() + m_LoadingModelQueue.Size();
+			unsigned int workLoadSizeRemaining = m_LoadingTexturesQueue.Size() + m_LoadingOrmTexturesQueue.Size() + m_LoadingCubemapQueue.Size() + m_LoadingModelQueue.Size();
 			const int msToWait = 10;
 			if (workLoadSizeRemaining <= 0)
 				std::this_thread::sleep_for(std::chrono::milliseconds(msToWait));
@@ -258,7 +412,11 @@ namespace Arcane
 			{
 				if (!loadJob.generationData.data)
 				{
-					m_TextureCache.erase(loadJob.texturePath);
+					{
+						std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+						m_TextureCache.erase(loadJob.cacheKey);
+						m_TextureReferences.erase(loadJob.cacheKey);
+					}
 					delete loadJob.generationData.texture;
 					--m_AssetsInFlight;
 					break;
@@ -266,13 +424,39 @@ namespace Arcane
 
 				TextureLoader::Generate2DTexture(loadJob.texturePath, loadJob.generationData);
 				--m_AssetsInFlight;
-				if (loadJob.callback)
+				if (!FreeIfUnreferenced(loadJob.cacheKey, loadJob.generationData.texture) && loadJob.callback)
 					loadJob.callback(loadJob.generationData.texture);
 
 				if (--texturesPerFrame <= 0)
 					break;
 			}
 		}
+		// Packed textures share the texture budget
+		while (texturesPerFrame > 0 && !m_GenerateOrmTexturesQueue.Empty())
+		{
+			OrmTextureLoadJob loadJob;
+			if (m_GenerateOrmTexturesQueue.TryPop(loadJob))
+			{
+				if (!loadJob.generationData.data)
+				{
+					{
+						std::lock_guard<std::mutex> lock(m_TextureCacheMutex);
+						m_OrmTextureCache.erase(loadJob.cacheKey);
+						m_OrmTextureReferences.erase(loadJob.cacheKey);
+					}
+					delete loadJob.generationData.texture;
+					--m_AssetsInFlight;
+					break;
+				}
+
+				TextureLoader::GenerateOrmTexture(loadJob.generationData);
+				--m_AssetsInFlight;
+				if (!FreeIfUnreferenced(loadJob.cacheKey, loadJob.generationData.texture) && loadJob.callback)
+					loadJob.callback(loadJob.generationData.texture);
+
+				--texturesPerFrame;
+			}
+		}
 		while (!m_GenerateCubemapQueue.Empty())
 		{
 			CubemapLoadJob loadJob;
@@ -301,13 +485,16 @@ namespace Arcane
 			{
 				if (loadJob.model->m_Meshes.size() == 0)
 				{
-					m_ModelCache.erase(loadJob.path);
+					m_ModelCache.erase(loadJob.cacheKey);
 					delete loadJob.model;
 					--m_AssetsInFlight;
+					if (loadJob.failedCallback)
+						loadJob.failedCallback();
 					break;
 				}
 
 				loadJob.model->GenerateGpuData();
+				loadJob.model->m_IsLoaded = true;
 				--m_AssetsInFlight;
 				if (loadJob.callback)
 					loadJob.callback(loadJob.model);
@@ -6,6 +6,14 @@
 #include <Arcane/Core/Threads/ThreadSafeQueue.h>
 #endif
 
+#ifndef LOCKFREEQUEUE_H
+#include <Arcane/Core/Threads/LockFreeQueue.h>
+#endif
+
+#ifndef STRINGID_H
+#include <Arcane/Util/StringId.h>
+#endif
+
 #ifndef TEXTURELOADER_H
 #include <Arcane/Util/Loaders/TextureLoader.h>
 #endif
@@ -18,10 +26,19 @@ namespace Arcane
 	struct TextureLoadJob
 	{
 		std::string texturePath;
+		StringId64 cacheKey; // Hashed once when the job is created
 		TextureGenerationData generationData;
 		std::function<void(Texture*)> callback = nullptr;
 	};
 
+	struct OrmTextureLoadJob
+	{
+		std::string occlusionPath, roughnessPath, metallicPath;
+		StringId64 cacheKey;
+		OrmTextureGenerationData generationData;
+		std::function<void(OrmTexture*)> callback = nullptr;
+	};
+
 	struct CubemapLoadJob
 	{
 		std::string texturePath;
@@ -32,8 +49,10 @@ namespace Arcane
 	struct ModelLoadJob
 	{
 		std::string path;
+		StringId64 cacheKey;
 		Model *model;
 		std::function<void(Model*)> callback = nullptr;
+		std::function<void()> failedCallback = nullptr;
 	};
 
 	class AssetManager : public Singleton
@@ -46,10 +65,18 @@ namespace Arcane
 		inline bool AssetsInFlight() { return m_AssetsInFlight > 0; }
 
 		Model* LoadModel(const std::string &path);
-		Model* LoadModelAsync(const std::string &path, std::function<void(Model*)> callback = nullptr);
+		Model* LoadModelAsync(const std::string &path, std::function<void(Model*)> callback = nullptr, std::function<void()> failedCallback = nullptr); // The returned model is deleted if the load fails, failedCallback is the only notice of that
+		void UnloadModel(const std::string &path); // Deletes a model that finished loading along with its GPU data, and releases its references to its material textures
 
+		// Every load (cache hits included) adds a reference to the texture. Whoever loaded it can release that reference, once none are left the texture is deleted
+		// Textures that are never released just stay cached for the lifetime of the asset manager
 		Texture* Load2DTexture(const std::string &path, TextureSettings *settings = nullptr);
 		Texture* Load2DTextureAsync(const std::string &path, TextureSettings *settings = nullptr, std::function<void(Texture*)> callback = nullptr);
+		void ReleaseTexture(const std::string &path);
+
+		// Packs a material's occlusion, roughness and metallic maps into one texture on the worker threads, any of the paths can be empty. Meant for single channel maps, only the first channel of each is kept
+		OrmTexture* LoadOrmTextureAsync(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath, TextureSettings *settings = nullptr, std::function<void(OrmTexture*)> callback = nullptr);
+		void ReleaseOrmTexture(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath);
 
 		// TODO: HDR loading
 		Cubemap* LoadCubemapTexture(const std::string &right, const std::string &left, const std::string &top, const std::string &bottom, const std::string &back, const std::string &front, CubemapSettings *settings = nullptr);
@@ -72,8 +99,12 @@ namespace Arcane
 		// Used to load resources asynchronously on a threadpool
 		void LoaderThread();
 
-		Model* FetchModelFromCache(const std::string &path);
-		Texture* FetchTextureFromCache(const std::string &path);
+		// Cache lookups take keys hashed with StringId64::HashOnly, keys are only interned when they are inserted
+		Model* FetchModelFromCache(StringId64 key);
+		Texture* FetchTextureFromCache(StringId64 key); // Adds a reference on a hit
+		bool FreeIfUnreferenced(StringId64 key, Texture *texture); // Frees a texture whose last reference was released while it was still loading
+		bool FreeIfUnreferenced(StringId64 key, OrmTexture *ormTexture);
+		static std::string GetOrmCacheName(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath);
 
 		std::vector<std::thread> m_WorkerThreads;
 		std::atomic<bool> m_LoadingThreadsActive;
@@ -82,16 +113,24 @@ namespace Arcane
 		// Keeps tracks of assets in flight, there can be a gap between the two queues and we need a way to know when all in-flight assets are complete. This is only incremented on asset load (main thread) and decremented on main thread when finishing creating the asset
 		int m_AssetsInFlight = 0;
 
-		std::unordered_map<std::string, Texture*> m_TextureCache;
+		// Loading queues are fed by the main thread so they stay unbounded, generate queues are fed by the worker threads and drained by the main thread so they use the lock-free queue (workers yield if the main thread falls behind)
+		std::mutex m_TextureCacheMutex; // Models load their material textures from the worker threads, guards both texture caches and their reference counts
+		std::unordered_map<StringId64, Texture*> m_TextureCache; // Keyed by the hashed asset path
+		std::unordered_map<StringId64, int> m_TextureReferences; // Same keys as m_TextureCache
+		std::unordered_map<StringId64, int> m_OrmTextureReferences; // Same keys as m_OrmTextureCache
 		ThreadSafeQueue<TextureLoadJob> m_LoadingTexturesQueue;
-		ThreadSafeQueue<TextureLoadJob> m_GenerateTexturesQueue;
+		LockFreeQueue<TextureLoadJob> m_GenerateTexturesQueue;
+
+		std::unordered_map<StringId64, OrmTexture*> m_OrmTextureCache; // Keyed by the hashed asset paths joined together
+		ThreadSafeQueue<OrmTextureLoadJob> m_LoadingOrmTexturesQueue;
+		LockFreeQueue<OrmTextureLoadJob> m_GenerateOrmTexturesQueue;
 
 		ThreadSafeQueue<CubemapLoadJob> m_LoadingCubemapQueue;
-		ThreadSafeQueue<CubemapLoadJob> m_GenerateCubemapQueue;
+		LockFreeQueue<CubemapLoadJob> m_GenerateCubemapQueue;
 
-		std::unordered_map<std::string, Model*> m_ModelCache;
+		std::unordered_map<StringId64, Model*> m_ModelCache; // Keyed by the hashed asset path
 		ThreadSafeQueue<ModelLoadJob> m_LoadingModelQueue;
-		ThreadSafeQueue<ModelLoadJob> m_GenerateModelQueue;
+		LockFreeQueue<ModelLoadJob> m_GenerateModelQueue;
 	};
 }
 #endif
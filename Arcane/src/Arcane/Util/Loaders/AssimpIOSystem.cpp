@@ -0,0 +1,71 @@
+#include "arcpch.h"
+#include "AssimpIOSystem.h"
+
+namespace Arcane
+{
+	bool AssimpIOSystem::Exists(const char *path) const
+	{
+		return VirtualFileSystem::Exists(path);
+	}
+
+	Assimp::IOStream* AssimpIOSystem::Open(const char *path, const char *mode)
+	{
+		// Packs are read only
+		if (strchr(mode, 'w') || strchr(mode, 'a'))
+			return nullptr;
+
+		VirtualFile file = VirtualFileSystem::ReadFile(path);
+		if (!file.IsValid())
+			return nullptr;
+
+		return new AssimpIOStream(std::move(file));
+	}
+
+	void AssimpIOSystem::Close(Assimp::IOStream *stream)
+	{
+		delete stream;
+	}
+
+	AssimpIOStream::AssimpIOStream(VirtualFile &&file) : m_File(std::move(file)), m_Position(0)
+	{
+
+	}
+
+	size_t AssimpIOStream::Read(void *buffer, size_t size, size_t count)
+	{
+		if (size == 0 || count == 0)
+			return 0;
+
+		size_t readCount = std::min(count, (m_File.GetSize() - m_Position) / size);
+		memcpy(buffer, m_File.GetData() + m_Position, readCount * size);
+		m_Position += readCount * size;
+		return readCount;
+	}
+
+	aiReturn AssimpIOStream::Seek(size_t offset, aiOrigin origin)
+	{
+		size_t newPosition;
+		switch (origin)
+		{
+		case aiOrigin_SET:
+			newPosition = offset;
+			break;
+		case aiOrigin_CUR:
+			newPosition = m_Position + offset;
+			break;
+		case aiOrigin_END:
+			if (offset > m_File.GetSize())
+				return aiReturn_FAILURE;
+			newPosition = m_File.GetSize() - offset;
+			break;
+		default:
+			return aiReturn_FAILURE;
+		}
+
+		if (newPosition > m_File.GetSize())
+			return aiReturn_FAILURE;
+
+		m_Position = newPosition;
+		return aiReturn_SUCCESS;
+	}
+}
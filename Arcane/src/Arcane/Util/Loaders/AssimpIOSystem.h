@@ -0,0 +1,40 @@
+#pragma once
+#ifndef ASSIMPIOSYSTEM_H
+#define ASSIMPIOSYSTEM_H
+
+#ifndef VIRTUALFILESYSTEM_H
+#include <Arcane/Util/VirtualFileSystem.h>
+#endif
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+namespace Arcane
+{
+	// Routes all of Assimp's file I/O (including the extra files a model references, like .mtl or .bin files) through the VirtualFileSystem
+	class AssimpIOSystem : public Assimp::IOSystem
+	{
+	public:
+		virtual bool Exists(const char *path) const override;
+		virtual char getOsSeparator() const override { return '/'; }
+		virtual Assimp::IOStream* Open(const char *path, const char *mode = "rb") override;
+		virtual void Close(Assimp::IOStream *stream) override;
+	};
+
+	class AssimpIOStream : public Assimp::IOStream
+	{
+	public:
+		AssimpIOStream(VirtualFile &&file);
+
+		virtual size_t Read(void *buffer, size_t size, size_t count) override;
+		virtual size_t Write(const void *buffer, size_t size, size_t count) override { return 0; }
+		virtual aiReturn Seek(size_t offset, aiOrigin origin) override;
+		virtual size_t Tell() const override { return m_Position; }
+		virtual size_t FileSize() const override { return m_File.GetSize(); }
+		virtual void Flush() override {}
+	private:
+		VirtualFile m_File;
+		size_t m_Position;
+	};
+}
+#endif
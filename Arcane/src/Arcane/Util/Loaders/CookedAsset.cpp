@@ -0,0 +1,82 @@
+#include "arcpch.h"
+#include "CookedAsset.h"
+
+#include <Arcane/Util/AssetPack.h>
+
+namespace Arcane
+{
+	std::string CookedAsset::GetCookedPath(const std::string &sourcePath, const char *extension)
+	{
+		return std::string(COOKED_ASSET_DIRECTORY) + AssetPack::NormalizePath(sourcePath) + extension;
+	}
+
+	uint64_t CookedAsset::HashContents(const unsigned char *data, size_t size)
+	{
+		return HashString64(reinterpret_cast<const char*>(data), size);
+	}
+
+	bool CookedAsset::HashFile(const std::string &path, uint64_t &outHash)
+	{
+		std::ifstream ifs(path, std::ios::in | std::ios::binary);
+		if (!ifs)
+			return false;
+
+		// Same FNV-1a as HashString64, streamed so large sources don't need to be held in memory
+		uint64_t hash = 14695981039346656037ull;
+		char buffer[64 * 1024];
+		while (ifs)
+		{
+			ifs.read(buffer, sizeof(buffer));
+			std::streamsize readCount = ifs.gcount();
+			for (std::streamsize i = 0; i < readCount; i++)
+			{
+				hash ^= static_cast<uint64_t>(static_cast<unsigned char>(buffer[i]));
+				hash *= 1099511628211ull;
+			}
+		}
+
+		outHash = hash;
+		return ifs.eof();
+	}
+
+	void CookedAsset::WriteHeader(std::ostream &stream, uint32_t magic, uint32_t version, uint64_t sourceHash)
+	{
+		CookedAssetHeader header;
+		header.Magic = magic;
+		header.Version = version;
+		header.SourceHash = sourceHash;
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(CookedAssetHeader));
+	}
+
+	VirtualFile CookedAsset::Open(const std::string &sourcePath, const char *extension, uint32_t magic, uint32_t version)
+	{
+		std::string cookedPath = GetCookedPath(sourcePath, extension);
+		if (!VirtualFileSystem::Exists(cookedPath))
+			return VirtualFile();
+
+		VirtualFile file = VirtualFileSystem::ReadFile(cookedPath);
+		if (!file.IsValid() || file.GetSize() < sizeof(CookedAssetHeader))
+			return VirtualFile();
+
+		CookedAssetHeader header;
+		memcpy(&header, file.GetData(), sizeof(CookedAssetHeader));
+		if (header.Magic != magic || header.Version != version)
+		{
+			ARC_LOG_WARN("Cooked asset is outdated, using the source asset until it is rebaked - {0}", cookedPath);
+			return VirtualFile();
+		}
+
+#if COOKED_ASSETS_VALIDATE_SOURCE
+		// Only loose sources can be edited after the bake, packed ones are always written together with their cooked asset
+		std::error_code error;
+		uint64_t sourceHash;
+		if (std::filesystem::is_regular_file(sourcePath, error) && HashFile(sourcePath, sourceHash) && sourceHash != header.SourceHash)
+		{
+			ARC_LOG_INFO("Source asset changed since it was baked, using the source asset - {0}", sourcePath);
+			return VirtualFile();
+		}
+#endif
+
+		return file;
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#ifndef COOKEDASSET_H
+#define COOKEDASSET_H
+
+#ifndef VIRTUALFILESYSTEM_H
+#include <Arcane/Util/VirtualFileSystem.h>
+#endif
+
+namespace Arcane
+{
+	struct CookedAssetHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceHash; // Content hash of the source file the asset was cooked from
+	};
+
+	/*
+		Shared bits of the runtime-ready files written by the AssetBaker. Every cooked file starts with a CookedAssetHeader followed by the payload of its type,
+		the loaders own the payload format (see Model::Cook and TextureLoader::CookTexture)
+	*/
+	class CookedAsset
+	{
+	public:
+		// Bump a version whenever its payload format or the processing done while cooking changes, the baker then recooks every asset of that type
+		static constexpr uint32_t ModelMagic = 0x4C444D41; // "AMDL"
+		static constexpr uint32_t ModelVersion = 3;
+		static constexpr uint32_t TextureMagic = 0x58455441; // "ATEX"
+		static constexpr uint32_t TextureVersion = 1;
+		static constexpr const char *ModelExtension = ".amdl";
+		static constexpr const char *TextureExtension = ".atex";
+
+		// ie: GetCookedPath("res/a.png", TextureExtension) -> COOKED_ASSET_DIRECTORY "res/a.png.atex"
+		static std::string GetCookedPath(const std::string &sourcePath, const char *extension);
+
+		static uint64_t HashContents(const unsigned char *data, size_t size);
+		static bool HashFile(const std::string &path, uint64_t &outHash); // Reads from the disk, not the VirtualFileSystem
+
+		static void WriteHeader(std::ostream &stream, uint32_t magic, uint32_t version, uint64_t sourceHash);
+
+		// Returns an invalid file if there is no cooked version, it was cooked by an older version or (with COOKED_ASSETS_VALIDATE_SOURCE) the loose source has changed since.
+		// The payload starts at sizeof(CookedAssetHeader)
+		static VirtualFile Open(const std::string &sourcePath, const char *extension, uint32_t magic, uint32_t version);
+	};
+}
+#endif
@@ -2,28 +2,62 @@
 #include "ShaderLoader.h"
 
 #include <Arcane/Graphics/Shader.h>
+#include <Arcane/Util/FileUtils.h>
 
 namespace Arcane
 {
 	// Static declarations
 	std::string ShaderLoader::s_ShaderFilepath;
-	std::unordered_map<std::size_t, Shader*> ShaderLoader::s_ShaderCache;
-	std::hash<std::string> ShaderLoader::s_Hasher;
+	std::unordered_map<StringId64, Shader*> ShaderLoader::s_ShaderCache;
+	std::thread ShaderLoader::s_PrefetchThread;
+	std::unordered_map<std::string, std::string> ShaderLoader::s_PrefetchedSources;
 
 	Shader* ShaderLoader::LoadShader(const std::string &path) {
 		std::string shaderPath = s_ShaderFilepath + path;
-		std::size_t hash = s_Hasher(shaderPath);
+		StringId64 shaderId = StringId64::HashOnly(shaderPath);
 
 		// Check the cache
-		auto iter = s_ShaderCache.find(hash);
+		auto iter = s_ShaderCache.find(shaderId);
 		if (iter != s_ShaderCache.end()) {
 			return iter->second;
 		}
 
-		// Load the shader
-		Shader *shader = new Shader(shaderPath);
+		// Load the shader, from the prefetched source if it's there
+		if (s_PrefetchThread.joinable())
+			s_PrefetchThread.join();
 
-		s_ShaderCache.insert(std::pair<std::size_t, Shader*>(hash, shader));
-		return s_ShaderCache[hash];
+		Shader *shader;
+		auto sourceIter = s_PrefetchedSources.find(shaderPath);
+		if (sourceIter != s_PrefetchedSources.end()) {
+			shader = new Shader(shaderPath, sourceIter->second);
+			s_PrefetchedSources.erase(sourceIter);
+		}
+		else {
+			shader = new Shader(shaderPath);
+		}
+
+		shaderId.Intern(shaderPath);
+		s_ShaderCache.insert(std::pair<StringId64, Shader*>(shaderId, shader));
+		return shader;
+	}
+
+	void ShaderLoader::PrefetchShaderSources() {
+		if (s_PrefetchThread.joinable())
+			return;
+
+		// Only loose files can be found this way, anything that isn't prefetched is just read by LoadShader
+		std::string shaderDirectory = s_ShaderFilepath;
+		s_PrefetchThread = std::thread([shaderDirectory]() {
+			std::error_code error;
+			for (const auto &directoryEntry : std::filesystem::recursive_directory_iterator(shaderDirectory, error)) {
+				if (!directoryEntry.is_regular_file() || directoryEntry.path().extension() != ".glsl")
+					continue;
+
+				std::string shaderPath = shaderDirectory + std::filesystem::relative(directoryEntry.path(), shaderDirectory, error).generic_string();
+				std::string source = FileUtils::ReadFile(shaderPath);
+				if (!source.empty())
+					s_PrefetchedSources.emplace(shaderPath, std::move(source));
+			}
+		});
 	}
 }
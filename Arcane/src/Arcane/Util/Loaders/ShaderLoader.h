@@ -2,6 +2,10 @@
 #ifndef SHADERLOADER_H
 #define SHADERLOADER_H
 
+#ifndef STRINGID_H
+#include <Arcane/Util/StringId.h>
+#endif
+
 namespace Arcane
 {
 	class Shader;
@@ -11,10 +15,15 @@ namespace Arcane
 	public:
 		static Shader* LoadShader(const std::string &path);
 		inline static void SetShaderFilepath(const std::string &path) { s_ShaderFilepath = path; }
+
+		// Reads every shader file under the shader filepath on another thread so the reads overlap with the rest of startup. The first LoadShader waits for it, prefetched shaders then only get compiled
+		static void PrefetchShaderSources();
 	private:
 		static std::string s_ShaderFilepath;
-		static std::unordered_map<std::size_t, Shader*> s_ShaderCache;
-		static std::hash<std::string> s_Hasher;
+		static std::unordered_map<StringId64, Shader*> s_ShaderCache;
+
+		static std::thread s_PrefetchThread;
+		static std::unordered_map<std::string, std::string> s_PrefetchedSources; // Keyed by the same full path LoadShader builds, entries are dropped once compiled
 	};
 }
 #endif
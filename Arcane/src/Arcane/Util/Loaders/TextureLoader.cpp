@@ -3,7 +3,11 @@
 
 #include <Arcane/Graphics/Texture/Texture.h>
 #include <Arcane/Graphics/Texture/Cubemap.h>
+#include <Arcane/Graphics/Texture/MipChainGenerator.h>
+#include <Arcane/Graphics/Texture/OrmTexture.h>
 #include <Arcane/Util/Loaders/AssetManager.h>
+#include <Arcane/Util/VirtualFileSystem.h>
+#include <Arcane/Util/Loaders/CookedAsset.h>
 
 namespace Arcane
 {
@@ -12,11 +16,56 @@ namespace Arcane
 	Texture *TextureLoader::s_WhiteTexture; Texture *TextureLoader::s_BlackTexture;
 	Texture *TextureLoader::s_WhiteTextureSRGB; Texture *TextureLoader::s_BlackTextureSRGB;
 
+	// Copies the first channel of an image out, that is the channel the shaders sampled from the separate PBR maps. Maps stored as RGB are fine as long as they are greyscale
+	static unsigned char* ExtractFirstChannel(const unsigned char *data, int width, int height, int components, const std::string &path)
+	{
+		size_t pixelCount = static_cast<size_t>(width) * height;
+		unsigned char *channel = static_cast<unsigned char*>(malloc(pixelCount));
+		bool isGreyscale = true;
+		for (size_t i = 0; i < pixelCount; i++)
+		{
+			const unsigned char *pixel = data + i * components;
+			channel[i] = pixel[0];
+			if (components >= 3 && (pixel[1] != pixel[0] || pixel[2] != pixel[0]))
+				isGreyscale = false;
+		}
+
+		if (!isGreyscale)
+			ARC_LOG_WARN("PBR map has colour in it, only its red channel gets packed - {0}", path);
+		return channel;
+	}
+
+	// Bilinear resample of a single channel into every stride-th byte of dest, only needed when a material's maps don't share a resolution
+	static void ResampleChannel(const unsigned char *source, int sourceWidth, int sourceHeight, unsigned char *dest, int destWidth, int destHeight, int destStride)
+	{
+		float scaleX = static_cast<float>(sourceWidth) / destWidth, scaleY = static_cast<float>(sourceHeight) / destHeight;
+		for (int y = 0; y < destHeight; y++)
+		{
+			float sourceY = glm::clamp((y + 0.5f) * scaleY - 0.5f, 0.0f, static_cast<float>(sourceHeight - 1));
+			int y0 = static_cast<int>(sourceY), y1 = glm::min(y0 + 1, sourceHeight - 1);
+			float weightY = sourceY - y0;
+			for (int x = 0; x < destWidth; x++)
+			{
+				float sourceX = glm::clamp((x + 0.5f) * scaleX - 0.5f, 0.0f, static_cast<float>(sourceWidth - 1));
+				int x0 = static_cast<int>(sourceX), x1 = glm::min(x0 + 1, sourceWidth - 1);
+				float weightX = sourceX - x0;
+
+				float top = glm::mix(static_cast<float>(source[y0 * sourceWidth + x0]), static_cast<float>(source[y0 * sourceWidth + x1]), weightX);
+				float bottom = glm::mix(static_cast<float>(source[y1 * sourceWidth + x0]), static_cast<float>(source[y1 * sourceWidth + x1]), weightX);
+				dest[(static_cast<size_t>(y) * destWidth + x) * destStride] = static_cast<unsigned char>(glm::mix(top, bottom, weightY) + 0.5f);
+			}
+		}
+	}
+
 	void TextureLoader::Load2DTextureData(const std::string &path, TextureGenerationData &inOutData)
 	{
 		// Load the texture data from file
 		int numComponents;
-		inOutData.data = stbi_load(path.c_str(), &inOutData.width, &inOutData.height, &numComponents, 0);
+		if (!LoadCookedTextureData(path, inOutData.width, inOutData.height, numComponents, inOutData.data))
+		{
+			VirtualFile file = VirtualFileSystem::ReadFile(path);
+			inOutData.data = file.IsValid() ? stbi_load_from_memory(file.GetData(), static_cast<int>(file.GetSize()), &inOutData.width, &inOutData.height, &numComponents, 0) : nullptr;
+		}
 		if (!inOutData.data)
 		{
 			ARC_LOG_ERROR("Failed to load texture path: {0}", path);
@@ -30,18 +79,143 @@ namespace Arcane
 		case 3: inOutData.dataFormat = GL_RGB;  break;
 		case 4: inOutData.dataFormat = GL_RGBA; break;
 		}
+
+#if CPU_MIP_GENERATION
+		// Build the mip chain here so generating the texture on the main thread is only an upload. The settings are set before the load job is queued
+		const TextureSettings &settings = inOutData.texture->GetTextureSettings();
+		if (settings.HasMips && numComponents != 2)
+		{
+			MipChainSettings mipSettings;
+			mipSettings.Filter = CPU_MIP_KAISER_FILTER ? MipFilter::Kaiser : MipFilter::Box;
+			mipSettings.IsSRGB = settings.IsSRGB;
+			mipSettings.IsNormalMap = settings.IsNormalMap;
+			mipSettings.WrapS = settings.TextureWrapSMode == GL_REPEAT || settings.TextureWrapSMode == GL_MIRRORED_REPEAT;
+			mipSettings.WrapT = settings.TextureWrapTMode == GL_REPEAT || settings.TextureWrapTMode == GL_MIRRORED_REPEAT;
+
+			inOutData.mipData = MipChainGenerator::Generate(inOutData.data, inOutData.width, inOutData.height, numComponents, mipSettings);
+			inOutData.mipLevelCount = MipChainGenerator::GetMipLevelCount(inOutData.width, inOutData.height);
+		}
+#endif
 	}
 
 	void TextureLoader::Generate2DTexture(const std::string &path, TextureGenerationData &inOutData)
 	{
-		inOutData.texture->Generate2DTexture(inOutData.width, inOutData.height, inOutData.dataFormat, GL_UNSIGNED_BYTE, inOutData.data);
+		if (inOutData.mipData)
+		{
+			inOutData.texture->Generate2DTextureWithMips(inOutData.width, inOutData.height, inOutData.dataFormat, inOutData.data, inOutData.mipData, inOutData.mipLevelCount);
+			free(inOutData.mipData);
+		}
+		else
+		{
+			inOutData.texture->Generate2DTexture(inOutData.width, inOutData.height, inOutData.dataFormat, GL_UNSIGNED_BYTE, inOutData.data);
+		}
 		stbi_image_free(inOutData.data);
 	}
+
+	void TextureLoader::LoadOrmTextureData(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath, OrmTextureGenerationData &inOutData)
+	{
+		// Missing occlusion is packed as white so it has no effect, missing roughness and metallic are ignored by the shaders in favour of the material's values
+		const std::string *paths[3] = { &occlusionPath, &roughnessPath, &metallicPath };
+		const unsigned char defaultValues[3] = { 255, 255, 0 };
+		unsigned char *channels[3] = { nullptr, nullptr, nullptr };
+		int widths[3] = { 0, 0, 0 }, heights[3] = { 0, 0, 0 };
+
+		inOutData.width = 0;
+		inOutData.height = 0;
+		inOutData.data = nullptr;
+		for (int i = 0; i < 3; i++)
+		{
+			if (paths[i]->empty())
+				continue;
+
+			int numComponents;
+			unsigned char *data;
+			if (!LoadCookedTextureData(*paths[i], widths[i], heights[i], numComponents, data))
+			{
+				VirtualFile file = VirtualFileSystem::ReadFile(*paths[i]);
+				data = file.IsValid() ? stbi_load_from_memory(file.GetData(), static_cast<int>(file.GetSize()), &widths[i], &heights[i], &numComponents, 0) : nullptr;
+			}
+			if (!data)
+			{
+				ARC_LOG_ERROR("Failed to load texture path: {0}", *paths[i]);
+				continue;
+			}
+
+			channels[i] = ExtractFirstChannel(data, widths[i], heights[i], numComponents, *paths[i]);
+			stbi_image_free(data);
+			inOutData.width = glm::max(inOutData.width, widths[i]);
+			inOutData.height = glm::max(inOutData.height, heights[i]);
+		}
+		if (!channels[0] && !channels[1] && !channels[2])
+			return;
+
+		inOutData.hasOcclusion = channels[0] != nullptr;
+		inOutData.hasRoughness = channels[1] != nullptr;
+		inOutData.hasMetallic = channels[2] != nullptr;
+
+		size_t pixelCount = static_cast<size_t>(inOutData.width) * inOutData.height;
+		inOutData.data = static_cast<unsigned char*>(malloc(pixelCount * 3));
+		for (int i = 0; i < 3; i++)
+		{
+			unsigned char *dest = inOutData.data + i;
+			if (!channels[i])
+			{
+				for (size_t j = 0; j < pixelCount; j++)
+					dest[j * 3] = defaultValues[i];
+				continue;
+			}
+
+			if (widths[i] == inOutData.width && heights[i] == inOutData.height)
+			{
+				for (size_t j = 0; j < pixelCount; j++)
+					dest[j * 3] = channels[i][j];
+			}
+			else
+			{
+				ARC_LOG_WARN("PBR map is {0}x{1} but the material's largest is {2}x{3}, it gets resampled to be packed - {4}", widths[i], heights[i], inOutData.width, inOutData.height, *paths[i]);
+				ResampleChannel(channels[i], widths[i], heights[i], dest, inOutData.width, inOutData.height, 3);
+			}
+			free(channels[i]);
+		}
+
+		// Always built here regardless of CPU_MIP_GENERATION, the channel views are made before any GPU mip generation could run
+		const TextureSettings &settings = inOutData.texture->Packed.GetTextureSettings();
+		if (settings.HasMips)
+		{
+			MipChainSettings mipSettings;
+			mipSettings.Filter = CPU_MIP_KAISER_FILTER ? MipFilter::Kaiser : MipFilter::Box;
+			mipSettings.WrapS = settings.TextureWrapSMode == GL_REPEAT || settings.TextureWrapSMode == GL_MIRRORED_REPEAT;
+			mipSettings.WrapT = settings.TextureWrapTMode == GL_REPEAT || settings.TextureWrapTMode == GL_MIRRORED_REPEAT;
+
+			inOutData.mipData = MipChainGenerator::Generate(inOutData.data, inOutData.width, inOutData.height, 3, mipSettings);
+			inOutData.mipLevelCount = MipChainGenerator::GetMipLevelCount(inOutData.width, inOutData.height);
+		}
+	}
+
+	void TextureLoader::GenerateOrmTexture(OrmTextureGenerationData &inOutData)
+	{
+		OrmTexture *ormTexture = inOutData.texture;
+		ormTexture->Packed.Generate2DTextureWithMips(inOutData.width, inOutData.height, GL_RGB, inOutData.data, inOutData.mipData, inOutData.mipData ? inOutData.mipLevelCount : 1);
+		ormTexture->OcclusionView.Generate2DChannelView(ormTexture->Packed, GL_RED);
+		ormTexture->RoughnessView.Generate2DChannelView(ormTexture->Packed, GL_GREEN);
+		ormTexture->MetallicView.Generate2DChannelView(ormTexture->Packed, GL_BLUE);
+		ormTexture->HasOcclusion = inOutData.hasOcclusion;
+		ormTexture->HasRoughness = inOutData.hasRoughness;
+		ormTexture->HasMetallic = inOutData.hasMetallic;
+
+		free(inOutData.mipData);
+		free(inOutData.data);
+	}
+
 	void TextureLoader::LoadCubemapTextureData(const std::string &path, CubemapGenerationData &inOutData)
 	{
 		// Load the cubemap data from file
 		int numComponents;
-		inOutData.data = stbi_load(path.c_str(), &inOutData.width, &inOutData.height, &numComponents, 0);
+		if (!LoadCookedTextureData(path, inOutData.width, inOutData.height, numComponents, inOutData.data))
+		{
+			VirtualFile file = VirtualFileSystem::ReadFile(path);
+			inOutData.data = file.IsValid() ? stbi_load_from_memory(file.GetData(), static_cast<int>(file.GetSize()), &inOutData.width, &inOutData.height, &numComponents, 0) : nullptr;
+		}
 		if (!inOutData.data)
 		{
 			ARC_LOG_ERROR("Failed to load cubemap face: {0}, at path: {1} - Reason: {2}", inOutData.face, path, stbi_failure_reason());
@@ -63,6 +237,66 @@ namespace Arcane
 		stbi_image_free(inOutData.data);
 	}
 
+	bool TextureLoader::CookTexture(const std::string &sourcePath, const std::string &cookedPath, uint64_t sourceHash)
+	{
+		int width, height, numComponents;
+		VirtualFile file = VirtualFileSystem::ReadFile(sourcePath);
+		unsigned char *data = file.IsValid() ? stbi_load_from_memory(file.GetData(), static_cast<int>(file.GetSize()), &width, &height, &numComponents, 0) : nullptr;
+		if (!data)
+		{
+			ARC_LOG_ERROR("Failed to cook texture: {0} - Reason: {1}", sourcePath, stbi_failure_reason());
+			return false;
+		}
+
+		std::ofstream ofs(cookedPath, std::ios::out | std::ios::binary);
+		if (!ofs)
+		{
+			ARC_LOG_ERROR("Failed to open cooked texture for writing - {0}", cookedPath);
+			stbi_image_free(data);
+			return false;
+		}
+
+		uint32_t dimensions[3] = { static_cast<uint32_t>(width), static_cast<uint32_t>(height), static_cast<uint32_t>(numComponents) };
+		CookedAsset::WriteHeader(ofs, CookedAsset::TextureMagic, CookedAsset::TextureVersion, sourceHash);
+		ofs.write(reinterpret_cast<const char*>(dimensions), sizeof(dimensions));
+		ofs.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(width) * height * numComponents);
+		stbi_image_free(data);
+
+		return ofs.good();
+	}
+
+	bool TextureLoader::LoadCookedTextureData(const std::string &path, int &outWidth, int &outHeight, int &outComponents, unsigned char *&outData)
+	{
+#if USE_COOKED_ASSETS
+		VirtualFile file = CookedAsset::Open(path, CookedAsset::TextureExtension, CookedAsset::TextureMagic, CookedAsset::TextureVersion);
+		if (!file.IsValid())
+			return false;
+
+		uint32_t dimensions[3];
+		size_t payloadOffset = sizeof(CookedAssetHeader) + sizeof(dimensions);
+		if (file.GetSize() < payloadOffset)
+			return false;
+		memcpy(dimensions, file.GetData() + sizeof(CookedAssetHeader), sizeof(dimensions));
+
+		size_t pixelBytes = static_cast<size_t>(dimensions[0]) * dimensions[1] * dimensions[2];
+		if (file.GetSize() - payloadOffset < pixelBytes || dimensions[2] < 1 || dimensions[2] > 4)
+		{
+			ARC_LOG_ERROR("Corrupt cooked texture for - {0}", path);
+			return false;
+		}
+
+		// Pixels are released with stbi_image_free by the generate step, so allocate them the same way stb does
+		outData = static_cast<unsigned char*>(malloc(pixelBytes));
+		memcpy(outData, file.GetData() + payloadOffset, pixelBytes);
+		outWidth = static_cast<int>(dimensions[0]);
+		outHeight = static_cast<int>(dimensions[1]);
+		outComponents = static_cast<int>(dimensions[2]);
+		return true;
+#else
+		return false;
+#endif
+	}
+
 	void TextureLoader::InitializeDefaultTextures()
 	{
 		// Setup texture and minimal filtering because they are 1x1 textures so they require none
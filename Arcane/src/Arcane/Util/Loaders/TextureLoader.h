@@ -8,15 +8,28 @@ namespace Arcane
 	struct TextureSettings;
 	class Cubemap;
 	struct CubemapSettings;
+	struct OrmTexture;
 
 	struct TextureGenerationData
 	{
 		int width, height;
 		GLenum dataFormat;
 		unsigned char *data;
+		unsigned char *mipData = nullptr; // Levels 1 and up when the mip chain was built on the loader thread (CPU_MIP_GENERATION)
+		int mipLevelCount = 0;
 		Texture *texture;
 	};
 
+	struct OrmTextureGenerationData
+	{
+		int width, height;
+		unsigned char *data; // Occlusion, roughness and metallic interleaved as RGB
+		unsigned char *mipData = nullptr;
+		int mipLevelCount = 0;
+		bool hasOcclusion = false, hasRoughness = false, hasMetallic = false;
+		OrmTexture *texture;
+	};
+
 	struct CubemapGenerationData
 	{
 		int width, height;
@@ -30,12 +43,21 @@ namespace Arcane
 	{
 		friend class AssetManager;
 		friend class Application;
+		friend class AssetBaker;
+		friend class ThumbnailGenerator;
 	private:
 		static void InitializeDefaultTextures();
 
+		// Cooked textures store the decoded pixels so loading them skips the image decode
+		static bool CookTexture(const std::string &sourcePath, const std::string &cookedPath, uint64_t sourceHash);
+		static bool LoadCookedTextureData(const std::string &path, int &outWidth, int &outHeight, int &outComponents, unsigned char *&outData);
+
 		static void Load2DTextureData(const std::string &path, TextureGenerationData &inOutData);
 		static void Generate2DTexture(const std::string &path, TextureGenerationData &inOutData);
 
+		static void LoadOrmTextureData(const std::string &occlusionPath, const std::string &roughnessPath, const std::string &metallicPath, OrmTextureGenerationData &inOutData);
+		static void GenerateOrmTexture(OrmTextureGenerationData &inOutData);
+
 		static void LoadCubemapTextureData(const std::string &path, CubemapGenerationData &inOutData);
 		static void GenerateCubemapTexture(const std::string &path, CubemapGenerationData &inOutData);
 	private:
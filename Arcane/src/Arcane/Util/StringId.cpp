@@ -0,0 +1,50 @@
+#include "arcpch.h"
+#include "StringId.h"
+
+namespace Arcane
+{
+#if !ARC_FINAL
+	// Function statics so the registry is valid even if a StringId is constructed during static initialization
+	static std::mutex& GetRegistryMutex()
+	{
+		static std::mutex registryMutex;
+		return registryMutex;
+	}
+
+	static std::unordered_map<uint64_t, std::string>& GetRegistry(int hashBits)
+	{
+		static std::unordered_map<uint64_t, std::string> registry32, registry64;
+		return hashBits == 64 ? registry64 : registry32;
+	}
+#endif
+
+	void StringIdRegistry::Register(uint64_t hash, int hashBits, const char *str, size_t length)
+	{
+#if !ARC_FINAL
+		std::lock_guard<std::mutex> lock(GetRegistryMutex());
+		auto &registry = GetRegistry(hashBits);
+
+		auto iter = registry.find(hash);
+		if (iter == registry.end())
+		{
+			registry.emplace(hash, std::string(str, length));
+			return;
+		}
+
+		ARC_ASSERT(iter->second.compare(0, std::string::npos, str, length) == 0, "String ID hash collision detected");
+#endif
+	}
+
+	const char* StringIdRegistry::Lookup(uint64_t hash, int hashBits)
+	{
+#if !ARC_FINAL
+		std::lock_guard<std::mutex> lock(GetRegistryMutex());
+		auto &registry = GetRegistry(hashBits);
+
+		auto iter = registry.find(hash);
+		if (iter != registry.end())
+			return iter->second.c_str();
+#endif
+		return nullptr;
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+#ifndef STRINGID_H
+#define STRINGID_H
+
+namespace Arcane
+{
+	// FNV-1a, constexpr so string literals can be hashed at compile time
+	constexpr uint32_t HashString32(const char *str, size_t length)
+	{
+		uint32_t hash = 2166136261u;
+		for (size_t i = 0; i < length; ++i)
+		{
+			hash ^= static_cast<uint32_t>(static_cast<unsigned char>(str[i]));
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	constexpr uint64_t HashString64(const char *str, size_t length)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (size_t i = 0; i < length; ++i)
+		{
+			hash ^= static_cast<uint64_t>(static_cast<unsigned char>(str[i]));
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	constexpr size_t StringLength(const char *str)
+	{
+		size_t length = 0;
+		while (str[length] != '\0')
+			++length;
+		return length;
+	}
+
+	/*
+		Global registry used for reverse lookups (hash -> original string) and collision detection. Only active in non-final builds, final builds
+		only ever deal with the hashes
+	*/
+	class StringIdRegistry
+	{
+	public:
+		static void Register(uint64_t hash, int hashBits, const char *str, size_t length);
+		static const char* Lookup(uint64_t hash, int hashBits);
+	};
+
+	/*
+		Hashed string that can be used as a hot-path key, comparisons and hashing are integer operations. 32 bit IDs are good for small sets (uniforms, bones),
+		use the 64 bit version for large sets like asset paths where collisions are more likely.
+		Constructing from a runtime string interns it (registers it for reverse lookups in non-final builds, which takes a lock), constructing from a literal with ARC_SID is compile-time.
+		Hot lookups should use HashOnly/FromLiteral and only Intern the keys that get inserted
+	*/
+	template<typename HashType>
+	class BasicStringId
+	{
+	public:
+		constexpr BasicStringId() : m_Hash(0) {}
+		constexpr explicit BasicStringId(HashType hash) : m_Hash(hash) {}
+		BasicStringId(const char *str) : BasicStringId(str, StringLength(str)) {}
+		BasicStringId(const std::string &str) : BasicStringId(str.c_str(), str.size()) {}
+		BasicStringId(const char *str, size_t length) : m_Hash(Hash(str, length))
+		{
+#if !ARC_FINAL
+			StringIdRegistry::Register(m_Hash, sizeof(HashType) * 8, str, length);
+#endif
+		}
+
+		static constexpr HashType Hash(const char *str, size_t length)
+		{
+			if constexpr (sizeof(HashType) == sizeof(uint64_t))
+				return HashString64(str, length);
+			else
+				return HashString32(str, length);
+		}
+
+		// Hashes without interning, use when the string is not needed for debugging and the call is hot
+		static constexpr BasicStringId FromLiteral(const char *str) { return BasicStringId(Hash(str, StringLength(str))); }
+		static BasicStringId HashOnly(const std::string &str) { return BasicStringId(Hash(str.c_str(), str.size())); }
+
+		// Interns an id that was created without interning, ie: a lookup key that missed and is about to be inserted, so the string isn't hashed twice
+		void Intern(const char *str, size_t length) const
+		{
+#if !ARC_FINAL
+			StringIdRegistry::Register(m_Hash, sizeof(HashType) * 8, str, length);
+#endif
+		}
+		void Intern(const std::string &str) const { Intern(str.c_str(), str.size()); }
+
+		inline constexpr HashType GetHash() const { return m_Hash; }
+		inline constexpr bool IsValid() const { return m_Hash != 0; }
+
+		// Returns the original string if it was interned, only available in non-final builds
+		const char* GetString() const
+		{
+#if !ARC_FINAL
+			const char *str = StringIdRegistry::Lookup(m_Hash, sizeof(HashType) * 8);
+			return str ? str : "<unknown string id>";
+#else
+			return "<string ids stripped>";
+#endif
+		}
+
+		inline constexpr bool operator==(const BasicStringId &other) const { return m_Hash == other.m_Hash; }
+		inline constexpr bool operator!=(const BasicStringId &other) const { return m_Hash != other.m_Hash; }
+		inline constexpr bool operator<(const BasicStringId &other) const { return m_Hash < other.m_Hash; }
+	private:
+		HashType m_Hash;
+	};
+
+	typedef BasicStringId<uint32_t> StringId;
+	typedef BasicStringId<uint64_t> StringId64;
+}
+
+namespace std
+{
+	template<typename HashType>
+	struct hash<Arcane::BasicStringId<HashType>>
+	{
+		size_t operator()(const Arcane::BasicStringId<HashType> &id) const { return static_cast<size_t>(id.GetHash()); }
+	};
+}
+
+// Compile-time string id for literals, ie: ARC_SID("view")
+#define ARC_SID(str) (::Arcane::StringId(std::integral_constant<uint32_t, ::Arcane::HashString32(str, sizeof(str) - 1)>::value))
+#endif
@@ -0,0 +1,277 @@
+#include "arcpch.h"
+#include "ThumbnailGenerator.h"
+
+#include <Arcane/Graphics/Shader.h>
+#include <Arcane/Graphics/Mesh/Model.h>
+#include <Arcane/Graphics/Texture/OrmTexture.h>
+#include <Arcane/Graphics/Renderer/GLCache.h>
+#include <Arcane/Graphics/Renderer/Renderer.h>
+#include <Arcane/Graphics/Renderer/FrameCapture.h>
+#include <Arcane/Platform/OpenGL/Framebuffer/Framebuffer.h>
+#include <Arcane/Util/AssetBaker.h>
+#include <Arcane/Util/AssetPack.h>
+#include <Arcane/Util/Loaders/AssetManager.h>
+#include <Arcane/Util/Loaders/ShaderLoader.h>
+#include <Arcane/Util/Loaders/TextureLoader.h>
+
+namespace Arcane
+{
+	static const int s_ThumbnailTexturesPerUpdate = 16;
+	static const int s_ThumbnailModelsPerUpdate = 2;
+
+	struct PendingThumbnail
+	{
+		std::string SourcePath;
+		Model *LoadedModel = nullptr;
+		double LoadedTime = 0.0;
+		bool Failed = false;
+	};
+
+	static bool IsTextureReady(const Texture *texture)
+	{
+		return !texture || texture->IsGenerated();
+	}
+
+	// Model textures are queued on the workers while the model is imported, so they usually finish shortly after the model itself
+	static bool AreMaterialTexturesReady(Model *model)
+	{
+		for (Mesh &mesh : model->GetMeshes())
+		{
+			Material &material = mesh.GetMaterial();
+			if (!IsTextureReady(material.GetAlbedoMap()) || !IsTextureReady(material.GetNormalMap()) || !IsTextureReady(material.GetEmissionMap()))
+				return false;
+
+			OrmTexture *ormTexture = material.GetOrmTexture();
+			if (ormTexture)
+			{
+				if (!ormTexture->IsGenerated())
+					return false;
+			}
+			else if (!IsTextureReady(material.GetMetallicMap()) || !IsTextureReady(material.GetRoughnessMap()) || !IsTextureReady(material.GetAmbientOcclusionMap()))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	ThumbnailResult ThumbnailGenerator::Generate(const ThumbnailSettings &settings)
+	{
+		ThumbnailResult result;
+
+		// Gather the work, sorted so runs are reproducible
+		std::vector<std::string> modelPaths;
+		std::error_code error;
+		for (const auto &directoryEntry : std::filesystem::recursive_directory_iterator(settings.SourceDirectory, error))
+		{
+			if (directoryEntry.is_regular_file() && AssetBaker::IsModelFile(directoryEntry.path()))
+				modelPaths.push_back(directoryEntry.path().generic_string());
+		}
+		if (error)
+		{
+			ARC_LOG_ERROR("Failed to walk the model directory {0} - {1}", settings.SourceDirectory, error.message());
+			result.Failed++;
+			return result;
+		}
+		std::sort(modelPaths.begin(), modelPaths.end());
+
+		ARC_LOG_INFO("Generating {0} thumbnails from {1} at {2}x{2}", modelPaths.size(), settings.SourceDirectory, settings.Size);
+
+		Shader *thumbnailShader = ShaderLoader::LoadShader("Thumbnail.glsl");
+		Framebuffer renderTarget(settings.Size, settings.Size, true);
+		renderTarget.AddColorTexture(Normalized8).AddDepthStencilRBO(NormalizedDepthStencil).CreateFramebuffer();
+		Framebuffer resolveTarget(settings.Size, settings.Size, false);
+		resolveTarget.AddColorTexture(Normalized8).CreateFramebuffer();
+
+		// Entries are referenced by the load callbacks so they need stable addresses
+		AssetManager &assetManager = AssetManager::GetInstance();
+		std::vector<std::unique_ptr<PendingThumbnail>> inFlight;
+		size_t nextModel = 0;
+		size_t modelsInFlight = static_cast<size_t>(std::max(settings.ModelsInFlight, 1));
+		std::filesystem::path outputDirectory(settings.OutputDirectory);
+		while (nextModel < modelPaths.size() || !inFlight.empty())
+		{
+			// Keep the workers ahead of the renderer
+			while (inFlight.size() < modelsInFlight && nextModel < modelPaths.size())
+			{
+				inFlight.push_back(std::make_unique<PendingThumbnail>());
+				PendingThumbnail *pending = inFlight.back().get();
+				pending->SourcePath = modelPaths[nextModel++];
+				assetManager.LoadModelAsync(pending->SourcePath,
+					[pending](Model *loadedModel)
+					{
+						pending->LoadedModel = loadedModel;
+						pending->LoadedTime = glfwGetTime();
+					},
+					[pending]() { pending->Failed = true; });
+			}
+
+			assetManager.Update(s_ThumbnailTexturesPerUpdate, 1, s_ThumbnailModelsPerUpdate);
+
+			// Queues the last thumbnail's readback and hands finished ones to the workers. If the ring had no room the target still holds that thumbnail and can't be drawn over yet
+			FrameCapture::OnFrameRendered(&resolveTarget);
+			if (FrameCapture::IsScreenshotPending())
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			bool renderedThumbnail = false;
+			double currentTime = glfwGetTime();
+			for (auto iter = inFlight.begin(); iter != inFlight.end(); )
+			{
+				if ((*iter)->Failed)
+				{
+					ARC_LOG_ERROR("Failed to load model for its thumbnail - {0}", (*iter)->SourcePath);
+					result.Failed++;
+					iter = inFlight.erase(iter);
+					continue;
+				}
+				if (!(*iter)->LoadedModel || (!AreMaterialTexturesReady((*iter)->LoadedModel) && currentTime - (*iter)->LoadedTime < THUMBNAIL_TEXTURE_WAIT_SECONDS))
+				{
+					++iter;
+					continue;
+				}
+
+				// One per update, the next one has to wait for this capture to get a readback slot
+				RenderThumbnail((*iter)->LoadedModel, thumbnailShader, &renderTarget, &resolveTarget, settings);
+				FrameCapture::RequestScreenshot((outputDirectory / (AssetPack::NormalizePath((*iter)->SourcePath) + ".png")).string());
+				result.Rendered++;
+
+				assetManager.UnloadModel((*iter)->SourcePath);
+				inFlight.erase(iter);
+				renderedThumbnail = true;
+				break;
+			}
+
+			// Nothing was ready so the workers are the bottleneck, don't compete with them for the CPU
+			if (!renderedThumbnail)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		// The last thumbnail still needs a slot before its target goes away
+		FrameCapture::OnFrameRendered(&resolveTarget);
+		while (FrameCapture::IsScreenshotPending())
+		{
+			std::this_thread::yield();
+			FrameCapture::OnFrameRendered(&resolveTarget);
+		}
+
+		return result;
+	}
+
+	void ThumbnailGenerator::RenderThumbnail(Model *model, Shader *shader, Framebuffer *renderTarget, Framebuffer *resolveTarget, const ThumbnailSettings &settings)
+	{
+		// Fit the bounding sphere inside the frustum, so the model fits no matter which way it's turned
+		AABB bounds = model->ComputeBounds();
+		glm::vec3 boundsCentre = (bounds.Min + bounds.Max) * 0.5f;
+		float boundsRadius = glm::max(glm::length(bounds.Max - bounds.Min) * 0.5f, 0.0001f);
+		float halfFieldOfView = glm::radians(THUMBNAIL_FIELD_OF_VIEW) * 0.5f;
+		float cameraDistance = boundsRadius / std::sin(halfFieldOfView);
+
+		// Three quarter view from the front right and slightly above, with the key light coming from the upper left
+		glm::vec3 cameraPosition = boundsCentre + glm::normalize(glm::vec3(0.6f, 0.45f, 1.0f)) * cameraDistance;
+		glm::mat4 view = glm::lookAt(cameraPosition, boundsCentre, glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 projection = glm::perspective(2.0f * halfFieldOfView, 1.0f, glm::max(cameraDistance - boundsRadius, cameraDistance * 0.01f), cameraDistance + boundsRadius);
+
+		GLCache *glCache = GLCache::GetInstance();
+		renderTarget->Bind();
+		glViewport(0, 0, renderTarget->GetWidth(), renderTarget->GetHeight());
+		glm::vec4 clearColour = glm::vec4(settings.BackgroundColour, 1.0f);
+		glClearNamedFramebufferfv(renderTarget->GetFramebuffer(), GL_COLOR, 0, &clearColour[0]);
+		float clearDepth = 1.0f;
+		glClearNamedFramebufferfv(renderTarget->GetFramebuffer(), GL_DEPTH, 0, &clearDepth);
+		glCache->SetDepthTest(true);
+		glCache->SetStencilTest(false);
+		glCache->SetBlend(false);
+		glCache->SetMultisample(true);
+		glCache->SetFaceCull(false); // Foliage cards are often single sided
+		glCache->SetShader(shader);
+
+		shader->SetUniform(ARC_UNIFORM("model"), glm::mat4(1.0f));
+		shader->SetUniform(ARC_UNIFORM("normalMatrix"), glm::mat3(1.0f));
+		shader->SetUniform(ARC_UNIFORM("view"), view);
+		shader->SetUniform(ARC_UNIFORM("projection"), projection);
+		shader->SetUniform(ARC_UNIFORM("viewPos"), cameraPosition);
+		shader->SetUniform(ARC_UNIFORM("keyLightDir"), glm::normalize(glm::vec3(0.6f, -1.0f, -0.7f)));
+		shader->SetUniform(ARC_UNIFORM("fillLightDir"), glm::normalize(glm::vec3(-1.0f, -0.2f, 0.5f)));
+		model->Draw(shader, MaterialRequired);
+
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, renderTarget->GetFramebuffer());
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, resolveTarget->GetFramebuffer());
+		glBlitFramebuffer(0, 0, renderTarget->GetWidth(), renderTarget->GetHeight(), 0, 0, resolveTarget->GetWidth(), resolveTarget->GetHeight(), GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glCache->SetFaceCull(true);
+	}
+
+	int ThumbnailGenerator::RunCommandLine(int argc, char **argv)
+	{
+		ThumbnailSettings settings;
+		int positionalCount = 0;
+		for (int i = 0; i < argc; i++)
+		{
+			std::string argument(argv[i]);
+			if (argument == "--size" && i + 1 < argc)
+			{
+				settings.Size = std::max(std::atoi(argv[++i]), 1);
+			}
+			else if (argument == "--in-flight" && i + 1 < argc)
+			{
+				settings.ModelsInFlight = std::atoi(argv[++i]);
+			}
+			else if (argument.rfind("--", 0) != 0 && positionalCount < 2)
+			{
+				(positionalCount++ == 0 ? settings.SourceDirectory : settings.OutputDirectory) = argument;
+			}
+			else
+			{
+				ARC_LOG_ERROR("Unknown thumbnail argument {0} - usage: --thumbnails [sourceDirectory] [outputDirectory] [--size pixels] [--in-flight count]", argument);
+				return 1;
+			}
+		}
+
+		// Same context as the editor's window, just never shown
+		glewExperimental = true;
+		if (!glfwInit())
+		{
+			ARC_LOG_FATAL("Failed to initialize GLFW");
+			return 1;
+		}
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+		glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_FALSE);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		GLFWwindow *window = glfwCreateWindow(1, 1, "Arcane Thumbnails", nullptr, nullptr);
+		if (!window)
+		{
+			ARC_LOG_FATAL("Failed to create the hidden window for thumbnail rendering");
+			glfwTerminate();
+			return 1;
+		}
+		glfwMakeContextCurrent(window);
+		if (glewInit() != GLEW_OK)
+		{
+			ARC_LOG_FATAL("Failed to initialize GLEW");
+			glfwDestroyWindow(window);
+			glfwTerminate();
+			return 1;
+		}
+
+		// Same order as the application, textures query the renderer for the max anisotropy
+		AssetManager::GetInstance();
+		ShaderLoader::SetShaderFilepath("../Arcane/src/Arcane/shaders/");
+		Renderer::Init();
+		TextureLoader::InitializeDefaultTextures();
+
+		ThumbnailResult result = Generate(settings);
+		Renderer::Shutdown(); // Waits for the remaining readbacks to be written
+
+		int failed = result.Failed + (result.Rendered - static_cast<int>(FrameCapture::GetFramesWritten()));
+		ARC_LOG_INFO("Thumbnails finished - written: {0}, failed: {1}", FrameCapture::GetFramesWritten(), failed);
+
+		glfwDestroyWindow(window);
+		glfwTerminate();
+		return failed == 0 ? 0 : 1;
+	}
+}
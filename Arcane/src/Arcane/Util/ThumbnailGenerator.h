@@ -0,0 +1,45 @@
+#pragma once
+#ifndef THUMBNAILGENERATOR_H
+#define THUMBNAILGENERATOR_H
+
+namespace Arcane
+{
+	class Framebuffer;
+	class Model;
+	class Shader;
+
+	struct ThumbnailSettings
+	{
+		std::string SourceDirectory = "res"; // Every model under it gets a thumbnail, paths are relative to the working directory like the ones the loaders are given
+		std::string OutputDirectory = "thumbnails/"; // Thumbnails mirror the source path under this directory, ie: "res/a.fbx" -> "thumbnails/res/a.fbx.png"
+		int Size = THUMBNAIL_DEFAULT_SIZE;
+		int ModelsInFlight = THUMBNAIL_MODELS_IN_FLIGHT;
+		glm::vec3 BackgroundColour = glm::vec3(0.18f, 0.18f, 0.2f);
+	};
+
+	struct ThumbnailResult
+	{
+		int Rendered = 0;
+		int Failed = 0; // Models that failed to load
+	};
+
+	/*
+		Batch preview generator for a whole directory of models. Each model is loaded through the AssetManager, framed from its bounding sphere, lit with a
+		fixed studio setup and rendered offscreen, then written out as a PNG by FrameCapture's readback ring and workers.
+		Loading is pipelined against rendering: up to ModelsInFlight models are always queued on the asset manager's workers, and whichever one is ready
+		(model and textures generated) gets rendered while the rest are still being read and imported. A rendered model is unloaded straight away so memory
+		stays bounded by the in flight count. Generate leaves the final readbacks in flight, they are written out when FrameCapture shuts down
+	*/
+	class ThumbnailGenerator
+	{
+	public:
+		// Needs a current GL context with the renderer and default textures initialized
+		static ThumbnailResult Generate(const ThumbnailSettings &settings = ThumbnailSettings());
+
+		// Arguments following --thumbnails: [sourceDirectory] [outputDirectory] [--size pixels] [--in-flight count]. Creates its own hidden window for the GL context. Returns the process exit code
+		static int RunCommandLine(int argc, char **argv);
+	private:
+		static void RenderThumbnail(Model *model, Shader *shader, Framebuffer *renderTarget, Framebuffer *resolveTarget, const ThumbnailSettings &settings);
+	};
+}
+#endif
@@ -0,0 +1,123 @@
+#include "arcpch.h"
+#include "VirtualFileSystem.h"
+
+#include <Arcane/Util/AssetPack.h>
+
+namespace Arcane
+{
+	std::vector<AssetPack*> VirtualFileSystem::s_MountedPacks;
+
+	bool VirtualFileSystem::Mount(const std::string &packPath)
+	{
+		AssetPack *pack = new AssetPack();
+		if (!pack->Open(packPath))
+		{
+			delete pack;
+			return false;
+		}
+
+		s_MountedPacks.push_back(pack);
+		return true;
+	}
+
+	void VirtualFileSystem::UnmountAll()
+	{
+		for (AssetPack *pack : s_MountedPacks)
+		{
+			delete pack;
+		}
+		s_MountedPacks.clear();
+	}
+
+	bool VirtualFileSystem::Exists(const std::string &path)
+	{
+		if (!s_MountedPacks.empty())
+		{
+			std::string normalizedPath = AssetPack::NormalizePath(path);
+			for (const AssetPack *pack : s_MountedPacks)
+			{
+				if (pack->FindEntry(normalizedPath))
+					return true;
+			}
+		}
+
+		std::error_code error;
+		return std::filesystem::is_regular_file(path, error);
+	}
+
+	VirtualFile VirtualFileSystem::ReadFile(const std::string &path)
+	{
+		VirtualFile file;
+#if ASSET_PACK_LOOSE_FILES_OVERRIDE
+		if (!ReadLooseFile(path, file))
+			ReadPackedFile(path, file);
+#else
+		if (!ReadPackedFile(path, file))
+			ReadLooseFile(path, file);
+#endif
+		return file;
+	}
+
+	bool VirtualFileSystem::ReadLooseFile(const std::string &path, VirtualFile &outFile)
+	{
+		std::ifstream ifs(path, std::ios::in | std::ios::binary | std::ios::ate);
+		if (!ifs)
+			return false;
+
+		std::streamoff fileSize = ifs.tellg();
+		if (fileSize < 0)
+			return false;
+
+		outFile.m_Buffer.resize(static_cast<size_t>(fileSize));
+		ifs.seekg(0);
+		if (fileSize > 0 && !ifs.read(reinterpret_cast<char*>(outFile.m_Buffer.data()), fileSize))
+		{
+			outFile.m_Buffer.clear();
+			return false;
+		}
+
+		outFile.m_Valid = true;
+		outFile.m_Data = outFile.m_Buffer.data();
+		outFile.m_Size = outFile.m_Buffer.size();
+		return true;
+	}
+
+	bool VirtualFileSystem::ReadPackedFile(const std::string &path, VirtualFile &outFile)
+	{
+		if (s_MountedPacks.empty())
+			return false;
+
+		// Newest mount wins so patch packs can override entries of the base pack
+		std::string normalizedPath = AssetPack::NormalizePath(path);
+		for (auto iter = s_MountedPacks.rbegin(); iter != s_MountedPacks.rend(); ++iter)
+		{
+			const AssetPack *pack = *iter;
+			const AssetPackEntry *entry = pack->FindEntry(normalizedPath);
+			if (!entry)
+				continue;
+
+			const unsigned char *storedData = pack->GetEntryData(*entry);
+			if (entry->Compression == CompressionType::None)
+			{
+				outFile.m_Data = storedData;
+				outFile.m_Size = static_cast<size_t>(entry->Size);
+			}
+			else
+			{
+				outFile.m_Buffer.resize(static_cast<size_t>(entry->Size));
+				if (!Compression::DecompressLZ4(storedData, static_cast<size_t>(entry->StoredSize), outFile.m_Buffer.data(), outFile.m_Buffer.size()))
+				{
+					ARC_LOG_ERROR("Failed to decompress {0} from asset pack {1}", path, pack->GetPath());
+					outFile.m_Buffer.clear();
+					return false;
+				}
+				outFile.m_Data = outFile.m_Buffer.data();
+				outFile.m_Size = outFile.m_Buffer.size();
+			}
+
+			outFile.m_Valid = true;
+			return true;
+		}
+		return false;
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+#ifndef VIRTUALFILESYSTEM_H
+#define VIRTUALFILESYSTEM_H
+
+namespace Arcane
+{
+	class AssetPack;
+
+	// Contents of a file read through the VirtualFileSystem. Uncompressed packed entries point straight into the pack's memory mapping, everything else owns its buffer
+	class VirtualFile
+	{
+		friend class VirtualFileSystem;
+	public:
+		VirtualFile() = default;
+		VirtualFile(VirtualFile&&) = default;
+		VirtualFile& operator=(VirtualFile&&) = default;
+		VirtualFile(const VirtualFile&) = delete;
+		VirtualFile& operator=(const VirtualFile&) = delete;
+
+		inline bool IsValid() const { return m_Valid; }
+		inline const unsigned char* GetData() const { return m_Data; }
+		inline size_t GetSize() const { return m_Size; }
+		inline std::string ToString() const { return std::string(reinterpret_cast<const char*>(m_Data), m_Size); }
+	private:
+		bool m_Valid = false;
+		const unsigned char *m_Data = nullptr;
+		size_t m_Size = 0;
+		std::vector<unsigned char> m_Buffer;
+	};
+
+	/*
+		Every loader reads its files through here. Paths are the same relative paths used for loose files (ie: "res/textures/a.png"), they are looked up
+		in the mounted asset packs (newest mount first) and fall back to the disk. With ASSET_PACK_LOOSE_FILES_OVERRIDE loose files win instead, so
+		assets can be iterated on without rebuilding the packs.
+		Packs must be mounted/unmounted while nothing is loading, reading is thread safe
+	*/
+	class VirtualFileSystem
+	{
+	public:
+		static bool Mount(const std::string &packPath);
+		static void UnmountAll();
+
+		static bool Exists(const std::string &path);
+		static VirtualFile ReadFile(const std::string &path);
+	private:
+		static bool ReadLooseFile(const std::string &path, VirtualFile &outFile);
+		static bool ReadPackedFile(const std::string &path, VirtualFile &outFile);
+	private:
+		static std::vector<AssetPack*> s_MountedPacks;
+	};
+}
+#endif
@@ -0,0 +1,68 @@
+#shader-type compute
+#version 430 core
+
+layout (local_size_x = 64) in;
+
+struct Meshlet
+{
+	vec4 boundingSphere; // xyz = centre, w = radius
+	vec4 coneAxisAndCutoff;
+	vec4 coneApex;
+	uvec4 indexRange; // x = first index, y = index count
+};
+
+struct DrawCommand
+{
+	uint count;
+	uint instanceCount;
+	uint firstIndex;
+	uint baseVertex;
+	uint baseInstance;
+};
+
+layout (std430, binding = 0) readonly buffer Meshlets
+{
+	Meshlet meshlets[];
+};
+
+layout (std430, binding = 1) writeonly buffer DrawCommands
+{
+	DrawCommand drawCommands[];
+};
+
+uniform mat4 model;
+uniform vec4 frustumPlanes[6];
+uniform float maxScale;
+uniform bool coneCulling;
+uniform vec3 cameraPositionMeshSpace;
+uniform int meshletCount;
+uniform int firstCommand;
+
+void main() {
+	uint meshletIndex = gl_GlobalInvocationID.x;
+	if (meshletIndex >= uint(meshletCount))
+		return;
+
+	Meshlet meshlet = meshlets[meshletIndex];
+	bool visible = true;
+
+	vec3 centre = (model * vec4(meshlet.boundingSphere.xyz, 1.0)).xyz;
+	float radius = meshlet.boundingSphere.w * maxScale;
+	for (int i = 0; i < 6; i++) {
+		if (dot(frustumPlanes[i].xyz, centre) + frustumPlanes[i].w < -radius)
+			visible = false;
+	}
+
+	// The camera sees every triangle of the cluster from behind when it's inside the (negated) normal cone
+	if (visible && coneCulling && dot(normalize(meshlet.coneApex.xyz - cameraPositionMeshSpace), meshlet.coneAxisAndCutoff.xyz) >= meshlet.coneAxisAndCutoff.w)
+		visible = false;
+
+	// Culled meshlets keep their slot as an empty draw, so the multi draw never needs to know how many survived
+	DrawCommand command;
+	command.count = visible ? meshlet.indexRange.y : 0u;
+	command.instanceCount = visible ? 1u : 0u;
+	command.firstIndex = meshlet.indexRange.x;
+	command.baseVertex = 0u;
+	command.baseInstance = 0u;
+	drawCommands[firstCommand + int(meshletIndex)] = command;
+}
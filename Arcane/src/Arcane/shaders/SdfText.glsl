@@ -0,0 +1,71 @@
+#shader-type vertex
+#version 430 core
+
+// Vertex pulling, every instance is a glyph and the 4 vertices of the triangle strip make up its quad
+
+struct GlyphInstance
+{
+	vec4 anchorAndSpace; // w = 1 for screen space
+	vec4 rect; // xy = offset from the anchor, zw = size
+	vec4 uvRect; // xy = top left, zw = bottom right
+	vec4 colour;
+};
+
+layout (std430, binding = 0) buffer GlyphInstances
+{
+	GlyphInstance glyphs[];
+};
+
+out vec2 TexCoords;
+out vec4 GlyphColour;
+
+uniform mat4 viewProjection;
+uniform vec3 cameraRight;
+uniform vec3 cameraUp;
+uniform vec2 viewportSize;
+
+void main() {
+	GlyphInstance glyph = glyphs[gl_InstanceID];
+	GlyphColour = glyph.colour;
+
+	vec2 corner = vec2(float(gl_VertexID & 1), float((gl_VertexID >> 1) & 1));
+	TexCoords = vec2(mix(glyph.uvRect.x, glyph.uvRect.z, corner.x), mix(glyph.uvRect.w, glyph.uvRect.y, corner.y));
+
+	vec2 quadPos = glyph.rect.xy + corner * glyph.rect.zw; // y up
+	if (glyph.anchorAndSpace.w > 0.5) {
+		// Screen space, the anchor is in pixels from the top left of the viewport
+		vec2 pixelPos = glyph.anchorAndSpace.xy + vec2(quadPos.x, -quadPos.y);
+		vec2 ndc = (pixelPos / viewportSize) * 2.0 - 1.0;
+		gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+	}
+	else {
+		// Camera facing label
+		vec3 worldPos = glyph.anchorAndSpace.xyz + cameraRight * quadPos.x + cameraUp * quadPos.y;
+		gl_Position = viewProjection * vec4(worldPos, 1.0);
+	}
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+in vec2 TexCoords;
+in vec4 GlyphColour;
+
+out vec4 FragColour;
+
+uniform sampler2D glyphAtlas;
+
+void main() {
+	// The edge is at 0.5, the screen space derivative keeps the edge about a pixel wide whatever size the text ends up on screen
+	float distance = texture(glyphAtlas, TexCoords).r;
+	float edgeWidth = max(fwidth(distance), 0.0001);
+	float coverage = clamp((distance - 0.5) / edgeWidth + 0.5, 0.0, 1.0);
+
+	if (coverage <= 0.001)
+		discard;
+
+	FragColour = vec4(GlyphColour.rgb, GlyphColour.a * coverage);
+}
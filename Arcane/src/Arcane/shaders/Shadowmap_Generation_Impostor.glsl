@@ -0,0 +1,105 @@
+#shader-type vertex
+#version 430 core
+
+// Same instance layout as the impostor geometry pass: model matrix in locations 0-3 and its inverse transpose in locations 4-6
+layout (location = 0) in mat4 instanceModel;
+layout (location = 4) in mat3 instanceNormalMatrix;
+
+out vec2 AtlasCoords;
+out vec3 ObjectPos;
+flat out vec3 FrameDir;
+flat out mat4 Model;
+
+uniform mat4 lightSpaceViewProjectionMatrix;
+uniform vec3 lightPos; // Eye position of the shadow camera, the frame facing it is used so the silhouette matches what the light sees
+
+uniform int framesPerSide;
+uniform bool hemispherical;
+uniform vec3 boundsCentre;
+uniform float boundsRadius;
+
+// Must match Impostor::OctahedralEncode/OctahedralDecode/GetFrameUp
+vec2 OctahedralEncode(vec3 dir) {
+	vec3 n = dir / (abs(dir.x) + abs(dir.y) + abs(dir.z));
+	if (hemispherical)
+		return vec2(n.x + n.z, n.x - n.z);
+	if (n.y >= 0.0)
+		return n.xz;
+	return (1.0 - abs(n.zx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.z >= 0.0 ? 1.0 : -1.0);
+}
+
+vec3 OctahedralDecode(vec2 coords) {
+	vec3 n;
+	if (hemispherical) {
+		n.x = (coords.x + coords.y) * 0.5;
+		n.z = (coords.x - coords.y) * 0.5;
+		n.y = 1.0 - abs(n.x) - abs(n.z);
+	}
+	else {
+		n = vec3(coords.x, 1.0 - abs(coords.x) - abs(coords.y), coords.y);
+		if (n.y < 0.0)
+			n.xz = (1.0 - abs(n.zx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.z >= 0.0 ? 1.0 : -1.0);
+	}
+	return normalize(n);
+}
+
+vec3 FrameUp(vec3 frameDir) {
+	return abs(frameDir.y) > 0.999 ? vec3(0.0, 0.0, -1.0) : vec3(0.0, 1.0, 0.0);
+}
+
+void main() {
+	vec3 worldCentre = (instanceModel * vec4(boundsCentre, 1.0)).xyz;
+	vec3 toLight = normalize((lightPos - worldCentre) * instanceNormalMatrix);
+	if (hemispherical)
+		toLight = normalize(vec3(toLight.x, max(toLight.y, 0.0), toLight.z));
+
+	vec2 octahedralUV = OctahedralEncode(toLight) * 0.5 + 0.5;
+	vec2 cell = clamp(floor(octahedralUV * float(framesPerSide)), vec2(0.0), vec2(float(framesPerSide - 1)));
+	FrameDir = OctahedralDecode(((cell + 0.5) / float(framesPerSide)) * 2.0 - 1.0);
+
+	vec3 forward = -FrameDir;
+	vec3 right = normalize(cross(forward, FrameUp(FrameDir)));
+	vec3 up = cross(right, forward);
+
+	vec2 corner = vec2(float(gl_VertexID & 1), float((gl_VertexID >> 1) & 1));
+	vec2 offset = corner * 2.0 - 1.0;
+	ObjectPos = boundsCentre + (right * offset.x + up * offset.y) * boundsRadius;
+	AtlasCoords = (cell + corner) / float(framesPerSide);
+
+	Model = instanceModel;
+	gl_Position = lightSpaceViewProjectionMatrix * instanceModel * vec4(ObjectPos, 1.0);
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+in vec2 AtlasCoords;
+in vec3 ObjectPos;
+flat in vec3 FrameDir;
+flat in mat4 Model;
+
+uniform sampler2D depthAtlas;
+uniform float boundsRadius;
+
+uniform mat4 lightSpaceViewProjectionMatrix;
+uniform bool linearDepth; // Point light shadows store the distance to the light instead
+uniform vec3 lightPos;
+uniform float lightFarPlane;
+
+void main() {
+	float capturedDepth = texture(depthAtlas, AtlasCoords).r;
+	if (capturedDepth >= 1.0)
+		discard;
+
+	vec3 surfaceWorldPos = (Model * vec4(ObjectPos + FrameDir * boundsRadius * (1.0 - 2.0 * capturedDepth), 1.0)).xyz;
+	if (linearDepth) {
+		gl_FragDepth = length(surfaceWorldPos - lightPos) / lightFarPlane;
+	}
+	else {
+		vec4 clipPos = lightSpaceViewProjectionMatrix * vec4(surfaceWorldPos, 1.0);
+		gl_FragDepth = (clipPos.z / clipPos.w) * 0.5 + 0.5;
+	}
+}
@@ -0,0 +1,109 @@
+#shader-type vertex
+#version 430 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 texCoords;
+layout (location = 3) in vec3 tangent;
+layout (location = 4) in vec3 bitangent;
+
+out mat3 TBN;
+out vec2 TexCoords;
+out vec3 FragPos;
+
+uniform mat4 model;
+uniform mat3 normalMatrix;
+uniform mat4 view;
+uniform mat4 projection;
+
+void main() {
+	vec3 T = normalize(normalMatrix * tangent);
+	vec3 B = normalize(normalMatrix * bitangent);
+	vec3 N = normalize(normalMatrix * normal);
+	TBN = mat3(T, B, N);
+	TexCoords = texCoords;
+	FragPos = vec3(model * vec4(position, 1.0));
+
+	gl_Position = projection * view * vec4(FragPos, 1.0);
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+out vec4 FragColour;
+
+struct Material {
+	vec4 albedoColour;
+	sampler2D texture_albedo;
+	sampler2D texture_normal;
+	sampler2D texture_metallic;
+	sampler2D texture_roughness;
+	sampler2D texture_ao;
+	sampler2D texture_orm; // Occlusion (r), roughness (g) and metallic (b) packed together, replaces the three maps above when hasOrmTexture is set
+	bool hasAlbedoTexture;
+	bool hasOrmTexture;
+	bool hasMetallicTexture;
+	bool hasRoughnessTexture;
+	float metallicValue;
+	float roughnessValue;
+};
+
+in mat3 TBN;
+in vec2 TexCoords;
+in vec3 FragPos;
+
+uniform Material material;
+uniform vec3 viewPos;
+uniform vec3 keyLightDir; // Direction the light travels in
+uniform vec3 fillLightDir;
+
+// Fixed studio setup instead of the scene's lights and probes, so every thumbnail is lit the same way no matter what else is loaded
+const vec3 keyLightColour = vec3(2.4, 2.3, 2.1);
+const vec3 fillLightColour = vec3(0.45, 0.5, 0.6);
+const vec3 skyAmbient = vec3(0.35, 0.38, 0.42);
+const vec3 groundAmbient = vec3(0.12, 0.11, 0.1);
+
+vec3 LightContribution(vec3 lightColour, vec3 L, vec3 N, vec3 V, vec3 diffuseColour, vec3 specularColour, float roughness) {
+	float NdotL = max(dot(N, L), 0.0);
+	vec3 H = normalize(L + V);
+	float shininess = 2.0 / max(roughness * roughness * roughness * roughness, 0.001) - 2.0;
+	float specular = pow(max(dot(N, H), 0.0), shininess) * (shininess + 8.0) / 25.1327;
+	return lightColour * NdotL * (diffuseColour + specularColour * specular);
+}
+
+void main() {
+	vec4 albedo = material.albedoColour;
+	if (material.hasAlbedoTexture)
+		albedo *= texture(material.texture_albedo, TexCoords);
+	if (albedo.a < 0.1)
+		discard;
+
+	vec3 normal = texture(material.texture_normal, TexCoords).rgb;
+	normal = normalize(TBN * normalize(normal * 2.0 - 1.0));
+	if (!gl_FrontFacing)
+		normal = -normal;
+
+	vec3 orm;
+	if (material.hasOrmTexture)
+		orm = texture(material.texture_orm, TexCoords).rgb;
+	else
+		orm = vec3(texture(material.texture_ao, TexCoords).r, texture(material.texture_roughness, TexCoords).r, texture(material.texture_metallic, TexCoords).r);
+	float metallic = material.hasMetallicTexture ? orm.b : material.metallicValue;
+	float roughness = clamp(material.hasRoughnessTexture ? orm.g : material.roughnessValue, 0.05, 1.0);
+	float ao = orm.r;
+
+	vec3 diffuseColour = albedo.rgb * (1.0 - metallic);
+	vec3 specularColour = mix(vec3(0.04), albedo.rgb, metallic);
+	vec3 V = normalize(viewPos - FragPos);
+
+	vec3 colour = LightContribution(keyLightColour, -keyLightDir, normal, V, diffuseColour, specularColour, roughness);
+	colour += LightContribution(fillLightColour, -fillLightDir, normal, V, diffuseColour, specularColour, roughness);
+	colour += mix(groundAmbient, skyAmbient, normal.y * 0.5 + 0.5) * (diffuseColour + specularColour * 0.5) * ao;
+
+	// Reinhard then gamma, the thumbnail target is a plain RGBA8 texture
+	colour = colour / (colour + vec3(1.0));
+	FragColour = vec4(pow(colour, vec3(1.0 / 2.2)), 1.0);
+}
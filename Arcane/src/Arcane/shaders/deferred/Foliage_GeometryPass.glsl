@@ -0,0 +1,113 @@
+#shader-type vertex
+#version 430 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 texCoords;
+layout (location = 3) in vec3 tangent;
+layout (location = 4) in vec3 bitangent;
+
+struct FoliageInstance
+{
+	vec4 positionAndScale;
+	vec4 params; // x = rotation around the up axis, y = random variation
+};
+
+layout (std430, binding = 0) readonly buffer Instances
+{
+	FoliageInstance instances[];
+};
+
+// Written by FoliageCull.glsl, gl_InstanceID indexes the visible instances
+layout (std430, binding = 1) readonly buffer VisibleIndices
+{
+	uint visibleIndices[];
+};
+
+out mat3 TBN;
+out vec2 TexCoords;
+out float Variation;
+
+uniform mat4 view;
+uniform mat4 projection;
+
+void main() {
+	FoliageInstance instance = instances[visibleIndices[gl_InstanceID]];
+	float scale = instance.positionAndScale.w;
+	float s = sin(instance.params.x);
+	float c = cos(instance.params.x);
+
+	// Rotation around the up axis only, so the rotation is also the normal matrix
+	mat3 rotation = mat3(c, 0.0, -s, 0.0, 1.0, 0.0, s, 0.0, c);
+	vec3 worldPos = instance.positionAndScale.xyz + rotation * (position * scale);
+
+	vec3 T = normalize(rotation * tangent);
+	vec3 B = normalize(rotation * bitangent);
+	vec3 N = normalize(rotation * normal);
+	TBN = mat3(T, B, N);
+	TexCoords = texCoords;
+	Variation = instance.params.y;
+
+	gl_Position = projection * view * vec4(worldPos, 1.0);
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+layout (location = 0) out vec4 gb_Albedo;
+layout (location = 1) out vec3 gb_Normal;
+layout (location = 2) out vec4 gb_MaterialInfo;
+
+struct Material {
+	vec4 albedoColour;
+	sampler2D texture_albedo;
+	sampler2D texture_normal;
+	sampler2D texture_metallic;
+	sampler2D texture_roughness;
+	sampler2D texture_ao;
+	sampler2D texture_orm; // Occlusion (r), roughness (g) and metallic (b) packed together, replaces the three maps above when hasOrmTexture is set
+	bool hasAlbedoTexture;
+	bool hasOrmTexture;
+	bool hasMetallicTexture;
+	bool hasRoughnessTexture;
+	float metallicValue;
+	float roughnessValue;
+};
+
+in mat3 TBN;
+in vec2 TexCoords;
+in float Variation;
+
+uniform Material material;
+
+void main() {
+	vec4 albedo = material.albedoColour;
+	if (material.hasAlbedoTexture)
+		albedo *= texture(material.texture_albedo, TexCoords);
+	if (albedo.a < 0.5) // Foliage is alpha tested
+		discard;
+
+	// Small per instance brightness variation so large fields don't look tiled
+	albedo.rgb *= mix(0.85, 1.15, Variation);
+
+	vec3 normal = texture(material.texture_normal, TexCoords).rgb;
+	normal = normalize(TBN * normalize(normal * 2.0 - 1.0));
+	if (!gl_FrontFacing)
+		normal = -normal;
+
+	vec3 orm;
+	if (material.hasOrmTexture)
+		orm = texture(material.texture_orm, TexCoords).rgb;
+	else
+		orm = vec3(texture(material.texture_ao, TexCoords).r, texture(material.texture_roughness, TexCoords).r, texture(material.texture_metallic, TexCoords).r);
+	float metallic = material.hasMetallicTexture ? orm.b : material.metallicValue;
+	float roughness = material.hasRoughnessTexture ? orm.g : material.roughnessValue;
+	float ao = orm.r;
+
+	gb_Albedo = vec4(albedo.rgb, 1.0);
+	gb_Normal = normal;
+	gb_MaterialInfo = vec4(metallic, roughness, ao, 0.0);
+}
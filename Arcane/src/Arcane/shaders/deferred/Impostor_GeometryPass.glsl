@@ -0,0 +1,114 @@
+#shader-type vertex
+#version 430 core
+
+// Per instance model matrix (takes up locations 0-3) and its inverse transpose (locations 4-6), the quad itself is generated from gl_VertexID as a 4 vertex triangle strip
+layout (location = 0) in mat4 instanceModel;
+layout (location = 4) in mat3 instanceNormalMatrix;
+
+out vec2 AtlasCoords;
+out vec3 ObjectPos;
+flat out vec3 FrameDir;
+flat out mat4 ModelViewProjection;
+flat out mat3 NormalMatrix;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 viewPos;
+
+uniform int framesPerSide;
+uniform bool hemispherical;
+uniform vec3 boundsCentre;
+uniform float boundsRadius;
+
+// Must match Impostor::OctahedralEncode/OctahedralDecode/GetFrameUp
+vec2 OctahedralEncode(vec3 dir) {
+	vec3 n = dir / (abs(dir.x) + abs(dir.y) + abs(dir.z));
+	if (hemispherical)
+		return vec2(n.x + n.z, n.x - n.z);
+	if (n.y >= 0.0)
+		return n.xz;
+	return (1.0 - abs(n.zx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.z >= 0.0 ? 1.0 : -1.0);
+}
+
+vec3 OctahedralDecode(vec2 coords) {
+	vec3 n;
+	if (hemispherical) {
+		n.x = (coords.x + coords.y) * 0.5;
+		n.z = (coords.x - coords.y) * 0.5;
+		n.y = 1.0 - abs(n.x) - abs(n.z);
+	}
+	else {
+		n = vec3(coords.x, 1.0 - abs(coords.x) - abs(coords.y), coords.y);
+		if (n.y < 0.0)
+			n.xz = (1.0 - abs(n.zx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.z >= 0.0 ? 1.0 : -1.0);
+	}
+	return normalize(n);
+}
+
+vec3 FrameUp(vec3 frameDir) {
+	return abs(frameDir.y) > 0.999 ? vec3(0.0, 0.0, -1.0) : vec3(0.0, 1.0, 0.0);
+}
+
+void main() {
+	// Pick the captured frame closest to the direction we are viewing the model from (in object space)
+	vec3 worldCentre = (instanceModel * vec4(boundsCentre, 1.0)).xyz;
+	vec3 toCamera = normalize((viewPos - worldCentre) * instanceNormalMatrix); // Multiplying from the left applies the transpose, which undoes the inverse transpose
+	if (hemispherical)
+		toCamera = normalize(vec3(toCamera.x, max(toCamera.y, 0.0), toCamera.z));
+
+	vec2 octahedralUV = OctahedralEncode(toCamera) * 0.5 + 0.5;
+	vec2 cell = clamp(floor(octahedralUV * float(framesPerSide)), vec2(0.0), vec2(float(framesPerSide - 1)));
+	FrameDir = OctahedralDecode(((cell + 0.5) / float(framesPerSide)) * 2.0 - 1.0);
+
+	// Rebuild the capture camera's basis (same as glm::lookAt) so the quad lines up with the baked frame
+	vec3 forward = -FrameDir;
+	vec3 right = normalize(cross(forward, FrameUp(FrameDir)));
+	vec3 up = cross(right, forward);
+
+	vec2 corner = vec2(float(gl_VertexID & 1), float((gl_VertexID >> 1) & 1));
+	vec2 offset = corner * 2.0 - 1.0;
+	ObjectPos = boundsCentre + (right * offset.x + up * offset.y) * boundsRadius;
+	AtlasCoords = (cell + corner) / float(framesPerSide);
+
+	ModelViewProjection = projection * view * instanceModel;
+	NormalMatrix = instanceNormalMatrix;
+	gl_Position = ModelViewProjection * vec4(ObjectPos, 1.0);
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+layout (location = 0) out vec4 gb_Albedo;
+layout (location = 1) out vec3 gb_Normal;
+layout (location = 2) out vec4 gb_MaterialInfo;
+
+in vec2 AtlasCoords;
+in vec3 ObjectPos;
+flat in vec3 FrameDir;
+flat in mat4 ModelViewProjection;
+flat in mat3 NormalMatrix;
+
+uniform sampler2D albedoAtlas;
+uniform sampler2D normalAtlas;
+uniform sampler2D materialInfoAtlas;
+uniform sampler2D depthAtlas;
+uniform float boundsRadius;
+
+void main() {
+	// Cleared depth means nothing was captured here
+	float capturedDepth = texture(depthAtlas, AtlasCoords).r;
+	if (capturedDepth >= 1.0)
+		discard;
+
+	// Captures used an ortho camera 2 * radius away with near = radius and far = 3 * radius, so depth maps linearly across the bounding sphere
+	vec3 surfaceObjectPos = ObjectPos + FrameDir * boundsRadius * (1.0 - 2.0 * capturedDepth);
+	vec4 clipPos = ModelViewProjection * vec4(surfaceObjectPos, 1.0);
+	gl_FragDepth = (clipPos.z / clipPos.w) * 0.5 + 0.5;
+
+	gb_Albedo = texture(albedoAtlas, AtlasCoords);
+	gb_Normal = normalize(NormalMatrix * texture(normalAtlas, AtlasCoords).xyz);
+	gb_MaterialInfo = texture(materialInfoAtlas, AtlasCoords);
+}
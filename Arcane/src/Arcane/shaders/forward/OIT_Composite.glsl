@@ -0,0 +1,55 @@
+#shader-type vertex
+#version 430 core
+
+layout (location = 0) in vec3 position;
+
+void main() {
+	gl_Position = vec4(position, 1.0);
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+// Resolves weighted blended OIT over the opaque scene. Blended with (GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA) so the background is scaled by the revealage.
+// Transparent model shaders with weightedBlendedOIT set need to write:
+//   location 0 (accumulation) = vec4(colour.rgb * colour.a, colour.a) * weight
+//   location 1 (revealage)    = colour.a
+// with weight = clamp(pow(min(1.0, colour.a * 10.0) + 0.01, 3.0) * 1e8 * pow(1.0 - gl_FragCoord.z * 0.9, 3.0), 1e-2, 3e3)
+
+out vec4 FragColour;
+
+uniform bool multisampled;
+uniform sampler2D accumulationTexture;
+uniform sampler2D revealageTexture;
+uniform sampler2DMS accumulationTextureMS;
+uniform sampler2DMS revealageTextureMS;
+
+void main() {
+	ivec2 coords = ivec2(gl_FragCoord.xy);
+
+	vec4 accumulation;
+	float revealage;
+	if (multisampled) {
+		// Reading gl_SampleID runs this per sample, so MSAA edges of transparent surfaces survive the resolve later on
+		accumulation = texelFetch(accumulationTextureMS, coords, gl_SampleID);
+		revealage = texelFetch(revealageTextureMS, coords, gl_SampleID).r;
+	}
+	else {
+		accumulation = texelFetch(accumulationTexture, coords, 0);
+		revealage = texelFetch(revealageTexture, coords, 0).r;
+	}
+
+	// Nothing transparent covered this pixel
+	if (revealage >= 0.9999)
+		discard;
+
+	// Guard against the accumulated weights overflowing half floats
+	if (isinf(max(max(abs(accumulation.r), abs(accumulation.g)), abs(accumulation.b))))
+		accumulation.rgb = vec3(accumulation.a);
+
+	vec3 averageColour = accumulation.rgb / max(accumulation.a, 0.00001);
+	FragColour = vec4(averageColour, revealage);
+}
@@ -0,0 +1,64 @@
+#shader-type vertex
+#version 430 core
+
+layout (location = 0) in vec3 position;
+layout (location = 2) in vec2 texCoords;
+layout (location = 7) in vec2 lightmapCoords;
+
+out vec2 TexCoords;
+out vec2 LightmapCoords;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec4 lightmapScaleOffset; // xy = scale, zw = offset into the atlas
+
+void main() {
+	TexCoords = texCoords;
+	LightmapCoords = lightmapCoords * lightmapScaleOffset.xy + lightmapScaleOffset.zw;
+	gl_Position = projection * view * model * vec4(position, 1.0);
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+out vec4 FragColour;
+
+struct Material {
+	vec4 albedoColour;
+	sampler2D texture_albedo;
+	sampler2D texture_metallic;
+	sampler2D texture_ao;
+	sampler2D texture_orm; // Occlusion (r), roughness (g) and metallic (b) packed together, replaces the maps above when hasOrmTexture is set
+	bool hasAlbedoTexture;
+	bool hasOrmTexture;
+	bool hasMetallicTexture;
+	float metallicValue;
+};
+
+in vec2 TexCoords;
+in vec2 LightmapCoords;
+
+uniform Material material;
+uniform sampler2D lightmapTexture;
+
+void main() {
+	vec4 albedo = material.albedoColour;
+	if (material.hasAlbedoTexture)
+		albedo *= texture(material.texture_albedo, TexCoords);
+
+	vec2 occlusionMetallic;
+	if (material.hasOrmTexture)
+		occlusionMetallic = texture(material.texture_orm, TexCoords).rb;
+	else
+		occlusionMetallic = vec2(texture(material.texture_ao, TexCoords).r, texture(material.texture_metallic, TexCoords).r);
+	float metallic = material.hasMetallicTexture ? occlusionMetallic.y : material.metallicValue;
+	float ao = occlusionMetallic.x;
+
+	// The lightmap stores the diffuse irradiance (already divided by pi), metals have no diffuse response
+	vec3 bakedLighting = texture(lightmapTexture, LightmapCoords).rgb;
+	FragColour = vec4(albedo.rgb * bakedLighting * (1.0 - metallic) * ao, 0.0);
+}
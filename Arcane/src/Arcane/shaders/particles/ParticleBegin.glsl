@@ -0,0 +1,40 @@
+#shader-type compute
+#version 430 core
+
+// Runs on a single thread before the emit/simulate dispatches and fills out their indirect dispatch args
+
+layout (local_size_x = 1) in;
+
+layout (std430, binding = 4) buffer Counters
+{
+	uint aliveCount;
+	uint deadCount;
+	uint newAliveCount;
+	uint emitCount;
+};
+
+layout (std430, binding = 5) buffer IndirectArgs
+{
+	uint emitDispatch[3];
+	uint simulateDispatch[3];
+	uint drawCount;
+	uint drawInstanceCount;
+	uint drawFirst;
+	uint drawBaseInstance;
+};
+
+uniform int requestedEmitCount;
+
+const uint THREAD_GROUP_SIZE = 256u;
+
+void main() {
+	// Can't emit more particles than we have free
+	uint realEmitCount = min(uint(requestedEmitCount), deadCount);
+	emitCount = realEmitCount;
+	emitDispatch[0] = (realEmitCount + THREAD_GROUP_SIZE - 1u) / THREAD_GROUP_SIZE;
+
+	// Simulation processes the existing particles and the ones emitted this frame
+	simulateDispatch[0] = (aliveCount + realEmitCount + THREAD_GROUP_SIZE - 1u) / THREAD_GROUP_SIZE;
+
+	newAliveCount = 0u;
+}
@@ -0,0 +1,29 @@
+#shader-type compute
+#version 430 core
+
+// One step (k, j) of a bitonic sort over the whole power of two sort buffer, the CPU dispatches every step
+
+layout (local_size_x = 256) in;
+
+layout (std430, binding = 6) buffer SortPairs
+{
+	uvec2 sortPairs[]; // x = key, y = particle index
+};
+
+uniform int sortStageK;
+uniform int sortStepJ;
+
+void main() {
+	uint index = gl_GlobalInvocationID.x;
+	uint partner = index ^ uint(sortStepJ);
+	if (partner <= index)
+		return;
+
+	uvec2 a = sortPairs[index];
+	uvec2 b = sortPairs[partner];
+	bool ascending = (index & uint(sortStageK)) == 0u;
+	if ((a.x > b.x) == ascending) {
+		sortPairs[index] = b;
+		sortPairs[partner] = a;
+	}
+}
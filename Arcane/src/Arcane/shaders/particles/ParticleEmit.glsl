@@ -0,0 +1,83 @@
+#shader-type compute
+#version 430 core
+
+layout (local_size_x = 256) in;
+
+struct Particle
+{
+	vec4 positionAndAge;
+	vec4 velocityAndLifetime;
+};
+
+layout (std430, binding = 0) buffer Particles
+{
+	Particle particles[];
+};
+
+layout (std430, binding = 1) buffer CurrentAliveIndices
+{
+	uint currentAliveIndices[];
+};
+
+layout (std430, binding = 3) buffer DeadIndices
+{
+	uint deadIndices[];
+};
+
+layout (std430, binding = 4) buffer Counters
+{
+	uint aliveCount;
+	uint deadCount;
+	uint newAliveCount;
+	uint emitCount;
+};
+
+uniform vec3 emitterPosition;
+uniform float spawnRadius;
+uniform vec3 initialVelocity;
+uniform vec3 velocityRandomness;
+uniform vec2 lifetimeRange;
+uniform int seed;
+
+const float PI = 3.14159265359;
+
+// Must match ParticleHash/ParticleRandom in ParticleData.h so the CPU reference simulator produces the same particles
+uint ParticleHash(uint inputValue) {
+	uint state = inputValue * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+float ParticleRandom(inout uint rngState) {
+	rngState = ParticleHash(rngState);
+	return float(rngState) / 4294967296.0;
+}
+
+void main() {
+	uint emitIndex = gl_GlobalInvocationID.x;
+	if (emitIndex >= emitCount)
+		return;
+
+	uint rngState = ParticleHash(uint(seed) + emitIndex);
+
+	// Uniformly distributed point inside of the spawn sphere
+	float theta = ParticleRandom(rngState) * 2.0 * PI;
+	float cosPhi = ParticleRandom(rngState) * 2.0 - 1.0;
+	float radius = spawnRadius * pow(ParticleRandom(rngState), 1.0 / 3.0);
+	float sinPhi = sqrt(max(0.0, 1.0 - cosPhi * cosPhi));
+	vec3 spawnOffset = radius * vec3(sinPhi * cos(theta), cosPhi, sinPhi * sin(theta));
+
+	vec3 randomVelocity = vec3(ParticleRandom(rngState), ParticleRandom(rngState), ParticleRandom(rngState)) * 2.0 - 1.0;
+	vec3 velocity = initialVelocity + randomVelocity * velocityRandomness;
+	float lifetime = mix(lifetimeRange.x, lifetimeRange.y, ParticleRandom(rngState));
+
+	// Begin clamped emitCount to the dead count, so there is always a free slot to pop
+	uint deadSlot = atomicAdd(deadCount, 0xFFFFFFFFu) - 1u;
+	uint particleIndex = deadIndices[deadSlot];
+
+	particles[particleIndex].positionAndAge = vec4(emitterPosition + spawnOffset, 0.0);
+	particles[particleIndex].velocityAndLifetime = vec4(velocity, lifetime);
+
+	uint aliveSlot = atomicAdd(aliveCount, 1u);
+	currentAliveIndices[aliveSlot] = particleIndex;
+}
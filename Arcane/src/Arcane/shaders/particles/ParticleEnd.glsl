@@ -0,0 +1,29 @@
+#shader-type compute
+#version 430 core
+
+// Runs on a single thread after the simulation, publishes the compacted alive count to the next frame and the indirect draw
+
+layout (local_size_x = 1) in;
+
+layout (std430, binding = 4) buffer Counters
+{
+	uint aliveCount;
+	uint deadCount;
+	uint newAliveCount;
+	uint emitCount;
+};
+
+layout (std430, binding = 5) buffer IndirectArgs
+{
+	uint emitDispatch[3];
+	uint simulateDispatch[3];
+	uint drawCount;
+	uint drawInstanceCount;
+	uint drawFirst;
+	uint drawBaseInstance;
+};
+
+void main() {
+	aliveCount = newAliveCount;
+	drawInstanceCount = newAliveCount;
+}
@@ -0,0 +1,82 @@
+#shader-type vertex
+#version 430 core
+
+// Vertex pulling, every instance is a particle and the 4 vertices of the triangle strip make up its camera facing quad
+
+struct Particle
+{
+	vec4 positionAndAge;
+	vec4 velocityAndLifetime;
+};
+
+layout (std430, binding = 0) buffer Particles
+{
+	Particle particles[];
+};
+
+layout (std430, binding = 1) buffer CurrentAliveIndices
+{
+	uint currentAliveIndices[];
+};
+
+layout (std430, binding = 6) buffer SortPairs
+{
+	uvec2 sortPairs[];
+};
+
+out vec2 TexCoords;
+out vec4 ParticleColour;
+
+uniform mat4 viewProjection;
+uniform vec3 cameraRight;
+uniform vec3 cameraUp;
+uniform vec2 sizeRange; // x = start size, y = end size
+uniform vec4 startColour;
+uniform vec4 endColour;
+uniform bool useSortedIndices;
+
+void main() {
+	uint particleIndex = useSortedIndices ? sortPairs[gl_InstanceID].y : currentAliveIndices[gl_InstanceID];
+	Particle particle = particles[particleIndex];
+
+	float normalizedAge = clamp(particle.positionAndAge.w / max(particle.velocityAndLifetime.w, 0.0001), 0.0, 1.0);
+	float size = mix(sizeRange.x, sizeRange.y, normalizedAge);
+	ParticleColour = mix(startColour, endColour, normalizedAge);
+
+	vec2 corner = vec2(float(gl_VertexID & 1), float((gl_VertexID >> 1) & 1));
+	TexCoords = corner;
+
+	vec3 worldPos = particle.positionAndAge.xyz + (cameraRight * (corner.x - 0.5) + cameraUp * (corner.y - 0.5)) * size;
+	gl_Position = viewProjection * vec4(worldPos, 1.0);
+}
+
+
+
+
+#shader-type fragment
+#version 430 core
+
+in vec2 TexCoords;
+in vec4 ParticleColour;
+
+out vec4 FragColour;
+
+uniform bool hasSpriteTexture;
+uniform sampler2D spriteTexture;
+
+void main() {
+	vec4 colour = ParticleColour;
+	if (hasSpriteTexture) {
+		colour *= texture(spriteTexture, TexCoords);
+	}
+	else {
+		// Soft circle
+		float distanceFromCenter = length(TexCoords - vec2(0.5)) * 2.0;
+		colour.a *= 1.0 - smoothstep(0.5, 1.0, distanceFromCenter);
+	}
+
+	if (colour.a <= 0.001)
+		discard;
+
+	FragColour = colour;
+}
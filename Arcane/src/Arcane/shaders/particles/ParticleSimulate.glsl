@@ -0,0 +1,66 @@
+#shader-type compute
+#version 430 core
+
+layout (local_size_x = 256) in;
+
+struct Particle
+{
+	vec4 positionAndAge;
+	vec4 velocityAndLifetime;
+};
+
+layout (std430, binding = 0) buffer Particles
+{
+	Particle particles[];
+};
+
+layout (std430, binding = 1) buffer CurrentAliveIndices
+{
+	uint currentAliveIndices[];
+};
+
+layout (std430, binding = 2) buffer NextAliveIndices
+{
+	uint nextAliveIndices[];
+};
+
+layout (std430, binding = 3) buffer DeadIndices
+{
+	uint deadIndices[];
+};
+
+layout (std430, binding = 4) buffer Counters
+{
+	uint aliveCount;
+	uint deadCount;
+	uint newAliveCount;
+	uint emitCount;
+};
+
+uniform float deltaTime;
+uniform vec3 acceleration;
+
+void main() {
+	uint aliveSlot = gl_GlobalInvocationID.x;
+	if (aliveSlot >= aliveCount)
+		return;
+
+	uint particleIndex = currentAliveIndices[aliveSlot];
+	Particle particle = particles[particleIndex];
+
+	float age = particle.positionAndAge.w + deltaTime;
+	float lifetime = particle.velocityAndLifetime.w;
+	if (age < lifetime) {
+		// Semi-implicit euler
+		vec3 velocity = particle.velocityAndLifetime.xyz + acceleration * deltaTime;
+		vec3 position = particle.positionAndAge.xyz + velocity * deltaTime;
+		particles[particleIndex].positionAndAge = vec4(position, age);
+		particles[particleIndex].velocityAndLifetime = vec4(velocity, lifetime);
+
+		// Compact the survivors into the alive list for the next frame
+		nextAliveIndices[atomicAdd(newAliveCount, 1u)] = particleIndex;
+	}
+	else {
+		deadIndices[atomicAdd(deadCount, 1u)] = particleIndex;
+	}
+}
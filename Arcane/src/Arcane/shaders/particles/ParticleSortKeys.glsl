@@ -0,0 +1,52 @@
+#shader-type compute
+#version 430 core
+
+layout (local_size_x = 256) in;
+
+struct Particle
+{
+	vec4 positionAndAge;
+	vec4 velocityAndLifetime;
+};
+
+layout (std430, binding = 0) buffer Particles
+{
+	Particle particles[];
+};
+
+layout (std430, binding = 1) buffer CurrentAliveIndices
+{
+	uint currentAliveIndices[];
+};
+
+layout (std430, binding = 4) buffer Counters
+{
+	uint aliveCount;
+	uint deadCount;
+	uint newAliveCount;
+	uint emitCount;
+};
+
+layout (std430, binding = 6) buffer SortPairs
+{
+	uvec2 sortPairs[]; // x = key, y = particle index
+};
+
+uniform vec3 cameraPosition;
+uniform int sortCapacity;
+
+void main() {
+	uint sortIndex = gl_GlobalInvocationID.x;
+	if (sortIndex >= uint(sortCapacity))
+		return;
+
+	// The sort is ascending, so invert the distance to get back to front. Positive floats keep their ordering when reinterpreted as uints
+	// Unused slots get the max key so they end up after every alive particle
+	uvec2 pair = uvec2(0xFFFFFFFFu, 0u);
+	if (sortIndex < aliveCount) {
+		uint particleIndex = currentAliveIndices[sortIndex];
+		vec3 toCamera = particles[particleIndex].positionAndAge.xyz - cameraPosition;
+		pair = uvec2(min(~floatBitsToUint(dot(toCamera, toCamera)), 0xFFFFFFFEu), particleIndex);
+	}
+	sortPairs[sortIndex] = pair;
+}
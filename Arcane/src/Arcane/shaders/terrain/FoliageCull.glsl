@@ -0,0 +1,58 @@
+#shader-type compute
+#version 430 core
+
+layout (local_size_x = 256) in;
+
+struct FoliageInstance
+{
+	vec4 positionAndScale;
+	vec4 params; // x = rotation around the up axis, y = random variation
+};
+
+layout (std430, binding = 0) readonly buffer Instances
+{
+	FoliageInstance instances[];
+};
+
+layout (std430, binding = 1) writeonly buffer VisibleIndices
+{
+	uint visibleIndices[];
+};
+
+// DrawElementsIndirectCommand array, only the first command's instanceCount (index 1) is written here
+layout (std430, binding = 2) buffer DrawCommands
+{
+	uint drawCommands[];
+};
+
+uniform vec4 frustumPlanes[6];
+uniform vec3 cameraPosition;
+uniform float maxDrawDistance;
+uniform vec3 boundsCentre;
+uniform float boundsRadius;
+uniform int instanceCount;
+
+void main() {
+	uint instanceIndex = gl_GlobalInvocationID.x;
+	if (instanceIndex >= uint(instanceCount))
+		return;
+
+	FoliageInstance instance = instances[instanceIndex];
+	float scale = instance.positionAndScale.w;
+	float s = sin(instance.params.x);
+	float c = cos(instance.params.x);
+
+	// Bounding sphere in world space (rotation is only around the up axis)
+	vec3 centre = instance.positionAndScale.xyz + vec3(c * boundsCentre.x + s * boundsCentre.z, boundsCentre.y, -s * boundsCentre.x + c * boundsCentre.z) * scale;
+	float radius = boundsRadius * scale;
+
+	if (distance(centre, cameraPosition) - radius > maxDrawDistance)
+		return;
+
+	for (int i = 0; i < 6; i++) {
+		if (dot(frustumPlanes[i].xyz, centre) + frustumPlanes[i].w < -radius)
+			return;
+	}
+
+	visibleIndices[atomicAdd(drawCommands[1], 1u)] = instanceIndex;
+}
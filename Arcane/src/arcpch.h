@@ -21,6 +21,8 @@
 #include <queue>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
+#include <thread>
 #include <limits>
 
 // Dependencies
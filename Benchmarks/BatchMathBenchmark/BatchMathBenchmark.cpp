@@ -0,0 +1,208 @@
+#include "arcpch.h"
+#include <Arcane/Math/BatchMath.h>
+
+#include <chrono>
+#include <cstdio>
+
+/*
+	Times the scalar GLM loops the engine used to run every frame against their BatchMath replacements. Build it once with USE_SIMD_MATH set to 1 and once
+	with it set to 0 (Defs.h) to compare the SSE and fallback paths. Every batch result is checked against the scalar one so a speedup can't come from a wrong answer
+*/
+
+using namespace Arcane;
+
+static constexpr size_t s_ElementCount = 16384; // Roughly the number of transforms/bones in a busy frame
+static constexpr int s_Iterations = 200;
+static constexpr float s_Tolerance = 1e-3f;
+
+static volatile float s_Sink; // Stops the optimiser from throwing the scalar loops away
+
+template<typename Func>
+static double TimeMilliseconds(Func func)
+{
+	func(); // Warm up the caches before timing
+
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < s_Iterations; i++)
+		func();
+	auto end = std::chrono::high_resolution_clock::now();
+
+	return std::chrono::duration<double, std::milli>(end - start).count() / s_Iterations;
+}
+
+// Relative once the values get large, translations and projected positions are in the hundreds
+static float Error(float a, float b)
+{
+	return glm::abs(a - b) / glm::max(1.0f, glm::abs(a));
+}
+
+static float MaxError(const glm::mat4 &a, const glm::mat4 &b)
+{
+	float error = 0.0f;
+	for (int c = 0; c < 4; c++)
+		for (int r = 0; r < 4; r++)
+			error = glm::max(error, Error(a[c][r], b[c][r]));
+	return error;
+}
+
+static float MaxError(const glm::mat3 &a, const glm::mat3 &b)
+{
+	float error = 0.0f;
+	for (int c = 0; c < 3; c++)
+		for (int r = 0; r < 3; r++)
+			error = glm::max(error, Error(a[c][r], b[c][r]));
+	return error;
+}
+
+static float MaxError(const glm::quat &a, const glm::quat &b)
+{
+	// q and -q are the same rotation
+	float error = glm::abs(a.x - b.x) + glm::abs(a.y - b.y) + glm::abs(a.z - b.z) + glm::abs(a.w - b.w);
+	float negatedError = glm::abs(a.x + b.x) + glm::abs(a.y + b.y) + glm::abs(a.z + b.z) + glm::abs(a.w + b.w);
+	return glm::min(error, negatedError);
+}
+
+static float MaxError(const AABB &a, const AABB &b)
+{
+	float error = 0.0f;
+	for (int i = 0; i < 3; i++)
+		error = glm::max(error, glm::max(Error(a.Min[i], b.Min[i]), Error(a.Max[i], b.Max[i])));
+	return error;
+}
+
+template<typename T>
+static bool Verify(const std::vector<T> &scalar, const std::vector<T> &batch)
+{
+	float maxError = 0.0f;
+	for (size_t i = 0; i < scalar.size(); i++)
+		maxError = glm::max(maxError, MaxError(scalar[i], batch[i]));
+	return maxError <= s_Tolerance;
+}
+
+static bool Report(const char *name, double scalarMs, double batchMs, bool matches)
+{
+	std::printf("%-18s scalar %8.3f ms   batch %8.3f ms   speedup %5.2fx   %s\n", name, scalarMs, batchMs, scalarMs / batchMs, matches ? "ok" : "MISMATCH");
+	return matches;
+}
+
+int main()
+{
+	std::mt19937 rng(1337);
+	std::uniform_real_distribution<float> positionDist(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> scaleDist(0.1f, 4.0f);
+	std::uniform_real_distribution<float> unitDist(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> tDist(0.0f, 1.0f);
+
+	auto randomQuat = [&]() { return glm::normalize(glm::quat(unitDist(rng), unitDist(rng), unitDist(rng), unitDist(rng))); };
+
+	std::vector<glm::vec3> translations(s_ElementCount), scales(s_ElementCount);
+	std::vector<glm::quat> rotations(s_ElementCount), targetRotations(s_ElementCount);
+	std::vector<float> slerpTs(s_ElementCount);
+	std::vector<AABB> aabbs(s_ElementCount);
+	for (size_t i = 0; i < s_ElementCount; i++)
+	{
+		translations[i] = glm::vec3(positionDist(rng), positionDist(rng), positionDist(rng));
+		scales[i] = glm::vec3(scaleDist(rng), scaleDist(rng), scaleDist(rng));
+		rotations[i] = randomQuat();
+		targetRotations[i] = randomQuat();
+		slerpTs[i] = tDist(rng);
+
+		glm::vec3 centre(unitDist(rng), unitDist(rng), unitDist(rng));
+		glm::vec3 extents(scaleDist(rng), scaleDist(rng), scaleDist(rng));
+		aabbs[i].Min = centre - extents;
+		aabbs[i].Max = centre + extents;
+	}
+
+	std::vector<glm::mat4> scalarMatrices(s_ElementCount), batchMatrices(s_ElementCount);
+	std::vector<glm::mat4> scalarProducts(s_ElementCount), batchProducts(s_ElementCount);
+	std::vector<glm::mat3> scalarNormals(s_ElementCount), batchNormals(s_ElementCount);
+	std::vector<glm::quat> scalarSlerps(s_ElementCount), batchSlerps(s_ElementCount);
+	std::vector<AABB> scalarAABBs(s_ElementCount), batchAABBs(s_ElementCount);
+	glm::mat4 viewProjection = glm::perspective(glm::radians(80.0f), 16.0f / 9.0f, 0.3f, 1000.0f) * glm::lookAt(glm::vec3(0.0f, 10.0f, 50.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	std::printf("BatchMath benchmark, %zu elements averaged over %d iterations, SIMD %s\n\n", s_ElementCount, s_Iterations, BatchMath::IsSIMDEnabled() ? "enabled" : "disabled");
+	bool allMatch = true;
+
+	// ComposeTRS
+	{
+		double scalarMs = TimeMilliseconds([&]() {
+			for (size_t i = 0; i < s_ElementCount; i++)
+				scalarMatrices[i] = glm::translate(glm::mat4(1.0f), translations[i]) * glm::toMat4(rotations[i]) * glm::scale(glm::mat4(1.0f), scales[i]);
+			s_Sink = scalarMatrices[s_ElementCount - 1][3][0];
+		});
+		double batchMs = TimeMilliseconds([&]() {
+			BatchMath::ComposeTRS(translations.data(), rotations.data(), scales.data(), batchMatrices.data(), s_ElementCount);
+			s_Sink = batchMatrices[s_ElementCount - 1][3][0];
+		});
+		allMatch &= Report("ComposeTRS", scalarMs, batchMs, Verify(scalarMatrices, batchMatrices));
+	}
+
+	// MultiplyMatrices, applying a view projection to every model matrix
+	{
+		double scalarMs = TimeMilliseconds([&]() {
+			for (size_t i = 0; i < s_ElementCount; i++)
+				scalarProducts[i] = viewProjection * scalarMatrices[i];
+			s_Sink = scalarProducts[s_ElementCount - 1][3][0];
+		});
+		double batchMs = TimeMilliseconds([&]() {
+			BatchMath::MultiplyMatrices(viewProjection, scalarMatrices.data(), batchProducts.data(), s_ElementCount);
+			s_Sink = batchProducts[s_ElementCount - 1][3][0];
+		});
+		allMatch &= Report("MultiplyMatrices", scalarMs, batchMs, Verify(scalarProducts, batchProducts));
+	}
+
+	// NormalMatrices
+	{
+		double scalarMs = TimeMilliseconds([&]() {
+			for (size_t i = 0; i < s_ElementCount; i++)
+				scalarNormals[i] = glm::mat3(glm::transpose(glm::inverse(scalarMatrices[i])));
+			s_Sink = scalarNormals[s_ElementCount - 1][2][0];
+		});
+		double batchMs = TimeMilliseconds([&]() {
+			BatchMath::NormalMatrices(scalarMatrices.data(), batchNormals.data(), s_ElementCount);
+			s_Sink = batchNormals[s_ElementCount - 1][2][0];
+		});
+		allMatch &= Report("NormalMatrices", scalarMs, batchMs, Verify(scalarNormals, batchNormals));
+	}
+
+	// SlerpQuaternions, what the animator does for every bone's rotation keys
+	{
+		double scalarMs = TimeMilliseconds([&]() {
+			for (size_t i = 0; i < s_ElementCount; i++)
+				scalarSlerps[i] = glm::normalize(glm::slerp(rotations[i], targetRotations[i], slerpTs[i]));
+			s_Sink = scalarSlerps[s_ElementCount - 1].w;
+		});
+		double batchMs = TimeMilliseconds([&]() {
+			BatchMath::SlerpQuaternions(rotations.data(), targetRotations.data(), slerpTs.data(), batchSlerps.data(), s_ElementCount);
+			s_Sink = batchSlerps[s_ElementCount - 1].w;
+		});
+		allMatch &= Report("SlerpQuaternions", scalarMs, batchMs, Verify(scalarSlerps, batchSlerps));
+	}
+
+	// TransformAABBs, the scalar version transforms all 8 corners which is what the culling code did before
+	{
+		double scalarMs = TimeMilliseconds([&]() {
+			for (size_t i = 0; i < s_ElementCount; i++)
+			{
+				glm::vec3 newMin(std::numeric_limits<float>::max()), newMax(std::numeric_limits<float>::lowest());
+				for (int corner = 0; corner < 8; corner++)
+				{
+					glm::vec3 point((corner & 1) ? aabbs[i].Max.x : aabbs[i].Min.x, (corner & 2) ? aabbs[i].Max.y : aabbs[i].Min.y, (corner & 4) ? aabbs[i].Max.z : aabbs[i].Min.z);
+					glm::vec3 transformed = glm::vec3(scalarMatrices[i] * glm::vec4(point, 1.0f));
+					newMin = glm::min(newMin, transformed);
+					newMax = glm::max(newMax, transformed);
+				}
+				scalarAABBs[i].Min = newMin;
+				scalarAABBs[i].Max = newMax;
+			}
+			s_Sink = scalarAABBs[s_ElementCount - 1].Max.x;
+		});
+		double batchMs = TimeMilliseconds([&]() {
+			BatchMath::TransformAABBs(aabbs.data(), scalarMatrices.data(), batchAABBs.data(), s_ElementCount);
+			s_Sink = batchAABBs[s_ElementCount - 1].Max.x;
+		});
+		allMatch &= Report("TransformAABBs", scalarMs, batchMs, Verify(scalarAABBs, batchAABBs));
+	}
+
+	return allMatch ? 0 : 1;
+}
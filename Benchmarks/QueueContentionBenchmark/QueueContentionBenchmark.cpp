@@ -0,0 +1,298 @@
+#include "arcpch.h"
+#include <Arcane/Core/Threads/LockFreeQueue.h>
+#include <Arcane/Core/Threads/ThreadSafeQueue.h>
+
+#include <chrono>
+#include <cstdio>
+
+/*
+	Measures LockFreeQueue against the mutex based ThreadSafeQueue as the number of threads hammering the queue goes from 1 to 32. Two workloads are run:
+	Mixed - every thread pushes an item and then pops one, so every thread contends on both ends of the queue
+	Split - half the threads only push and the other half only pop, which is how the asset and job pipelines use the queues
+	Both workloads are also run batched, moving s_BatchSize items per call with TryPushBatch/TryPopBatch so a whole batch costs one CAS. ThreadSafeQueue has no
+	batch API, so its batched runs still take the lock once per item, which is the cost the batch calls avoid.
+	Each run checks that every pushed item was popped exactly once (count and sum) so a fast result can't come from a lost or duplicated item
+*/
+
+using namespace Arcane;
+
+static constexpr uint64_t s_ItemsPerRun = 1 << 20;
+static constexpr int s_ThreadCounts[] = { 1, 2, 4, 8, 16, 32 };
+static constexpr uint64_t s_BatchSize = 32; // 32 threads * 32 items still fits the default capacity, so a mixed batch never has to wait for room
+
+struct RunResult
+{
+	double Milliseconds = 0.0;
+	bool Valid = false;
+};
+
+template<typename Func>
+static double RunThreads(int threadCount, Func work)
+{
+	std::atomic<bool> start(false);
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount);
+	for (int i = 0; i < threadCount; i++)
+	{
+		threads.emplace_back([&start, &work, i]() {
+			while (!start.load(std::memory_order_acquire))
+				std::this_thread::yield();
+			work(i);
+		});
+	}
+
+	// Only time the queue traffic, not the thread creation
+	auto begin = std::chrono::high_resolution_clock::now();
+	start.store(true, std::memory_order_release);
+	for (auto &thread : threads)
+		thread.join();
+	auto end = std::chrono::high_resolution_clock::now();
+
+	return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+template<typename Queue>
+static RunResult RunMixed(int threadCount)
+{
+	Queue queue;
+	std::atomic<uint64_t> poppedCount(0), poppedSum(0);
+	uint64_t itemsPerThread = s_ItemsPerRun / threadCount;
+
+	RunResult result;
+	result.Milliseconds = RunThreads(threadCount, [&](int threadIndex) {
+		uint64_t localSum = 0;
+		for (uint64_t i = 0; i < itemsPerThread; i++)
+		{
+			queue.Push(threadIndex * itemsPerThread + i + 1);
+
+			// Every thread pushes before it pops so there is always an item for each waiting thread, this only spins while another thread is mid push
+			uint64_t item;
+			while (!queue.TryPop(item))
+				std::this_thread::yield();
+			localSum += item;
+		}
+		poppedCount.fetch_add(itemsPerThread, std::memory_order_relaxed);
+		poppedSum.fetch_add(localSum, std::memory_order_relaxed);
+	});
+
+	uint64_t totalItems = itemsPerThread * threadCount;
+	result.Valid = poppedCount.load() == totalItems && poppedSum.load() == totalItems * (totalItems + 1) / 2;
+	return result;
+}
+
+template<typename Queue>
+static RunResult RunSplit(int threadCount)
+{
+	Queue queue;
+	int producerCount = threadCount / 2;
+	uint64_t itemsPerProducer = s_ItemsPerRun / producerCount;
+	uint64_t totalItems = itemsPerProducer * producerCount;
+	std::atomic<uint64_t> poppedCount(0), poppedSum(0);
+
+	RunResult result;
+	result.Milliseconds = RunThreads(threadCount, [&](int threadIndex) {
+		if (threadIndex < producerCount)
+		{
+			for (uint64_t i = 0; i < itemsPerProducer; i++)
+				queue.Push(threadIndex * itemsPerProducer + i + 1);
+			return;
+		}
+
+		uint64_t localSum = 0;
+		while (poppedCount.load(std::memory_order_relaxed) < totalItems)
+		{
+			uint64_t item;
+			if (queue.TryPop(item))
+			{
+				localSum += item;
+				poppedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+		poppedSum.fetch_add(localSum, std::memory_order_relaxed);
+	});
+
+	result.Valid = poppedCount.load() == totalItems && poppedSum.load() == totalItems * (totalItems + 1) / 2;
+	return result;
+}
+
+// Batch calls return how many items they moved, the lock-free queue may move fewer than asked for when it is full/empty or a batch straddles another thread's
+static size_t PushBatch(LockFreeQueue<uint64_t> &queue, uint64_t *items, size_t count)
+{
+	return queue.TryPushBatch(items, count);
+}
+
+static size_t PushBatch(ThreadSafeQueue<uint64_t> &queue, uint64_t *items, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+		queue.Push(items[i]);
+	return count;
+}
+
+static size_t PopBatch(LockFreeQueue<uint64_t> &queue, uint64_t *items, size_t count)
+{
+	return queue.TryPopBatch(items, count);
+}
+
+static size_t PopBatch(ThreadSafeQueue<uint64_t> &queue, uint64_t *items, size_t count)
+{
+	size_t popped = 0;
+	while (popped < count && queue.TryPop(items[popped]))
+		popped++;
+	return popped;
+}
+
+template<typename Queue>
+static void PushAll(Queue &queue, uint64_t *items, size_t count)
+{
+	size_t pushed = 0;
+	while (pushed < count)
+	{
+		size_t batchPushed = PushBatch(queue, items + pushed, count - pushed);
+		pushed += batchPushed;
+		if (batchPushed == 0)
+			std::this_thread::yield();
+	}
+}
+
+template<typename Queue>
+static RunResult RunMixedBatched(int threadCount)
+{
+	Queue queue;
+	std::atomic<uint64_t> poppedCount(0), poppedSum(0);
+	uint64_t batchesPerThread = s_ItemsPerRun / threadCount / s_BatchSize;
+
+	RunResult result;
+	result.Milliseconds = RunThreads(threadCount, [&](int threadIndex) {
+		uint64_t items[s_BatchSize];
+		uint64_t localSum = 0;
+		for (uint64_t batch = 0; batch < batchesPerThread; batch++)
+		{
+			for (uint64_t i = 0; i < s_BatchSize; i++)
+				items[i] = (threadIndex * batchesPerThread + batch) * s_BatchSize + i + 1;
+			PushAll(queue, items, s_BatchSize);
+
+			// Pops as many as it pushed, there are always at least that many in the queue once the other threads finish their pushes
+			size_t popped = 0;
+			while (popped < s_BatchSize)
+			{
+				size_t batchPopped = PopBatch(queue, items, s_BatchSize - popped);
+				for (size_t i = 0; i < batchPopped; i++)
+					localSum += items[i];
+				popped += batchPopped;
+				if (batchPopped == 0)
+					std::this_thread::yield();
+			}
+		}
+		poppedCount.fetch_add(batchesPerThread * s_BatchSize, std::memory_order_relaxed);
+		poppedSum.fetch_add(localSum, std::memory_order_relaxed);
+	});
+
+	uint64_t totalItems = batchesPerThread * s_BatchSize * threadCount;
+	result.Valid = poppedCount.load() == totalItems && poppedSum.load() == totalItems * (totalItems + 1) / 2;
+	return result;
+}
+
+template<typename Queue>
+static RunResult RunSplitBatched(int threadCount)
+{
+	Queue queue;
+	int producerCount = threadCount / 2;
+	uint64_t batchesPerProducer = s_ItemsPerRun / producerCount / s_BatchSize;
+	uint64_t totalItems = batchesPerProducer * s_BatchSize * producerCount;
+	std::atomic<uint64_t> poppedCount(0), poppedSum(0);
+
+	RunResult result;
+	result.Milliseconds = RunThreads(threadCount, [&](int threadIndex) {
+		uint64_t items[s_BatchSize];
+		if (threadIndex < producerCount)
+		{
+			for (uint64_t batch = 0; batch < batchesPerProducer; batch++)
+			{
+				for (uint64_t i = 0; i < s_BatchSize; i++)
+					items[i] = (threadIndex * batchesPerProducer + batch) * s_BatchSize + i + 1;
+				PushAll(queue, items, s_BatchSize);
+			}
+			return;
+		}
+
+		uint64_t localSum = 0;
+		while (poppedCount.load(std::memory_order_relaxed) < totalItems)
+		{
+			size_t popped = PopBatch(queue, items, s_BatchSize);
+			if (popped > 0)
+			{
+				for (size_t i = 0; i < popped; i++)
+					localSum += items[i];
+				poppedCount.fetch_add(popped, std::memory_order_relaxed);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+		poppedSum.fetch_add(localSum, std::memory_order_relaxed);
+	});
+
+	result.Valid = poppedCount.load() == totalItems && poppedSum.load() == totalItems * (totalItems + 1) / 2;
+	return result;
+}
+
+static bool Report(const char *workload, int threadCount, const RunResult &lockFree, const RunResult &mutexBased)
+{
+	double lockFreeMops = s_ItemsPerRun / (lockFree.Milliseconds * 1000.0);
+	double mutexMops = s_ItemsPerRun / (mutexBased.Milliseconds * 1000.0);
+	bool valid = lockFree.Valid && mutexBased.Valid;
+	std::printf("%-9s %2d threads   lock-free %8.2f ms (%6.2f Mops/s)   mutex %8.2f ms (%6.2f Mops/s)   speedup %5.2fx   %s\n", workload, threadCount,
+		lockFree.Milliseconds, lockFreeMops, mutexBased.Milliseconds, mutexMops, mutexBased.Milliseconds / lockFree.Milliseconds, valid ? "ok" : "LOST ITEMS");
+	return valid;
+}
+
+int main()
+{
+	std::printf("Queue contention benchmark, %llu items per run, %u hardware threads\n\n", static_cast<unsigned long long>(s_ItemsPerRun), std::thread::hardware_concurrency());
+	bool allValid = true;
+
+	for (int threadCount : s_ThreadCounts)
+	{
+		RunResult lockFree = RunMixed<LockFreeQueue<uint64_t>>(threadCount);
+		RunResult mutexBased = RunMixed<ThreadSafeQueue<uint64_t>>(threadCount);
+		allValid &= Report("Mixed", threadCount, lockFree, mutexBased);
+	}
+	std::printf("\n");
+
+	// Needs at least one producer and one consumer
+	for (int threadCount : s_ThreadCounts)
+	{
+		if (threadCount < 2)
+			continue;
+
+		RunResult lockFree = RunSplit<LockFreeQueue<uint64_t>>(threadCount);
+		RunResult mutexBased = RunSplit<ThreadSafeQueue<uint64_t>>(threadCount);
+		allValid &= Report("Split", threadCount, lockFree, mutexBased);
+	}
+	std::printf("\n");
+
+	for (int threadCount : s_ThreadCounts)
+	{
+		RunResult lockFree = RunMixedBatched<LockFreeQueue<uint64_t>>(threadCount);
+		RunResult mutexBased = RunMixedBatched<ThreadSafeQueue<uint64_t>>(threadCount);
+		allValid &= Report("Mixed x32", threadCount, lockFree, mutexBased);
+	}
+	std::printf("\n");
+
+	for (int threadCount : s_ThreadCounts)
+	{
+		if (threadCount < 2)
+			continue;
+
+		RunResult lockFree = RunSplitBatched<LockFreeQueue<uint64_t>>(threadCount);
+		RunResult mutexBased = RunSplitBatched<ThreadSafeQueue<uint64_t>>(threadCount);
+		allValid &= Report("Split x32", threadCount, lockFree, mutexBased);
+	}
+
+	return allValid ? 0 : 1;
+}
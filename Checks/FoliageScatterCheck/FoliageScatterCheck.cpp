@@ -0,0 +1,213 @@
+#include "arcpch.h"
+#include <Arcane/Terrain/Foliage/FoliageScatter.h>
+
+#include <cstdio>
+
+/*
+	Headless checks for FoliageScatter on synthetic heightfields and maps. Checks that placement is deterministic per seed, stays on the terrain mesh, and that
+	the density map, splatmap and slope limit reject the right candidates. The maps are laid out so a half texel misregistration against the terrain's UVs fails
+*/
+
+using namespace Arcane;
+
+static constexpr unsigned int s_SideVertexCount = 65;
+static constexpr float s_SizeXZ = 65.0f; // 1 meter between vertices so the mesh spans [0, 64]
+
+static int s_FailedChecks = 0;
+
+static void Check(bool condition, const char *description)
+{
+	std::printf("%s  %s\n", condition ? "ok  " : "FAIL", description);
+	if (!condition)
+		s_FailedChecks++;
+}
+
+static FoliageHeightfield MakeHeightfield(const std::vector<float> &heights)
+{
+	FoliageHeightfield heightfield;
+	heightfield.Heights = heights.data();
+	heightfield.SideVertexCount = s_SideVertexCount;
+	heightfield.SizeXZ = s_SizeXZ;
+	return heightfield;
+}
+
+// Square image with the given channel set to 255 for the texels where inside(x, y) is true and 0 everywhere else
+template<typename Func>
+static std::vector<unsigned char> MakeMask(int size, int channels, int channel, Func inside)
+{
+	std::vector<unsigned char> data(static_cast<size_t>(size) * size * channels, 0);
+	for (int y = 0; y < size; y++)
+		for (int x = 0; x < size; x++)
+			if (inside(x, y))
+				data[(x + y * size) * channels + channel] = 255;
+	return data;
+}
+
+static bool SameInstances(const std::vector<FoliageInstance> &a, const std::vector<FoliageInstance> &b)
+{
+	if (a.size() != b.size())
+		return false;
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i].PositionAndScale != b[i].PositionAndScale || a[i].Params != b[i].Params)
+			return false;
+	return true;
+}
+
+template<typename Func>
+static bool AllInstances(const std::vector<FoliageInstance> &instances, Func predicate)
+{
+	for (const FoliageInstance &instance : instances)
+		if (!predicate(instance))
+			return false;
+	return true;
+}
+
+static void CheckDeterminism(const FoliageHeightfield &flat)
+{
+	FoliageScatterSettings settings;
+	settings.Density = 2.0f;
+	settings.Seed = 17;
+
+	std::vector<FoliageInstance> a, b, c;
+	FoliageScatter::Scatter(flat, FoliageImage(), FoliageImage(), settings, a);
+	FoliageScatter::Scatter(flat, FoliageImage(), FoliageImage(), settings, b);
+	settings.Seed = 18;
+	FoliageScatter::Scatter(flat, FoliageImage(), FoliageImage(), settings, c);
+
+	Check(!a.empty() && SameInstances(a, b), "The same seed produces identical instances in the same order");
+	Check(!SameInstances(a, c), "A different seed produces different instances");
+}
+
+static void CheckPlacement(const FoliageHeightfield &flat)
+{
+	FoliageScatterSettings settings;
+	settings.Density = 4.0f; // 0.5m cells, 128 per side over the 64m mesh
+	settings.MinScale = 0.5f;
+	settings.MaxScale = 0.75f;
+
+	std::vector<FoliageInstance> instances;
+	FoliageScatter::Scatter(flat, FoliageImage(), FoliageImage(), settings, instances);
+
+	float extent = flat.GetExtent();
+	Check(instances.size() == 128 * 128, "Without maps every cell of a flat terrain gets an instance");
+	Check(AllInstances(instances, [extent](const FoliageInstance &instance) {
+		return instance.PositionAndScale.x >= 0.0f && instance.PositionAndScale.x < extent && instance.PositionAndScale.z >= 0.0f && instance.PositionAndScale.z < extent;
+	}), "Instances stay within the terrain mesh");
+	Check(AllInstances(instances, [&settings](const FoliageInstance &instance) {
+		return instance.PositionAndScale.y == 0.0f && instance.PositionAndScale.w >= settings.MinScale && instance.PositionAndScale.w <= settings.MaxScale;
+	}), "Instances sit on the surface with a scale in [MinScale, MaxScale]");
+
+	settings.MaxInstances = 100;
+	FoliageScatter::Scatter(flat, FoliageImage(), FoliageImage(), settings, instances);
+	Check(instances.size() == 100, "Placement stops at MaxInstances");
+}
+
+static void CheckDensityMap(const FoliageHeightfield &flat)
+{
+	FoliageScatterSettings settings;
+	settings.Density = 4.0f;
+	float extent = flat.GetExtent();
+
+	// Half density everywhere
+	std::vector<unsigned char> halfData(64 * 64, 128);
+	FoliageImage half;
+	half.Data = halfData.data();
+	half.Width = half.Height = 64;
+	half.Channels = 1;
+
+	std::vector<FoliageInstance> instances;
+	FoliageScatter::Scatter(flat, FoliageImage(), half, settings, instances);
+	float acceptedFraction = instances.size() / (128.0f * 128.0f);
+	Check(glm::abs(acceptedFraction - 128.0f / 255.0f) < 0.02f, "A constant density map accepts candidates at its density");
+
+	// Left half (texels 0-31) full density, right half empty. Texel x sits at u = x / 63 like the terrain's vertex UVs, so between texels 31 and 32 it blends
+	std::vector<unsigned char> leftData = MakeMask(64, 1, 0, [](int x, int y) { return x < 32; });
+	FoliageImage left;
+	left.Data = leftData.data();
+	left.Width = left.Height = 64;
+	left.Channels = 1;
+
+	FoliageScatter::Scatter(flat, FoliageImage(), left, settings, instances);
+	Check(AllInstances(instances, [extent](const FoliageInstance &instance) { return instance.PositionAndScale.x / extent * 63.0f < 32.0f; }),
+		"No instances where the density map is empty");
+
+	size_t fullDensityCount = 0, fullDensityCells = 0;
+	for (const FoliageInstance &instance : instances)
+		fullDensityCount += instance.PositionAndScale.x / extent * 63.0f <= 31.0f;
+	std::vector<FoliageInstance> unmasked;
+	FoliageScatter::Scatter(flat, FoliageImage(), FoliageImage(), settings, unmasked);
+	for (const FoliageInstance &instance : unmasked)
+		fullDensityCells += instance.PositionAndScale.x / extent * 63.0f <= 31.0f;
+	Check(fullDensityCount == fullDensityCells, "Every candidate where the density map is full is kept");
+}
+
+static void CheckSplatmap(const FoliageHeightfield &flat)
+{
+	FoliageScatterSettings settings;
+	settings.Density = 4.0f;
+	float extent = flat.GetExtent();
+
+	// Channel 2 covers the top half (texels 0-31 along v)
+	std::vector<unsigned char> splatData = MakeMask(64, 4, 2, [](int x, int y) { return y < 32; });
+	FoliageImage splatmap;
+	splatmap.Data = splatData.data();
+	splatmap.Width = splatmap.Height = 64;
+	splatmap.Channels = 4;
+
+	std::vector<FoliageInstance> instances;
+	settings.SplatChannel = 2;
+	FoliageScatter::Scatter(flat, splatmap, FoliageImage(), settings, instances);
+	Check(!instances.empty() && AllInstances(instances, [extent](const FoliageInstance &instance) { return instance.PositionAndScale.z / extent * 63.0f < 32.0f; }),
+		"Instances only appear where the splat channel is painted");
+
+	settings.SplatChannel = 1;
+	FoliageScatter::Scatter(flat, splatmap, FoliageImage(), settings, instances);
+	Check(instances.empty(), "An unpainted splat channel rejects every candidate");
+
+	settings.SplatChannel = -1;
+	FoliageScatter::Scatter(flat, splatmap, FoliageImage(), settings, instances);
+	Check(instances.size() == 128 * 128, "A splat channel of -1 ignores the splatmap");
+}
+
+static void CheckSlope()
+{
+	// Flat for z <= 32, then rising 2m per meter (~63 degrees)
+	std::vector<float> heights(s_SideVertexCount * s_SideVertexCount);
+	for (unsigned int z = 0; z < s_SideVertexCount; z++)
+		for (unsigned int x = 0; x < s_SideVertexCount; x++)
+			heights[x + z * s_SideVertexCount] = z > 32 ? (z - 32) * 2.0f : 0.0f;
+	FoliageHeightfield ramp = MakeHeightfield(heights);
+
+	FoliageScatterSettings settings;
+	settings.Density = 4.0f;
+	settings.MaxSlopeDegrees = 35.0f;
+
+	// The normal is sampled one vertex either side, so only the cells next to the crease see a blend of the two slopes
+	std::vector<FoliageInstance> instances;
+	FoliageScatter::Scatter(ramp, FoliageImage(), FoliageImage(), settings, instances);
+	size_t flatCount = 0;
+	for (const FoliageInstance &instance : instances)
+		flatCount += instance.PositionAndScale.z < 31.0f;
+	Check(AllInstances(instances, [](const FoliageInstance &instance) { return instance.PositionAndScale.z < 33.0f; }), "Slopes steeper than MaxSlopeDegrees are rejected");
+	Check(flatCount == 62 * 128, "Flat ground next to the slope keeps every candidate");
+
+	settings.MaxSlopeDegrees = 70.0f;
+	FoliageScatter::Scatter(ramp, FoliageImage(), FoliageImage(), settings, instances);
+	Check(instances.size() == 128 * 128, "Slopes within MaxSlopeDegrees are kept");
+}
+
+int main()
+{
+	std::vector<float> flatHeights(s_SideVertexCount * s_SideVertexCount, 0.0f);
+	FoliageHeightfield flat = MakeHeightfield(flatHeights);
+
+	CheckDeterminism(flat);
+	CheckPlacement(flat);
+	CheckDensityMap(flat);
+	CheckSplatmap(flat);
+	CheckSlope();
+
+	if (s_FailedChecks != 0)
+		std::printf("\n%d check(s) failed\n", s_FailedChecks);
+	return s_FailedChecks == 0 ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+#include "arcpch.h"
+#include <Arcane/Graphics/Particles/ParticleSimulatorCPU.h>
+#include <Arcane/Scene/Components.h>
+
+#include <cstdio>
+
+/*
+	Headless checks for ParticleSimulatorCPU, the reference the GPU particle simulation is validated against. Runs fixed seeds and checks the spawn counts,
+	the alive/dead bookkeeping, lifetime expiry, that spawned particles respect the emitter settings and that the same seed always gives the same particles
+*/
+
+using namespace Arcane;
+
+static int s_FailedChecks = 0;
+
+static void Check(bool condition, const char *description)
+{
+	std::printf("%s  %s\n", condition ? "ok  " : "FAIL", description);
+	if (!condition)
+		s_FailedChecks++;
+}
+
+static bool AliveIndicesAreUnique(const ParticleSimulatorCPU &simulator, uint32_t maxParticles)
+{
+	std::vector<bool> seen(maxParticles, false);
+	const std::vector<uint32_t> &aliveIndices = simulator.GetAliveIndices();
+	for (uint32_t i = 0; i < simulator.GetAliveCount(); i++)
+	{
+		uint32_t index = aliveIndices[i];
+		if (index >= maxParticles || seen[index])
+			return false;
+		seen[index] = true;
+	}
+	return true;
+}
+
+static bool SameParticles(const ParticleSimulatorCPU &a, const ParticleSimulatorCPU &b)
+{
+	if (a.GetAliveCount() != b.GetAliveCount())
+		return false;
+
+	for (uint32_t i = 0; i < a.GetAliveCount(); i++)
+	{
+		uint32_t indexA = a.GetAliveIndices()[i], indexB = b.GetAliveIndices()[i];
+		const GPUParticle &particleA = a.GetParticles()[indexA], &particleB = b.GetParticles()[indexB];
+		if (indexA != indexB || particleA.PositionAndAge != particleB.PositionAndAge || particleA.VelocityAndLifetime != particleB.VelocityAndLifetime)
+			return false;
+	}
+	return true;
+}
+
+static void CheckSpawnCounts()
+{
+	ParticleEmitterComponent settings;
+	ParticleSimulatorCPU simulator(1000);
+
+	simulator.Simulate(settings, glm::vec3(0.0f), 100, 0.01f, 1);
+	Check(simulator.GetAliveCount() == 100 && simulator.GetDeadCount() == 900, "Emitting 100 particles leaves 100 alive and 900 dead");
+	Check(AliveIndicesAreUnique(simulator, 1000), "Every alive index is a unique particle slot");
+
+	simulator.Simulate(settings, glm::vec3(0.0f), 5000, 0.01f, 2);
+	Check(simulator.GetAliveCount() == 1000 && simulator.GetDeadCount() == 0, "Emitting more than the dead list holds is clamped to the free slots");
+	Check(AliveIndicesAreUnique(simulator, 1000), "A full emitter still has unique alive indices");
+
+	simulator.Simulate(settings, glm::vec3(0.0f), 10, 0.01f, 3);
+	Check(simulator.GetAliveCount() == 1000 && simulator.GetDeadCount() == 0, "A full emitter can't emit until particles die");
+}
+
+static void CheckLifetimeExpiry()
+{
+	ParticleEmitterComponent settings;
+	settings.LifetimeMin = settings.LifetimeMax = 1.0f;
+	const float deltaTime = 0.25f; // Exact in binary so the particles die on a known frame
+
+	// A single burst is updated on the frame it is emitted so it reaches its lifetime on the 4th frame
+	{
+		ParticleSimulatorCPU simulator(256);
+		simulator.Simulate(settings, glm::vec3(0.0f), 50, deltaTime, 7);
+		simulator.Simulate(settings, glm::vec3(0.0f), 0, deltaTime, 8);
+		simulator.Simulate(settings, glm::vec3(0.0f), 0, deltaTime, 9);
+		Check(simulator.GetAliveCount() == 50, "A burst is still alive just before its lifetime");
+
+		simulator.Simulate(settings, glm::vec3(0.0f), 0, deltaTime, 10);
+		Check(simulator.GetAliveCount() == 0 && simulator.GetDeadCount() == 256, "A burst dies once its age reaches its lifetime and every slot is returned");
+	}
+
+	// Emitting every frame reaches a steady state of 3 frames worth of particles
+	{
+		ParticleSimulatorCPU simulator(256);
+		bool countsMatch = true, bookkeepingMatches = true;
+		for (uint32_t frame = 1; frame <= 12; frame++)
+		{
+			simulator.Simulate(settings, glm::vec3(0.0f), 10, deltaTime, frame * 100);
+			countsMatch &= simulator.GetAliveCount() == std::min(frame * 10, 30u);
+			bookkeepingMatches &= simulator.GetAliveCount() + simulator.GetDeadCount() == 256;
+		}
+		Check(countsMatch, "Continuous emission settles at emit count * frames per lifetime");
+		Check(bookkeepingMatches, "Alive + dead always equals the particle budget");
+	}
+}
+
+static void CheckSpawnSettings()
+{
+	ParticleEmitterComponent settings;
+	settings.SpawnRadius = 2.0f;
+	settings.LifetimeMin = 0.5f;
+	settings.LifetimeMax = 1.5f;
+	settings.InitialVelocity = glm::vec3(1.0f, 5.0f, -2.0f);
+	settings.VelocityRandomness = glm::vec3(0.5f, 1.0f, 0.25f);
+	glm::vec3 emitterPosition(10.0f, -3.0f, 4.0f);
+
+	// A zero timestep leaves the particles exactly where and how they spawned
+	ParticleSimulatorCPU simulator(4096);
+	simulator.Simulate(settings, emitterPosition, 4096, 0.0f, 42);
+
+	bool insideRadius = true, lifetimeInRange = true, velocityInRange = true;
+	for (uint32_t i = 0; i < simulator.GetAliveCount(); i++)
+	{
+		const GPUParticle &particle = simulator.GetParticles()[simulator.GetAliveIndices()[i]];
+		insideRadius &= glm::length(glm::vec3(particle.PositionAndAge) - emitterPosition) <= settings.SpawnRadius + 1e-4f;
+		lifetimeInRange &= particle.VelocityAndLifetime.w >= settings.LifetimeMin && particle.VelocityAndLifetime.w <= settings.LifetimeMax;
+		glm::vec3 velocityOffset = glm::abs(glm::vec3(particle.VelocityAndLifetime) - settings.InitialVelocity);
+		velocityInRange &= glm::all(glm::lessThanEqual(velocityOffset, settings.VelocityRandomness + 1e-4f));
+	}
+	Check(simulator.GetAliveCount() == 4096, "Every particle survives a zero timestep");
+	Check(insideRadius, "Particles spawn inside the spawn radius");
+	Check(lifetimeInRange, "Lifetimes are within [LifetimeMin, LifetimeMax]");
+	Check(velocityInRange, "Velocities are within InitialVelocity +/- VelocityRandomness");
+}
+
+static void CheckDeterminism()
+{
+	ParticleEmitterComponent settings;
+	ParticleSimulatorCPU a(2048), b(2048), c(2048);
+	for (uint32_t frame = 0; frame < 30; frame++)
+	{
+		a.Simulate(settings, glm::vec3(0.0f), 80, 1.0f / 60.0f, 1234 + frame);
+		b.Simulate(settings, glm::vec3(0.0f), 80, 1.0f / 60.0f, 1234 + frame);
+		c.Simulate(settings, glm::vec3(0.0f), 80, 1.0f / 60.0f, 9876 + frame);
+	}
+	Check(SameParticles(a, b), "The same seeds produce identical particles");
+	Check(!SameParticles(a, c), "Different seeds produce different particles");
+}
+
+int main()
+{
+	CheckSpawnCounts();
+	CheckLifetimeExpiry();
+	CheckSpawnSettings();
+	CheckDeterminism();
+
+	if (s_FailedChecks != 0)
+		std::printf("\n%d check(s) failed\n", s_FailedChecks);
+	return s_FailedChecks == 0 ? 0 : 1;
+}
@@ -13,3 +13,82 @@ workspace "Arcane"
 	{
 		"MultiProcessorCompile"
 	}
+
+outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
+
+-- Standalone console benchmarks and headless checks. They compile the engine sources they exercise directly so they don't need the engine library, a window or a GL context
+function consoleproject(folder, name)
+	project(name)
+		location(folder .. "/" .. name)
+		kind "ConsoleApp"
+		language "C++"
+		cppdialect "C++17"
+		staticruntime "off"
+
+		targetdir("bin/" .. outputdir .. "/%{prj.name}")
+		objdir("bin-int/" .. outputdir .. "/%{prj.name}")
+
+		files
+		{
+			folder .. "/" .. name .. "/**.h",
+			folder .. "/" .. name .. "/**.cpp"
+		}
+
+		includedirs
+		{
+			"Arcane/src",
+			"Dependencies/GLEW/include",
+			"Dependencies/GLFW/include",
+			"Dependencies/GLM/include",
+			"Dependencies/spdlog/include"
+		}
+
+		defines
+		{
+			"ARC_PLATFORM_WINDOWS"
+		}
+
+		filter "configurations:Debug"
+			defines "ARC_DEBUG"
+			runtime "Debug"
+			symbols "on"
+
+		filter "configurations:Release"
+			defines "ARC_RELEASE"
+			runtime "Release"
+			optimize "on"
+
+		filter "configurations:Final"
+			defines "ARC_FINAL"
+			runtime "Release"
+			optimize "on"
+
+		filter {}
+end
+
+group "Benchmarks"
+	consoleproject("Benchmarks", "BatchMathBenchmark")
+		files
+		{
+			"Arcane/src/Arcane/Math/BatchMath.cpp"
+		}
+
+	-- The queues are header only
+	consoleproject("Benchmarks", "QueueContentionBenchmark")
+group ""
+
+-- Each check exits with a non-zero code if any of its checks fail
+group "Checks"
+	consoleproject("Checks", "ParticleSimulatorCheck")
+		files
+		{
+			"Arcane/src/Arcane/Graphics/Particles/ParticleSimulatorCPU.cpp"
+		}
+
+	consoleproject("Checks", "FoliageScatterCheck")
+		files
+		{
+			"Arcane/src/Arcane/Terrain/Foliage/FoliageScatter.cpp",
+			"Arcane/src/Arcane/Util/Logger.cpp"
+		}
+group ""